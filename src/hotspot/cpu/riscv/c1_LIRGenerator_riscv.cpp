@@ -981,7 +981,7 @@ void LIRGenerator::do_CheckCast(CheckCast* x) {
     assert(patching_info == nullptr, "can't patch this");
     stub = new DeoptimizeStub(info_for_exception,
                               Deoptimization::Reason_class_check,
-                              Deoptimization::Action_none);
+                              x->receiver_check_action());
   } else {
     stub = new SimpleExceptionStub(Runtime1::throw_class_cast_exception_id, obj.result(), info_for_exception);
   }
@@ -225,6 +225,13 @@ define_pd_global(intx, InitArrayShortSize, 8*BytesPerLong);
              range(0, max_jint)                                             \
              constraint(AVX3ThresholdConstraintFunc,AfterErgo)              \
                                                                             \
+  product(int, ArrayCopyNonTemporalThreshold, 0, DIAGNOSTIC,                \
+             "Minimum size in bytes of primitive array copies that use "    \
+             "non-temporal stores in the AVX-512 arraycopy stubs, to "      \
+             "not evict the working set from the caches. 0 disables "       \
+             "non-temporal stores.")                                        \
+             range(0, max_jint)                                             \
+                                                                            \
   product(bool, IntelJccErratumMitigation, true, DIAGNOSTIC,                \
              "Turn off JVM mitigations related to Intel micro code "        \
              "mitigations for the Intel JCC erratum")
@@ -517,6 +517,8 @@ address StubGenerator::generate_disjoint_copy_avx3_masked(address* entry, const
   bool use64byteVector = (MaxVectorSize > 32) && (avx3threshold == 0);
   Label L_main_loop, L_main_loop_64bytes, L_tail, L_tail64, L_exit, L_entry;
   Label L_repmovs, L_main_pre_loop, L_main_pre_loop_64bytes, L_pre_main_post_64;
+  Label L_main_pre_loop_nt, L_main_loop_nt;
+  const bool use_nt_stores = !is_oop && (ArrayCopyNonTemporalThreshold > 0);
   const Register from        = rdi;  // source array address
   const Register to          = rsi;  // destination array address
   const Register count       = rdx;  // elements count
@@ -676,6 +678,11 @@ address StubGenerator::generate_disjoint_copy_avx3_masked(address* entry, const
       __ jcc(Assembler::less, L_tail64);
 
       __ BIND(L_main_pre_loop_64bytes);
+      if (use_nt_stores) {
+        // Copies much larger than the caches use non-temporal stores.
+        __ cmpq(temp1, ArrayCopyNonTemporalThreshold >> shift);
+        __ jcc(Assembler::greaterEqual, L_main_pre_loop_nt);
+      }
       __ subq(temp1, loop_size[shift]);
 
       // Main loop with aligned copy block size of 192 bytes at
@@ -699,6 +706,31 @@ address StubGenerator::generate_disjoint_copy_avx3_masked(address* entry, const
       use64byteVector = true;
       arraycopy_avx3_special_cases(xmm1, k2, from, to, temp1, shift,
                                    temp4, temp3, use64byteVector, L_entry, L_exit);
+
+      if (use_nt_stores) {
+        __ BIND(L_main_pre_loop_nt);
+        __ subq(temp1, loop_size[shift]);
+
+        // Main loop with aligned copy block size of 192 bytes at 64 byte
+        // copy granularity, using non-temporal stores. The destination is
+        // 64 byte aligned here.
+        Address::ScaleFactor scale = (Address::ScaleFactor)(shift);
+        __ align32();
+        __ BIND(L_main_loop_nt);
+        for (int offset = 0; offset < 192; offset += 64) {
+          __ evmovdquq(xmm1, Address(from, temp4, scale, offset), Assembler::AVX_512bit);
+          __ evmovntdq(Address(to, temp4, scale, offset), xmm1, Assembler::AVX_512bit);
+        }
+        __ addptr(temp4, loop_size[shift]);
+        __ subq(temp1, loop_size[shift]);
+        __ jcc(Assembler::greater, L_main_loop_nt);
+
+        // Non-temporal stores are weakly ordered.
+        __ sfence();
+        __ addq(temp1, loop_size[shift]);
+        __ jcc(Assembler::lessEqual, L_exit);
+        __ jmp(L_tail64);
+      }
     }
     __ BIND(L_exit);
   }
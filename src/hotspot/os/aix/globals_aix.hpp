@@ -26,6 +26,8 @@
 #ifndef OS_AIX_GLOBALS_AIX_HPP
 #define OS_AIX_GLOBALS_AIX_HPP
 
+#include "globals_posix.hpp"
+
 //
 // Declare Aix specific flags. They are not available on other platforms.
 //
@@ -76,7 +78,10 @@
   /* explicit commit behaviour. This flag, if true, causes the VM to touch     */   \
   /* memory on os::commit_memory() (which normally is a noop).                 */   \
   product(bool, UseExplicitCommit, false,                                           \
-          "Explicit commit for virtual memory.")
+          "Explicit commit for virtual memory.")                                    \
+                                                                                    \
+  RUNTIME_POSIX_FLAGS(develop, develop_pd, product, product_pd,                     \
+                      notproduct, range, constraint)
 
 // end of RUNTIME_OS_FLAGS
 
@@ -25,6 +25,8 @@
 #ifndef OS_BSD_GLOBALS_BSD_HPP
 #define OS_BSD_GLOBALS_BSD_HPP
 
+#include "globals_posix.hpp"
+
 //
 // Declare Bsd specific flags. They are not available on other platforms.
 //
@@ -38,7 +40,10 @@
                                                                         \
   AARCH64_ONLY(develop(bool, AssertWXAtThreadSync, false,                \
           "Conservatively check W^X thread state at possible safepoint" \
-          "or handshake"))
+          "or handshake"))                                              \
+                                                                        \
+  RUNTIME_POSIX_FLAGS(develop, develop_pd, product, product_pd,         \
+                      notproduct, range, constraint)
 
 // end of RUNTIME_OS_FLAGS
 
@@ -25,6 +25,8 @@
 #ifndef OS_LINUX_GLOBALS_LINUX_HPP
 #define OS_LINUX_GLOBALS_LINUX_HPP
 
+#include "globals_posix.hpp"
+
 //
 // Declare Linux specific flags. They are not available on other platforms.
 //
@@ -50,6 +52,12 @@
   product(bool, UseTransparentHugePages, false,                         \
           "Use MADV_HUGEPAGE for large pages")                          \
                                                                         \
+  product(bool, UseTransparentHugePagesForCode, false, EXPERIMENTAL,    \
+          "Use MADV_HUGEPAGE for the code cache and the text segment "  \
+          "of the JVM library, independently of the other large page "  \
+          "flags. Requires transparent huge pages in mode madvise or "  \
+          "always")                                                     \
+                                                                        \
   product(bool, LoadExecStackDllInVMThread, true,                       \
           "Load DLLs with executable-stack attribute in the VM Thread") \
                                                                         \
@@ -98,6 +106,9 @@
   develop(bool, DelayThreadStartALot, false,                            \
           "Artificially delay thread starts randomly for testing.")     \
                                                                         \
+  RUNTIME_POSIX_FLAGS(develop, develop_pd, product, product_pd,         \
+                      notproduct, range, constraint)                    \
+                                                                        \
 
 
 // end of RUNTIME_OS_FLAGS
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2005, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2005, 2024, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2011, 2023, Red Hat Inc. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -131,6 +131,25 @@ static os::PageSizes scan_hugepages() {
   return pagesizes;
 }
 
+size_t StaticHugePageSupport::available_pages(size_t pagesize) const {
+  assert(_initialized, "Not initialized");
+  if (!_pagesizes.contains(pagesize)) {
+    return 0;
+  }
+  char file[256];
+  size_t free_pages = 0;
+  size_t resv_pages = 0;
+  os::snprintf_checked(file, sizeof(file), "%s/hugepages-" SIZE_FORMAT "kB/free_hugepages", sys_hugepages, pagesize / K);
+  if (!read_number_file(file, &free_pages)) {
+    return 0;
+  }
+  os::snprintf_checked(file, sizeof(file), "%s/hugepages-" SIZE_FORMAT "kB/resv_hugepages", sys_hugepages, pagesize / K);
+  if (!read_number_file(file, &resv_pages)) {
+    resv_pages = 0;
+  }
+  return free_pages > resv_pages ? free_pages - resv_pages : 0;
+}
+
 void StaticHugePageSupport::print_on(outputStream* os) {
   if (_initialized) {
     os->print_cr("Static hugepage support:");
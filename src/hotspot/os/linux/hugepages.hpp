@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2005, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2005, 2024, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2011, 2023, Red Hat Inc. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -62,6 +62,11 @@ public:
 
   os::PageSizes pagesizes() const;
   size_t default_hugepage_size() const;
+
+  // Number of pages of the given size currently available in the pool, i.e.
+  // free and not reserved by other mappings. Read from the OS on every call,
+  // since the pool can change at any time. Returns 0 if the pool can't be read.
+  size_t available_pages(size_t pagesize) const;
   void print_on(outputStream* os);
 
   bool inconsistent() const { return _inconsistent; }
@@ -103,6 +108,7 @@ public:
   static const THPSupport& thp_info() { return _thp_support; }
 
   static size_t default_static_hugepage_size()  { return _static_hugepage_support.default_hugepage_size(); }
+  static size_t available_static_hugepages(size_t pagesize) { return _static_hugepage_support.available_pages(pagesize); }
   static bool supports_static_hugepages()       { return default_static_hugepage_size() > 0 && !_static_hugepage_support.inconsistent(); }
   static THPMode thp_mode()                     { return _thp_support.mode(); }
   static bool supports_thp()                    { return thp_mode() == THPMode::madvise || thp_mode() == THPMode::always; }
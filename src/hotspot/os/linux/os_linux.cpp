@@ -2835,6 +2835,11 @@ int os::Linux::commit_memory_impl(char* addr, size_t size,
   int err = os::Linux::commit_memory_impl(addr, size, exec);
   if (err == 0) {
     realign_memory(addr, size, alignment_hint);
+    if (exec && UseTransparentHugePagesForCode) {
+      // Executable memory is committed for the code cache. As above, the
+      // return value is not checked.
+      ::madvise(addr, size, MADV_HUGEPAGE);
+    }
   }
   return err;
 }
@@ -3779,6 +3784,37 @@ struct LargePageInitializationLoggerMark {
   }
 };
 
+// Advises the kernel to back the text segment of the JVM library with
+// transparent huge pages. Text is mapped from the file, so this only has an
+// effect if the kernel can collapse read-only file mappings.
+static int advise_jvm_text_hugepages(struct dl_phdr_info* info, size_t size, void* data) {
+  const address jvm_text = (address)data;
+  for (int idx = 0; idx < info->dlpi_phnum; idx++) {
+    const ElfW(Phdr)* phdr = info->dlpi_phdr + idx;
+    if (phdr->p_type != PT_LOAD || (phdr->p_flags & PF_X) == 0) {
+      continue;
+    }
+    address start = reinterpret_cast<address>(info->dlpi_addr + phdr->p_vaddr);
+    address end = start + phdr->p_memsz;
+    if (jvm_text < start || jvm_text >= end) {
+      continue;
+    }
+    // Only whole huge pages in the segment can be backed by huge pages.
+    const size_t ps = HugePages::thp_pagesize();
+    address aligned_start = align_up(start, ps);
+    address aligned_end = align_down(end, ps);
+    if (aligned_start < aligned_end) {
+      int res = ::madvise(aligned_start, pointer_delta(aligned_end, aligned_start, 1), MADV_HUGEPAGE);
+      log_info(pagesize)("Advised huge pages for JVM text [" PTR_FORMAT ", " PTR_FORMAT "): %s",
+                         p2i(aligned_start), p2i(aligned_end), res == 0 ? "ok" : os::strerror(errno));
+    } else {
+      log_info(pagesize)("JVM text is too small for huge pages");
+    }
+    return 1;
+  }
+  return 0;
+}
+
 void os::large_page_init() {
   LargePageInitializationLoggerMark logger;
 
@@ -3800,6 +3836,20 @@ void os::large_page_init() {
     FLAG_SET_ERGO(THPStackMitigation, false); // Mitigation not needed
   }
 
+  // Transparent huge pages for code are independent of the other flags.
+  if (UseTransparentHugePagesForCode) {
+    if (!HugePages::supports_thp()) {
+      log_warning(pagesize)("UseTransparentHugePagesForCode disabled, transparent huge pages are not supported by the operating system.");
+      FLAG_SET_DEFAULT(UseTransparentHugePagesForCode, false);
+    } else {
+      dl_iterate_phdr(advise_jvm_text_hugepages, (void*)&advise_jvm_text_hugepages);
+      // Commit the code cache in whole huge pages where possible.
+      if (FLAG_IS_DEFAULT(CodeCacheExpansionSize)) {
+        FLAG_SET_ERGO(CodeCacheExpansionSize, MAX2(CodeCacheExpansionSize, HugePages::thp_pagesize()));
+      }
+    }
+  }
+
   // 1) Handle the case where we do not want to use huge pages
   if (!UseLargePages &&
       !UseTransparentHugePages &&
@@ -4121,7 +4171,7 @@ char* os::Linux::reserve_memory_special_huge_tlbfs(size_t bytes,
     return aligned_start;
   }
 
-  // The requested size requires some small pages as well.
+  // The requested size requires some smaller pages as well.
   char* small_start = aligned_start + large_bytes;
   size_t small_size = bytes - large_bytes;
   if (!large_committed) {
@@ -4131,13 +4181,37 @@ char* os::Linux::reserve_memory_special_huge_tlbfs(size_t bytes,
     return nullptr;
   }
 
-  // Commit the remaining bytes using small pages.
-  bool small_committed = commit_memory_special(small_size, os::vm_page_size(), small_start, exec);
-  if (!small_committed) {
-    // Failed to commit the remaining size, need to unmap
-    // the large pages part of the reservation.
-    ::munmap(aligned_start, large_bytes);
-    return nullptr;
+  // Commit the remaining bytes using the available smaller page sizes
+  // in descending order, ending with small pages. E.g. with 1G pages the
+  // remainder uses 2M pages where possible instead of only small pages.
+  // os::pagesizes() lists every size the kernel supports, even if its pool
+  // is empty, so intermediate sizes without enough available pages are
+  // skipped and their part of the remainder goes to the next smaller size.
+  for (size_t smaller_page_size = _page_sizes.next_smaller(page_size);
+       small_size > 0;
+       smaller_page_size = _page_sizes.next_smaller(smaller_page_size)) {
+    assert(smaller_page_size != 0, "Remainder must be small page aligned");
+    size_t smaller_bytes = align_down(small_size, smaller_page_size);
+    if (smaller_bytes == 0) {
+      continue;
+    }
+    if (smaller_page_size > os::vm_page_size() &&
+        HugePages::available_static_hugepages(smaller_page_size) < smaller_bytes / smaller_page_size) {
+      log_debug(pagesize)("Not enough available " SIZE_FORMAT "%s pages for the remainder, using smaller pages",
+                          byte_size_in_exact_unit(smaller_page_size), exact_unit_for_byte_size(smaller_page_size));
+      continue;
+    }
+    if (!commit_memory_special(smaller_bytes, smaller_page_size, small_start, exec)) {
+      // Failed to commit the remaining size, need to unmap the already
+      // committed part and what is left of the reservation.
+      ::munmap(aligned_start, pointer_delta(small_start, aligned_start, 1));
+      if (small_size > smaller_bytes) {
+        ::munmap(small_start + smaller_bytes, small_size - smaller_bytes);
+      }
+      return nullptr;
+    }
+    small_start += smaller_bytes;
+    small_size -= smaller_bytes;
   }
   return aligned_start;
 }
@@ -5176,14 +5250,18 @@ static jlong slow_thread_cpu_time(Thread *thread, bool user_sys_cpu_time) {
   char cdummy;
   int idummy;
   long ldummy;
-  FILE *fp;
+  int fd;
 
+  // This is called for every thread when M&M clients poll thread user times,
+  // so read the file directly without the allocation and locking of stdio.
+  // A single read of the stat file returns the complete content.
   snprintf(proc_name, 64, "/proc/self/task/%d/stat", tid);
-  fp = os::fopen(proc_name, "r");
-  if (fp == nullptr) return -1;
-  statlen = fread(stat, 1, 2047, fp);
+  fd = ::open(proc_name, O_RDONLY | O_CLOEXEC);
+  if (fd == -1) return -1;
+  statlen = (int)::read(fd, stat, sizeof(stat) - 1);
+  ::close(fd);
+  if (statlen <= 0) return -1;
   stat[statlen] = '\0';
-  fclose(fp);
 
   // Skip pid and the command string. Note that we could be dealing with
   // weird command names, e.g. user could decide to rename java launcher
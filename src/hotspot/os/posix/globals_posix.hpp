@@ -0,0 +1,47 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef OS_POSIX_GLOBALS_POSIX_HPP
+#define OS_POSIX_GLOBALS_POSIX_HPP
+
+//
+// Declare flags shared by the Posix platforms. They are added to the
+// RUNTIME_OS_FLAGS of each of them, and are not available on other platforms.
+//
+#define RUNTIME_POSIX_FLAGS(develop,                                    \
+                            develop_pd,                                 \
+                            product,                                    \
+                            product_pd,                                 \
+                            notproduct,                                 \
+                            range,                                      \
+                            constraint)                                 \
+                                                                        \
+  product(int, ParkSpinIterations, 0, DIAGNOSTIC,                       \
+          "Number of times Unsafe.park spins waiting for a permit "     \
+          "before blocking the thread (0 is off)")                      \
+          range(0, max_jint)
+
+// end of RUNTIME_POSIX_FLAGS
+
+#endif // OS_POSIX_GLOBALS_POSIX_HPP
@@ -41,6 +41,7 @@
 #include "runtime/orderAccess.hpp"
 #include "runtime/park.hpp"
 #include "runtime/perfMemory.hpp"
+#include "runtime/safepointMechanism.inline.hpp"
 #include "utilities/align.hpp"
 #include "utilities/defaultStream.hpp"
 #include "utilities/events.hpp"
@@ -1703,6 +1704,23 @@ void Parker::park(bool isAbsolute, jlong time) {
     to_abstime(&absTime, time, isAbsolute, false);
   }
 
+  // In park/unpark handoffs the permit often arrives within a few
+  // microseconds, so spin for it briefly before paying for the state
+  // transitions and the condvar wait. An interrupt also sets the permit.
+  // Stop spinning if a safepoint or handshake is pending, since we are
+  // still _thread_in_vm.
+  if (ParkSpinIterations > 0 && os::is_MP()) {
+    for (int i = 0; i < ParkSpinIterations; i++) {
+      if (Atomic::load(&_counter) > 0 && Atomic::xchg(&_counter, 0) > 0) {
+        return;
+      }
+      if (SafepointMechanism::local_poll_armed(jt)) {
+        break;
+      }
+      SpinPause();
+    }
+  }
+
   // Enter safepoint region
   // Beware of deadlocks such as 6317397.
   // The per-thread Parker:: mutex is a classic leaf-lock.
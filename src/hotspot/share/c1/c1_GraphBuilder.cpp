@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1999, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1999, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -2110,6 +2110,30 @@ void GraphBuilder::invoke(Bytecodes::Code code) {
     }
   }
 
+  // Bind to the target for the only receiver type seen in the profile, if
+  // neither the declared type nor CHA reveal the target method.
+  if (C1InlineProfiledReceiver && DeoptC1 && Inline && will_link && !patch_for_appendix &&
+      cha_monomorphic_target == nullptr && exact_target == nullptr &&
+      (code == Bytecodes::_invokevirtual || code == Bytecodes::_invokeinterface) &&
+      target->is_loaded() && !target->can_be_statically_bound() &&
+      !target->is_method_handle_intrinsic() && !target->is_compiled_lambda_form() &&
+      callee_holder->is_loaded()) {
+    ciInstanceKlass* profiled_klass = profiled_receiver_klass();
+    if (profiled_klass != nullptr && profiled_klass->is_subtype_of(callee_holder)) {
+      ciMethod* profiled_target = target->resolve_invoke(calling_klass, profiled_klass);
+      if (profiled_target != nullptr && profiled_target->is_loaded() && !profiled_target->is_abstract()) {
+        int index = state()->stack_size() - (target->arg_size_no_receiver() + 1);
+        CheckCast* c = new CheckCast(profiled_klass, state()->stack_at(index), copy_state_before());
+        // go to uncommon_trap and invalidate the code when the receiver type differs
+        c->set_profiled_receiver_check();
+        state()->stack_at_put(index, append_split(c));
+        exact_target = profiled_target;
+        target = profiled_target;
+        code = Bytecodes::_invokespecial;
+      }
+    }
+  }
+
   if (cha_monomorphic_target != nullptr) {
     assert(!target->can_be_statically_bound() || target == cha_monomorphic_target, "");
     assert(!cha_monomorphic_target->is_abstract(), "");
@@ -2213,6 +2237,11 @@ void GraphBuilder::invoke(Bytecodes::Code code) {
         } else if (exact_target != nullptr) {
           target_klass = exact_target->holder();
         }
+        if (C1InlineProfiledReceiver && target_klass != nullptr && recv != nullptr &&
+            recv->exact_type() != nullptr && recv->exact_type()->is_instance_klass()) {
+          // Record the actual receiver type rather than the holder of the target.
+          target_klass = recv->exact_type()->as_instance_klass();
+        }
         profile_call(target, recv, target_klass, collect_args_for_profiling(args, nullptr, false), false);
       }
     }
@@ -2272,6 +2301,30 @@ bool GraphBuilder::direct_compare(ciKlass* k) {
 }
 
 
+// Returns the only receiver type recorded in the mature profile of the call
+// at the current bci, unless receiver type checks failed in this method.
+// The profile is mature once the method reached ProfileMaturityPercentage of
+// the tier 3 thresholds, and the call site must have been executed.
+ciInstanceKlass* GraphBuilder::profiled_receiver_klass() {
+  ciMethodData* md = method()->method_data_or_null();
+  if (md == nullptr || !md->is_mature() ||
+      md->has_trap_at(bci(), method(), Deoptimization::Reason_class_check) != 0 ||
+      md->trap_count(Deoptimization::Reason_class_check) >= (uint)PerMethodTrapLimit) {
+    return nullptr;
+  }
+  ciCallProfile profile = method()->call_profile_at_bci(bci());
+  if (profile.morphism() != 1 || profile.count() <= 0 ||
+      !profile.receiver(0)->is_instance_klass()) {
+    return nullptr;
+  }
+  ciInstanceKlass* klass = profile.receiver(0)->as_instance_klass();
+  if (!klass->is_loaded() || klass->is_interface() || klass->is_abstract()) {
+    return nullptr;
+  }
+  return klass;
+}
+
+
 void GraphBuilder::check_cast(int klass_index) {
   ciKlass* klass = stream()->get_klass();
   ValueStack* state_before = !klass->is_loaded() || PatchALot ? copy_state_before() : copy_state_for_exception();
@@ -3980,7 +4033,13 @@ bool GraphBuilder::try_inline_full(ciMethod* callee, bool holder_known, bool ign
         }
         check_args_for_profiling(obj_args, s);
       }
-      profile_call(callee, recv, holder_known ? callee->holder() : nullptr, obj_args, true);
+      ciKlass* known_holder = holder_known ? callee->holder() : nullptr;
+      if (C1InlineProfiledReceiver && holder_known && recv != nullptr &&
+          recv->exact_type() != nullptr && recv->exact_type()->is_instance_klass()) {
+        // Record the actual receiver type rather than the holder of the callee.
+        known_holder = recv->exact_type()->as_instance_klass();
+      }
+      profile_call(callee, recv, known_holder, obj_args, true);
     }
   }
 
@@ -283,6 +283,7 @@ class GraphBuilder {
   void iterate_all_blocks(bool start_in_current_block_for_inlining = false);
   Dependencies* dependency_recorder() const; // = compilation()->dependencies()
   bool direct_compare(ciKlass* k);
+  ciInstanceKlass* profiled_receiver_klass();
   Value make_constant(ciConstant value, ciField* field);
 
   void kill_all();
@@ -224,6 +224,13 @@ ciType* NewInstance::declared_type() const {
   return exact_type();
 }
 
+ciType* CheckCast::exact_type() const {
+  if (is_profiled_receiver_check()) {
+    return klass();
+  }
+  return Instruction::exact_type();
+}
+
 ciType* CheckCast::declared_type() const {
   return klass();
 }
@@ -358,6 +358,7 @@ class Instruction: public CompilationResourceObj {
     NeedsPatchingFlag,
     ThrowIncompatibleClassChangeErrorFlag,
     InvokeSpecialReceiverCheckFlag,
+    ProfiledReceiverCheckFlag,
     ProfileMDOFlag,
     IsLinkedInBlockFlag,
     NeedsRangeCheckFlag,
@@ -1443,11 +1444,26 @@ LEAF(CheckCast, TypeCheck)
   bool is_invokespecial_receiver_check() const {
     return check_flag(InvokeSpecialReceiverCheckFlag);
   }
+  // Exact receiver type check for a call inlined based on the receiver type
+  // profile. It deoptimizes like an invokespecial receiver check, but also
+  // invalidates the code so that the call site is compiled without it.
+  void set_profiled_receiver_check() {
+    set_flag(InvokeSpecialReceiverCheckFlag, true);
+    set_flag(ProfiledReceiverCheckFlag, true);
+    set_direct_compare(true);
+  }
+  bool is_profiled_receiver_check() const {
+    return check_flag(ProfiledReceiverCheckFlag);
+  }
+  Deoptimization::DeoptAction receiver_check_action() const {
+    return is_profiled_receiver_check() ? Deoptimization::Action_make_not_entrant : Deoptimization::Action_none;
+  }
 
   virtual bool needs_exception_state() const {
     return !is_invokespecial_receiver_check();
   }
 
+  ciType* exact_type() const;
   ciType* declared_type() const;
 };
 
@@ -5151,6 +5151,10 @@ int LinearScanWalker::find_optimal_split_pos(Interval* it, int min_split_pos, in
     TRACE_LINEAR_SCAN(4, tty->print_cr("      min-pos and max-pos are equal, no optimization possible"));
     optimal_split_pos = min_split_pos;
 
+  } else if (allocator()->use_fast_split()) {
+    TRACE_LINEAR_SCAN(4, tty->print_cr("      huge method, splitting at max_split_pos"));
+    optimal_split_pos = max_split_pos;
+
   } else {
     assert(min_split_pos < max_split_pos, "must be true then");
     assert(min_split_pos > 0, "cannot access min_split_pos - 1 otherwise");
@@ -197,6 +197,10 @@ class LinearScan : public CompilationResourceObj {
 
   bool is_block_begin(int op_id)                    { return op_id == 0 || block_of_op_with_id(op_id) != block_of_op_with_id(op_id - 1); }
 
+  // For huge methods, the search for the best split position would take time linear in the
+  // number of blocks for each split, so intervals are split as late as possible instead.
+  bool use_fast_split() const                       { return LinearScanFastSplitLIRSize > 0 && _lir_ops.length() > LinearScanFastSplitLIRSize; }
+
   bool has_call(int op_id)                          { assert(op_id % 2 == 0, "must be even"); return _has_call.at(op_id >> 1); }
   bool has_info(int op_id)                          { assert(op_id % 2 == 0, "must be even"); return _has_info.at(op_id >> 1); }
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1999, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1999, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -799,6 +799,21 @@ JRT_ENTRY(void, Runtime1::deoptimize(JavaThread* current, jint trap_request))
         if (trap_mdo != nullptr) {
           trap_mdo->inc_tenure_traps();
         }
+      } else if (reason == Deoptimization::Reason_class_check) {
+        // Only the check of the profiled receiver type of a virtual or interface
+        // call (see GraphBuilder::invoke) makes the code not entrant. Record the
+        // failure so that the call site is compiled without the check.
+        vframeStream vfst(current, true);
+        methodHandle trap_method(current, vfst.method());
+        Bytecodes::Code code = Bytecodes::java_code_at(trap_method(), trap_method->bcp_from(vfst.bci()));
+        assert(code == Bytecodes::_invokevirtual || code == Bytecodes::_invokeinterface,
+               "unexpected class check trap at %s", Bytecodes::name(code));
+        if (code == Bytecodes::_invokevirtual || code == Bytecodes::_invokeinterface) {
+          MethodData* trap_mdo = Deoptimization::get_method_data(current, trap_method, true /*create_if_missing*/);
+          if (trap_mdo != nullptr) {
+            Deoptimization::update_method_data_from_interpreter(trap_mdo, vfst.bci(), reason);
+          }
+        }
       }
     }
   }
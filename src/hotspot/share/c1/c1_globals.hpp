@@ -153,6 +153,11 @@
   product(bool, InlineSynchronizedMethods, true,                            \
           "Inline synchronized methods")                                    \
                                                                             \
+  product(bool, C1InlineProfiledReceiver, false, EXPERIMENTAL,              \
+          "Inline virtual and interface calls whose mature receiver type "  \
+          "profile is monomorphic, guarded by a check of the exact "        \
+          "receiver type that deoptimizes when it fails")                   \
+                                                                            \
   develop(bool, CanonicalizeNodes, true,                                    \
           "Canonicalize graph nodes")                                       \
                                                                             \
@@ -213,6 +218,12 @@
   product(bool, TimeLinearScan, false,                                      \
           "detailed timing of LinearScan phases")                           \
                                                                             \
+  product(intx, LinearScanFastSplitLIRSize, 20000, DIAGNOSTIC,              \
+          "Number of LIR operations above which LinearScan splits "         \
+          "intervals as late as possible instead of searching for the "     \
+          "best block boundary (0 means never)")                            \
+          range(0, max_jint)                                                \
+                                                                            \
   develop(bool, TimeEachLinearScan, false,                                  \
           "print detailed timing of each LinearScan run")                   \
                                                                             \
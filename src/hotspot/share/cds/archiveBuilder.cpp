@@ -30,6 +30,8 @@
 #include "cds/dumpAllocStats.hpp"
 #include "cds/heapShared.hpp"
 #include "cds/metaspaceShared.hpp"
+#include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/workerThread.hpp"
 #include "classfile/classLoaderDataShared.hpp"
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionaryShared.hpp"
@@ -40,13 +42,16 @@
 #include "memory/allStatic.hpp"
 #include "memory/memRegion.hpp"
 #include "memory/resourceArea.hpp"
+#include "memory/universe.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/objArrayKlass.hpp"
 #include "oops/objArrayOop.inline.hpp"
 #include "oops/oopHandle.inline.hpp"
 #include "runtime/arguments.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/javaThread.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "utilities/align.hpp"
 #include "utilities/bitMap.inline.hpp"
@@ -112,9 +117,10 @@ class RelocateEmbeddedPointers : public BitMapClosure {
   ArchiveBuilder* _builder;
   address _buffered_obj;
   BitMap::idx_t _start_idx;
+  bool _par;
 public:
-  RelocateEmbeddedPointers(ArchiveBuilder* builder, address buffered_obj, BitMap::idx_t start_idx) :
-    _builder(builder), _buffered_obj(buffered_obj), _start_idx(start_idx) {}
+  RelocateEmbeddedPointers(ArchiveBuilder* builder, address buffered_obj, BitMap::idx_t start_idx, bool par) :
+    _builder(builder), _buffered_obj(buffered_obj), _start_idx(start_idx), _par(par) {}
 
   bool do_bit(BitMap::idx_t bit_offset) {
     size_t field_offset = size_t(bit_offset - _start_idx) * sizeof(address);
@@ -126,18 +132,22 @@ public:
     log_trace(cds)("Ref: [" PTR_FORMAT "] -> " PTR_FORMAT " => " PTR_FORMAT,
                    p2i(ptr_loc), p2i(old_p), p2i(new_p));
 
-    ArchivePtrMarker::set_and_mark_pointer(ptr_loc, new_p);
+    if (_par) {
+      ArchivePtrMarker::set_and_par_mark_pointer(ptr_loc, new_p);
+    } else {
+      ArchivePtrMarker::set_and_mark_pointer(ptr_loc, new_p);
+    }
     return true; // keep iterating the bitmap
   }
 };
 
-void ArchiveBuilder::SourceObjList::relocate(int i, ArchiveBuilder* builder) {
+void ArchiveBuilder::SourceObjList::relocate(int i, ArchiveBuilder* builder, bool par) {
   SourceObjInfo* src_info = objs()->at(i);
   assert(src_info->should_copy(), "must be");
   BitMap::idx_t start = BitMap::idx_t(src_info->ptrmap_start()); // inclusive
   BitMap::idx_t end = BitMap::idx_t(src_info->ptrmap_end());     // exclusive
 
-  RelocateEmbeddedPointers relocator(builder, src_info->buffered_addr(), start);
+  RelocateEmbeddedPointers relocator(builder, src_info->buffered_addr(), start, par);
   _ptrmap.iterate(&relocator, start, end);
 }
 
@@ -656,16 +666,62 @@ address ArchiveBuilder::get_source_addr(address buffered_addr) const {
   return *src_p;
 }
 
-void ArchiveBuilder::relocate_embedded_pointers(ArchiveBuilder::SourceObjList* src_objs) {
-  for (int i = 0; i < src_objs->objs()->length(); i++) {
-    src_objs->relocate(i, this);
+// Relocates the embedded pointers of the source objects in chunks claimed
+// by the workers. Every object is relocated independently of all others, and
+// the resulting buffer contents and pointer bitmap do not depend on the order
+// in which the objects are processed, so the archive stays deterministic.
+class ArchiveBuilder::RelocateEmbeddedPointersTask : public WorkerTask {
+  static const int ChunkSize = 256;
+
+  ArchiveBuilder* _builder;
+  SourceObjList* _src_objs;
+  volatile int _next;
+
+public:
+  RelocateEmbeddedPointersTask(ArchiveBuilder* builder, SourceObjList* src_objs) :
+    WorkerTask("Relocate Embedded Pointers"),
+    _builder(builder), _src_objs(src_objs), _next(0) {}
+
+  void work(uint worker_id) {
+    const int length = _src_objs->objs()->length();
+    while (true) {
+      int start = Atomic::fetch_then_add(&_next, ChunkSize);
+      if (start >= length) {
+        break;
+      }
+      int end = MIN2(start + ChunkSize, length);
+      for (int i = start; i < end; i++) {
+        _src_objs->relocate(i, _builder, true /* par */);
+      }
+    }
+  }
+};
+
+void ArchiveBuilder::relocate_embedded_pointers(ArchiveBuilder::SourceObjList* src_objs, WorkerThreads* workers) {
+  if (workers != nullptr) {
+    RelocateEmbeddedPointersTask task(this, src_objs);
+    workers->run_task(&task);
+  } else {
+    for (int i = 0; i < src_objs->objs()->length(); i++) {
+      src_objs->relocate(i, this, false /* par */);
+    }
   }
 }
 
 void ArchiveBuilder::relocate_metaspaceobj_embedded_pointers() {
   log_info(cds)("Relocating embedded pointers in core regions ... ");
-  relocate_embedded_pointers(&_rw_src_objs);
-  relocate_embedded_pointers(&_ro_src_objs);
+
+  // All objects have been copied, so the pointer bitmap can be expanded up front
+  // and shared by the workers.
+  WorkerThreads* workers = Universe::heap()->safepoint_workers();
+  if (workers != nullptr && workers->active_workers() > 1) {
+    assert(SafepointSynchronize::is_at_safepoint(), "must be");
+    ArchivePtrMarker::expand_to_committed();
+  } else {
+    workers = nullptr;
+  }
+  relocate_embedded_pointers(&_rw_src_objs, workers);
+  relocate_embedded_pointers(&_ro_src_objs, workers);
 }
 
 void ArchiveBuilder::make_klasses_shareable() {
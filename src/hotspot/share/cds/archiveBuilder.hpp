@@ -42,6 +42,7 @@ class FileMapInfo;
 class Klass;
 class MemRegion;
 class Symbol;
+class WorkerThreads;
 
 // Metaspace::allocate() requires that all blocks must be aligned with KlassAlignmentInBytes.
 // We enforce the same alignment rule in blocks allocated from the shared space.
@@ -179,13 +180,14 @@ private:
 
     void append(MetaspaceClosure::Ref* enclosing_ref, SourceObjInfo* src_info);
     void remember_embedded_pointer(SourceObjInfo* pointing_obj, MetaspaceClosure::Ref* ref);
-    void relocate(int i, ArchiveBuilder* builder);
+    void relocate(int i, ArchiveBuilder* builder, bool par);
 
     // convenience accessor
     SourceObjInfo* at(int i) const { return objs()->at(i); }
   };
 
   class CDSMapLogger;
+  class RelocateEmbeddedPointersTask;
 
   static const int INITIAL_TABLE_SIZE = 15889;
   static const int MAX_TABLE_SIZE     = 1000000;
@@ -240,7 +242,7 @@ private:
   void make_shallow_copies(DumpRegion *dump_region, const SourceObjList* src_objs);
   void make_shallow_copy(DumpRegion *dump_region, SourceObjInfo* src_info);
 
-  void relocate_embedded_pointers(SourceObjList* src_objs);
+  void relocate_embedded_pointers(SourceObjList* src_objs, WorkerThreads* workers);
 
   bool is_excluded(Klass* k);
   void clean_up_src_obj_table();
@@ -91,6 +91,30 @@ void ArchivePtrMarker::mark_pointer(address* ptr_loc) {
   }
 }
 
+void ArchivePtrMarker::expand_to_committed() {
+  assert(_ptrmap != nullptr, "not initialized");
+  assert(!_compacted, "cannot mark anymore");
+  size_t size = ptr_end() - ptr_base();
+  if (_ptrmap->size() < size) {
+    _ptrmap->resize(size);
+  }
+}
+
+void ArchivePtrMarker::par_mark_pointer(address* ptr_loc) {
+  assert(_ptrmap != nullptr, "not initialized");
+  assert(!_compacted, "cannot mark anymore");
+
+  assert(ptr_base() <= ptr_loc && ptr_loc < ptr_end(), "must be");
+  address value = *ptr_loc;
+  assert(value != (address)ptr_base(), "don't point to the bottom of the archive");
+  if (value != nullptr) {
+    assert(uintx(ptr_loc) % sizeof(intptr_t) == 0, "pointers must be stored in aligned addresses");
+    size_t idx = ptr_loc - ptr_base();
+    assert(idx < _ptrmap->size(), "bitmap must have been expanded");
+    _ptrmap->par_set_bit(idx);
+  }
+}
+
 void ArchivePtrMarker::clear_pointer(address* ptr_loc) {
   assert(_ptrmap != nullptr, "not initialized");
   assert(!_compacted, "cannot clear anymore");
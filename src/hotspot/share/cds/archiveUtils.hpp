@@ -55,6 +55,12 @@ public:
   static void initialize(CHeapBitMap* ptrmap, VirtualSpace* vs);
   static void mark_pointer(address* ptr_loc);
   static void clear_pointer(address* ptr_loc);
+
+  // Expand the bitmap to cover all of the currently committed space. Afterwards,
+  // pointers in this space can be marked concurrently by multiple threads with
+  // par_mark_pointer().
+  static void expand_to_committed();
+  static void par_mark_pointer(address* ptr_loc);
   static void compact(address relocatable_base, address relocatable_end);
   static void compact(size_t max_non_null_offset);
 
@@ -69,6 +75,12 @@ public:
     mark_pointer(ptr_loc);
   }
 
+  template <typename T>
+  static void set_and_par_mark_pointer(T* ptr_loc, T ptr_value) {
+    *ptr_loc = ptr_value;
+    par_mark_pointer((address*)ptr_loc);
+  }
+
   static CHeapBitMap* ptrmap() {
     return _ptrmap;
   }
@@ -95,6 +95,11 @@
            "(2) always map at preferred address, and if unsuccessful, "     \
            "do not map the archive")                                        \
            range(0, 2)                                                      \
+                                                                            \
+  product(bool, ReadArchiveForRelocation, false, DIAGNOSTIC,                \
+          "Read the core regions of an archive that is not mapped at "      \
+          "its requested address into memory instead of mapping them, "     \
+          "since relocation modifies all of their pages anyway")            \
 // end of CDS_FLAGS
 
 DECLARE_FLAGS(CDS_FLAGS)
@@ -31,6 +31,7 @@
 #include "oops/constantPool.inline.hpp"
 #include "oops/instanceKlass.hpp"
 #include "oops/klass.inline.hpp"
+#include "oops/objArrayKlass.hpp"
 #include "runtime/handles.inline.hpp"
 
 ClassPrelinker::ClassesTable* ClassPrelinker::_processed_classes = nullptr;
@@ -106,8 +107,18 @@ bool ClassPrelinker::can_archive_resolved_klass(InstanceKlass* cp_holder, Klass*
       // ik is defined in this loader, so it's safe to archive the resolved klass reference.
       return true;
     }
-
-    // TODO -- allow objArray classes, too
+  } else if (resolved_klass->is_objArray_klass()) {
+    // An object array class is defined by the loader of its bottom class, so the
+    // resolution is as safe to archive as that of its bottom class.
+    Klass* bottom = ObjArrayKlass::cast(resolved_klass)->bottom_klass();
+    if (bottom->is_instance_klass()) {
+      return can_archive_resolved_klass(cp_holder, bottom);
+    } else {
+      assert(bottom->is_typeArray_klass(), "must be");
+      return true;
+    }
+  } else if (resolved_klass->is_typeArray_klass()) {
+    return true;
   }
 
   return false;
@@ -1790,11 +1790,23 @@ MapArchiveResult FileMapInfo::map_region(int i, intx addr_delta, char* mapped_ba
     r->set_read_only(false); // Need to patch the pointers
   }
 
-  if (MetaspaceShared::use_windows_memory_mapping() && rs.is_reserved()) {
-    // This is the second time we try to map the archive(s). We have already created a ReservedSpace
-    // that covers all the FileMapRegions to ensure all regions can be mapped. However, Windows
-    // can't mmap into a ReservedSpace, so we just ::read() the data. We're going to patch all the
-    // regions anyway, so there's no benefit for mmap anyway.
+  bool read_into_reserved_space = false;
+  if (rs.is_reserved()) {
+    if (MetaspaceShared::use_windows_memory_mapping()) {
+      // This is the second time we try to map the archive(s). We have already created a ReservedSpace
+      // that covers all the FileMapRegions to ensure all regions can be mapped. However, Windows
+      // can't mmap into a ReservedSpace, so we just ::read() the data. We're going to patch all the
+      // regions anyway, so there's no benefit for mmap anyway.
+      read_into_reserved_space = true;
+    } else if (addr_delta != 0 && ReadArchiveForRelocation) {
+      // Relocation writes to (almost) every page of the region, so a private file mapping
+      // would take a page fault and a copy-on-write for each page. Reading the region in
+      // one go is cheaper.
+      read_into_reserved_space = true;
+    }
+  }
+
+  if (read_into_reserved_space) {
     if (!read_region(i, requested_addr, size, /* do_commit = */ true)) {
       log_info(cds)("Failed to read %s shared space into reserved space at " INTPTR_FORMAT,
                     shared_region_name[i], p2i(requested_addr));
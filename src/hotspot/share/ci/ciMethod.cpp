@@ -499,13 +499,12 @@ ciCallProfile ciMethod::call_profile_at_bci(int bci) {
           // we will set result._method also.
         }
         // Determine call site's morphism.
-        // The call site count is 0 with known morphism (only 1 or 2 receivers)
+        // The call site count is 0 with known morphism (at most TypeProfileWidth receivers)
         // or < 0 in the case of a type check failure for checkcast, aastore, instanceof.
         // The call site count is > 0 in the case of a polymorphic virtual call.
         if (morphism > 0 && morphism == result._limit) {
-           // The morphism <= MorphismLimit.
-           if ((morphism <  ciCallProfile::MorphismLimit) ||
-               (morphism == ciCallProfile::MorphismLimit && count == 0)) {
+           // The morphism <= TypeProfileWidth, and no other receiver was seen.
+           if ((morphism == 1) || (count == 0)) {
 #ifdef ASSERT
              if (count > 0) {
                this->print_short_name(tty);
@@ -151,11 +151,17 @@ uint32_t AltHashing::halfsiphash_32(uint64_t seed, const void* in, int len) {
   // body
   while (count >= 4) {
 
+#ifdef VM_LITTLE_ENDIAN
+    // The bytes are combined in little endian order, so on little endian
+    // platforms a single (possibly unaligned) load gives the same value.
+    memcpy(&newdata, data + off, sizeof(newdata));
+#else
     // Avoid sign extension with 0x0ff
     newdata = (data[off] & 0x0FF)
         | (data[off + 1] & 0x0FF) << 8
         | (data[off + 2] & 0x0FF) << 16
         | data[off + 3] << 24;
+#endif
 
     count -= 4;
     off += 4;
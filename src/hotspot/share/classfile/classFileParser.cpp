@@ -1422,6 +1422,26 @@ class ClassFileParser::FieldAllocationCount : public ResourceObj {
   }
 };
 
+// Returns true if the ContendedFields list contains the field, given as
+// <class name>.<field name>. The list elements are separated by commas or,
+// if the flag was given multiple times, newlines.
+static bool is_listed_contended_field(const Symbol* class_name, const Symbol* field_name) {
+  const int class_len = class_name->utf8_length();
+  const int field_len = field_name->utf8_length();
+  const char* p = ContendedFields;
+  while (*p != '\0') {
+    const char* end = p + strcspn(p, ",\n");
+    if (end - p == class_len + 1 + field_len &&
+        p[class_len] == '.' &&
+        class_name->equals(p, class_len) &&
+        field_name->equals(p + class_len + 1, field_len)) {
+      return true;
+    }
+    p = (*end == '\0') ? end : end + 1;
+  }
+  return false;
+}
+
 // Side-effects: populates the _fields, _fields_annotations,
 // _fields_type_annotations fields
 void ClassFileParser::parse_fields(const ClassFileStream* const cfs,
@@ -1536,6 +1556,11 @@ void ClassFileParser::parse_fields(const ClassFileStream* const cfs,
       fi.set_generic_signature_index(generic_signature_index);
     }
     parsed_annotations.apply_to(&fi);
+    if (!is_static && !fi.field_flags().is_contended() && EnableContended &&
+        ContendedFields[0] != '\0' && is_listed_contended_field(_class_name, name)) {
+      // Each listed field is put into the default contended group, i.e. on its own.
+      fi.set_contended_group(0);
+    }
     if (fi.field_flags().is_contended()) {
       _has_contended_fields = true;
     }
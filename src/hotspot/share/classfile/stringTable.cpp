@@ -161,6 +161,17 @@ class StringTableConfig : public StackObj {
   }
 };
 
+// Filter for table entries whose cached String.hashCode() cannot match the
+// lookup, which avoids comparing their characters. Only valid when the table
+// does not use the alternate hash, in which case the lookup hash is the
+// String.hashCode() of the looked up string. The alternate hash is only ever
+// switched on, so a lookup object that sees it off belongs to a lookup whose
+// hash was computed without it.
+static bool hash_mismatch(oop val_oop, uintx hash, bool alt_hash) {
+  return !alt_hash && java_lang_String::hash_is_set(val_oop) &&
+         java_lang_String::hash_code_noupdate(val_oop) != hash;
+}
+
 class StringTableLookupJchar : StackObj {
  private:
   Thread* _thread;
@@ -168,17 +179,18 @@ class StringTableLookupJchar : StackObj {
   int _len;
   const jchar* _str;
   Handle _found;
+  const bool _alt_hash;
 
  public:
   StringTableLookupJchar(Thread* thread, uintx hash, const jchar* key, int len)
-    : _thread(thread), _hash(hash), _len(len), _str(key) {
+    : _thread(thread), _hash(hash), _len(len), _str(key), _alt_hash(::_alt_hash) {
   }
   uintx get_hash() const {
     return _hash;
   }
   bool equals(WeakHandle* value) {
     oop val_oop = value->peek();
-    if (val_oop == nullptr) {
+    if (val_oop == nullptr || hash_mismatch(val_oop, _hash, _alt_hash)) {
       return false;
     }
     bool equals = java_lang_String::equals(val_oop, _str, _len);
@@ -202,9 +214,10 @@ class StringTableLookupOop : public StackObj {
   Handle _find;
   Handle _found;  // Might be a different oop with the same value that's already
                   // in the table, which is the point.
+  const bool _alt_hash;
  public:
   StringTableLookupOop(Thread* thread, uintx hash, Handle handle)
-    : _thread(thread), _hash(hash), _find(handle) { }
+    : _thread(thread), _hash(hash), _find(handle), _alt_hash(::_alt_hash) { }
 
   uintx get_hash() const {
     return _hash;
@@ -212,7 +225,7 @@ class StringTableLookupOop : public StackObj {
 
   bool equals(WeakHandle* value) {
     oop val_oop = value->peek();
-    if (val_oop == nullptr) {
+    if (val_oop == nullptr || hash_mismatch(val_oop, _hash, _alt_hash)) {
       return false;
     }
     bool equals = java_lang_String::equals(_find(), val_oop);
@@ -399,6 +412,7 @@ oop StringTable::do_intern(Handle string_or_null_h, const jchar* name,
     // The hash table takes ownership of the WeakHandle, even if it's not inserted.
     if (_local_table->insert(THREAD, lookup, wh, &rehash_warning)) {
       update_needs_rehash(rehash_warning);
+      trigger_grow_if_needed();
       return wh.resolve();
     }
     // In case another thread did a concurrent add, return value already in the table.
@@ -498,6 +512,16 @@ void StringTable::gc_notification(size_t num_dead) {
   }
 }
 
+// Growing is otherwise only triggered by GC notifications. Without it, bursts
+// of interning between GCs would make the chains long enough to require a
+// rehash in a safepoint.
+void StringTable::trigger_grow_if_needed() {
+  if (!has_work() && should_grow()) {
+    log_debug(stringtable)("Concurrent grow triggered, live factor: %g", get_load_factor());
+    trigger_concurrent_work();
+  }
+}
+
 bool StringTable::has_work() {
   return Atomic::load_acquire(&_has_work);
 }
@@ -507,7 +531,13 @@ void StringTable::do_concurrent_work(JavaThread* jt) {
   log_debug(stringtable, perf)("Concurrent work, live factor: %g", load_factor);
   // We prefer growing, since that also removes dead items
   if (load_factor > PREF_AVG_LIST_LEN && !_local_table->is_max_size_reached()) {
-    grow(jt);
+    // Each grow doubles the table, so keep going until the load factor is
+    // acceptable, unless a grow did not happen.
+    size_t size_before;
+    do {
+      size_before = _current_size;
+      grow(jt);
+    } while (_current_size != size_before && should_grow());
   } else {
     clean_dead_entries(jt);
   }
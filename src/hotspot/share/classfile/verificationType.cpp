@@ -119,7 +119,7 @@ bool VerificationType::is_reference_assignable_from(
       }
     }
 
-    return resolve_and_check_assignability(klass, name(), from.name(),
+    return context->resolve_and_check_assignability(name(), from.name(),
           from_field_is_protected, from.is_array(), from.is_object(), THREAD);
   } else if (is_array() && from.is_array()) {
     VerificationType comp_this = get_component(context);
@@ -2106,6 +2106,25 @@ Klass* ClassVerifier::load_class(Symbol* name, TRAPS) {
   return kls;
 }
 
+bool ClassVerifier::resolve_and_check_assignability(Symbol* name, Symbol* from_name,
+                                                    bool from_field_is_protected, bool from_is_array,
+                                                    bool from_is_object, TRAPS) {
+  if (log_is_enabled(Debug, class, resolve)) {
+    // Trace every resolution.
+    return VerificationType::resolve_and_check_assignability(current_class(), name, from_name,
+             from_field_is_protected, from_is_array, from_is_object, THREAD);
+  }
+  AssignabilityCheck check(name, from_name, from_field_is_protected);
+  bool* cached = _assignability_cache.get(check);
+  if (cached != nullptr) {
+    return *cached;
+  }
+  bool result = VerificationType::resolve_and_check_assignability(current_class(), name, from_name,
+                  from_field_is_protected, from_is_array, from_is_object, CHECK_false);
+  _assignability_cache.put(check, result);
+  return result;
+}
+
 bool ClassVerifier::is_protected_access(InstanceKlass* this_class,
                                         Klass* target_class,
                                         Symbol* field_name,
@@ -274,6 +274,33 @@ class sig_as_verification_types : public ResourceObj {
 typedef ResourceHashtable<int, sig_as_verification_types*, 1007>
                           method_signatures_table_type;
 
+// Key of the cache of reference assignability checks that need to resolve
+// classes. Whether the source type is an array or an object follows from
+// its name.
+class AssignabilityCheck {
+ public:
+  Symbol* _target;
+  Symbol* _from;
+  bool    _from_field_is_protected;
+
+  AssignabilityCheck(Symbol* target, Symbol* from, bool from_field_is_protected) :
+    _target(target), _from(from), _from_field_is_protected(from_field_is_protected) {}
+
+  static unsigned hash(const AssignabilityCheck& c) {
+    return c._target->identity_hash() * 31 + c._from->identity_hash() + (c._from_field_is_protected ? 1 : 0);
+  }
+  static bool equals(const AssignabilityCheck& c1, const AssignabilityCheck& c2) {
+    return c1._target == c2._target && c1._from == c2._from &&
+           c1._from_field_is_protected == c2._from_field_is_protected;
+  }
+};
+
+// The checks are resolved against the loader of the class being verified,
+// so their results do not change while the class is verified.
+typedef ResourceHashtable<AssignabilityCheck, bool, 251, AnyObj::C_HEAP, mtClass,
+                          AssignabilityCheck::hash, AssignabilityCheck::equals>
+                          assignability_cache_type;
+
 // A new instance of this class is created for each class being verified
 class ClassVerifier : public StackObj {
  private:
@@ -287,6 +314,9 @@ class ClassVerifier : public StackObj {
 
   method_signatures_table_type _method_signatures_table;
 
+  // Results of the assignability checks that resolved classes
+  assignability_cache_type _assignability_cache;
+
   ErrorContext _error_context;  // contains information about an error
 
   void verify_method(const methodHandle& method, TRAPS);
@@ -437,6 +467,12 @@ class ClassVerifier : public StackObj {
 
   Klass* load_class(Symbol* name, TRAPS);
 
+  // Same as VerificationType::resolve_and_check_assignability() for the
+  // current class, but only resolves the classes of a check once.
+  bool resolve_and_check_assignability(Symbol* name, Symbol* from_name,
+                                       bool from_field_is_protected, bool from_is_array,
+                                       bool from_is_object, TRAPS);
+
   method_signatures_table_type* method_signatures_table() {
     return &_method_signatures_table;
   }
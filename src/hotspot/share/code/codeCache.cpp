@@ -61,6 +61,7 @@
 #include "runtime/java.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "runtime/os.inline.hpp"
+#include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
 #include "runtime/vmThread.hpp"
 #include "sanitizers/leak.hpp"
@@ -1363,14 +1364,21 @@ void CodeCache::mark_for_deoptimization(DeoptimizationScope* deopt_scope, Method
 }
 
 void CodeCache::make_marked_nmethods_deoptimized() {
-  RelaxedCompiledMethodIterator iter(RelaxedCompiledMethodIterator::only_not_unloading);
-  while(iter.next()) {
-    CompiledMethod* nm = iter.method();
-    if (nm->is_marked_for_deoptimization() && !nm->has_been_deoptimized() && nm->can_be_deoptimized()) {
+  // Only visit the methods marked since the last time. Marked methods are not
+  // freed before this thread reaches a safepoint or handshake, because they
+  // are forgotten when they are unlinked.
+  GrowableArrayCHeap<CompiledMethod*, mtCode>* marked = DeoptimizationScope::take_marked_methods();
+  if (marked == nullptr) {
+    return;
+  }
+  for (CompiledMethod* nm : *marked) {
+    if (nm->is_marked_for_deoptimization() && !nm->has_been_deoptimized() &&
+        nm->can_be_deoptimized() && !nm->is_unloading()) {
       nm->make_not_entrant();
       nm->make_deoptimized();
     }
   }
+  delete marked;
 }
 
 // Marks compiled methods dependent on dependee.
@@ -1703,6 +1711,23 @@ void CodeCache::print() {
 #endif // !PRODUCT
 }
 
+static void print_heap_fragmentation(outputStream* st, CodeHeap* heap) {
+  size_t free = heap->unallocated_capacity();
+  size_t largest = heap->largest_free_block();
+  st->print_cr(" free_blocks=%d largest_free=" SIZE_FORMAT "Kb fragmentation=" SIZE_FORMAT "%%",
+               heap->freelist_length(), largest/K,
+               free == 0 ? 0 : (free - MIN2(largest, free)) * 100 / free);
+}
+
+void CodeCache::print_fragmentation(outputStream* st) {
+  assert_locked_or_safepoint(CodeCache_lock);
+  FOR_ALL_HEAPS(heap_iterator) {
+    CodeHeap* heap = (*heap_iterator);
+    st->print("%s:", heap->name());
+    print_heap_fragmentation(st, heap);
+  }
+}
+
 void CodeCache::print_summary(outputStream* st, bool detailed) {
   int full_count = 0;
   FOR_ALL_HEAPS(heap_iterator) {
@@ -1723,6 +1748,11 @@ void CodeCache::print_summary(outputStream* st, bool detailed) {
                    p2i(heap->low_boundary()),
                    p2i(heap->high()),
                    p2i(heap->high_boundary()));
+      // Walking the freelist is only safe with the lock, which is not held
+      // during error reporting.
+      if (CodeCache_lock->owned_by_self() || SafepointSynchronize::is_at_safepoint()) {
+        print_heap_fragmentation(st, heap);
+      }
 
       full_count += get_codemem_full_count(heap->code_blob_type());
     }
@@ -1762,6 +1792,43 @@ void CodeCache::print_layout(outputStream* st) {
   MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
   ResourceMark rm;
   print_summary(st, true);
+  print_nmethod_section_sizes(st);
+}
+
+void CodeCache::print_nmethod_section_sizes(outputStream* st) {
+  assert_locked_or_safepoint(CodeCache_lock);
+  size_t count = 0, total = 0;
+  size_t insts = 0, stubs = 0, consts = 0;
+  size_t header = 0, relocation = 0, oops = 0, metadata = 0, scopes_pcs = 0, scopes_data = 0;
+  size_t dependencies = 0, handler_table = 0, nul_chk_table = 0;
+  NMethodIterator iter(NMethodIterator::all_blobs);
+  while (iter.next()) {
+    nmethod* nm = iter.method();
+    count++;
+    total         += nm->size();
+    insts         += nm->insts_size();
+    stubs         += nm->stub_size();
+    consts        += nm->consts_size();
+    header        += nm->header_size();
+    relocation    += nm->relocation_size();
+    oops          += nm->oops_size();
+    metadata      += nm->metadata_size();
+    scopes_pcs    += nm->scopes_pcs_size();
+    scopes_data   += nm->scopes_data_size();
+    dependencies  += nm->dependencies_size();
+    handler_table += nm->handler_table_size();
+    nul_chk_table += nm->nul_chk_table_size();
+  }
+  size_t code = insts + stubs + consts;
+  st->print_cr(" nmethods=" SIZE_FORMAT " total=" SIZE_FORMAT "Kb code=" SIZE_FORMAT "Kb (" SIZE_FORMAT "%%)",
+               count, total/K, code/K, total == 0 ? 0 : code * 100 / total);
+  st->print_cr("  code: insts=" SIZE_FORMAT "Kb stubs=" SIZE_FORMAT "Kb consts=" SIZE_FORMAT "Kb",
+               insts/K, stubs/K, consts/K);
+  st->print_cr("  metadata: header=" SIZE_FORMAT "Kb relocation=" SIZE_FORMAT "Kb oops=" SIZE_FORMAT "Kb"
+               " metadata=" SIZE_FORMAT "Kb scopes_pcs=" SIZE_FORMAT "Kb scopes_data=" SIZE_FORMAT "Kb",
+               header/K, relocation/K, oops/K, metadata/K, scopes_pcs/K, scopes_data/K);
+  st->print_cr("            dependencies=" SIZE_FORMAT "Kb handler_table=" SIZE_FORMAT "Kb nul_chk_table=" SIZE_FORMAT "Kb",
+               dependencies/K, handler_table/K, nul_chk_table/K);
 }
 
 void CodeCache::log_state(outputStream* st) {
@@ -228,6 +228,8 @@ class CodeCache : AllStatic {
   static void verify();                          // verifies the code cache
   static void print_trace(const char* event, CodeBlob* cb, int size = 0) PRODUCT_RETURN;
   static void print_summary(outputStream* st, bool detailed = true); // Prints a summary of the code cache usage
+  static void print_fragmentation(outputStream* st); // Prints the fragmentation of the free space of all code heaps
+  static void print_nmethod_section_sizes(outputStream* st); // Prints how much of the nmethods is code and metadata
   static void log_state(outputStream* st);
   LINUX_ONLY(static void write_perf_map();)
   static const char* get_code_heap_name(CodeBlobType code_blob_type)  { return (heap_available(code_blob_type) ? get_code_heap(code_blob_type)->name() : "Unused"); }
@@ -31,13 +31,16 @@
 #include "gc/shared/collectedHeap.inline.hpp"
 #include "interpreter/interpreter.hpp"
 #include "interpreter/linkResolver.hpp"
+#include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/method.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/globals_extension.hpp"
 #include "runtime/handles.inline.hpp"
 #include "runtime/javaThread.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "runtime/os.hpp"
 #include "runtime/stubRoutines.hpp"
 #include "runtime/vmOperations.hpp"
 
@@ -139,8 +142,26 @@ void ICStub::print() {
 // Implementation of InlineCacheBuffer
 
 
+// Transition stubs are only released at safepoints, so running out of them
+// forces an otherwise useless safepoint (ICBufferFull). The number of call
+// sites concurrently changing state during warmup grows with the number of
+// threads running Java code, so give machines with many processors a larger
+// buffer, but keep it to a modest fraction of the non-nmethod code heap.
+static size_t ergo_inline_cache_buffer_size() {
+  const int processors_per_default_size = 4;
+  size_t scale = MAX2(1, os::active_processor_count() / processors_per_default_size);
+  size_t size = MIN2(InlineCacheBufferSize * scale, NonNMethodCodeHeapSize / 16);
+  return MAX2(size, InlineCacheBufferSize);
+}
+
 void InlineCacheBuffer::initialize() {
   if (_buffer != nullptr) return; // already initialized
+  if (FLAG_IS_DEFAULT(InlineCacheBufferSize)) {
+    FLAG_SET_ERGO(InlineCacheBufferSize, ergo_inline_cache_buffer_size());
+  }
+  log_debug(codecache)("InlineCacheBuffer size: " SIZE_FORMAT "K (at most %d stubs)",
+                       InlineCacheBufferSize / K,
+                       checked_cast<int>(InlineCacheBufferSize) / ic_stub_code_size());
   _buffer = new StubQueue(new ICStubInterface, checked_cast<int>(InlineCacheBufferSize), InlineCacheBuffer_lock, "InlineCacheBuffer");
   assert (_buffer != nullptr, "cannot allocate InlineCacheBuffer");
 }
@@ -158,6 +179,8 @@ void InlineCacheBuffer::refill_ic_stubs() {
 #endif
   // we ran out of inline cache buffer space; must enter safepoint.
   // We do this by forcing a safepoint
+  log_debug(codecache)("InlineCacheBuffer full with %d stubs, forcing a safepoint",
+                       buffer()->number_of_stubs());
   VM_ICBufferFull ibf;
   VMThread::execute(&ibf);
 }
@@ -1418,6 +1418,9 @@ void nmethod::unlink() {
 
   flush_dependencies();
 
+  // The nmethod may be freed before the marked methods are made not entrant.
+  DeoptimizationScope::unlink(this);
+
   // unlink_from_method will take the CompiledMethod_lock.
   // In this case we don't strictly need it when unlinking nmethods from
   // the Method, because it is only concurrently unlinked by
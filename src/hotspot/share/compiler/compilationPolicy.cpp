@@ -23,11 +23,13 @@
  */
 
 #include "precompiled.hpp"
+#include "code/codeCache.hpp"
 #include "code/scopeDesc.hpp"
 #include "compiler/compilationPolicy.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerDefinitions.inline.hpp"
 #include "compiler/compilerOracle.hpp"
+#include "logging/log.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/methodData.hpp"
 #include "oops/method.inline.hpp"
@@ -41,6 +43,7 @@
 #include "runtime/handles.inline.hpp"
 #include "runtime/safepoint.hpp"
 #include "runtime/safepointVerifiers.hpp"
+#include "utilities/resourceHash.hpp"
 #ifdef COMPILER1
 #include "c1/c1_Compiler.hpp"
 #endif
@@ -159,6 +162,39 @@ bool CompilationPolicy::is_compilation_enabled() {
   return CompileBroker::should_compile_new_jobs();
 }
 
+// Write a CompileThresholdScaling command for each method that has code of
+// the highest tier, so that a later run with -XX:CompileCommandFile reaches
+// peak performance for these methods sooner. Hidden classes are skipped since
+// their names are not stable across runs.
+void CompilationPolicy::write_hot_methods_file() {
+  fileStream fs(HotMethodsAtExitFile, "w");
+  if (!fs.is_open()) {
+    log_warning(jit, compilation)("Failed to create %s for hot methods", HotMethodsAtExitFile);
+    return;
+  }
+
+  ResourceMark rm;
+  ResourceHashtable<const Method*, bool> written;
+  int count = 0;
+  {
+    MutexLocker mu(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    NMethodIterator iter(NMethodIterator::only_not_unloading);
+    while (iter.next()) {
+      nmethod* nm = iter.method();
+      Method* m = nm->method();
+      if (m == nullptr || !nm->is_in_use() || nm->comp_level() != highest_compile_level() ||
+          m->method_holder()->is_hidden() || !written.put(m, true)) {
+        continue;
+      }
+      fs.print_cr("CompileThresholdScaling,%s.%s%s,%f",
+                  m->klass_name()->as_C_string(), m->name()->as_C_string(),
+                  m->signature()->as_C_string(), HotMethodsThresholdScaling);
+      count++;
+    }
+  }
+  log_info(jit, compilation)("Wrote %d hot methods to %s", count, HotMethodsAtExitFile);
+}
+
 CompileTask* CompilationPolicy::select_task_helper(CompileQueue* compile_queue) {
   // Remove unloaded methods from the queue
   for (CompileTask* task = compile_queue->first(); task != nullptr; ) {
@@ -372,6 +408,9 @@ void CompilationPolicy::print_event(EventType type, const Method* m, const Metho
   case MAKE_NOT_ENTRANT:
     tty->print("make-not-entrant");
     break;
+  case CREATE_MDO:
+    tty->print("create-mdo");
+    break;
   default:
     tty->print("unknown");
   }
@@ -490,9 +529,15 @@ void CompilationPolicy::initialize() {
         set_c1_count(c1_count);
       } else
 #endif
-      {
+      if (FLAG_IS_DEFAULT(CIC1ThreadFraction)) {
         set_c1_count(MAX2(count / 3, 1));
         set_c2_count(MAX2(count - c1_count(), 1));
+      } else {
+        // Keep at least one thread for each compiler so that a flood of tasks
+        // for one of them never starves the other.
+        int c1_count = clamp((int) (count * CIC1ThreadFraction), 1, MAX2(count - 1, 1));
+        set_c1_count(c1_count);
+        set_c2_count(MAX2(count - c1_count, 1));
       }
     }
     assert(count == c1_count() + c2_count(), "inconsistent compiler thread count");
@@ -927,6 +972,12 @@ bool CompilationPolicy::should_create_mdo(const methodHandle& method, CompLevel
   if (cur_level != CompLevel_none || force_comp_at_level_simple(method) || CompilationModeFlag::quick_only() || !ProfileInterpreter) {
     return false;
   }
+  if (!Tier0ProfileQueuedMethods && CompileBroker::compilation_is_in_queue(method) &&
+      CompileBroker::queue_size(CompLevel_full_profile) <= Tier3LoadFeedback * compiler_count(CompLevel_full_profile)) {
+    // The method is going to be compiled soon, and C1 code collects the profile
+    // faster than the interpreter.
+    return false;
+  }
   if (is_old(method)) {
     return true;
   }
@@ -962,6 +1013,9 @@ void CompilationPolicy::create_mdo(const methodHandle& mh, JavaThread* THREAD) {
   }
   if (mh->method_data() == nullptr) {
     Method::build_profiling_method_data(mh, CHECK_AND_CLEAR);
+    if (PrintTieredEvents && mh->method_data() != nullptr) {
+      print_event(CREATE_MDO, mh(), mh(), InvocationEntryBci, CompLevel_none);
+    }
   }
   if (ProfileInterpreter) {
     MethodData* mdo = mh->method_data();
@@ -222,7 +222,7 @@ class CompilationPolicy : AllStatic {
   static void set_c1_count(int x) { _c1_count = x;    }
   static void set_c2_count(int x) { _c2_count = x;    }
 
-  enum EventType { CALL, LOOP, COMPILE, REMOVE_FROM_QUEUE, UPDATE_IN_QUEUE, REPROFILE, MAKE_NOT_ENTRANT };
+  enum EventType { CALL, LOOP, COMPILE, REMOVE_FROM_QUEUE, UPDATE_IN_QUEUE, REPROFILE, MAKE_NOT_ENTRANT, CREATE_MDO };
   static void print_event(EventType type, const Method* m, const Method* im, int bci, CompLevel level);
   // Check if the method can be compiled, change level if necessary
   static void compile(const methodHandle& mh, int bci, CompLevel level, TRAPS);
@@ -272,6 +272,8 @@ public:
   static bool is_mature(Method* method);
   // Initialize: set compiler thread count
   static void initialize();
+  // Write the methods compiled at the highest tier to HotMethodsAtExitFile.
+  static void write_hot_methods_file();
   static bool should_not_inline(ciEnv* env, ciMethod* callee);
 
   // Return desired initial compilation level for Xcomp
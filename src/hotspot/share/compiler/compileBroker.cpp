@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1999, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1999, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -2114,7 +2114,8 @@ static void post_compilation_event(EventCompilation& event, CompileTask* task) {
                                         task->is_success(),
                                         task->osr_bci() != CompileBroker::standard_entry_bci,
                                         task->nm_total_size(),
-                                        task->num_inlined_bytecodes());
+                                        task->num_inlined_bytecodes(),
+                                        task->arena_bytes());
 }
 
 int DirectivesStack::_depth = 0;
@@ -2234,6 +2235,8 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
     NoHandleMark  nhm;
     ThreadToNativeFromVM ttn(thread);
 
+    // Account the arena memory of this compilation, including the ciEnv's.
+    thread->reset_arena_stat();
     ciEnv ci_env(task);
     if (should_break) {
       ci_env.set_break_at_compile(true);
@@ -2281,6 +2284,9 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
       }
     }
 
+    task->set_arena_bytes(thread->arena_peak_bytes());
+    log_debug(jit, compilation)("%d   arena peak: " SIZE_FORMAT " bytes", compile_id, task->arena_bytes());
+
     DirectivesStack::release(directive);
 
     if (!ci_env.failing() && !task->is_success()) {
@@ -2336,7 +2342,11 @@ void CompileBroker::invoke_compiler_on_method(CompileTask* task) {
     if (task->is_success()) {
       tty->print("size: %d(%d) ", task->nm_total_size(), task->nm_insts_size());
     }
-    tty->print_cr("time: %d inlined: %d bytes", (int)time.milliseconds(), task->num_inlined_bytecodes());
+    tty->print("time: %d inlined: %d bytes", (int)time.milliseconds(), task->num_inlined_bytecodes());
+    if (task->arena_bytes() != 0) {
+      tty->print(" arena: " SIZE_FORMAT "K", task->arena_bytes() / K);
+    }
+    tty->cr();
   }
 
   Log(compilation, codecache) log;
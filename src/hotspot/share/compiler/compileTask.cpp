@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1998, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1998, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -121,6 +121,7 @@ void CompileTask::initialize(int compile_id,
   _directive = DirectivesStack::getMatchingDirective(method, comp);
   _nm_insts_size = 0;
   _nm_total_size = 0;
+  _arena_bytes = 0;
   _failure_reason = nullptr;
   _failure_reason_on_C_heap = false;
 
@@ -386,6 +387,9 @@ void CompileTask::log_task_done(CompileLog* log) {
   if (_num_inlined_bytecodes != 0) {
     log->print(" inlined_bytes='%d'", _num_inlined_bytecodes);
   }
+  if (_arena_bytes != 0) {
+    log->print(" arena_bytes='" SIZE_FORMAT "'", _arena_bytes);
+  }
   log->stamp();
   log->end_elem();
   log->clear_identities();   // next task will have different CI
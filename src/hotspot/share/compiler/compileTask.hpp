@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1998, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1998, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -86,6 +86,7 @@ class CompileTask : public CHeapObj<mtCompiler> {
   CodeSection::csize_t _nm_content_size;
   CodeSection::csize_t _nm_total_size;
   CodeSection::csize_t _nm_insts_size;
+  size_t               _arena_bytes;         // peak arena memory used by the compilation
   DirectiveSet*  _directive;
 #if INCLUDE_JVMCI
   bool                 _has_waiter;
@@ -134,6 +135,8 @@ class CompileTask : public CHeapObj<mtCompiler> {
   void         set_nm_insts_size(CodeSection::csize_t size) { _nm_insts_size = size; }
   CodeSection::csize_t nm_total_size() { return _nm_total_size; }
   void         set_nm_total_size(CodeSection::csize_t size) { _nm_total_size = size; }
+  size_t       arena_bytes() const               { return _arena_bytes; }
+  void         set_arena_bytes(size_t bytes)     { _arena_bytes = bytes; }
   bool         can_become_stale() const          {
     switch (_compile_reason) {
       case Reason_BackedgeCount:
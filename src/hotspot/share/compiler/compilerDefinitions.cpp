@@ -629,6 +629,10 @@ void CompilerConfig::ergo_initialize() {
     FLAG_SET_ERGO(PrintIdealGraphLevel, -1);
   }
 #endif
+  if (UsePolymorphicInlining && FLAG_IS_DEFAULT(TypeProfileWidth) && TypeProfileWidth < 4) {
+    // Record enough receiver types for polymorphic inlining to be useful
+    FLAG_SET_ERGO(TypeProfileWidth, 4);
+  }
   if (!UseTypeSpeculation && FLAG_IS_DEFAULT(TypeProfileLevel)) {
     // nothing to use the profiling, turn if off
     FLAG_SET_DEFAULT(TypeProfileLevel, 0);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2020, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2020, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -41,6 +41,7 @@ class EventCompilation;
 class EventCompilationFailure;
 class EventCompilerInlining;
 class EventCompilerPhase;
+class EventCompilerTimerPhase;
 struct JfrStructCalleeMethod;
 
 class CompilerEvent : AllStatic {
@@ -52,7 +53,7 @@ class CompilerEvent : AllStatic {
 
   class CompilationEvent : AllStatic {
    public:
-    static void post(EventCompilation& event, int compile_id, CompilerType type, Method* method, int compile_level, bool success, bool is_osr, int code_size, int inlined_bytecodes) NOT_JFR_RETURN();
+    static void post(EventCompilation& event, int compile_id, CompilerType type, Method* method, int compile_level, bool success, bool is_osr, int code_size, int inlined_bytecodes, size_t arena_bytes) NOT_JFR_RETURN();
   };
 
   class CompilationFailureEvent : AllStatic {
@@ -77,6 +78,11 @@ class CompilerEvent : AllStatic {
     }
   };
 
+  class TimerPhaseEvent : AllStatic {
+   public:
+    static void post(EventCompilerTimerPhase& event, const Ticks& start_time, const char* phase, int compile_id, uint live_nodes) NOT_JFR_RETURN();
+  };
+
   class InlineEvent : AllStatic {
     static void post(EventCompilerInlining& event, int compile_id, Method* caller, const JfrStructCalleeMethod& callee, bool success, const char* msg, int bci) NOT_JFR_RETURN();
    public:
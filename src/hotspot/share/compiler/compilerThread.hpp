@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2021, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2021, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -54,6 +54,9 @@ class CompilerThread : public JavaThread {
   AbstractCompiler*     _compiler;
   TimeStamp             _idle_time;
 
+  ssize_t               _arena_bytes;       // Arena memory allocated since reset_arena_stat
+  ssize_t               _arena_peak_bytes;  // Peak of _arena_bytes
+
  public:
 
   static CompilerThread* current() {
@@ -96,6 +99,15 @@ class CompilerThread : public JavaThread {
     _log = log;
   }
 
+  // Arena memory accounting for the current compilation, updated through
+  // Arena::set_size_in_bytes for all mtCompiler arenas of this thread.
+  void   reset_arena_stat()                      { _arena_bytes = 0; _arena_peak_bytes = 0; }
+  virtual void compiler_arena_size_changed(ssize_t delta) {
+    _arena_bytes += delta;
+    _arena_peak_bytes = MAX2(_arena_peak_bytes, _arena_bytes);
+  }
+  size_t arena_peak_bytes() const                { return (size_t)_arena_peak_bytes; }
+
   void start_idle_timer()                        { _idle_time.update(); }
   jlong idle_time_millis() {
     return TimeHelper::counter_to_millis(_idle_time.ticks_since_update());
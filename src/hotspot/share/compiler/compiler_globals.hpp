@@ -95,6 +95,13 @@
   product(bool, CICompilerCountPerCPU, false,                               \
           "1 compiler thread for log(N CPUs)")                              \
                                                                             \
+  product(double, CIC1ThreadFraction, 0.33, EXPERIMENTAL,                   \
+          "The fraction of compiler threads used by C1 if both C1 and C2 "  \
+          "are used. By default, one third of the compiler threads, "       \
+          "rounded down, is used by C1. At least one thread is used by "    \
+          "each compiler")                                                  \
+          range(0.0, 1.0)                                                   \
+                                                                            \
   notproduct(intx, CICrashAt, -1,                                           \
           "id of compilation to trigger assert in compiler thread for "     \
           "the purpose of testing, e.g. generation of replay data")         \
@@ -217,6 +224,12 @@
           "do not start profiling in the interpreter")                      \
           range(0, max_jint)                                                \
                                                                             \
+  product(bool, Tier0ProfileQueuedMethods, true, DIAGNOSTIC,                \
+          "Start profiling in the interpreter also for methods that are "   \
+          "queued for compilation. If false, such methods are not "         \
+          "profiled in the interpreter unless the C1 queue size is over "   \
+          "Tier3LoadFeedback per compiler thread")                          \
+                                                                            \
   product(intx, TieredOldPercentage, 1000, DIAGNOSTIC,                      \
           "Percentage over tier 3 thresholds after which a method is "      \
           "considered old (turns off parts of prioritization based on "     \
@@ -299,6 +312,17 @@
   product(ccstr, CompileCommandFile, nullptr,                               \
           "Read compiler commands from this file [.hotspot_compiler]")      \
                                                                             \
+  product(ccstr, HotMethodsAtExitFile, nullptr, DIAGNOSTIC,                 \
+          "At exit, write compiler commands that scale the compile "        \
+          "thresholds of all methods compiled at the highest tier by "      \
+          "HotMethodsThresholdScaling to this file, for use with "          \
+          "CompileCommandFile in later runs")                               \
+                                                                            \
+  product(double, HotMethodsThresholdScaling, 0.1, DIAGNOSTIC,              \
+          "CompileThresholdScaling written for each method to "             \
+          "HotMethodsAtExitFile")                                           \
+          range(0.0, DBL_MAX)                                               \
+                                                                            \
   product(ccstr, CompilerDirectivesFile, nullptr, DIAGNOSTIC,               \
           "Read compiler directives from this file")                        \
                                                                             \
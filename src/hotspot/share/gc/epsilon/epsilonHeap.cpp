@@ -24,20 +24,29 @@
  */
 
 #include "precompiled.hpp"
+#include "classfile/classLoaderDataGraph.hpp"
+#include "code/codeCache.hpp"
 #include "gc/epsilon/epsilonHeap.hpp"
 #include "gc/epsilon/epsilonInitLogger.hpp"
 #include "gc/epsilon/epsilonMemoryPool.hpp"
 #include "gc/epsilon/epsilonThreadLocalData.hpp"
 #include "gc/shared/gcArguments.hpp"
 #include "gc/shared/locationPrinter.inline.hpp"
+#include "gc/shared/oopStorageSet.inline.hpp"
+#include "gc/shared/spaceDecorator.hpp"
+#include "gc/shared/weakProcessor.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
 #include "memory/allocation.inline.hpp"
+#include "memory/iterator.inline.hpp"
 #include "memory/metaspaceUtils.hpp"
 #include "memory/resourceArea.hpp"
 #include "memory/universe.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "runtime/threads.hpp"
+#include "runtime/vmOperations.hpp"
+#include "runtime/vmThread.hpp"
 
 jint EpsilonHeap::initialize() {
   size_t align = HeapAlignment;
@@ -298,6 +307,127 @@ void EpsilonHeap::object_iterate(ObjectClosure *cl) {
   _space->object_iterate(cl);
 }
 
+// Finds references into the part of the heap that is about to be discarded.
+class EpsilonFindRefsIntoClosure : public BasicOopIterateClosure {
+  const MemRegion _region;
+  const char* _kind;
+  size_t _found;
+
+  template <class T>
+  void do_oop_work(T* p) {
+    oop obj = RawAccess<>::oop_load(p);
+    if (obj != nullptr && _region.contains(obj)) {
+      if (_found == 0) {
+        log_warning(gc)("Heap reset refused: %s reference at " PTR_FORMAT " points into the discarded part of the heap: " PTR_FORMAT,
+                        _kind, p2i(p), p2i(obj));
+      }
+      _found++;
+    }
+  }
+
+public:
+  EpsilonFindRefsIntoClosure(MemRegion region) :
+    _region(region), _kind(nullptr), _found(0) {}
+
+  void set_kind(const char* kind) { _kind = kind; }
+  size_t found() const { return _found; }
+
+  virtual void do_oop(oop* p)       { do_oop_work(p); }
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+};
+
+class EpsilonIsOutsideClosure : public BoolObjectClosure {
+  const MemRegion _region;
+public:
+  EpsilonIsOutsideClosure(MemRegion region) : _region(region) {}
+  bool do_object_b(oop obj) { return !_region.contains(obj); }
+};
+
+class VM_EpsilonResetHeap : public VM_Operation {
+  HeapWord* const _watermark;
+  bool _result;
+public:
+  VM_EpsilonResetHeap(HeapWord* watermark) :
+    _watermark(watermark), _result(false) {}
+
+  VMOp_Type type() const { return VMOp_EpsilonResetHeap; }
+  void doit() { _result = EpsilonHeap::heap()->reset_to_watermark_at_safepoint(_watermark); }
+  bool result() const { return _result; }
+};
+
+bool EpsilonHeap::reset_to_watermark(HeapWord* watermark) {
+  if (!EpsilonAllowHeapReset) {
+    log_warning(gc)("Heap reset refused: EpsilonAllowHeapReset is not enabled");
+    return false;
+  }
+  VM_EpsilonResetHeap op(watermark);
+  VMThread::execute(&op);
+  return op.result();
+}
+
+bool EpsilonHeap::reset_to_watermark_at_safepoint(HeapWord* watermark) {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at safepoint");
+
+  HeapWord* const bottom = _space->bottom();
+  HeapWord* const top = _space->top();
+  if (watermark < bottom || watermark > top || !is_object_aligned(watermark)) {
+    log_warning(gc)("Heap reset refused: watermark " PTR_FORMAT " is not in the allocated part of the heap [" PTR_FORMAT ", " PTR_FORMAT ")",
+                    p2i(watermark), p2i(bottom), p2i(top));
+    return false;
+  }
+
+  // Retire all TLABs: the heap has to be parsable below the watermark, and no
+  // thread may keep allocating into memory that is about to be discarded.
+  ensure_parsability(true);
+
+  const MemRegion discarded(watermark, top);
+  if (discarded.is_empty()) {
+    return true;
+  }
+
+  // Everything that survives the reset must not refer into the discarded part.
+  EpsilonFindRefsIntoClosure cl(discarded);
+  CodeBlobToOopClosure blobs(&cl, !CodeBlobToOopClosure::FixRelocations);
+  CLDToOopClosure clds(&cl, ClassLoaderData::_claim_none);
+
+  cl.set_kind("thread");
+  Threads::oops_do(&cl, nullptr);
+  cl.set_kind("strong root");
+  OopStorageSet::strong_oops_do(&cl);
+  cl.set_kind("class loader data");
+  ClassLoaderDataGraph::cld_do(&clds);
+  cl.set_kind("code cache");
+  CodeCache::blobs_do(&blobs);
+  cl.set_kind("heap");
+  for (HeapWord* cur = bottom; cur < watermark; ) {
+    oop obj = cast_to_oop(cur);
+    obj->oop_iterate(&cl);
+    cur += obj->size();
+  }
+
+  if (cl.found() > 0) {
+    log_warning(gc)("Heap reset refused: " SIZE_FORMAT " references into the discarded part of the heap", cl.found());
+    return false;
+  }
+
+  // Nothing that survives can reach the discarded objects any more; clear the
+  // weak references to them like a collection would.
+  EpsilonIsOutsideClosure is_alive(discarded);
+  WeakProcessor::weak_oops_do(&is_alive, &do_nothing_cl);
+
+  SpaceMangler::mangle_region(discarded);
+  _space->set_top(watermark);
+
+  size_t used = _space->used();
+  _last_counter_update = MIN2(_last_counter_update, used);
+  _last_heap_print = MIN2(_last_heap_print, used);
+  _monitoring_support->update_counters();
+
+  log_info(gc)("Heap reset discarded " SIZE_FORMAT "%s",
+               byte_size_in_proper_unit(discarded.byte_size()), proper_unit_for_byte_size(discarded.byte_size()));
+  return true;
+}
+
 void EpsilonHeap::print_on(outputStream *st) const {
   st->print_cr("Epsilon Heap");
 
@@ -109,6 +109,14 @@ public:
   // Heap walking support
   void object_iterate(ObjectClosure* cl) override;
 
+  // Heap reset support, enabled by EpsilonAllowHeapReset. A trusted runtime
+  // records the current allocation watermark, and later discards everything
+  // allocated after it. The reset is refused if anything outside the discarded
+  // part of the heap still refers into it; weak references into it are cleared.
+  HeapWord* watermark() const { return _space->top(); }
+  bool reset_to_watermark(HeapWord* watermark);
+  bool reset_to_watermark_at_safepoint(HeapWord* watermark);
+
   // Object pinning support: every object is implicitly pinned
   void pin_object(JavaThread* thread, oop obj) override { }
   void unpin_object(JavaThread* thread, oop obj) override { }
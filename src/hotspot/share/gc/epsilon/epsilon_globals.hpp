@@ -86,7 +86,12 @@
   product(size_t, EpsilonMinHeapExpand, 128 * M, EXPERIMENTAL,              \
           "Min expansion step for heap. Larger value improves performance " \
           "at the potential expense of memory waste.")                      \
-          range(1, max_intx)
+          range(1, max_intx)                                                \
+                                                                            \
+  product(bool, EpsilonAllowHeapReset, false, EXPERIMENTAL,                 \
+          "Allow trusted runtime code to discard all objects allocated "    \
+          "after a saved heap watermark, provided nothing outside the "     \
+          "discarded part of the heap refers into it.")
 
 // end of GC_EPSILON_FLAGS
 
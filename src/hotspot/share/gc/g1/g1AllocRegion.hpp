@@ -273,8 +273,8 @@ public:
 
 class OldGCAllocRegion : public G1GCAllocRegion {
 public:
-  OldGCAllocRegion(G1EvacStats* stats)
-  : G1GCAllocRegion("Old GC Alloc Region", true /* bot_updates */, stats, G1HeapRegionAttr::Old) { }
+  OldGCAllocRegion(G1EvacStats* stats, uint node_index = G1NUMA::AnyNodeIndex)
+  : G1GCAllocRegion("Old GC Alloc Region", true /* bot_updates */, stats, G1HeapRegionAttr::Old, node_index) { }
 };
 
 #endif // SHARE_GC_G1_G1ALLOCREGION_HPP
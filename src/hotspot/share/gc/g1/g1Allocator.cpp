@@ -45,8 +45,9 @@ G1Allocator::G1Allocator(G1CollectedHeap* heap) :
   _num_alloc_regions(_numa->num_active_nodes()),
   _mutator_alloc_regions(nullptr),
   _survivor_gc_alloc_regions(nullptr),
-  _old_gc_alloc_region(heap->alloc_buffer_stats(G1HeapRegionAttr::Old)),
-  _retained_old_gc_alloc_region(nullptr) {
+  _num_old_alloc_regions(G1NUMAPreserveOldNode ? (uint)_num_alloc_regions : 1),
+  _old_gc_alloc_regions(nullptr),
+  _retained_old_gc_alloc_regions(nullptr) {
 
   _mutator_alloc_regions = NEW_C_HEAP_ARRAY(MutatorAllocRegion, _num_alloc_regions, mtGC);
   _survivor_gc_alloc_regions = NEW_C_HEAP_ARRAY(SurvivorGCAllocRegion, _num_alloc_regions, mtGC);
@@ -56,6 +57,17 @@ G1Allocator::G1Allocator(G1CollectedHeap* heap) :
     ::new(_mutator_alloc_regions + i) MutatorAllocRegion(i);
     ::new(_survivor_gc_alloc_regions + i) SurvivorGCAllocRegion(stat, i);
   }
+
+  _old_gc_alloc_regions = NEW_C_HEAP_ARRAY(OldGCAllocRegion, _num_old_alloc_regions, mtGC);
+  _retained_old_gc_alloc_regions = NEW_C_HEAP_ARRAY(HeapRegion*, _num_old_alloc_regions, mtGC);
+  G1EvacStats* old_stat = heap->alloc_buffer_stats(G1HeapRegionAttr::Old);
+
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    // A single old alloc region takes regions from any node.
+    uint node_index = _num_old_alloc_regions == 1 ? G1NUMA::AnyNodeIndex : i;
+    ::new(_old_gc_alloc_regions + i) OldGCAllocRegion(old_stat, node_index);
+    _retained_old_gc_alloc_regions[i] = nullptr;
+  }
 }
 
 G1Allocator::~G1Allocator() {
@@ -63,8 +75,13 @@ G1Allocator::~G1Allocator() {
     _mutator_alloc_regions[i].~MutatorAllocRegion();
     _survivor_gc_alloc_regions[i].~SurvivorGCAllocRegion();
   }
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    _old_gc_alloc_regions[i].~OldGCAllocRegion();
+  }
   FREE_C_HEAP_ARRAY(MutatorAllocRegion, _mutator_alloc_regions);
   FREE_C_HEAP_ARRAY(SurvivorGCAllocRegion, _survivor_gc_alloc_regions);
+  FREE_C_HEAP_ARRAY(OldGCAllocRegion, _old_gc_alloc_regions);
+  FREE_C_HEAP_ARRAY(HeapRegion*, _retained_old_gc_alloc_regions);
 }
 
 #ifdef ASSERT
@@ -89,7 +106,12 @@ void G1Allocator::release_mutator_alloc_regions() {
 }
 
 bool G1Allocator::is_retained_old_region(HeapRegion* hr) {
-  return _retained_old_gc_alloc_region == hr;
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    if (_retained_old_gc_alloc_regions[i] == hr) {
+      return true;
+    }
+  }
+  return false;
 }
 
 void G1Allocator::reuse_retained_old_region(G1EvacInfo* evacuation_info,
@@ -119,7 +141,7 @@ void G1Allocator::reuse_retained_old_region(G1EvacInfo* evacuation_info,
     _g1h->old_set_remove(retained_region);
     old->set(retained_region);
     _g1h->hr_printer()->reuse(retained_region);
-    evacuation_info->set_alloc_regions_used_before(retained_region->used());
+    evacuation_info->add_alloc_regions_used_before(retained_region->used());
   }
 }
 
@@ -133,10 +155,12 @@ void G1Allocator::init_gc_alloc_regions(G1EvacInfo* evacuation_info) {
     survivor_gc_alloc_region(i)->init();
   }
 
-  _old_gc_alloc_region.init();
-  reuse_retained_old_region(evacuation_info,
-                            &_old_gc_alloc_region,
-                            &_retained_old_gc_alloc_region);
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    _old_gc_alloc_regions[i].init();
+    reuse_retained_old_region(evacuation_info,
+                              &_old_gc_alloc_regions[i],
+                              &_retained_old_gc_alloc_regions[i]);
+  }
 }
 
 void G1Allocator::release_gc_alloc_regions(G1EvacInfo* evacuation_info) {
@@ -145,23 +169,29 @@ void G1Allocator::release_gc_alloc_regions(G1EvacInfo* evacuation_info) {
     survivor_region_count += survivor_gc_alloc_region(node_index)->count();
     survivor_gc_alloc_region(node_index)->release();
   }
-  evacuation_info->set_allocation_regions(survivor_region_count +
-                                          old_gc_alloc_region()->count());
+  uint old_region_count = 0;
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    old_region_count += _old_gc_alloc_regions[i].count();
+  }
+  evacuation_info->set_allocation_regions(survivor_region_count + old_region_count);
 
   // If we have an old GC alloc region to release, we'll save it in
-  // _retained_old_gc_alloc_region. If we don't
-  // _retained_old_gc_alloc_region will become null. This is what we
-  // want either way so no reason to check explicitly for either
-  // condition.
-  _retained_old_gc_alloc_region = old_gc_alloc_region()->release();
+  // _retained_old_gc_alloc_regions. If we don't the entry will become
+  // null. This is what we want either way so no reason to check
+  // explicitly for either condition.
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    _retained_old_gc_alloc_regions[i] = _old_gc_alloc_regions[i].release();
+  }
 }
 
 void G1Allocator::abandon_gc_alloc_regions() {
   for (uint i = 0; i < _num_alloc_regions; i++) {
     assert(survivor_gc_alloc_region(i)->get() == nullptr, "pre-condition");
   }
-  assert(old_gc_alloc_region()->get() == nullptr, "pre-condition");
-  _retained_old_gc_alloc_region = nullptr;
+  for (uint i = 0; i < _num_old_alloc_regions; i++) {
+    assert(_old_gc_alloc_regions[i].get() == nullptr, "pre-condition");
+    _retained_old_gc_alloc_regions[i] = nullptr;
+  }
 }
 
 bool G1Allocator::survivor_is_full() const {
@@ -231,7 +261,7 @@ HeapWord* G1Allocator::par_allocate_during_gc(G1HeapRegionAttr dest,
     case G1HeapRegionAttr::Young:
       return survivor_attempt_allocation(min_word_size, desired_word_size, actual_word_size, node_index);
     case G1HeapRegionAttr::Old:
-      return old_attempt_allocation(min_word_size, desired_word_size, actual_word_size);
+      return old_attempt_allocation(min_word_size, desired_word_size, actual_word_size, node_index);
     default:
       ShouldNotReachHere();
       return nullptr; // Keep some compilers happy
@@ -270,11 +300,12 @@ HeapWord* G1Allocator::survivor_attempt_allocation(size_t min_word_size,
 
 HeapWord* G1Allocator::old_attempt_allocation(size_t min_word_size,
                                               size_t desired_word_size,
-                                              size_t* actual_word_size) {
+                                              size_t* actual_word_size,
+                                              uint node_index) {
   assert(!_g1h->is_humongous(desired_word_size),
          "we should not be seeing humongous-size allocations in this path");
 
-  HeapWord* result = old_gc_alloc_region()->attempt_allocation(min_word_size,
+  HeapWord* result = old_gc_alloc_region(node_index)->attempt_allocation(min_word_size,
                                                                desired_word_size,
                                                                actual_word_size);
   if (result == nullptr && !old_is_full()) {
@@ -283,9 +314,9 @@ HeapWord* G1Allocator::old_attempt_allocation(size_t min_word_size,
     // actually is still memory available. Redo the check under the lock to avoid unnecessary work;
     // the memory may have been used up as the threads waited to acquire the lock.
     if (!old_is_full()) {
-      result = old_gc_alloc_region()->attempt_allocation_locked(min_word_size,
-                                                                desired_word_size,
-                                                                actual_word_size);
+      result = old_gc_alloc_region(node_index)->attempt_allocation_locked(min_word_size,
+                                                                          desired_word_size,
+                                                                          actual_word_size);
       if (result == nullptr) {
         set_old_full();
       }
@@ -45,8 +45,16 @@ inline SurvivorGCAllocRegion* G1Allocator::survivor_gc_alloc_region(uint node_in
   return &_survivor_gc_alloc_regions[node_index];
 }
 
-inline OldGCAllocRegion* G1Allocator::old_gc_alloc_region() {
-  return &_old_gc_alloc_region;
+inline uint G1Allocator::old_alloc_region_index(uint node_index) const {
+  if (_num_old_alloc_regions == 1) {
+    return 0;
+  }
+  assert(node_index < _num_old_alloc_regions, "Invalid index: %u", node_index);
+  return node_index;
+}
+
+inline OldGCAllocRegion* G1Allocator::old_gc_alloc_region(uint node_index) {
+  return &_old_gc_alloc_regions[old_alloc_region_index(node_index)];
 }
 
 inline HeapWord* G1Allocator::attempt_allocation(size_t min_word_size,
@@ -93,7 +101,7 @@ inline PLAB* G1PLABAllocator::alloc_buffer(region_type_t dest, uint node_index)
            "Allocation buffer index out of bounds: %u, %u", dest, node_index);
     return _dest_data[dest]._alloc_buffer[node_index];
   } else {
-    return _dest_data[dest]._alloc_buffer[0];
+    return _dest_data[dest]._alloc_buffer[_allocator->old_alloc_region_index(node_index)];
   }
 }
 
@@ -101,7 +109,7 @@ inline uint G1PLABAllocator::alloc_buffers_length(region_type_t dest) const {
   if (dest == G1HeapRegionAttr::Young) {
     return _allocator->num_nodes();
   } else {
-    return 1;
+    return _allocator->num_old_alloc_regions();
   }
 }
 
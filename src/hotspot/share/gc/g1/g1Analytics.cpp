@@ -81,6 +81,9 @@ G1Analytics::G1Analytics(const G1Predictions* predictor) :
     _cost_per_card_scan_ms_seq(TruncatedSeqLength),
     _cost_per_card_merge_ms_seq(TruncatedSeqLength),
     _cost_per_byte_copied_ms_seq(TruncatedSeqLength),
+    _card_merge_time_ms_reg_seq(TruncatedSeqLength),
+    _card_scan_time_ms_reg_seq(TruncatedSeqLength),
+    _object_copy_time_ms_reg_seq(TruncatedSeqLength),
     _pending_cards_seq(TruncatedSeqLength),
     _rs_length_seq(TruncatedSeqLength),
     _constant_other_time_ms_seq(TruncatedSeqLength),
@@ -194,6 +197,16 @@ void G1Analytics::report_cost_per_byte_ms(double cost_per_byte_ms, bool for_youn
   _cost_per_byte_copied_ms_seq.add(cost_per_byte_ms, for_young_only_phase);
 }
 
+void G1Analytics::report_work_time_ms(WorkKind kind, size_t amount, double time_ms, bool for_young_only_phase) {
+  switch (kind) {
+    case WorkKind::MergeCards:  _card_merge_time_ms_reg_seq.add(amount, time_ms, for_young_only_phase); break;
+    case WorkKind::ScanCards:   _card_scan_time_ms_reg_seq.add(amount, time_ms, for_young_only_phase); break;
+    case WorkKind::CopyObjects: _object_copy_time_ms_reg_seq.add(amount, time_ms, for_young_only_phase); break;
+    default:
+      ShouldNotReachHere();
+  }
+}
+
 void G1Analytics::report_young_other_cost_per_region_ms(double other_cost_per_region_ms) {
   _young_other_cost_per_region_ms_seq.add(other_cost_per_region_ms);
 }
@@ -238,16 +251,74 @@ size_t G1Analytics::predict_scan_card_num(size_t rs_length, bool for_young_only_
   return rs_length * predict_in_unit_interval(&_card_scan_to_merge_ratio_seq, for_young_only_phase);
 }
 
+const char* G1Analytics::work_kind_to_string(WorkKind kind) {
+  switch (kind) {
+    case WorkKind::MergeCards:  return "Merge Cards";
+    case WorkKind::ScanCards:   return "Scan Cards";
+    case WorkKind::CopyObjects: return "Copy Objects";
+    default:
+      ShouldNotReachHere();
+      return "";
+  }
+}
+
+G1Analytics::CostModel G1Analytics::cost_model() {
+  return G1UseRegressionPausePrediction ? CostModel::Regression : CostModel::AverageCostPerUnit;
+}
+
+const G1PhaseDependentSeq* G1Analytics::cost_per_unit_seq(WorkKind kind) const {
+  switch (kind) {
+    case WorkKind::MergeCards:  return &_cost_per_card_merge_ms_seq;
+    case WorkKind::ScanCards:   return &_cost_per_card_scan_ms_seq;
+    case WorkKind::CopyObjects: return &_cost_per_byte_copied_ms_seq;
+    default:
+      ShouldNotReachHere();
+      return nullptr;
+  }
+}
+
+const G1PhaseDependentRegressionSeq* G1Analytics::regression_seq(WorkKind kind) const {
+  switch (kind) {
+    case WorkKind::MergeCards:  return &_card_merge_time_ms_reg_seq;
+    case WorkKind::ScanCards:   return &_card_scan_time_ms_reg_seq;
+    case WorkKind::CopyObjects: return &_object_copy_time_ms_reg_seq;
+    default:
+      ShouldNotReachHere();
+      return nullptr;
+  }
+}
+
+bool G1Analytics::has_regression_model(WorkKind kind, bool for_young_only_phase) const {
+  return regression_seq(kind)->has_model(for_young_only_phase);
+}
+
+double G1Analytics::predict_work_time_ms(WorkKind kind, size_t amount, bool for_young_only_phase, CostModel model) const {
+  if (model == CostModel::Regression && has_regression_model(kind, for_young_only_phase)) {
+    // Use the upper bound of the slope so that predictions for parts of the work
+    // can be summed up without adding the fixed cost multiple times.
+    return amount * regression_seq(kind)->predict_slope(_predictor, for_young_only_phase);
+  }
+  return amount * predict_zero_bounded(cost_per_unit_seq(kind), for_young_only_phase);
+}
+
+double G1Analytics::predict_fixed_work_time_ms(WorkKind kind, bool for_young_only_phase, CostModel model) const {
+  if (model == CostModel::Regression && has_regression_model(kind, for_young_only_phase)) {
+    return MAX2(regression_seq(kind)->predict_intercept(for_young_only_phase), 0.0);
+  }
+  // The average cost per unit includes the fixed cost.
+  return 0.0;
+}
+
 double G1Analytics::predict_card_merge_time_ms(size_t card_num, bool for_young_only_phase) const {
-  return card_num * predict_zero_bounded(&_cost_per_card_merge_ms_seq, for_young_only_phase);
+  return predict_work_time_ms(WorkKind::MergeCards, card_num, for_young_only_phase);
 }
 
 double G1Analytics::predict_card_scan_time_ms(size_t card_num, bool for_young_only_phase) const {
-  return card_num * predict_zero_bounded(&_cost_per_card_scan_ms_seq, for_young_only_phase);
+  return predict_work_time_ms(WorkKind::ScanCards, card_num, for_young_only_phase);
 }
 
 double G1Analytics::predict_object_copy_time_ms(size_t bytes_to_copy, bool for_young_only_phase) const {
-  return bytes_to_copy * predict_zero_bounded(&_cost_per_byte_copied_ms_seq, for_young_only_phase);
+  return predict_work_time_ms(WorkKind::CopyObjects, bytes_to_copy, for_young_only_phase);
 }
 
 double G1Analytics::predict_constant_other_time_ms() const {
@@ -33,6 +33,25 @@ class TruncatedSeq;
 class G1Predictions;
 
 class G1Analytics: public CHeapObj<mtGC> {
+public:
+  // Kinds of pause work whose time is predicted from the amount of work.
+  enum class WorkKind : uint {
+    MergeCards,         // Merging remembered sets and log buffers, in cards.
+    ScanCards,          // Scanning the heap roots, in cards.
+    CopyObjects,        // Evacuating objects, in bytes.
+    NumKinds
+  };
+  static const char* work_kind_to_string(WorkKind kind);
+
+  // How the time for pause work is predicted from the amount of work.
+  enum class CostModel : uint {
+    AverageCostPerUnit, // Average cost per card or byte of recent pauses.
+    Regression          // Linear regression with fixed cost over recent pauses.
+  };
+  // The cost model used for pause time predictions.
+  static CostModel cost_model();
+
+private:
   const static int TruncatedSeqLength = 10;
   const static int NumPrevPausesForHeuristics = 10;
   const G1Predictions* _predictor;
@@ -60,6 +79,14 @@ class G1Analytics: public CHeapObj<mtGC> {
   // The cost to copy a byte in ms.
   G1PhaseDependentSeq _cost_per_byte_copied_ms_seq;
 
+  // Time versus amount of work for every WorkKind, for the Regression cost model.
+  G1PhaseDependentRegressionSeq _card_merge_time_ms_reg_seq;
+  G1PhaseDependentRegressionSeq _card_scan_time_ms_reg_seq;
+  G1PhaseDependentRegressionSeq _object_copy_time_ms_reg_seq;
+
+  const G1PhaseDependentSeq* cost_per_unit_seq(WorkKind kind) const;
+  const G1PhaseDependentRegressionSeq* regression_seq(WorkKind kind) const;
+
   G1PhaseDependentSeq _pending_cards_seq;
   G1PhaseDependentSeq _rs_length_seq;
 
@@ -135,6 +162,8 @@ public:
   void report_constant_other_time_ms(double constant_other_time_ms);
   void report_pending_cards(double pending_cards, bool for_young_only_phase);
   void report_rs_length(double rs_length, bool for_young_only_phase);
+  // Record the total time taken for the given amount of work in a pause.
+  void report_work_time_ms(WorkKind kind, size_t amount, double time_ms, bool for_young_only_phase);
 
   double predict_alloc_rate_ms() const;
   int num_alloc_rate_ms() const;
@@ -147,6 +176,18 @@ public:
   // the number of total cards scanned.
   size_t predict_scan_card_num(size_t rs_length, bool for_young_only_phase) const;
 
+  // Predict the time for the given amount of work of the given kind, not
+  // including the fixed cost of that kind of work during a pause. Falls back to
+  // the AverageCostPerUnit model if there is no regression model yet.
+  double predict_work_time_ms(WorkKind kind, size_t amount, bool for_young_only_phase,
+                              CostModel model = cost_model()) const;
+  // Predict the time for the given kind of work during a pause that does not
+  // depend on the amount of work.
+  double predict_fixed_work_time_ms(WorkKind kind, bool for_young_only_phase,
+                                    CostModel model = cost_model()) const;
+  // Returns whether there is a regression model for the given kind of work.
+  bool has_regression_model(WorkKind kind, bool for_young_only_phase) const;
+
   double predict_card_merge_time_ms(size_t card_num, bool for_young_only_phase) const;
   double predict_card_scan_time_ms(size_t card_num, bool for_young_only_phase) const;
 
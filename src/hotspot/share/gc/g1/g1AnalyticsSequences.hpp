@@ -25,6 +25,7 @@
 #ifndef SHARE_GC_G1_G1ANALYTICSSEQUENCES_HPP
 #define SHARE_GC_G1_G1ANALYTICSSEQUENCES_HPP
 
+#include "gc/g1/g1LinearRegressionSeq.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/numberSeq.hpp"
 
@@ -52,5 +53,24 @@ public:
   double predict(const G1Predictions* predictor, bool use_young_only_phase_seq) const;
 };
 
+// Container for G1LinearRegressionSeqs that need separate models by GC phase.
+class G1PhaseDependentRegressionSeq {
+  G1LinearRegressionSeq _young_only_seq;
+  G1LinearRegressionSeq _mixed_seq;
+
+  NONCOPYABLE(G1PhaseDependentRegressionSeq);
+
+  const G1LinearRegressionSeq* seq_for(bool use_young_only_phase_seq) const;
+public:
+
+  G1PhaseDependentRegressionSeq(uint length);
+
+  void add(double x, double y, bool for_young_only_phase);
+
+  bool has_model(bool use_young_only_phase_seq) const;
+  double predict_slope(const G1Predictions* predictor, bool use_young_only_phase_seq) const;
+  double predict_intercept(bool use_young_only_phase_seq) const;
+};
+
 #endif /* SHARE_GC_G1_G1ANALYTICSSEQUENCES_HPP */
 
@@ -57,5 +57,38 @@ double G1PhaseDependentSeq::predict(const G1Predictions* predictor, bool use_you
   }
 }
 
+G1PhaseDependentRegressionSeq::G1PhaseDependentRegressionSeq(uint length) :
+  _young_only_seq(length),
+  _mixed_seq(length)
+{ }
+
+const G1LinearRegressionSeq* G1PhaseDependentRegressionSeq::seq_for(bool use_young_only_phase_seq) const {
+  if (use_young_only_phase_seq || !_mixed_seq.has_model()) {
+    return &_young_only_seq;
+  } else {
+    return &_mixed_seq;
+  }
+}
+
+void G1PhaseDependentRegressionSeq::add(double x, double y, bool for_young_only_phase) {
+  if (for_young_only_phase) {
+    _young_only_seq.add(x, y);
+  } else {
+    _mixed_seq.add(x, y);
+  }
+}
+
+bool G1PhaseDependentRegressionSeq::has_model(bool use_young_only_phase_seq) const {
+  return seq_for(use_young_only_phase_seq)->has_model();
+}
+
+double G1PhaseDependentRegressionSeq::predict_slope(const G1Predictions* predictor, bool use_young_only_phase_seq) const {
+  return seq_for(use_young_only_phase_seq)->predict_slope(predictor);
+}
+
+double G1PhaseDependentRegressionSeq::predict_intercept(bool use_young_only_phase_seq) const {
+  return seq_for(use_young_only_phase_seq)->predict_intercept();
+}
+
 #endif /* SHARE_GC_G1_G1ANALYTICSSEQUENCES_INLINE_HPP */
 
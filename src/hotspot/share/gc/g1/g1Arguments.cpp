@@ -34,6 +34,7 @@
 #include "gc/shared/cardTable.hpp"
 #include "gc/shared/gcArguments.hpp"
 #include "gc/shared/workerPolicy.hpp"
+#include "logging/log.hpp"
 #include "runtime/globals.hpp"
 #include "runtime/globals_extension.hpp"
 #include "runtime/java.hpp"
@@ -44,6 +45,49 @@ static size_t calculate_heap_alignment(size_t space_alignment) {
   return MAX3(card_table_alignment, space_alignment, page_size);
 }
 
+// The heap size the ergonomic region size selection is based on.
+static size_t region_size_selection_heap_size() {
+  if (G1ExpectedMaxWorkingSetSize == 0) {
+    return MaxHeapSize;
+  }
+  return MIN2(G1ExpectedMaxWorkingSetSize, MaxHeapSize);
+}
+
+void G1Arguments::log_region_size_selection(bool ergonomic, size_t selection_heap_size) {
+  LogTarget(Debug, gc, ergo, heap) lt;
+  if (!lt.is_enabled()) {
+    return;
+  }
+
+  size_t const max_regions = MaxHeapSize / HeapRegion::GrainBytes;
+  if (ergonomic) {
+    lt.print("Region size " SIZE_FORMAT "%s based on " SIZE_FORMAT "%s %s: " SIZE_FORMAT " regions at maximum heap size",
+             byte_size_in_proper_unit(HeapRegion::GrainBytes), proper_unit_for_byte_size(HeapRegion::GrainBytes),
+             byte_size_in_proper_unit(selection_heap_size), proper_unit_for_byte_size(selection_heap_size),
+             G1ExpectedMaxWorkingSetSize != 0 ? "expected maximum working set" : "maximum heap size",
+             max_regions);
+  } else {
+    lt.print("Region size " SIZE_FORMAT "%s set by G1HeapRegionSize: " SIZE_FORMAT " regions at maximum heap size",
+             byte_size_in_proper_unit(HeapRegion::GrainBytes), proper_unit_for_byte_size(HeapRegion::GrainBytes),
+             max_regions);
+  }
+
+  // Project the remembered set memory per region for this region size: a
+  // remembered set has at most one container for every card region of every
+  // other region, using at most a Howl container of Howl Bitmaps each before
+  // being coarsened to Full.
+  G1CardSetConfiguration config;
+  size_t const array_size = G1CardSetArray::size_in_bytes(config.max_cards_in_array());
+  size_t const bitmap_size = G1CardSetBitMap::size_in_bytes(config.max_cards_in_howl_bitmap());
+  size_t const howl_size = G1CardSetHowl::size_in_bytes(config.num_buckets_in_howl());
+  size_t const card_regions = (max_regions - 1) << config.log2_card_regions_per_heap_region();
+  size_t const max_remset_size = card_regions * (howl_size + config.num_buckets_in_howl() * bitmap_size);
+  lt.print("Projected remembered set container sizes: Array of Cards " SIZE_FORMAT "B Howl " SIZE_FORMAT "B Howl Bitmap " SIZE_FORMAT "B, "
+           "up to " SIZE_FORMAT "%s per remembered set before coarsening to Full",
+           array_size, howl_size, bitmap_size,
+           byte_size_in_proper_unit(max_remset_size), proper_unit_for_byte_size(max_remset_size));
+}
+
 void G1Arguments::initialize_alignments() {
   // Initialize card size before initializing alignments
   CardTable::initialize_card_size();
@@ -53,7 +97,9 @@ void G1Arguments::initialize_alignments() {
   // There is a circular dependency here. We base the region size on the heap
   // size, but the heap size should be aligned with the region size. To get
   // around this we use the unaligned values for the heap.
-  HeapRegion::setup_heap_region_size(MaxHeapSize);
+  bool const ergonomic_region_size = (G1HeapRegionSize == 0);
+  size_t const selection_heap_size = region_size_selection_heap_size();
+  HeapRegion::setup_heap_region_size(selection_heap_size);
 
   SpaceAlignment = HeapRegion::GrainBytes;
   HeapAlignment = calculate_heap_alignment(SpaceAlignment);
@@ -66,6 +112,8 @@ void G1Arguments::initialize_alignments() {
   if (FLAG_IS_DEFAULT(G1EagerReclaimRemSetThreshold)) {
     FLAG_SET_ERGO(G1EagerReclaimRemSetThreshold, G1RemSetArrayOfCardsEntries);
   }
+
+  log_region_size_selection(ergonomic_region_size, selection_heap_size);
 }
 
 size_t G1Arguments::conservative_max_heap_alignment() {
@@ -35,6 +35,7 @@ class G1Arguments : public GCArguments {
 
   static void initialize_mark_stack_size();
   static void initialize_card_set_configuration();
+  static void log_region_size_selection(bool ergonomic, size_t selection_heap_size);
   static void initialize_verification_types();
   static void parse_verification_type(const char* type);
 
@@ -53,6 +53,23 @@ public:
 
 using CardSetHash = ConcurrentHashTable<G1CardSetHashTableConfig, mtGCCardSet>;
 
+// Runs of cards containers are allocated from the Howl memory objects, so they
+// are only worth using if Howl memory objects are smaller than bitmaps, and can
+// hold a reasonable number of runs.
+static uint default_max_runs_in_howl_runs(uint num_buckets_in_howl, uint max_cards_in_howl_bitmap) {
+  const uint MinRunsInHowlRuns = 4;
+
+  if (!G1RemSetUseHowlRuns) {
+    return 0;
+  }
+  size_t mem_object_size = G1CardSetHowl::size_in_bytes(num_buckets_in_howl);
+  if (mem_object_size >= G1CardSetBitMap::size_in_bytes(max_cards_in_howl_bitmap)) {
+    return 0;
+  }
+  uint max_runs = G1CardSetRuns::max_runs_in(mem_object_size);
+  return max_runs >= MinRunsInHowlRuns ? max_runs : 0;
+}
+
 static uint default_log2_card_regions_per_region() {
   uint log2_card_regions_per_heap_region = 0;
 
@@ -112,7 +129,8 @@ G1CardSetConfiguration::G1CardSetConfiguration(uint inline_ptr_bits_per_card,
   _log2_max_cards_in_howl_bitmap(log2i_exact(_max_cards_in_howl_bitmap)),
   _bitmap_hash_mask(~(~(0) << _log2_max_cards_in_howl_bitmap)),
   _log2_card_regions_per_heap_region(log2_card_regions_per_heap_region),
-  _log2_cards_per_card_region(log2i_exact(_max_cards_in_card_set)) {
+  _log2_cards_per_card_region(log2i_exact(_max_cards_in_card_set)),
+  _max_runs_in_howl_runs(default_max_runs_in_howl_runs(_num_buckets_in_howl, _max_cards_in_howl_bitmap)) {
 
   assert(_inline_ptr_bits_per_card <= G1CardSetContainer::LogCardsPerRegionLimit,
          "inline_ptr_bits_per_card (%u) is wasteful, can represent more than maximum possible card indexes (%u)",
@@ -164,11 +182,13 @@ void G1CardSetConfiguration::log_configuration() {
                           "Array Of Cards #cards %u size %zu "
                           "Howl #buckets %u coarsen threshold %u "
                           "Howl Bitmap #cards %u size %zu coarsen threshold %u "
+                          "Howl Runs #runs %u "
                           "Card regions per heap region %u cards per card region %u",
                           max_cards_in_inline_ptr(), sizeof(void*),
                           max_cards_in_array(), G1CardSetArray::size_in_bytes(max_cards_in_array()),
                           num_buckets_in_howl(), cards_in_howl_threshold(),
                           max_cards_in_howl_bitmap(), G1CardSetBitMap::size_in_bytes(max_cards_in_howl_bitmap()), cards_in_howl_bitmap_threshold(),
+                          max_runs_in_howl_runs(),
                           (uint)1 << log2_card_regions_per_heap_region(),
                           max_cards_in_region());
 }
@@ -227,15 +247,17 @@ void G1CardSetCoarsenStats::print_on(outputStream* out) {
                 "AoC->Howl %zu (%zu) "
                 "Howl->Full %zu (%zu) "
                 "Inline->AoC %zu (%zu) "
-                "AoC->BitMap %zu (%zu) "
-                "BitMap->Full %zu (%zu) ",
+                "AoC->BitMap/Runs %zu (%zu) "
+                "BitMap->Full %zu (%zu) "
+                "Runs->BitMap %zu (%zu) ",
                 _coarsen_from[0], _coarsen_collision[0],
                 _coarsen_from[1], _coarsen_collision[1],
                 // There is no BitMap at the first level so we can't .
                 _coarsen_from[3], _coarsen_collision[3],
                 _coarsen_from[4], _coarsen_collision[4],
                 _coarsen_from[5], _coarsen_collision[5],
-                _coarsen_from[6], _coarsen_collision[6]
+                _coarsen_from[6], _coarsen_collision[6],
+                _coarsen_from[7], _coarsen_collision[7]
                );
 }
 
@@ -541,7 +563,7 @@ G1AddCardResult G1CardSet::add_to_howl(ContainerPtr parent_container,
     }
 
     container = acquire_container(bucket_entry);
-    add_result = add_to_container(bucket_entry, container, card_region, card_in_region);
+    add_result = add_to_container(bucket_entry, container, card_region, card_in_region, true /* increment_total */, true /* within_howl */);
 
     if (add_result != Overflow) {
       break;
@@ -577,22 +599,60 @@ G1AddCardResult G1CardSet::add_to_bitmap(ContainerPtr container, uint card_in_re
   return bitmap->add(card_offset, _config->cards_in_howl_bitmap_threshold(), _config->max_cards_in_howl_bitmap());
 }
 
+G1AddCardResult G1CardSet::add_to_runs(ContainerPtr container, uint card_in_region) {
+  G1CardSetRuns* runs = container_ptr<G1CardSetRuns>(container);
+  return runs->add(card_in_region);
+}
+
 G1AddCardResult G1CardSet::add_to_inline_ptr(ContainerPtr volatile* container_addr, ContainerPtr container, uint card_in_region) {
   G1CardSetInlinePtr value(container_addr, container);
   return value.add(card_in_region, _config->inline_ptr_bits_per_card(), _config->max_cards_in_inline_ptr());
 }
 
-G1CardSet::ContainerPtr G1CardSet::create_coarsened_array_of_cards(uint card_in_region, bool within_howl) {
-  uint8_t* data = nullptr;
+G1CardSet::ContainerPtr G1CardSet::create_howl_bitmap(uint card_in_region) {
+  uint const size_in_bits = _config->max_cards_in_howl_bitmap();
+  uint container_offset = _config->howl_bitmap_offset(card_in_region);
+  uint8_t* data = allocate_mem_object(ContainerBitMap);
+  new (data) G1CardSetBitMap(container_offset, size_in_bits);
+  return make_container_ptr(data, ContainerBitMap);
+}
+
+G1CardSet::ContainerPtr G1CardSet::create_howl_runs(uint card_in_region) {
+  uint const size = _config->max_runs_in_howl_runs();
+  uint8_t* data = allocate_mem_object(ContainerRuns);
+  new (data) G1CardSetRuns(card_in_region, size);
+  return make_container_ptr(data, ContainerRuns);
+}
+
+bool G1CardSet::should_coarsen_to_runs(ContainerPtr array_container) const {
+  if (_config->max_runs_in_howl_runs() == 0) {
+    return false;
+  }
+  // Count the number of runs the cards in the array form, assuming that the new card
+  // starts another one. The array is full, so its contents do not change any more.
+  G1CardSetArray* array = container_ptr<G1CardSetArray>(array_container);
+  uint num_runs = 1;
+  auto count_run_starts = [&] (uint card_idx) {
+    if (card_idx == 0 || !array->contains(card_idx - 1)) {
+      num_runs++;
+    }
+  };
+  array->iterate(count_run_starts);
+  // Leave room for runs started by further cards; the transfer may also create
+  // more runs than necessary as runs are not merged.
+  return num_runs <= _config->max_runs_in_howl_runs() / 2;
+}
+
+G1CardSet::ContainerPtr G1CardSet::create_coarsened_array_of_cards(ContainerPtr cur_container, uint card_in_region, bool within_howl) {
   ContainerPtr new_container;
   if (within_howl) {
-    uint const size_in_bits = _config->max_cards_in_howl_bitmap();
-    uint container_offset = _config->howl_bitmap_offset(card_in_region);
-    data = allocate_mem_object(ContainerBitMap);
-    new (data) G1CardSetBitMap(container_offset, size_in_bits);
-    new_container = make_container_ptr(data, ContainerBitMap);
+    if (should_coarsen_to_runs(cur_container)) {
+      new_container = create_howl_runs(card_in_region);
+    } else {
+      new_container = create_howl_bitmap(card_in_region);
+    }
   } else {
-    data = allocate_mem_object(ContainerHowl);
+    uint8_t* data = allocate_mem_object(ContainerHowl);
     new (data) G1CardSetHowl(card_in_region, _config);
     new_container = make_container_ptr(data, ContainerHowl);
   }
@@ -607,7 +667,7 @@ bool G1CardSet::coarsen_container(ContainerPtr volatile* container_addr,
 
   switch (container_type(cur_container)) {
     case ContainerArrayOfCards: {
-      new_container = create_coarsened_array_of_cards(card_in_region, within_howl);
+      new_container = create_coarsened_array_of_cards(cur_container, card_in_region, within_howl);
       break;
     }
     case ContainerBitMap: {
@@ -622,7 +682,12 @@ bool G1CardSet::coarsen_container(ContainerPtr volatile* container_addr,
       break;
     }
     case ContainerHowl: {
-      new_container = FullCardSet; // anything will do at this point.
+      if (within_howl) {
+        // Actually ContainerRuns that ran out of space for runs.
+        new_container = create_howl_bitmap(card_in_region);
+      } else {
+        new_container = FullCardSet; // anything will do at this point.
+      }
       break;
     }
     default:
@@ -639,7 +704,7 @@ bool G1CardSet::coarsen_container(ContainerPtr volatile* container_addr,
     bool should_free = release_container(cur_container);
     assert(!should_free, "must have had more than one reference");
     // Free containers if cur_container is ContainerHowl
-    if (container_type(cur_container) == ContainerHowl) {
+    if (!within_howl && container_type(cur_container) == ContainerHowl) {
       G1ReleaseCardsets rel(this);
       container_ptr<G1CardSetHowl>(cur_container)->iterate(rel, _config->num_buckets_in_howl());
     }
@@ -688,7 +753,8 @@ void G1CardSet::transfer_cards_in_howl(ContainerPtr parent_container,
   // Need to transfer old entries unless there is a Full card set in place now, i.e.
   // the old type has been ContainerBitMap.
   if (container_type(source_container) != ContainerBitMap) {
-    // We only need to transfer from anything below ContainerBitMap.
+    // We only need to transfer from anything below ContainerBitMap, including
+    // ContainerRuns.
     G1TransferCard iter(this, card_region);
     iterate_cards_during_transfer(source_container, iter);
   } else {
@@ -717,7 +783,8 @@ G1AddCardResult G1CardSet::add_to_container(ContainerPtr volatile* container_add
                                             ContainerPtr container,
                                             uint card_region,
                                             uint card_in_region,
-                                            bool increment_total) {
+                                            bool increment_total,
+                                            bool within_howl) {
   assert(container_addr != nullptr, "must be");
 
   G1AddCardResult add_result;
@@ -740,6 +807,11 @@ G1AddCardResult G1CardSet::add_to_container(ContainerPtr volatile* container_add
       if (container == FullCardSet) {
         return Found;
       }
+      if (within_howl) {
+        assert(ContainerRuns == ContainerHowl, "must be");
+        add_result = add_to_runs(container, card_in_region);
+        break;
+      }
       add_result = add_to_howl(container, card_region, card_in_region, increment_total);
       break;
     }
@@ -898,7 +970,7 @@ void G1CardSet::print_info(outputStream* st, uintptr_t card) {
 template <class CardVisitor>
 void G1CardSet::iterate_cards_during_transfer(ContainerPtr const container, CardVisitor& cl) {
   uint type = container_type(container);
-  assert(type == ContainerInlinePtr || type == ContainerArrayOfCards,
+  assert(type == ContainerInlinePtr || type == ContainerArrayOfCards || type == ContainerRuns,
          "invalid card set type %d to transfer from",
          container_type(container));
 
@@ -912,6 +984,10 @@ void G1CardSet::iterate_cards_during_transfer(ContainerPtr const container, Card
       container_ptr<G1CardSetArray>(container)->iterate(cl);
       return;
     }
+    case ContainerRuns: {
+      container_ptr<G1CardSetRuns>(container)->iterate_cards(cl);
+      return;
+    }
     default:
       ShouldNotReachHere();
   }
@@ -948,7 +1024,7 @@ public:
 
   void operator()(uint card_idx, uint length) {
     for (uint i = 0; i < length; i++) {
-      _cl.do_card(_region_idx, card_idx);
+      _cl.do_card(_region_idx, card_idx + i);
     }
   }
 };
@@ -58,6 +58,7 @@ class G1CardSetConfiguration {
   size_t _bitmap_hash_mask;
   uint _log2_card_regions_per_heap_region;
   uint _log2_cards_per_card_region;
+  uint _max_runs_in_howl_runs;
 
   G1CardSetAllocOptions* _card_set_alloc_options;
 
@@ -102,6 +103,10 @@ public:
   uint cards_in_howl_bitmap_threshold() const { return _cards_in_howl_bitmap_threshold; }
   uint log2_max_cards_in_howl_bitmap() const {return _log2_max_cards_in_howl_bitmap;}
 
+  // Runs of cards within Howl card set container configuration
+  // Maximum number of runs in a "Runs of Cards" container; 0 if disabled.
+  uint max_runs_in_howl_runs() const { return _max_runs_in_howl_runs; }
+
   // Howl card set container configuration
   uint num_buckets_in_howl() const { return _num_buckets_in_howl; }
   // Threshold at which to turn howling arrays into Full.
@@ -131,7 +136,9 @@ public:
 
   // Memory object types configuration
   // Number of distinctly sized memory objects on the card set heap.
-  // Currently contains CHT-Nodes, ArrayOfCards, BitMaps, Howl
+  // Currently contains CHT-Nodes, ArrayOfCards, BitMaps, Howl. Runs of Cards
+  // containers are allocated as Howl memory objects: their ContainerPtr type is
+  // the same, and they are sized to fit.
   static constexpr uint num_mem_object_types() { return 4; }
   // Returns the memory allocation options for the memory objects on the card set heap.
   const G1CardSetAllocOptions* mem_object_alloc_options(uint idx);
@@ -147,7 +154,7 @@ public:
   // Number of entries in the statistics tables: since we index with the source
   // container of the coarsening, this is the total number of combinations of
   // card set containers - 1.
-  static constexpr size_t NumCoarsenCategories = 7;
+  static constexpr size_t NumCoarsenCategories = 8;
   // Coarsening statistics for the possible ContainerPtr in the Howl card set
   // start from this offset.
   static constexpr size_t CoarsenHowlOffset = 4;
@@ -179,7 +186,7 @@ public:
 // Technically it is implemented using a ConcurrentHashTable that stores a card
 // set container for every region containing at least one card.
 //
-// There are in total five different containers, encoded in the ConcurrentHashTable
+// There are in total six different containers, encoded in the ConcurrentHashTable
 // node as ContainerPtr. A ContainerPtr may cover the whole region or just a part of
 // it.
 // See its description below for more information.
@@ -218,6 +225,7 @@ public:
   // X...XXX11 howl               This is a card set container containing an array of ContainerPtr, with each ContainerPtr
   //                              limited to a sub-range of the original range. Currently only one level of this
   //                              container is supported.
+  // X...XXX11 runs of cards      Within a howl container only: the container is an array of runs of card indexes.
   //
   // The container's pointer starts off with an inline container and is then subsequently
   // coarsened as more cards are added.
@@ -237,6 +245,15 @@ public:
   //
   //   Free -> ContainerInlinePtr -> ContainerArrayOfCards -> ContainerBitMap -> Full
   //
+  // If enabled by G1RemSetUseHowlRuns, an overflowing ContainerArrayOfCards whose
+  // cards form few enough runs is coarsened into a ContainerRuns instead, which in
+  // turn is coarsened into a ContainerBitMap when running out of space for runs:
+  //
+  //   ... -> ContainerArrayOfCards -> ContainerRuns -> ContainerBitMap -> Full
+  //
+  // Since there are no nested Howl containers, ContainerRuns reuses the encoding of
+  // ContainerHowl within Howl containers.
+  //
   // Throughout the code it is assumed (and checked) that the last two bits of the encoding
   // for Howl (0b11) is assumed to be the same as the last two bits for "FullCardSet"; this
   // has been done in various places to not be required to check for a "FullCardSet" first
@@ -247,6 +264,7 @@ public:
   static const uintptr_t ContainerArrayOfCards   = 0x1;
   static const uintptr_t ContainerBitMap         = 0x2;
   static const uintptr_t ContainerHowl           = 0x3;
+  static const uintptr_t ContainerRuns           = 0x3; // Within ContainerHowl only.
 
   // The special sentinel values
   static constexpr ContainerPtr FreeCardSet = nullptr;
@@ -292,7 +310,12 @@ private:
                          ContainerPtr cur_container,
                          uint card_in_region, bool within_howl = false);
 
-  ContainerPtr create_coarsened_array_of_cards(uint card_in_region, bool within_howl);
+  ContainerPtr create_coarsened_array_of_cards(ContainerPtr cur_container, uint card_in_region, bool within_howl);
+  ContainerPtr create_howl_bitmap(uint card_in_region);
+  ContainerPtr create_howl_runs(uint card_in_region);
+  // Returns whether the cards of the given full ContainerArrayOfCards within a Howl
+  // container form few enough runs to coarsen it to a ContainerRuns.
+  bool should_coarsen_to_runs(ContainerPtr array_container) const;
 
   // Transfer entries from source_card_set to a recently installed coarser storage type
   // We only need to transfer anything finer than ContainerBitMap. "Full" contains
@@ -300,11 +323,13 @@ private:
   void transfer_cards(G1CardSetHashTableValue* table_entry, ContainerPtr source_container, uint card_region);
   void transfer_cards_in_howl(ContainerPtr parent_container, ContainerPtr source_container, uint card_region);
 
-  G1AddCardResult add_to_container(ContainerPtr volatile* container_addr, ContainerPtr container, uint card_region, uint card, bool increment_total = true);
+  G1AddCardResult add_to_container(ContainerPtr volatile* container_addr, ContainerPtr container, uint card_region, uint card,
+                                   bool increment_total = true, bool within_howl = false);
 
   G1AddCardResult add_to_inline_ptr(ContainerPtr volatile* container_addr, ContainerPtr container, uint card_in_region);
   G1AddCardResult add_to_array(ContainerPtr container, uint card_in_region);
   G1AddCardResult add_to_bitmap(ContainerPtr container, uint card_in_region);
+  G1AddCardResult add_to_runs(ContainerPtr container, uint card_in_region);
   G1AddCardResult add_to_howl(ContainerPtr parent_container, uint card_region, uint card_in_region, bool increment_total = true);
 
   G1CardSetHashTableValue* get_or_add_container(uint card_region, bool* should_grow_table);
@@ -162,6 +162,7 @@ public:
 };
 
 class G1CardSetArray : public G1CardSetContainer {
+  friend class G1CardSetRuns;
 public:
   typedef uint16_t EntryDataType;
   typedef uint EntryCountType;
@@ -238,6 +239,79 @@ public:
   static size_t size_in_bytes(size_t size_in_bits) { return header_size_in_bytes() + BitMap::calc_size_in_words(size_in_bits) * BytesPerWord; }
 };
 
+// Card set container storing runs of consecutive card indexes. Every run is
+// encoded in a single entry as the first and last card index of that run.
+//
+// Only used within Howl card set containers, for buckets that are too large for
+// an Array of Cards but where the cards are clustered so that there are
+// significantly fewer runs than cards.
+//
+// New runs are appended under the same lock embedded in the number of entries as
+// in G1CardSetArray. Extending an existing run by a card at either end atomically
+// replaces that entry. Runs never overlap, but runs that became adjacent by such
+// an extension are not merged.
+class G1CardSetRuns : public G1CardSetContainer {
+public:
+  typedef uint32_t EntryDataType;
+  typedef G1CardSetArray::EntryCountType EntryCountType;
+  using ContainerPtr = G1CardSet::ContainerPtr;
+private:
+  EntryCountType _size;
+  EntryCountType volatile _num_entries;
+  EntryDataType _data[2];
+
+  static const uint LastCardShift = 16;
+  static const EntryDataType FirstCardMask = ((EntryDataType)1 << LastCardShift) - 1;
+
+  static EntryDataType encode(uint first_card, uint last_card) {
+    return ((EntryDataType)last_card << LastCardShift) | first_card;
+  }
+  static uint first_card(EntryDataType entry) { return entry & FirstCardMask; }
+  static uint last_card(EntryDataType entry) { return entry >> LastCardShift; }
+
+  static bool run_contains(EntryDataType entry, uint card_idx) {
+    return first_card(entry) <= card_idx && card_idx <= last_card(entry);
+  }
+
+  EntryDataType entry_at(EntryCountType idx) const { return Atomic::load(&_data[idx]); }
+
+public:
+  G1CardSetRuns(uint const card_in_region, EntryCountType num_runs);
+
+  G1AddCardResult add(uint card_idx);
+
+  bool contains(uint card_idx);
+
+  // Calls
+  //
+  //   void operator ()(uint card_idx)
+  //
+  // for every card in this container.
+  template <class CardVisitor>
+  void iterate_cards(CardVisitor& found);
+
+  // Calls
+  //
+  //   void operator ()(uint card_idx, uint length)
+  //
+  // for every run of cards in this container.
+  template <class CardRangeVisitor>
+  void iterate_runs(CardRangeVisitor& found);
+
+  size_t num_entries() const { return _num_entries & G1CardSetArray::EntryMask; }
+
+  static size_t header_size_in_bytes();
+
+  static size_t size_in_bytes(size_t num_runs) {
+    return header_size_in_bytes() + sizeof(EntryDataType) * num_runs;
+  }
+
+  // Maximum number of runs that fit into a container of the given size.
+  static uint max_runs_in(size_t size_in_bytes) {
+    return size_in_bytes <= header_size_in_bytes() ? 0 : (uint)((size_in_bytes - header_size_in_bytes()) / sizeof(EntryDataType));
+  }
+};
+
 class G1CardSetHowl : public G1CardSetContainer {
 public:
   typedef uint EntryCountType;
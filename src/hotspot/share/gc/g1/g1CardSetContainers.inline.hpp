@@ -256,6 +256,96 @@ inline size_t G1CardSetBitMap::header_size_in_bytes() {
     return offset_of(G1CardSetBitMap, _bits);
 }
 
+inline G1CardSetRuns::G1CardSetRuns(uint card_in_region, EntryCountType num_runs) :
+  G1CardSetContainer(),
+  _size(num_runs),
+  _num_entries(1) {
+  assert(_size > 0, "CardSetRuns of size 0 not supported.");
+  assert(_size < G1CardSetArray::LockBitMask, "Only support CardSetRuns of size %u or smaller.", G1CardSetArray::LockBitMask - 1);
+  assert(card_in_region <= FirstCardMask, "Card index %u does not fit allowed card value range.", card_in_region);
+  _data[0] = encode(card_in_region, card_in_region);
+}
+
+inline G1AddCardResult G1CardSetRuns::add(uint card_idx) {
+  assert(card_idx <= FirstCardMask, "Card index %u does not fit allowed card value range.", card_idx);
+  EntryCountType num_entries = Atomic::load_acquire(&_num_entries) & G1CardSetArray::EntryMask;
+  for (EntryCountType idx = 0; idx < num_entries; idx++) {
+    if (run_contains(entry_at(idx), card_idx)) {
+      return Found;
+    }
+  }
+
+  // Since we did not find the card, lock.
+  G1CardSetArray::G1CardSetArrayLocker x(&_num_entries);
+
+  // Runs may have been added or extended while waiting for the lock, so check
+  // all of them again. The card must not be in any run before extending one,
+  // as runs must not overlap.
+  num_entries = x.num_entries();
+  for (EntryCountType idx = 0; idx < num_entries; idx++) {
+    if (run_contains(_data[idx], card_idx)) {
+      return Found;
+    }
+  }
+
+  for (EntryCountType idx = 0; idx < num_entries; idx++) {
+    EntryDataType entry = _data[idx];
+    if (last_card(entry) + 1 == card_idx) {
+      Atomic::store(&_data[idx], encode(first_card(entry), card_idx));
+      return Added;
+    } else if (card_idx + 1 == first_card(entry)) {
+      Atomic::store(&_data[idx], encode(card_idx, last_card(entry)));
+      return Added;
+    }
+  }
+
+  // Check if there is space left for a new run.
+  if (num_entries == _size) {
+    return Overflow;
+  }
+
+  _data[num_entries] = encode(card_idx, card_idx);
+
+  x.inc_num_entries();
+
+  return Added;
+}
+
+inline bool G1CardSetRuns::contains(uint card_idx) {
+  EntryCountType num_entries = Atomic::load_acquire(&_num_entries) & G1CardSetArray::EntryMask;
+
+  for (EntryCountType idx = 0; idx < num_entries; idx++) {
+    if (run_contains(entry_at(idx), card_idx)) {
+      return true;
+    }
+  }
+  return false;
+}
+
+template <class CardVisitor>
+void G1CardSetRuns::iterate_cards(CardVisitor& found) {
+  EntryCountType num_entries = Atomic::load_acquire(&_num_entries) & G1CardSetArray::EntryMask;
+  for (EntryCountType idx = 0; idx < num_entries; idx++) {
+    EntryDataType entry = entry_at(idx);
+    for (uint card_idx = first_card(entry); card_idx <= last_card(entry); card_idx++) {
+      found(card_idx);
+    }
+  }
+}
+
+template <class CardRangeVisitor>
+void G1CardSetRuns::iterate_runs(CardRangeVisitor& found) {
+  EntryCountType num_entries = Atomic::load_acquire(&_num_entries) & G1CardSetArray::EntryMask;
+  for (EntryCountType idx = 0; idx < num_entries; idx++) {
+    EntryDataType entry = entry_at(idx);
+    found(first_card(entry), last_card(entry) - first_card(entry) + 1);
+  }
+}
+
+inline size_t G1CardSetRuns::header_size_in_bytes() {
+  return offset_of(G1CardSetRuns, _data);
+}
+
 inline G1CardSetHowl::G1CardSetHowl(EntryCountType card_in_region, G1CardSetConfiguration* config) :
   G1CardSetContainer(),
   _num_entries((config->max_cards_in_array() + 1)) /* Card Transfer will not increment _num_entries */ {
@@ -287,9 +377,12 @@ inline bool G1CardSetHowl::contains(uint card_idx, G1CardSetConfiguration* confi
       G1CardSetInlinePtr ptr(container);
       return ptr.contains(card_idx, config->inline_ptr_bits_per_card());
     }
-    case G1CardSet::ContainerHowl: {// Fullcard set entry
-      assert(container == G1CardSet::FullCardSet, "Must be");
-      return true;
+    case G1CardSet::ContainerRuns: {
+      // Full card set entries share the tag with runs of cards.
+      if (container == G1CardSet::FullCardSet) {
+        return true;
+      }
+      return G1CardSet::container_ptr<G1CardSetRuns>(container)->contains(card_idx);
     }
   }
   return false;
@@ -332,11 +425,14 @@ inline void G1CardSetHowl::iterate_cardset(ContainerPtr const container, uint in
       }
       return;
     }
-    case G1CardSet::ContainerHowl: { // actually FullCardSet
-      assert(container == G1CardSet::FullCardSet, "Must be");
-      if (found.start_iterate(G1GCPhaseTimes::MergeRSHowlFull)) {
-        uint offset = index << config->log2_max_cards_in_howl_bitmap();
-        found(offset, config->max_cards_in_howl_bitmap());
+    case G1CardSet::ContainerRuns: { // or FullCardSet
+      if (container == G1CardSet::FullCardSet) {
+        if (found.start_iterate(G1GCPhaseTimes::MergeRSHowlFull)) {
+          uint offset = index << config->log2_max_cards_in_howl_bitmap();
+          found(offset, config->max_cards_in_howl_bitmap());
+        }
+      } else if (found.start_iterate(G1GCPhaseTimes::MergeRSHowlRuns)) {
+        G1CardSet::container_ptr<G1CardSetRuns>(container)->iterate_runs(found);
       }
       return;
     }
@@ -0,0 +1,180 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1CARDTABLECHUNKSCANNER_HPP
+#define SHARE_GC_G1_G1CARDTABLECHUNKSCANNER_HPP
+
+#include "gc/g1/g1CardTable.hpp"
+#include "memory/allocation.hpp"
+#include "utilities/debug.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+// Locates runs of consecutive cards to scan (i.e. dirty cards) inside a chunk of
+// the card table, and applies a function to every such run.
+//
+// Cards are examined a block of several words at a time: the per-block tests
+// only combine words with bitwise operations and a single branch, which the C++
+// compiler turns into vector instructions where available. Since card tables
+// of large heaps are usually sparsely dirty, most blocks are skipped this way;
+// blocks with both dirty and non-dirty cards are examined word by word, and
+// then card by card.
+class G1CardTableChunkScanner : public StackObj {
+  using CardValue = G1CardTable::CardValue;
+  using Word = size_t;
+
+  static const size_t WordsPerBlock = 4;
+  static const size_t CardsPerBlock = WordsPerBlock * sizeof(Word);
+
+  CardValue* const _start_card;
+  CardValue* const _end_card;
+
+  static const size_t ExpandedToScanMask = G1CardTable::WordAlreadyScanned;
+  static const size_t ToScanMask = G1CardTable::g1_card_already_scanned;
+
+  static bool is_card_dirty(const CardValue* const card) {
+    return (*card & ToScanMask) == 0;
+  }
+
+  static bool is_word_aligned(const void* const addr) {
+    return ((uintptr_t)addr) % sizeof(Word) == 0;
+  }
+
+  static Word word_at(const CardValue* const card, size_t i) {
+    return reinterpret_cast<const Word*>(card)[i];
+  }
+
+  static bool has_dirty_cards_in_word(Word word_value) {
+    return (~word_value & ExpandedToScanMask) != 0;
+  }
+
+  static bool block_has_dirty_cards(const CardValue* const card) {
+    Word all_words = word_at(card, 0);
+    for (size_t i = 1; i < WordsPerBlock; i++) {
+      all_words &= word_at(card, i);
+    }
+    return has_dirty_cards_in_word(all_words);
+  }
+
+  static bool block_is_all_dirty(const CardValue* const card) {
+    STATIC_ASSERT(G1CardTable::WordAllDirty == 0);
+    Word any_word = word_at(card, 0);
+    for (size_t i = 1; i < WordsPerBlock; i++) {
+      any_word |= word_at(card, i);
+    }
+    return any_word == G1CardTable::WordAllDirty;
+  }
+
+  CardValue* find_first_dirty_card(CardValue* i_card) const {
+    while (!is_word_aligned(i_card)) {
+      if (is_card_dirty(i_card)) {
+        return i_card;
+      }
+      i_card++;
+    }
+
+    // Skip whole blocks without dirty cards.
+    while (pointer_delta(_end_card, i_card, sizeof(CardValue)) >= CardsPerBlock &&
+           !block_has_dirty_cards(i_card)) {
+      i_card += CardsPerBlock;
+    }
+
+    for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
+      Word word_value = *reinterpret_cast<Word*>(i_card);
+
+      if (has_dirty_cards_in_word(word_value)) {
+        for (uint i = 0; i < sizeof(Word); ++i) {
+          if (is_card_dirty(i_card)) {
+            return i_card;
+          }
+          i_card++;
+        }
+        assert(false, "should have early-returned");
+      }
+    }
+
+    return _end_card;
+  }
+
+  CardValue* find_first_non_dirty_card(CardValue* i_card) const {
+    while (!is_word_aligned(i_card)) {
+      if (!is_card_dirty(i_card)) {
+        return i_card;
+      }
+      i_card++;
+    }
+
+    // Skip whole blocks of dirty cards.
+    while (pointer_delta(_end_card, i_card, sizeof(CardValue)) >= CardsPerBlock &&
+           block_is_all_dirty(i_card)) {
+      i_card += CardsPerBlock;
+    }
+
+    for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
+      Word word_value = *reinterpret_cast<Word*>(i_card);
+      bool all_cards_dirty = (word_value == G1CardTable::WordAllDirty);
+
+      if (!all_cards_dirty) {
+        for (uint i = 0; i < sizeof(Word); ++i) {
+          if (!is_card_dirty(i_card)) {
+            return i_card;
+          }
+          i_card++;
+        }
+        assert(false, "should have early-returned");
+      }
+    }
+
+    return _end_card;
+  }
+
+public:
+  G1CardTableChunkScanner(CardValue* const start_card, CardValue* const end_card) :
+    _start_card(start_card),
+    _end_card(end_card) {
+      assert(is_word_aligned(start_card), "precondition");
+      assert(is_word_aligned(end_card), "precondition");
+    }
+
+  // Apply f to every run [dirty_l, dirty_r) of consecutive dirty cards in the chunk.
+  template<typename Func>
+  void on_dirty_cards(Func&& f) {
+    for (CardValue* cur_card = _start_card; cur_card < _end_card; /* empty */) {
+      CardValue* dirty_l = find_first_dirty_card(cur_card);
+      CardValue* dirty_r = find_first_non_dirty_card(dirty_l);
+
+      assert(dirty_l <= dirty_r, "inv");
+
+      if (dirty_l == dirty_r) {
+        assert(dirty_r == _end_card, "finished the entire chunk");
+        return;
+      }
+
+      f(dirty_l, dirty_r);
+
+      cur_card = dirty_r + 1;
+    }
+  }
+};
+
+#endif // SHARE_GC_G1_G1CARDTABLECHUNKSCANNER_HPP
@@ -37,6 +37,7 @@
 #include "gc/g1/g1CollectionSet.hpp"
 #include "gc/g1/g1CollectionSetCandidates.hpp"
 #include "gc/g1/g1CollectorState.hpp"
+#include "gc/g1/g1CommitAheadTask.hpp"
 #include "gc/g1/g1ConcurrentRefine.hpp"
 #include "gc/g1/g1ConcurrentRefineThread.hpp"
 #include "gc/g1/g1ConcurrentMarkThread.inline.hpp"
@@ -51,6 +52,7 @@
 #include "gc/g1/g1HeapTransition.hpp"
 #include "gc/g1/g1HeapVerifier.hpp"
 #include "gc/g1/g1InitLogger.hpp"
+#include "gc/g1/g1LateRemSetRebuildTask.hpp"
 #include "gc/g1/g1MemoryPool.hpp"
 #include "gc/g1/g1MonotonicArenaFreeMemoryTask.hpp"
 #include "gc/g1/g1OopClosures.inline.hpp"
@@ -1220,6 +1222,8 @@ G1CollectedHeap::G1CollectedHeap() :
   _service_thread(nullptr),
   _periodic_gc_task(nullptr),
   _free_arena_memory_task(nullptr),
+  _late_remset_rebuild_task(nullptr),
+  _commit_ahead_task(nullptr),
   _workers(nullptr),
   _card_table(nullptr),
   _collection_pause_end(Ticks::now()),
@@ -1496,6 +1500,19 @@ jint G1CollectedHeap::initialize() {
   _free_arena_memory_task = new G1MonotonicArenaFreeMemoryTask("Card Set Free Memory Task");
   _service_thread->register_task(_free_arena_memory_task);
 
+  if (G1UseLateRemSetRebuild) {
+    // The task does nothing until scheduled again at the start of the mixed phase.
+    _late_remset_rebuild_task = new G1LateRemSetRebuildTask("Late Remembered Set Rebuild Task");
+    _late_remset_rebuild_task->initialize(max_reserved_regions());
+    _service_thread->register_task(_late_remset_rebuild_task);
+  }
+
+  if (G1CommitAhead) {
+    // The task does nothing until a young collection predicts heap expansion.
+    _commit_ahead_task = new G1CommitAheadTask("Commit Ahead Task");
+    _service_thread->register_task(_commit_ahead_task);
+  }
+
   // Here we allocate the dummy HeapRegion that is required by the
   // G1AllocRegion class.
   HeapRegion* dummy_region = _hrm.get_dummy_region();
@@ -2344,6 +2361,18 @@ bool G1CollectedHeap::has_uncommittable_regions() {
   return _hrm.has_inactive_regions();
 }
 
+uint G1CollectedHeap::commit_regions_ahead(uint num_regions) {
+  return _hrm.commit_ahead(num_regions, _workers);
+}
+
+uint G1CollectedHeap::num_committed_ahead_regions() const {
+  return _hrm.num_committed_ahead();
+}
+
+void G1CollectedHeap::limit_committed_ahead_regions(uint num_regions) {
+  _hrm.limit_committed_ahead(num_regions);
+}
+
 void G1CollectedHeap::uncommit_regions_if_necessary() {
   if (has_uncommittable_regions()) {
     G1UncommitRegionTask::enqueue();
@@ -2482,6 +2511,10 @@ void G1CollectedHeap::expand_heap_after_young_collection(){
     }
     phase_times()->record_expand_heap_time(expand_ms);
   }
+
+  if (_commit_ahead_task != nullptr) {
+    _commit_ahead_task->update_target(_heap_sizing_policy->predicted_young_collection_expansion_amount());
+  }
 }
 
 bool G1CollectedHeap::do_collection_pause_at_safepoint() {
@@ -69,12 +69,14 @@
 class G1Allocator;
 class G1BatchedTask;
 class G1CardTableEntryClosure;
+class G1CommitAheadTask;
 class G1ConcurrentMark;
 class G1ConcurrentMarkThread;
 class G1ConcurrentRefine;
 class G1GCCounters;
 class G1GCPhaseTimes;
 class G1HeapSizingPolicy;
+class G1LateRemSetRebuildTask;
 class G1NewTracer;
 class G1RemSet;
 class G1ServiceTask;
@@ -172,6 +174,8 @@ private:
   G1ServiceThread* _service_thread;
   G1ServiceTask* _periodic_gc_task;
   G1MonotonicArenaFreeMemoryTask* _free_arena_memory_task;
+  G1LateRemSetRebuildTask* _late_remset_rebuild_task;
+  G1CommitAheadTask* _commit_ahead_task;
 
   WorkerThreads* _workers;
   G1CardTable* _card_table;
@@ -532,6 +536,9 @@ public:
 
   G1ServiceThread* service_thread() const { return _service_thread; }
 
+  // The late remembered set rebuild task; null if G1UseLateRemSetRebuild is disabled.
+  G1LateRemSetRebuildTask* late_remset_rebuild_task() const { return _late_remset_rebuild_task; }
+
   WorkerThreads* workers() const { return _workers; }
 
   // Run the given batch task using the workers.
@@ -568,6 +575,13 @@ public:
   uint uncommit_regions(uint region_limit);
   bool has_uncommittable_regions();
 
+  // Commit up to num_regions regions ahead of heap expansion, returning the
+  // number of regions committed.
+  uint commit_regions_ahead(uint num_regions);
+  uint num_committed_ahead_regions() const;
+  // Keep at most num_regions regions committed ahead of heap expansion.
+  void limit_committed_ahead_regions(uint num_regions);
+
   G1NUMA* numa() const { return _numa; }
 
   // Expand the garbage-first heap by at least the given size (in bytes!).
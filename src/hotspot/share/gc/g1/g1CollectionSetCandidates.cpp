@@ -23,9 +23,10 @@
  */
 
 #include "precompiled.hpp"
-#include "gc/g1/g1CollectionSetCandidates.hpp"
+#include "gc/g1/g1CollectionSetCandidates.inline.hpp"
 #include "gc/g1/g1CollectionSetChooser.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
+#include "runtime/safepoint.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/growableArray.hpp"
 
@@ -38,6 +39,35 @@ void G1CollectionCandidateList::set(G1CollectionCandidateList::CandidateInfo* ca
   _candidates.appendAll(&a);
 }
 
+void G1CollectionCandidateList::merge(G1CollectionCandidateList::CandidateInfo* candidate_infos, uint num_infos) {
+  if (num_infos == 0) {
+    return;
+  }
+
+  // Create a list from scratch, merging the elements of both lists by efficiency.
+  // Finally deallocate and overwrite the old list.
+  GrowableArray<CandidateInfo> new_list(_candidates.length() + (int)num_infos, mtGC);
+
+  uint candidate_idx = 0;
+  uint info_idx = 0;
+  while (candidate_idx < (uint)_candidates.length() && info_idx < num_infos) {
+    if (compare(&_candidates.at(candidate_idx), &candidate_infos[info_idx]) <= 0) {
+      new_list.append(_candidates.at(candidate_idx++));
+    } else {
+      new_list.append(candidate_infos[info_idx++]);
+    }
+  }
+  while (candidate_idx < (uint)_candidates.length()) {
+    new_list.append(_candidates.at(candidate_idx++));
+  }
+  while (info_idx < num_infos) {
+    new_list.append(candidate_infos[info_idx++]);
+  }
+  _candidates.swap(&new_list);
+
+  verify();
+}
+
 void G1CollectionCandidateList::remove(G1CollectionCandidateRegionList* other) {
   guarantee((uint)_candidates.length() >= other->length(), "must be");
 
@@ -144,11 +174,14 @@ G1CollectionSetCandidates::G1CollectionSetCandidates() :
   _marking_regions(),
   _contains_map(nullptr),
   _max_regions(0),
-  _last_marking_candidates_length(0)
+  _last_marking_candidates_length(0),
+  _refinement_deferral_budget(nullptr),
+  _has_refinement_deferral_budget(false)
 { }
 
 G1CollectionSetCandidates::~G1CollectionSetCandidates() {
   FREE_C_HEAP_ARRAY(CandidateOrigin, _contains_map);
+  FREE_C_HEAP_ARRAY(uint, _refinement_deferral_budget);
 }
 
 bool G1CollectionSetCandidates::is_from_marking(HeapRegion* r) const {
@@ -160,6 +193,10 @@ void G1CollectionSetCandidates::initialize(uint max_regions) {
   assert(_contains_map == nullptr, "already initialized");
   _max_regions = max_regions;
   _contains_map = NEW_C_HEAP_ARRAY(CandidateOrigin, max_regions, mtGC);
+  _refinement_deferral_budget = NEW_C_HEAP_ARRAY(uint, max_regions, mtGC);
+  for (uint i = 0; i < max_regions; i++) {
+    _refinement_deferral_budget[i] = 0;
+  }
   clear();
 }
 
@@ -169,6 +206,7 @@ void G1CollectionSetCandidates::clear() {
     _contains_map[i] = CandidateOrigin::Invalid;
   }
   _last_marking_candidates_length = 0;
+  clear_refinement_deferral_budget();
 }
 
 void G1CollectionSetCandidates::set_candidates_from_marking(G1CollectionCandidateList::CandidateInfo* candidate_infos,
@@ -188,17 +226,59 @@ void G1CollectionSetCandidates::set_candidates_from_marking(G1CollectionCandidat
   verify();
 }
 
+void G1CollectionSetCandidates::add_late_rebuild_candidates(G1CollectionCandidateList::CandidateInfo* candidate_infos,
+                                                            uint num_infos) {
+  verify();
+
+  _marking_regions.merge(candidate_infos, num_infos);
+  for (uint i = 0; i < num_infos; i++) {
+    HeapRegion* r = candidate_infos[i]._r;
+    assert(!contains(r), "must not contain region %u", r->hrm_index());
+    _contains_map[r->hrm_index()] = CandidateOrigin::Marking;
+  }
+
+  verify();
+}
+
 void G1CollectionSetCandidates::remove(G1CollectionCandidateRegionList* other) {
   _marking_regions.remove(other);
 
   for (HeapRegion* r : *other) {
     assert(contains(r), "must contain region %u", r->hrm_index());
     _contains_map[r->hrm_index()] = CandidateOrigin::Invalid;
+    _refinement_deferral_budget[r->hrm_index()] = 0;
   }
 
   verify();
 }
 
+void G1CollectionSetCandidates::set_refinement_deferral_budget(uint num_regions, uint cards_per_region) {
+  assert_at_safepoint();
+
+  clear_refinement_deferral_budget();
+  if (cards_per_region == 0) {
+    return;
+  }
+  for (HeapRegion* r : _marking_regions) {
+    if (num_regions == 0) {
+      break;
+    }
+    _refinement_deferral_budget[r->hrm_index()] = cards_per_region;
+    _has_refinement_deferral_budget = true;
+    num_regions--;
+  }
+}
+
+void G1CollectionSetCandidates::clear_refinement_deferral_budget() {
+  if (!_has_refinement_deferral_budget) {
+    return;
+  }
+  for (uint i = 0; i < _max_regions; i++) {
+    _refinement_deferral_budget[i] = 0;
+  }
+  _has_refinement_deferral_budget = false;
+}
+
 bool G1CollectionSetCandidates::is_empty() const {
   return length() == 0;
 }
@@ -100,6 +100,9 @@ public:
 
   // Put the given set of candidates into this list, preserving the efficiency ordering.
   void set(CandidateInfo* candidate_infos, uint num_infos);
+  // Add the given set of candidates, sorted by gc efficiency, to this list,
+  // preserving the efficiency ordering.
+  void merge(CandidateInfo* candidate_infos, uint num_infos);
   // Removes any HeapRegions stored in this list also in the other list. The other
   // list may only contain regions in this list, sorted by gc efficiency. It need
   // not be a prefix of this list. Returns the number of regions removed.
@@ -173,6 +176,12 @@ class G1CollectionSetCandidates : public CHeapObj<mtGC> {
   // The number of regions from the last merge of candidates from the marking.
   uint _last_marking_candidates_length;
 
+  // Per region the number of dirty cards concurrent refinement may still leave
+  // to the next garbage collection, see try_defer_refinement(). Only non-zero
+  // for candidates likely to be evacuated by the next collection.
+  volatile uint* _refinement_deferral_budget;
+  bool _has_refinement_deferral_budget;
+
   bool is_from_marking(HeapRegion* r) const;
 
 public:
@@ -193,6 +202,10 @@ public:
   // set_candidates_from_marking(). Used for calculating minimum collection set
   // regions.
   uint last_marking_candidates_length() const { return _last_marking_candidates_length; }
+  // Add candidates whose remembered sets have been rebuilt during the mixed phase
+  // to the current marking list.
+  void add_late_rebuild_candidates(G1CollectionCandidateList::CandidateInfo* candidate_infos,
+                                   uint num_infos);
 
   // Remove the given regions from the candidates. All given regions must be part
   // of the candidates.
@@ -200,6 +213,21 @@ public:
 
   bool contains(const HeapRegion* r) const;
 
+  // Allow concurrent refinement to defer refinement of up to cards_per_region
+  // dirty cards in each of the first num_regions marking candidates, i.e. the
+  // regions the next mixed collection will evacuate at least. Resets the budget
+  // of all other regions.
+  // precondition: at safepoint.
+  void set_refinement_deferral_budget(uint num_regions, uint cards_per_region);
+  // precondition: at safepoint.
+  void clear_refinement_deferral_budget();
+  bool has_refinement_deferral_budget() const { return _has_refinement_deferral_budget; }
+  // Returns whether refinement of a dirty card in the region with the given
+  // index may be deferred to the next collection, consuming one card of
+  // that region's budget. Concurrent updates of the budget are racy, so it
+  // may be exceeded by a few cards.
+  inline bool try_defer_refinement(uint region_idx);
+
   const char* get_short_type_str(const HeapRegion* r) const;
 
   bool is_empty() const;
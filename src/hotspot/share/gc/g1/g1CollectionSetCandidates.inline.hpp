@@ -27,6 +27,7 @@
 
 #include "gc/g1/g1CollectionSetCandidates.hpp"
 
+#include "runtime/atomic.hpp"
 #include "utilities/growableArray.hpp"
 
 inline G1CollectionCandidateListIterator::G1CollectionCandidateListIterator(G1CollectionCandidateList* which, uint position) :
@@ -76,4 +77,19 @@ inline bool G1CollectionSetCandidatesIterator::operator!=(const G1CollectionSetC
   return !(*this == rhs);
 }
 
+inline bool G1CollectionSetCandidates::try_defer_refinement(uint region_idx) {
+  assert(region_idx < _max_regions, "must be");
+  volatile uint* budget_addr = &_refinement_deferral_budget[region_idx];
+  uint budget = Atomic::load(budget_addr);
+  // Concurrent refinement threads may race for the same region.
+  while (budget > 0) {
+    uint cur = Atomic::cmpxchg(budget_addr, budget, budget - 1, memory_order_relaxed);
+    if (cur == budget) {
+      return true;
+    }
+    budget = cur;
+  }
+  return false;
+}
+
 #endif /* SHARE_GC_G1_G1COLLECTIONSETCANDIDATES_INLINE_HPP */
@@ -0,0 +1,123 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1CommitAheadTask.hpp"
+#include "gc/g1/heapRegion.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
+#include "logging/log.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/safepoint.hpp"
+#include "utilities/align.hpp"
+
+G1CommitAheadTask::G1CommitAheadTask(const char* name) :
+  G1ServiceTask(name),
+  // Registering the task schedules it.
+  _active(true),
+  _target_regions(0),
+  _summary_duration(),
+  _summary_region_count(0) { }
+
+void G1CommitAheadTask::set_active(bool state) {
+  assert(_active != state, "Must do a state change");
+  // The state is set to true only in a safepoint and set to false while
+  // running on the service thread joined with the suspendible thread set.
+  _active = state;
+}
+
+void G1CommitAheadTask::report_execution(Tickspan time, uint regions) {
+  _summary_region_count += regions;
+  _summary_duration += time;
+
+  log_trace(gc, heap)("Concurrent Commit Ahead: " SIZE_FORMAT "%s, %u regions, %1.3fms",
+                      byte_size_in_proper_unit(regions * HeapRegion::GrainBytes),
+                      proper_unit_for_byte_size(regions * HeapRegion::GrainBytes),
+                      regions,
+                      time.seconds() * 1000);
+}
+
+void G1CommitAheadTask::report_summary() {
+  if (_summary_region_count > 0) {
+    log_debug(gc, heap)("Concurrent Commit Ahead Summary: " SIZE_FORMAT "%s, %u regions, %1.3fms",
+                        byte_size_in_proper_unit(_summary_region_count * HeapRegion::GrainBytes),
+                        proper_unit_for_byte_size(_summary_region_count * HeapRegion::GrainBytes),
+                        _summary_region_count,
+                        _summary_duration.seconds() * 1000);
+  }
+  _summary_duration = Tickspan();
+  _summary_region_count = 0;
+}
+
+void G1CommitAheadTask::update_target(size_t predicted_expand_bytes) {
+  assert_at_safepoint_on_vm_thread();
+
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+  _target_regions = (uint)(align_up(predicted_expand_bytes, HeapRegion::GrainBytes) / HeapRegion::GrainBytes);
+
+  uint committed_ahead = g1h->num_committed_ahead_regions();
+  if (_target_regions < committed_ahead) {
+    log_debug(gc, heap)("Commit ahead: release %u of %u regions",
+                        committed_ahead - _target_regions, committed_ahead);
+    g1h->limit_committed_ahead_regions(_target_regions);
+    g1h->uncommit_regions_if_necessary();
+  } else if (_target_regions > committed_ahead && !_active) {
+    log_debug(gc, heap)("Commit ahead: commit %u regions, %u already committed",
+                        _target_regions - committed_ahead, committed_ahead);
+    set_active(true);
+    g1h->service_thread()->schedule_task(this, 0);
+  }
+}
+
+void G1CommitAheadTask::execute() {
+  assert(_active, "Must be active");
+
+  // Translate the size limit into a number of regions. This cannot be a
+  // compile time constant because G1HeapRegionSize is set ergonomically.
+  const uint region_limit = MAX2((uint)(CommitSizeLimit / HeapRegion::GrainBytes), 1u);
+
+  // Prevent from running during a GC pause.
+  SuspendibleThreadSetJoiner sts;
+  G1CollectedHeap* g1h = G1CollectedHeap::heap();
+
+  uint committed_ahead = g1h->num_committed_ahead_regions();
+  uint commit_count = 0;
+  if (_target_regions > committed_ahead) {
+    Ticks start = Ticks::now();
+    commit_count = g1h->commit_regions_ahead(MIN2(_target_regions - committed_ahead, region_limit));
+    if (commit_count > 0) {
+      report_execution(Ticks::now() - start, commit_count);
+    }
+  }
+
+  // Reschedule if there are more regions to commit, otherwise change state
+  // to inactive.
+  if (commit_count > 0 && _target_regions > g1h->num_committed_ahead_regions()) {
+    // Delay to avoid starving application.
+    schedule(CommitTaskDelayMs);
+  } else {
+    set_active(false);
+    report_summary();
+  }
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1COMMITAHEADTASK_HPP
+#define SHARE_GC_G1_G1COMMITAHEADTASK_HPP
+
+#include "gc/g1/g1ServiceThread.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/ticks.hpp"
+
+// Task committing, and with AlwaysPreTouch pre-touching, the regions the heap
+// is predicted to expand by, before that expansion happens. These regions are
+// kept inactive, so that expanding the heap only needs to activate them
+// instead of committing and pre-touching memory, often during a pause.
+//
+// After every young collection G1HeapSizingPolicy predicts the upcoming
+// expansion and sets the number of regions to keep committed ahead. When the
+// prediction drops, or the heap is shrunk, surplus regions are uncommitted
+// by G1UncommitRegionTask like other inactive regions.
+class G1CommitAheadTask : public G1ServiceTask {
+  // Each execution of the task is limited to commit at most 128M, like
+  // uncommitting, to keep the duration of each invocation short.
+  static const uint CommitSizeLimit = 128 * M;
+  // The delay between two task executions.
+  static const uint CommitTaskDelayMs = 10;
+
+  // Whether the task is scheduled or running. Prevents scheduling the task
+  // multiple times.
+  bool _active;
+  // The number of regions to keep committed ahead of expansion.
+  uint _target_regions;
+
+  // Members to keep a summary of the current commit ahead work.
+  Tickspan _summary_duration;
+  uint _summary_region_count;
+
+  void set_active(bool state);
+
+  void report_execution(Tickspan time, uint regions);
+  void report_summary();
+
+public:
+  explicit G1CommitAheadTask(const char* name);
+
+  // Update the number of regions to keep committed ahead of expansion from
+  // the given predicted expansion.
+  // precondition: at safepoint.
+  void update_target(size_t predicted_expand_bytes);
+
+  void execute() override;
+};
+
+#endif // SHARE_GC_G1_G1COMMITAHEADTASK_HPP
@@ -88,6 +88,15 @@ void G1CommittedRegionMap::deactivate(uint start, uint end) {
   inactive_set_range(start, end);
 }
 
+void G1CommittedRegionMap::commit_inactive(uint start, uint end) {
+  verify_active_count(start, end, 0);
+  verify_inactive_count(start, end, 0);
+
+  log_debug(gc, heap, region)("Commit inactive regions [%u, %u)", start, end);
+
+  inactive_set_range(start, end);
+}
+
 void G1CommittedRegionMap::uncommit(uint start, uint end) {
   verify_active_count(start, end, 0);
   verify_inactive_count(start, end, (end-start));
@@ -128,6 +137,24 @@ HeapRegionRange G1CommittedRegionMap::next_committable_range(uint offset) const
   return HeapRegionRange(start, end);
 }
 
+HeapRegionRange G1CommittedRegionMap::next_uncommitted_range(uint offset) const {
+  // Find first region from offset that is neither active nor inactive.
+  uint start = (uint) _active.find_first_clear_bit(offset);
+  while (start < max_length() && inactive(start)) {
+    start = (uint) _inactive.find_first_clear_bit(start);
+    start = (uint) _active.find_first_clear_bit(start);
+  }
+  if (start == max_length()) {
+    // Early out when no uncommitted regions are found.
+    return HeapRegionRange(max_length(), max_length());
+  }
+
+  uint end = (uint) MIN2(_active.find_first_set_bit(start), _inactive.find_first_set_bit(start));
+  verify_free_range(start, end);
+
+  return HeapRegionRange(start, end);
+}
+
 HeapRegionRange G1CommittedRegionMap::next_inactive_range(uint offset) const {
   // Find first inactive region from offset.
   uint start = (uint) _inactive.find_first_set_bit(offset);
@@ -50,6 +50,7 @@ class HeapRegionRange : public StackObj {
 //
 // State transitions:
 //   Uncommitted -> Active      (activate())
+//   Uncommitted -> Inactive    (commit_inactive())
 //   Active      -> Inactive    (deactivate())
 //   Inactive    -> Active      (reactivate())
 //   Inactive    -> Uncommitted (uncommit())
@@ -95,6 +96,9 @@ public:
   void activate(uint start, uint end);
   // Mark a range of regions as inactive and ready to be uncommitted.
   void deactivate(uint start, uint end);
+  // Mark a range of newly committed regions as inactive, so that they can be
+  // activated later without committing them.
+  void commit_inactive(uint start, uint end);
   // Mark a range of regions active again and no longer ready for uncommit.
   void reactivate(uint start, uint end);
   // Uncommit a range of inactive regions.
@@ -108,6 +112,9 @@ public:
   // This function must only be called when no inactive regions are
   // present and can be used to activate more regions.
   HeapRegionRange next_committable_range(uint offset) const;
+  // Finds the next range of uncommitted regions starting at offset. Unlike
+  // next_committable_range() inactive regions may be present.
+  HeapRegionRange next_uncommitted_range(uint offset) const;
 
 protected:
   virtual void guarantee_mt_safety_active() const;
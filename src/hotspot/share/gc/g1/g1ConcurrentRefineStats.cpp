@@ -29,7 +29,8 @@ G1ConcurrentRefineStats::G1ConcurrentRefineStats() :
   _refinement_time(),
   _refined_cards(0),
   _precleaned_cards(0),
-  _dirtied_cards(0)
+  _dirtied_cards(0),
+  _deferred_cards(0)
 {}
 
 double G1ConcurrentRefineStats::refinement_rate_ms() const {
@@ -44,6 +45,7 @@ G1ConcurrentRefineStats::operator+=(const G1ConcurrentRefineStats& other) {
   _refined_cards += other._refined_cards;
   _precleaned_cards += other._precleaned_cards;
   _dirtied_cards += other._dirtied_cards;
+  _deferred_cards += other._deferred_cards;
   return *this;
 }
 
@@ -58,6 +60,7 @@ G1ConcurrentRefineStats::operator-=(const G1ConcurrentRefineStats& other) {
   _refined_cards = clipped_sub(_refined_cards, other._refined_cards);
   _precleaned_cards = clipped_sub(_precleaned_cards, other._precleaned_cards);
   _dirtied_cards = clipped_sub(_dirtied_cards, other._dirtied_cards);
+  _deferred_cards = clipped_sub(_deferred_cards, other._deferred_cards);
   return *this;
 }
 
@@ -37,6 +37,7 @@ class G1ConcurrentRefineStats : public CHeapObj<mtGC> {
   size_t _refined_cards;
   size_t _precleaned_cards;
   size_t _dirtied_cards;
+  size_t _deferred_cards;
 
 public:
   G1ConcurrentRefineStats();
@@ -57,10 +58,15 @@ public:
   // Number of cards marked dirty and in need of refinement.
   size_t dirtied_cards() const { return _dirtied_cards; }
 
+  // Number of dirty cards left to the next garbage collection because their
+  // regions are likely to be evacuated by it.
+  size_t deferred_cards() const { return _deferred_cards; }
+
   void inc_refinement_time(Tickspan t) { _refinement_time += t; }
   void inc_refined_cards(size_t cards) { _refined_cards += cards; }
   void inc_precleaned_cards(size_t cards) { _precleaned_cards += cards; }
   void inc_dirtied_cards(size_t cards) { _dirtied_cards += cards; }
+  void inc_deferred_cards(size_t cards) { _deferred_cards += cards; }
 
   G1ConcurrentRefineStats& operator+=(const G1ConcurrentRefineStats& other);
   G1ConcurrentRefineStats& operator-=(const G1ConcurrentRefineStats& other);
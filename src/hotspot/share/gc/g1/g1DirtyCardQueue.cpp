@@ -26,6 +26,8 @@
 #include "gc/g1/g1BarrierSet.inline.hpp"
 #include "gc/g1/g1CardTableEntryClosure.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1CollectionSet.hpp"
+#include "gc/g1/g1CollectionSetCandidates.inline.hpp"
 #include "gc/g1/g1ConcurrentRefineStats.hpp"
 #include "gc/g1/g1ConcurrentRefineThread.hpp"
 #include "gc/g1/g1DirtyCardQueue.hpp"
@@ -70,6 +72,8 @@ G1DirtyCardQueueSet::G1DirtyCardQueueSet(BufferNode::Allocator* allocator) :
   _mutator_refinement_threshold(SIZE_MAX),
   _completed(),
   _paused(),
+  _deferred(),
+  _num_deferred_cards(0),
   _free_ids(par_ids_start(), num_par_ids()),
   _detached_refinement_stats()
 {}
@@ -119,6 +123,10 @@ size_t G1DirtyCardQueueSet::num_cards() const {
   return Atomic::load(&_num_cards);
 }
 
+size_t G1DirtyCardQueueSet::num_deferred_cards() const {
+  return Atomic::load(&_num_deferred_cards);
+}
+
 void G1DirtyCardQueueSet::enqueue_completed_buffer(BufferNode* cbn) {
   assert(cbn != nullptr, "precondition");
   // Increment _num_cards before adding to queue, so queue removal doesn't
@@ -307,6 +315,26 @@ void G1DirtyCardQueueSet::enqueue_all_paused_buffers() {
   enqueue_paused_buffers_aux(_paused.take_all());
 }
 
+void G1DirtyCardQueueSet::record_deferred_buffer(BufferNode* node) {
+  assert(node->next() == nullptr, "precondition");
+  Atomic::add(&_num_deferred_cards, buffer_size() - node->index());
+  _deferred.push(*node);
+}
+
+void G1DirtyCardQueueSet::enqueue_all_deferred_buffers() {
+  assert_at_safepoint();
+  BufferNode* head = _deferred.pop_all();
+  if (head != nullptr) {
+    BufferNode* tail = head;
+    while (tail->next() != nullptr) {
+      tail = tail->next();
+    }
+    Atomic::add(&_num_cards, Atomic::load(&_num_deferred_cards));
+    _completed.append(*head, *tail);
+  }
+  Atomic::store(&_num_deferred_cards, size_t(0));
+}
+
 void G1DirtyCardQueueSet::abandon_completed_buffers() {
   BufferNodeList list = take_all_completed_buffers();
   BufferNode* buffers_to_delete = list._head;
@@ -331,6 +359,7 @@ void G1DirtyCardQueueSet::merge_bufferlists(G1RedirtyCardsQueueSet* src) {
 
 BufferNodeList G1DirtyCardQueueSet::take_all_completed_buffers() {
   enqueue_all_paused_buffers();
+  enqueue_all_deferred_buffers();
   verify_num_cards();
   Pair<BufferNode*, BufferNode*> pair = _completed.take_all();
   size_t num_cards = Atomic::load(&_num_cards);
@@ -342,29 +371,64 @@ class G1RefineBufferedCards : public StackObj {
   BufferNode* const _node;
   CardTable::CardValue** const _node_buffer;
   const size_t _node_buffer_size;
+  // End of the cards to refine; the cards from here to _node_buffer_size
+  // have been deferred to the next garbage collection.
+  size_t _refine_end;
   const uint _worker_id;
   G1ConcurrentRefineStats* _stats;
+  G1CollectedHeap* const _g1h;
   G1RemSet* const _g1rs;
+  G1CollectionSetCandidates* const _candidates;
 
   static inline int compare_card(const CardTable::CardValue* p1,
                                  const CardTable::CardValue* p2) {
     return p2 - p1;
   }
 
-  // Sorts the cards from start_index to _node_buffer_size in *decreasing*
+  // Sorts the cards from start_index to _refine_end in *decreasing*
   // address order. Tests showed that this order is preferable to not sorting
   // or increasing address order.
   void sort_cards(size_t start_index) {
     QuickSort::sort(&_node_buffer[start_index],
-                    _node_buffer_size - start_index,
+                    _refine_end - start_index,
                     compare_card,
                     false);
   }
 
+  bool should_defer(CardTable::CardValue* card_ptr) {
+    HeapRegion* r = _g1h->heap_region_containing_or_null(_g1h->card_table()->addr_for(card_ptr));
+    return r != nullptr && _candidates->try_defer_refinement(r->hrm_index());
+  }
+
+  // Moves the cards whose refinement may be deferred to the next garbage
+  // collection to the end of the buffer, and excludes them from refinement.
+  // Refining cards in regions evacuated by the next collection is wasted
+  // work: that collection drops them when merging the remaining buffers.
+  // The deferred cards stay dirty so that the post write barrier does not
+  // enqueue them again. If the region is not evacuated after all, these
+  // cards are scanned during that collection like any other pending card.
+  void defer_cards() {
+    if (!_candidates->has_refinement_deferral_budget()) {
+      return;
+    }
+    size_t i = _node->index();
+    size_t end = _node_buffer_size;
+    while (i < end) {
+      if (should_defer(_node_buffer[i])) {
+        --end;
+        swap(_node_buffer[i], _node_buffer[end]);
+      } else {
+        ++i;
+      }
+    }
+    _stats->inc_deferred_cards(_node_buffer_size - end);
+    _refine_end = end;
+  }
+
   // Returns the index to the first clean card in the buffer.
   size_t clean_cards() {
     const size_t start = _node->index();
-    assert(start <= _node_buffer_size, "invariant");
+    assert(start <= _refine_end, "invariant");
 
     // Two-fingered compaction algorithm similar to the filtering mechanism in
     // SATBMarkQueue. The main difference is that clean_card_before_refine()
@@ -372,7 +436,7 @@ class G1RefineBufferedCards : public StackObj {
     // We don't check for SuspendibleThreadSet::should_yield(), because
     // cleaning and redirtying the cards is fast.
     CardTable::CardValue** src = &_node_buffer[start];
-    CardTable::CardValue** dst = &_node_buffer[_node_buffer_size];
+    CardTable::CardValue** dst = &_node_buffer[_refine_end];
     assert(src <= dst, "invariant");
     for ( ; src < dst; ++src) {
       // Search low to high for a card to keep.
@@ -391,7 +455,7 @@ class G1RefineBufferedCards : public StackObj {
     // dst points to the first retained clean card, or the end of the buffer
     // if all the cards were discarded.
     const size_t first_clean = dst - _node_buffer;
-    assert(first_clean >= start && first_clean <= _node_buffer_size, "invariant");
+    assert(first_clean >= start && first_clean <= _refine_end, "invariant");
     // Discarded cards are considered as refined.
     _stats->inc_refined_cards(first_clean - start);
     _stats->inc_precleaned_cards(first_clean - start);
@@ -401,7 +465,7 @@ class G1RefineBufferedCards : public StackObj {
   bool refine_cleaned_cards(size_t start_index) {
     bool result = true;
     size_t i = start_index;
-    for ( ; i < _node_buffer_size; ++i) {
+    for ( ; i < _refine_end; ++i) {
       if (SuspendibleThreadSet::should_yield()) {
         redirty_unrefined_cards(i);
         result = false;
@@ -415,7 +479,7 @@ class G1RefineBufferedCards : public StackObj {
   }
 
   void redirty_unrefined_cards(size_t start) {
-    for ( ; start < _node_buffer_size; ++start) {
+    for ( ; start < _refine_end; ++start) {
       *_node_buffer[start] = G1CardTable::dirty_card_val();
     }
   }
@@ -428,13 +492,17 @@ public:
     _node(node),
     _node_buffer(reinterpret_cast<CardTable::CardValue**>(BufferNode::make_buffer_from_node(node))),
     _node_buffer_size(node_buffer_size),
+    _refine_end(node_buffer_size),
     _worker_id(worker_id),
     _stats(stats),
-    _g1rs(G1CollectedHeap::heap()->rem_set()) {}
+    _g1h(G1CollectedHeap::heap()),
+    _g1rs(_g1h->rem_set()),
+    _candidates(_g1h->collection_set()->candidates()) {}
 
   bool refine() {
+    defer_cards();
     size_t first_clean_index = clean_cards();
-    if (first_clean_index == _node_buffer_size) {
+    if (first_clean_index == _refine_end) {
       _node->set_index(first_clean_index);
       return true;
     }
@@ -468,10 +536,15 @@ bool G1DirtyCardQueueSet::refine_buffer(BufferNode* node,
 void G1DirtyCardQueueSet::handle_refined_buffer(BufferNode* node,
                                                 bool fully_processed) {
   if (fully_processed) {
-    assert(node->index() == buffer_size(),
-           "Buffer not fully consumed: index: " SIZE_FORMAT ", size: " SIZE_FORMAT,
+    assert(node->index() <= buffer_size(),
+           "Buffer overconsumed: index: " SIZE_FORMAT ", size: " SIZE_FORMAT,
            node->index(), buffer_size());
-    deallocate_buffer(node);
+    if (node->index() == buffer_size()) {
+      deallocate_buffer(node);
+    } else {
+      // The remaining cards have been deferred to the next garbage collection.
+      record_deferred_buffer(node);
+    }
   } else {
     assert(node->index() < buffer_size(), "Buffer fully consumed.");
     // Buffer incompletely processed because there is a pending safepoint.
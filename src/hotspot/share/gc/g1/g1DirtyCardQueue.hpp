@@ -172,6 +172,12 @@ class G1DirtyCardQueueSet: public PtrQueueSet {
   // Buffers for which refinement is temporarily paused.
   // PausedBuffers has inner padding, including trailer.
   PausedBuffers _paused;
+  // Buffers whose remaining cards refinement left to the next garbage
+  // collection, see G1CollectionSetCandidates::try_defer_refinement().
+  // Their cards are not included in _num_cards, so they do not cause
+  // further refinement work.
+  BufferNode::Stack _deferred;
+  volatile size_t _num_deferred_cards;
 
   G1FreeIdSet _free_ids;
 
@@ -192,6 +198,12 @@ class G1DirtyCardQueueSet: public PtrQueueSet {
   // precondition: at safepoint.
   void enqueue_all_paused_buffers();
 
+  // Thread-safe add a buffer whose remaining cards have been deferred.
+  void record_deferred_buffer(BufferNode* node);
+  // Transfer all deferred buffers to the queue.
+  // precondition: at safepoint.
+  void enqueue_all_deferred_buffers();
+
   void abandon_completed_buffers();
 
   // Refine the cards in "node" from its index to buffer_size.
@@ -200,13 +212,15 @@ class G1DirtyCardQueueSet: public PtrQueueSet {
   // is a pending yield request.  The node's index is updated to exclude
   // the processed elements, e.g. up to the element before processing
   // stopped, or one past the last element if the entire buffer was
-  // processed. Updates stats.
+  // processed. Cards whose refinement has been deferred are moved to the
+  // end of the buffer and are not considered processed. Updates stats.
   bool refine_buffer(BufferNode* node,
                      uint worker_id,
                      G1ConcurrentRefineStats* stats);
 
   // Deal with buffer after a call to refine_buffer.  If fully processed,
-  // deallocate the buffer.  Otherwise, record it as paused.
+  // deallocate the buffer, or record it as deferred if it still contains
+  // deferred cards.  Otherwise, record it as paused.
   void handle_refined_buffer(BufferNode* node, bool fully_processed);
 
   // Thread-safe attempt to remove and return the first buffer from
@@ -248,6 +262,10 @@ public:
   // is a concurrent modification of the set of buffers.
   size_t num_cards() const;
 
+  // Number of cards in buffers whose refinement has been deferred to the
+  // next garbage collection. These are not included in num_cards().
+  size_t num_deferred_cards() const;
+
   void merge_bufferlists(G1RedirtyCardsQueueSet* src);
 
   BufferNodeList take_all_completed_buffers();
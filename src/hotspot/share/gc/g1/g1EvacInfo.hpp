@@ -58,8 +58,8 @@ public:
     _collection_set_used_after += used;
   }
 
-  void set_alloc_regions_used_before(size_t used) {
-    _alloc_regions_used_before = used;
+  void add_alloc_regions_used_before(size_t used) {
+    _alloc_regions_used_before += used;
   }
 
   void set_bytes_used(size_t used) {
@@ -110,6 +110,7 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
     MergeRSHowlInline,
     MergeRSHowlArrayOfCards,
     MergeRSHowlBitmap,
+    MergeRSHowlRuns,
     MergeRSHowlFull,
     MergeRSCards,
     MergeRSContainersSentinel
@@ -117,7 +118,8 @@ class G1GCPhaseTimes : public CHeapObj<mtGC> {
 
   static constexpr const char* GCMergeRSWorkItemsStrings[MergeRSContainersSentinel] =
     { "Merged Inline", "Merged ArrayOfCards", "Merged Howl", "Merged Full",
-      "Merged Howl Inline", "Merged Howl ArrayOfCards", "Merged Howl BitMap", "Merged Howl Full",
+      "Merged Howl Inline", "Merged Howl ArrayOfCards", "Merged Howl BitMap", "Merged Howl Runs",
+      "Merged Howl Full",
       "Merged Cards" };
 
   enum GCScanHRWorkItems {
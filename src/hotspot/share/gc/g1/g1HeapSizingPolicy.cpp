@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,7 +28,9 @@
 #include "gc/g1/g1HeapSizingPolicy.hpp"
 #include "gc/shared/gc_globals.hpp"
 #include "logging/log.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/globals.hpp"
+#include "utilities/align.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 
@@ -83,6 +85,12 @@ static void log_expansion(double short_term_pause_time_ratio,
                             resize_bytes);
 }
 
+size_t G1HeapSizingPolicy::soft_max_capacity() {
+  // SoftMaxHeapSize is manageable and may change at any time.
+  size_t soft_max = align_up(Atomic::load(&SoftMaxHeapSize), HeapRegion::GrainBytes);
+  return clamp(soft_max, MinHeapSize, MaxHeapSize);
+}
+
 size_t G1HeapSizingPolicy::young_collection_expansion_amount() {
   assert(GCTimeRatio > 0, "must be");
 
@@ -92,8 +100,9 @@ size_t G1HeapSizingPolicy::young_collection_expansion_amount() {
   double threshold = scale_with_heap(pause_time_threshold);
 
   size_t expand_bytes = 0;
+  const size_t max_bytes = soft_max_capacity();
 
-  if (_g1h->capacity() == _g1h->max_capacity()) {
+  if (_g1h->capacity() >= max_bytes) {
     log_expansion(short_term_pause_time_ratio, long_term_pause_time_ratio,
                   threshold, pause_time_threshold, true, 0);
     clear_ratio_check_data();
@@ -124,9 +133,8 @@ size_t G1HeapSizingPolicy::young_collection_expansion_amount() {
   if ((_ratio_over_threshold_count == MinOverThresholdForGrowth) ||
       (filled_history_buffer && (long_term_pause_time_ratio > threshold))) {
     size_t min_expand_bytes = HeapRegion::GrainBytes;
-    size_t reserved_bytes = _g1h->max_capacity();
     size_t committed_bytes = _g1h->capacity();
-    size_t uncommitted_bytes = reserved_bytes - committed_bytes;
+    size_t uncommitted_bytes = max_bytes - committed_bytes;
     size_t expand_bytes_via_pct =
       uncommitted_bytes * G1ExpandByPercentOfAvailable / 100;
     double scale_factor = 1.0;
@@ -174,7 +182,7 @@ size_t G1HeapSizingPolicy::young_collection_expansion_amount() {
     expand_bytes = static_cast<size_t>(expand_bytes * scale_factor);
 
     // Ensure the expansion size is at least the minimum growth amount
-    // and at most the remaining uncommitted byte size.
+    // and at most the remaining uncommitted byte size below the soft maximum.
     expand_bytes = clamp(expand_bytes, min_expand_bytes, uncommitted_bytes);
 
     clear_ratio_check_data();
@@ -197,6 +205,31 @@ size_t G1HeapSizingPolicy::young_collection_expansion_amount() {
   return expand_bytes;
 }
 
+size_t G1HeapSizingPolicy::predicted_young_collection_expansion_amount() const {
+  if (_ratio_over_threshold_count == 0) {
+    // Recent pause time ratios did not exceed the threshold.
+    return 0;
+  }
+
+  size_t committed_bytes = _g1h->capacity();
+  size_t max_bytes = soft_max_capacity();
+  if (committed_bytes >= max_bytes) {
+    return 0;
+  }
+  size_t uncommitted_bytes = max_bytes - committed_bytes;
+
+  // Predict the base expansion size young_collection_expansion_amount() uses
+  // before scaling it with the amount the threshold has been exceeded by.
+  size_t expand_bytes;
+  if (committed_bytes < InitialHeapSize / 4) {
+    expand_bytes = (InitialHeapSize - committed_bytes) / 2;
+  } else {
+    size_t expand_bytes_via_pct = uncommitted_bytes * G1ExpandByPercentOfAvailable / 100;
+    expand_bytes = MIN2(expand_bytes_via_pct, committed_bytes);
+  }
+  return clamp(expand_bytes, HeapRegion::GrainBytes, uncommitted_bytes);
+}
+
 static size_t target_heap_capacity(size_t used_bytes, uintx free_ratio) {
   const double desired_free_percentage = (double) free_ratio / 100.0;
   const double desired_used_percentage = 1.0 - desired_free_percentage;
@@ -244,6 +277,9 @@ size_t G1HeapSizingPolicy::full_collection_resize_amount(bool& expand) {
   // with respect to the heap max size as it's an upper bound (i.e.,
   // we'll try to make the capacity smaller than it, not greater).
   maximum_desired_capacity =  MAX2(maximum_desired_capacity, MinHeapSize);
+  // Shrink towards SoftMaxHeapSize, but keep at least MinHeapFreeRatio free.
+  maximum_desired_capacity = MAX2(MIN2(maximum_desired_capacity, soft_max_capacity()),
+                                  minimum_desired_capacity);
 
   // Don't expand unless it's significant; prefer expansion to shrinking.
   if (capacity_after_gc < minimum_desired_capacity) {
@@ -263,8 +299,10 @@ size_t G1HeapSizingPolicy::full_collection_resize_amount(bool& expand) {
 
     log_debug(gc, ergo, heap)("Attempt heap shrinking (capacity higher than max desired capacity). "
                               "Capacity: " SIZE_FORMAT "B occupancy: " SIZE_FORMAT "B live: " SIZE_FORMAT "B "
-                              "maximum_desired_capacity: " SIZE_FORMAT "B (" UINTX_FORMAT " %%)",
-                              capacity_after_gc, used_after_gc, _g1h->used(), maximum_desired_capacity, MaxHeapFreeRatio);
+                              "maximum_desired_capacity: " SIZE_FORMAT "B (" UINTX_FORMAT " %%) "
+                              "soft_max_capacity: " SIZE_FORMAT "B",
+                              capacity_after_gc, used_after_gc, _g1h->used(), maximum_desired_capacity, MaxHeapFreeRatio,
+                              soft_max_capacity());
 
     expand = false;
     return shrink_bytes;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2016, 2020, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2016, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -49,6 +49,11 @@ class G1HeapSizingPolicy: public CHeapObj<mtGC> {
   // eagerly at small heap sizes.
   double scale_with_heap(double pause_time_threshold);
 
+  // The capacity heap sizing tries to keep the heap within: SoftMaxHeapSize,
+  // but at least MinHeapSize. Heap expansion to satisfy an allocation and
+  // to keep MinHeapFreeRatio free may still exceed it.
+  static size_t soft_max_capacity();
+
   G1HeapSizingPolicy(const G1CollectedHeap* g1h, const G1Analytics* analytics);
 public:
 
@@ -56,6 +61,11 @@ public:
   // exceeded the desired limit, return an amount to expand by.
   size_t young_collection_expansion_amount();
 
+  // Returns the amount of bytes the heap is likely to be expanded by after one
+  // of the next young collections, because recent GC overhead exceeded the
+  // desired limit without triggering an expansion yet.
+  size_t predicted_young_collection_expansion_amount() const;
+
   // Returns the amount of bytes to resize the heap; if expand is set, the heap
   // should by expanded by that amount, shrunk otherwise.
   size_t full_collection_resize_amount(bool& expand);
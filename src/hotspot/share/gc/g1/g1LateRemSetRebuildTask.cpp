@@ -0,0 +1,432 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.inline.hpp"
+#include "gc/g1/g1CollectionSetCandidates.hpp"
+#include "gc/g1/g1CollectionSet.hpp"
+#include "gc/g1/g1DirtyCardQueue.hpp"
+#include "gc/g1/g1LateRemSetRebuildTask.hpp"
+#include "gc/g1/g1Policy.hpp"
+#include "gc/g1/g1_globals.hpp"
+#include "gc/g1/heapRegion.inline.hpp"
+#include "gc/g1/heapRegionRemSet.inline.hpp"
+#include "gc/shared/suspendibleThreadSet.hpp"
+#include "logging/log.hpp"
+#include "memory/iterator.inline.hpp"
+#include "memory/memRegion.hpp"
+#include "oops/access.inline.hpp"
+#include "oops/oop.inline.hpp"
+#include "runtime/os.hpp"
+
+// Adds references into regions with a remembered set in Updating state, i.e.
+// the targets of the late rebuild, to their remembered sets. Other tracked
+// remembered sets are already complete.
+class G1LateRebuildRemSetClosure : public BasicOopIterateClosure {
+  G1CollectedHeap* _g1h;
+  uint _worker_id;
+
+  template <class T> void do_oop_work(T* p) {
+    oop const obj = RawAccess<MO_RELAXED>::oop_load(p);
+    if (obj == nullptr) {
+      return;
+    }
+
+    if (HeapRegion::is_in_same_region(p, obj)) {
+      return;
+    }
+
+    HeapRegionRemSet* rem_set = _g1h->heap_region_containing(obj)->rem_set();
+    if (rem_set->is_updating()) {
+      rem_set->add_reference(p, _worker_id);
+    }
+  }
+
+public:
+  G1LateRebuildRemSetClosure(G1CollectedHeap* g1h, uint worker_id) : _g1h(g1h), _worker_id(worker_id) { }
+
+  virtual void do_oop(oop* p)       { do_oop_work(p); }
+  virtual void do_oop(narrowOop* p) { do_oop_work(p); }
+
+  virtual ReferenceIterationMode reference_iteration_mode() { return DO_FIELDS; }
+};
+
+// The late rebuild never runs concurrently with marking, so it may use the
+// remembered set worker id of the first concurrent marking worker.
+static uint late_rebuild_worker_id() {
+  return G1DirtyCardQueueSet::num_par_ids() + G1ConcRefinementThreads;
+}
+
+G1LateRemSetRebuildTask::G1LateRemSetRebuildTask(const char* name) :
+  G1ServiceTask(name),
+  _g1h(G1CollectedHeap::heap()),
+  _state(State::Inactive),
+  _epoch(0),
+  _started_in_mixed_phase(false),
+  _targets(),
+  _max_regions(0),
+  _scan_limits(nullptr),
+  _cur_region(0),
+  _cur_addr(nullptr) { }
+
+G1LateRemSetRebuildTask::~G1LateRemSetRebuildTask() {
+  FREE_C_HEAP_ARRAY(HeapWord*, _scan_limits);
+}
+
+void G1LateRemSetRebuildTask::initialize(uint max_regions) {
+  assert(_scan_limits == nullptr, "already initialized");
+  _max_regions = max_regions;
+  _scan_limits = NEW_C_HEAP_ARRAY(HeapWord*, max_regions, mtGC);
+  clear_scan_limits();
+}
+
+void G1LateRemSetRebuildTask::clear_scan_limits() {
+  for (uint i = 0; i < _max_regions; i++) {
+    _scan_limits[i] = nullptr;
+  }
+}
+
+void G1LateRemSetRebuildTask::set_state(State new_state) {
+  log_trace(gc, remset, tracking)("Late Rebuild: State change from %u to %u",
+                                  static_cast<std::underlying_type_t<State>>(_state),
+                                  static_cast<std::underlying_type_t<State>>(new_state));
+  _state = new_state;
+}
+
+static int compare_live_bytes(HeapRegion** r1, HeapRegion** r2) {
+  size_t live1 = (*r1)->live_bytes();
+  size_t live2 = (*r2)->live_bytes();
+  if (live1 < live2) {
+    return -1;
+  } else if (live1 > live2) {
+    return 1;
+  } else {
+    return 0;
+  }
+}
+
+bool G1LateRemSetRebuildTask::start() {
+  assert_at_safepoint_on_vm_thread();
+  assert(!is_active(), "must be");
+  assert(_targets.is_empty(), "must be");
+
+  G1CollectionSetCandidates* candidates = _g1h->collection_set()->candidates();
+  size_t const live_threshold = HeapRegion::GrainBytes * G1LateRemSetRebuildLiveThresholdPercent / 100;
+
+  GrowableArrayCHeap<HeapRegion*, mtGC> eligible;
+  for (uint i = 0; i < _max_regions; i++) {
+    HeapRegion* r = _g1h->region_at_or_null(i);
+    if (r == nullptr || !r->is_old() || r->rem_set()->is_tracked() || candidates->contains(r)) {
+      continue;
+    }
+    size_t const live_bytes = r->live_bytes();
+    if (live_bytes > 0 && live_bytes <= live_threshold) {
+      eligible.append(r);
+    }
+  }
+
+  // Prefer the regions with the least live data; limit the number of targets to
+  // about what a single mixed gc may evacuate.
+  eligible.sort(compare_live_bytes);
+  uint const max_targets = MIN2((uint)eligible.length(), _g1h->policy()->calc_max_old_cset_length());
+  for (uint i = 0; i < max_targets; i++) {
+    _targets.append(eligible.at(i));
+  }
+
+  if (_targets.is_empty()) {
+    log_debug(gc, remset, tracking)("Late Rebuild: No regions selected");
+    return false;
+  }
+
+  // All old and humongous regions with objects that might reference the targets
+  // must be scanned up to their current top. Humongous primitive arrays do not
+  // contain references.
+  for (uint i = 0; i < _max_regions; i++) {
+    HeapRegion* r = _g1h->region_at_or_null(i);
+    HeapWord* limit = nullptr;
+    if (r != nullptr && r->is_old_or_humongous()) {
+      if (!r->is_humongous() || !cast_to_oop(r->humongous_start_region()->bottom())->is_typeArray()) {
+        limit = r->top();
+      }
+    }
+    _scan_limits[i] = limit;
+  }
+
+  for (HeapRegion* r : _targets) {
+    r->rem_set()->set_state_updating();
+  }
+
+  _cur_region = 0;
+  _cur_addr = nullptr;
+  _epoch++;
+
+  log_debug(gc, remset, tracking)("Late Rebuild: Selected %d of %d eligible regions", _targets.length(), eligible.length());
+  return true;
+}
+
+void G1LateRemSetRebuildTask::complete() {
+  assert_at_safepoint_on_vm_thread();
+  assert(_state == State::Completed, "must be");
+
+  GrowableArrayCHeap<G1CollectionCandidateList::CandidateInfo, mtGC> infos(_targets.length());
+  for (HeapRegion* r : _targets) {
+    // All targets are still old regions, freeing them requires a full gc, which
+    // aborts the late rebuild.
+    assert(r->is_old() && r->rem_set()->is_updating(), "Late rebuild target %u must be updating old region but is %s %s",
+           r->hrm_index(), r->get_short_type_str(), r->rem_set()->get_state_str());
+    r->rem_set()->set_state_complete();
+    infos.append(G1CollectionCandidateList::CandidateInfo(r, r->calc_gc_efficiency()));
+  }
+  infos.sort(G1CollectionCandidateList::compare);
+  _g1h->collection_set()->candidates()->add_late_rebuild_candidates(infos.adr_at(0), (uint)infos.length());
+
+  log_debug(gc, remset, tracking)("Late Rebuild: Added %d candidate regions", infos.length());
+
+  _targets.clear();
+  clear_scan_limits();
+  set_state(State::Inactive);
+}
+
+void G1LateRemSetRebuildTask::abort(const char* reason) {
+  assert_at_safepoint_on_vm_thread();
+
+  if (!is_active()) {
+    return;
+  }
+
+  for (HeapRegion* r : _targets) {
+    if (r->rem_set()->is_updating()) {
+      r->rem_set()->clear(true /* only_cardset */);
+    }
+  }
+  log_debug(gc, remset, tracking)("Late Rebuild: Aborted for %d regions (%s)", _targets.length(), reason);
+
+  _targets.clear();
+  clear_scan_limits();
+  _epoch++;
+  set_state(State::Inactive);
+}
+
+void G1LateRemSetRebuildTask::record_young_collection_end() {
+  assert_at_safepoint_on_vm_thread();
+
+  G1CollectorState* collector_state = _g1h->collector_state();
+  if (!collector_state->in_mixed_phase()) {
+    abort("mixed phase ended");
+    _started_in_mixed_phase = false;
+    return;
+  }
+
+  switch (_state) {
+    case State::Inactive: {
+      if (!_started_in_mixed_phase) {
+        _started_in_mixed_phase = true;
+        if (start()) {
+          set_state(State::Scanning);
+          _g1h->service_thread()->schedule_task(this, 0);
+        }
+      }
+      break;
+    }
+    case State::Scanning: {
+      // Still in progress.
+      break;
+    }
+    case State::Completed: {
+      complete();
+      break;
+    }
+    default:
+      ShouldNotReachHere();
+  }
+}
+
+void G1LateRemSetRebuildTask::record_full_collection_start() {
+  abort("full gc");
+  _started_in_mixed_phase = false;
+}
+
+void G1LateRemSetRebuildTask::note_region_freed(HeapRegion* r) {
+  assert_at_safepoint();
+  _scan_limits[r->hrm_index()] = nullptr;
+}
+
+bool G1LateRemSetRebuildTask::yield_if_necessary(uint epoch) {
+  if (SuspendibleThreadSet::should_yield()) {
+    SuspendibleThreadSet::yield();
+  }
+  return _state != State::Scanning || _epoch != epoch;
+}
+
+bool G1LateRemSetRebuildTask::scan_humongous_region(HeapRegion* hr, HeapWord* limit, uint epoch, jlong deadline) {
+  G1LateRebuildRemSetClosure cl(_g1h, late_rebuild_worker_id());
+  size_t const chunk_words = G1RebuildRemSetChunkSize / HeapWordSize;
+
+  oop humongous = cast_to_oop(hr->humongous_start_region()->bottom());
+  HeapWord* const end = MIN2(limit, hr->humongous_start_region()->bottom() + humongous->size());
+
+  // Humongous objects can be scanned in chunks, so progress can be kept across
+  // yields at any address.
+  while (_cur_addr < end) {
+    MemRegion mr(_cur_addr, MIN2(_cur_addr + chunk_words, end));
+    humongous->oop_iterate(&cl, mr);
+    _cur_addr = mr.end();
+
+    if (yield_if_necessary(epoch)) {
+      return true;
+    }
+    if (_scan_limits[hr->hrm_index()] == nullptr) {
+      // Eagerly reclaimed during the yield.
+      return false;
+    }
+    if (os::elapsed_counter() >= deadline) {
+      return _cur_addr < end;
+    }
+  }
+  return false;
+}
+
+bool G1LateRemSetRebuildTask::scan_old_region(HeapRegion* hr, HeapWord* limit, uint epoch, jlong deadline) {
+  G1LateRebuildRemSetClosure cl(_g1h, late_rebuild_worker_id());
+  size_t const chunk_words = G1RebuildRemSetChunkSize / HeapWordSize;
+  size_t processed_words = 0;
+
+  // Returns whether scanning of this region needs to stop after a yield.
+  auto yield_and_check = [&] (bool& stop_scanning) {
+    // A collection set candidate may have been evacuated during the yield; if that
+    // failed the region stays old, but the object layout may have changed as dead
+    // objects were replaced by filler objects. Restart such a region from bottom.
+    bool const may_be_evacuated = hr->is_collection_set_candidate();
+    uint const collections = _g1h->total_collections();
+
+    stop_scanning = yield_if_necessary(epoch);
+    if (stop_scanning || _scan_limits[hr->hrm_index()] == nullptr) {
+      return true;
+    }
+    if (may_be_evacuated && collections != _g1h->total_collections()) {
+      _cur_addr = hr->bottom();
+      return true;
+    }
+    return false;
+  };
+
+  while (_cur_addr < limit) {
+    oop obj = cast_to_oop(_cur_addr);
+    size_t const obj_size = obj->size();
+
+    if (obj_size > chunk_words) {
+      // Large object, scan in chunks to not stall safepoints.
+      HeapWord* const obj_end = _cur_addr + obj_size;
+      HeapWord* start = _cur_addr;
+      do {
+        MemRegion mr(start, MIN2(start + chunk_words, obj_end));
+        obj->oop_iterate(&cl, mr);
+        start = mr.end();
+
+        bool stop_scanning;
+        if (start < obj_end && yield_and_check(stop_scanning)) {
+          return stop_scanning || _cur_addr == hr->bottom();
+        }
+      } while (start < obj_end);
+    } else {
+      obj->oop_iterate(&cl);
+      processed_words += obj_size;
+    }
+    _cur_addr += obj_size;
+
+    if (processed_words >= chunk_words || obj_size > chunk_words) {
+      processed_words = 0;
+      bool stop_scanning;
+      if (yield_and_check(stop_scanning)) {
+        return stop_scanning || _cur_addr == hr->bottom();
+      }
+      if (os::elapsed_counter() >= deadline) {
+        return _cur_addr < limit;
+      }
+    }
+  }
+  return false;
+}
+
+bool G1LateRemSetRebuildTask::scan_step() {
+  if (_state != State::Scanning) {
+    return false;
+  }
+
+  jlong const start = os::elapsed_counter();
+  jlong const deadline = start + (os::elapsed_frequency() / 1000) * G1LateRemSetRebuildStepDurationMillis;
+  uint const epoch = _epoch;
+
+  while (_cur_region < _max_regions) {
+    HeapWord* const limit = _scan_limits[_cur_region];
+    if (limit == nullptr) {
+      _cur_region++;
+      _cur_addr = nullptr;
+      continue;
+    }
+
+    HeapRegion* hr = _g1h->region_at(_cur_region);
+    if (_cur_addr == nullptr) {
+      _cur_addr = hr->bottom();
+    }
+
+    bool more_work_in_region;
+    if (hr->is_humongous()) {
+      more_work_in_region = scan_humongous_region(hr, limit, epoch, deadline);
+    } else {
+      more_work_in_region = scan_old_region(hr, limit, epoch, deadline);
+    }
+
+    if (_state != State::Scanning || _epoch != epoch) {
+      // Aborted or restarted during a yield; any new scan has been scheduled separately.
+      return false;
+    }
+    if (more_work_in_region) {
+      // Either the deadline passed, or scanning of the region needs to be restarted.
+      if (os::elapsed_counter() >= deadline) {
+        return true;
+      }
+      continue;
+    }
+
+    _cur_region++;
+    _cur_addr = nullptr;
+
+    if (os::elapsed_counter() >= deadline) {
+      return true;
+    }
+  }
+
+  log_debug(gc, remset, tracking)("Late Rebuild: Scanning completed for %d regions", _targets.length());
+  set_state(State::Completed);
+  return false;
+}
+
+void G1LateRemSetRebuildTask::execute() {
+  SuspendibleThreadSetJoiner sts;
+
+  if (scan_step()) {
+    schedule(0);
+  }
+}
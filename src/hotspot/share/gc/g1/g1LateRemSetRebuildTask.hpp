@@ -0,0 +1,128 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1LATEREMSETREBUILDTASK_HPP
+#define SHARE_GC_G1_G1LATEREMSETREBUILDTASK_HPP
+
+#include "gc/g1/g1ServiceThread.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/growableArray.hpp"
+
+class G1CollectedHeap;
+class HeapRegion;
+
+// Task rebuilding the remembered sets of additional old regions during the
+// mixed phase, i.e. after the regular rebuild that is part of concurrent marking.
+//
+// At the first pause of the mixed phase a set of old regions that has not been
+// selected for rebuild by G1RemSetTrackingPolicy at Remark, but has less than
+// G1LateRemSetRebuildLiveThresholdPercent live data, is selected as targets.
+// Their remembered set state is set to Updating, and the current top of every
+// old and humongous region is recorded as the limit up to which that region
+// needs to be scanned for references into the targets.
+//
+// From that pause on, refinement and evacuation record new references into the
+// targets like for any other tracked remembered set. This task scans the
+// objects below the recorded limits in steps of at most
+// G1LateRemSetRebuildStepDurationMillis on the service thread, yielding
+// to safepoints in between.
+//
+// The first pause after scanning completed sets the remembered set state of the
+// targets to Complete and adds them to the collection set candidates, so that
+// the remaining mixed gcs may evacuate them. If the mixed phase ends, marking
+// starts, or a full gc occurs while still in progress, the incomplete
+// remembered sets of the targets are dropped.
+class G1LateRemSetRebuildTask : public G1ServiceTask {
+  enum class State : uint {
+    Inactive,           // No late rebuild in progress.
+    Scanning,           // Targets selected, scanning the heap for references into them.
+    Completed           // Scanning completed, waiting for the next pause to add the candidates.
+  };
+
+  G1CollectedHeap* _g1h;
+
+  State _state;
+  // Incremented every time the set of targets changes. Allows the scanning step
+  // to detect that the targets changed while it yielded.
+  uint _epoch;
+  // Whether a late rebuild has already been attempted during the current mixed phase.
+  bool _started_in_mixed_phase;
+
+  GrowableArrayCHeap<HeapRegion*, mtGC> _targets;
+
+  // Per region the address up to which the region must be scanned, or null if
+  // the region does not need to be scanned (any more).
+  uint _max_regions;
+  HeapWord** _scan_limits;
+
+  // Scanning progress; _cur_addr is null if scanning of _cur_region has not
+  // been started yet.
+  uint _cur_region;
+  HeapWord* _cur_addr;
+
+  void set_state(State new_state);
+
+  bool is_active() const { return _state != State::Inactive; }
+
+  // Select target regions and prepare for scanning. Returns whether any target
+  // region has been found.
+  bool start();
+  // Make the target regions collection set candidates.
+  void complete();
+  // Drop the remembered sets of the targets.
+  void abort(const char* reason);
+
+  void clear_scan_limits();
+
+  // Yield to a pending safepoint. Returns whether scanning must not continue
+  // because the targets changed.
+  bool yield_if_necessary(uint epoch);
+
+  // Scan the given humongous region from _cur_addr to limit.
+  bool scan_humongous_region(HeapRegion* hr, HeapWord* limit, uint epoch, jlong deadline);
+  // Scan the given old region from _cur_addr to limit.
+  bool scan_old_region(HeapRegion* hr, HeapWord* limit, uint epoch, jlong deadline);
+
+  // Do a single step of scanning. Returns whether there is more work to do and
+  // this task should be rescheduled.
+  bool scan_step();
+
+public:
+  explicit G1LateRemSetRebuildTask(const char* name);
+  ~G1LateRemSetRebuildTask();
+
+  void initialize(uint max_regions);
+
+  void execute() override;
+
+  // Advance the late rebuild at the end of a young collection.
+  void record_young_collection_end();
+  // Drop any late rebuild in progress at the start of a full collection.
+  void record_full_collection_start();
+
+  // Region r has just been freed, it does not need scanning any more.
+  void note_region_freed(HeapRegion* r);
+};
+
+#endif // SHARE_GC_G1_G1LATEREMSETREBUILDTASK_HPP
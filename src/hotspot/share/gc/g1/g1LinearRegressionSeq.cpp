@@ -0,0 +1,126 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1LinearRegressionSeq.hpp"
+#include "gc/g1/g1Predictions.hpp"
+#include "memory/allocation.inline.hpp"
+#include "utilities/debug.hpp"
+
+#include <math.h>
+
+G1LinearRegressionSeq::G1LinearRegressionSeq(uint length) :
+  _length(length),
+  _num(0),
+  _next(0),
+  _x(NEW_C_HEAP_ARRAY(double, length, mtGC)),
+  _y(NEW_C_HEAP_ARRAY(double, length, mtGC)) {
+  assert(length >= MinSamples, "must keep at least %u samples", MinSamples);
+}
+
+G1LinearRegressionSeq::~G1LinearRegressionSeq() {
+  FREE_C_HEAP_ARRAY(double, _x);
+  FREE_C_HEAP_ARRAY(double, _y);
+}
+
+void G1LinearRegressionSeq::add(double x, double y) {
+  _x[_next] = x;
+  _y[_next] = y;
+  _next = (_next + 1) % _length;
+  _num = MIN2(_num + 1, _length);
+}
+
+bool G1LinearRegressionSeq::fit(Fit* result) const {
+  // Minimum spread of the sampled x values, relative to their mean, for the
+  // slope to be meaningful.
+  const double MinRelativeXDeviation = 0.01;
+
+  if (_num < MinSamples) {
+    return false;
+  }
+
+  double x_sum = 0.0;
+  double y_sum = 0.0;
+  for (uint i = 0; i < _num; i++) {
+    x_sum += _x[i];
+    y_sum += _y[i];
+  }
+  double x_mean = x_sum / _num;
+  double y_mean = y_sum / _num;
+
+  double x_sq_diff_sum = 0.0;
+  double xy_diff_sum = 0.0;
+  for (uint i = 0; i < _num; i++) {
+    double x_diff = _x[i] - x_mean;
+    x_sq_diff_sum += x_diff * x_diff;
+    xy_diff_sum += x_diff * (_y[i] - y_mean);
+  }
+
+  double min_x_deviation = x_mean * MinRelativeXDeviation;
+  if (x_sq_diff_sum <= min_x_deviation * min_x_deviation * _num) {
+    return false;
+  }
+
+  double slope = xy_diff_sum / x_sq_diff_sum;
+  if (slope < 0.0) {
+    return false;
+  }
+  double intercept = y_mean - slope * x_mean;
+
+  double residual_sq_sum = 0.0;
+  for (uint i = 0; i < _num; i++) {
+    double residual = _y[i] - (intercept + slope * _x[i]);
+    residual_sq_sum += residual * residual;
+  }
+
+  result->_num = _num;
+  result->_intercept = intercept;
+  result->_slope = slope;
+  // Two degrees of freedom are used up by the fit itself.
+  result->_residual_variance = residual_sq_sum / (_num - 2);
+  result->_x_sq_diff_sum = x_sq_diff_sum;
+  return true;
+}
+
+bool G1LinearRegressionSeq::has_model() const {
+  Fit f;
+  return fit(&f);
+}
+
+double G1LinearRegressionSeq::predict_slope(const G1Predictions* predictor) const {
+  Fit f;
+  bool has_fit = fit(&f);
+  assert(has_fit, "must have a model to predict");
+
+  double slope_variance = f._residual_variance / f._x_sq_diff_sum;
+  return f._slope + predictor->sigma() * sqrt(slope_variance);
+}
+
+double G1LinearRegressionSeq::predict_intercept() const {
+  Fit f;
+  bool has_fit = fit(&f);
+  assert(has_fit, "must have a model to predict");
+
+  return f._intercept;
+}
@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_G1_G1LINEARREGRESSIONSEQ_HPP
+#define SHARE_GC_G1_G1LINEARREGRESSIONSEQ_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class G1Predictions;
+
+// Keeps the most recent samples (x, y) of some cost y depending on an amount
+// of work x, e.g. the time taken by a garbage collection phase and the number
+// of cards or bytes processed in it, and fits the linear model
+//
+//   y = intercept + slope * x
+//
+// to them using least squares. In contrast to averaging the cost per unit of
+// work, the fixed part of the cost is modeled separately, and the model follows
+// changes in the relation between x and y as soon as the old samples drop out.
+//
+// The model is used by splitting predictions into the fitted fixed cost, and
+// an upper confidence bound of the slope (the fitted slope plus sigma times its
+// standard error) that is the cost per additional unit of work. This allows
+// summing up predictions for parts of the work, e.g. per region, without
+// counting the fixed cost multiple times.
+class G1LinearRegressionSeq {
+  const uint _length;
+  uint _num;              // Number of valid samples.
+  uint _next;             // Index of the next sample to overwrite.
+  double* _x;
+  double* _y;
+
+  NONCOPYABLE(G1LinearRegressionSeq);
+
+  struct Fit {
+    uint _num;
+    double _intercept;
+    double _slope;
+    // Variance of the samples around the fit.
+    double _residual_variance;
+    // Sum of squared differences of the sampled x values from their mean.
+    double _x_sq_diff_sum;
+  };
+
+  // Fits the model to the current samples. Returns false if there is no useful
+  // fit, i.e. not enough samples, too little spread in their x values, or the
+  // cost decreasing with the amount of work.
+  bool fit(Fit* result) const;
+
+public:
+  static const uint MinSamples = 3;
+
+  explicit G1LinearRegressionSeq(uint length);
+  ~G1LinearRegressionSeq();
+
+  void add(double x, double y);
+
+  uint num() const { return _num; }
+
+  // Returns whether the samples allow predictions.
+  bool has_model() const;
+
+  // Predicts the cost per unit of work including the confidence bound.
+  // Requires has_model().
+  double predict_slope(const G1Predictions* predictor) const;
+  // Predicts the fixed cost, which may be negative. Requires has_model().
+  double predict_intercept() const;
+};
+
+#endif // SHARE_GC_G1_G1LINEARREGRESSIONSEQ_HPP
@@ -87,6 +87,8 @@ public:
     NewRegionAlloc,
     // Statistics of object processing during copy to survivor region.
     LocalObjProcessAtCopyToSurv,
+    // Statistics of old region placement during copy to old region.
+    LocalObjCopyToOld,
     NodeDataItemsSentinel
   };
 
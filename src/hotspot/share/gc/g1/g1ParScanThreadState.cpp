@@ -79,12 +79,14 @@ G1ParScanThreadState::G1ParScanThreadState(G1CollectedHeap* g1h,
     _surviving_young_words(nullptr),
     _surviving_words_length(collection_set->young_region_length() + 1),
     _old_gen_is_full(false),
+    _fast_copy_max_word_size(G1EvacuationFailureALot ? 0 : G1FastCopyMaxObjectWords),
     _partial_objarray_chunk_size(ParGCArrayScanChunk),
     _partial_array_stepper(num_workers),
     _string_dedup_requests(),
     _max_num_optional_regions(collection_set->optional_region_length()),
     _numa(g1h->numa()),
     _obj_alloc_stat(nullptr),
+    _old_alloc_stat(nullptr),
     EVAC_FAILURE_INJECTOR_ONLY(_evac_failure_inject_counter(0) COMMA)
     _preserved_marks(preserved_marks),
     _evacuation_failed_info(),
@@ -137,6 +139,7 @@ G1ParScanThreadState::~G1ParScanThreadState() {
   FREE_C_HEAP_ARRAY(size_t, _surviving_young_words_base);
   delete[] _oops_into_optional_regions;
   FREE_C_HEAP_ARRAY(size_t, _obj_alloc_stat);
+  FREE_C_HEAP_ARRAY(size_t, _old_alloc_stat);
 }
 
 size_t G1ParScanThreadState::lab_waste_words() const {
@@ -209,7 +212,8 @@ void G1ParScanThreadState::do_oop_evac(T* p) {
   if (m.is_marked()) {
     obj = cast_to_oop(m.decode_pointer());
   } else {
-    obj = do_copy_to_survivor_space(region_attr, obj, m);
+    oop copy = try_copy_small_to_survivor_space(region_attr, obj, m);
+    obj = (copy != nullptr) ? copy : do_copy_to_survivor_space(region_attr, obj, m);
   }
   RawAccess<IS_NOT_NULL>::oop_store(p, obj);
 
@@ -414,6 +418,9 @@ HeapWord* G1ParScanThreadState::allocate_copy_slow(G1HeapRegionAttr* dest_attr,
   }
   if (obj_ptr != nullptr) {
     update_numa_stats(node_index);
+    if (dest_attr->is_old()) {
+      update_numa_old_stats(node_index, obj_ptr);
+    }
     if (_g1h->gc_tracer_stw()->should_report_promotion_events()) {
       // The events are checked individually as part of the actual commit
       report_promotion_event(*dest_attr, old, word_sz, age, obj_ptr, node_index);
@@ -442,6 +449,68 @@ void G1ParScanThreadState::update_bot_after_copying(oop obj, size_t word_sz) {
   region->update_bot_for_obj(obj_start, word_sz);
 }
 
+MAYBE_INLINE_EVACUATION
+oop G1ParScanThreadState::try_copy_small_to_survivor_space(G1HeapRegionAttr const region_attr,
+                                                           oop const old,
+                                                           markWord const old_mark) {
+  assert(region_attr.is_in_cset(),
+         "Unexpected region attr type: %s", region_attr.get_type_str());
+
+  // Only objects staying in young gen. Evaluate the cheap conditions on the
+  // mark word and the klass kind first; objects taking the general path in the
+  // end only do these few additional checks.
+  if (!region_attr.is_young()) {
+    return nullptr;
+  }
+  uint age = !old_mark.has_displaced_mark_helper() ? old_mark.age()
+                                                   : old_mark.displaced_mark_helper().age();
+  if (age >= _tenuring_threshold) {
+    return nullptr;
+  }
+
+  Klass* klass = old->klass();
+  if (klass->is_array_klass() ||
+      klass->is_stack_chunk_instance_klass() ||
+      StringDedup::is_enabled_string(klass)) {
+    return nullptr;
+  }
+  const size_t word_sz = old->size_given_klass(klass);
+  if (word_sz > _fast_copy_max_word_size) {
+    return nullptr;
+  }
+
+  HeapRegion* const from_region = _g1h->heap_region_containing(old);
+  uint node_index = from_region->node_index();
+  HeapWord* obj_ptr = _plab_allocator->plab_allocate(region_attr, word_sz, node_index);
+  if (obj_ptr == nullptr) {
+    return nullptr;
+  }
+
+  Prefetch::write(obj_ptr, PrefetchCopyIntervalInBytes);
+  Copy::aligned_disjoint_words(cast_from_oop<HeapWord*>(old), obj_ptr, word_sz);
+
+  const oop obj = cast_to_oop(obj_ptr);
+  // See do_copy_to_survivor_space() about the memory ordering.
+  const oop forward_ptr = old->forward_to_atomic(obj, old_mark, memory_order_relaxed);
+  if (forward_ptr != nullptr) {
+    _plab_allocator->undo_allocation(region_attr, obj_ptr, word_sz, node_index);
+    return forward_ptr;
+  }
+
+  _surviving_young_words[from_region->young_index_in_cset()] += word_sz;
+
+  if (age < markWord::max_age) {
+    age++;
+    obj->incr_age();
+  }
+  _age_table.add(age, word_sz);
+
+  assert(_g1h->heap_region_containing(obj)->is_survivor(), "must be");
+  G1SkipCardEnqueueSetter x(&_scanner, true /* skip_card_enqueue */);
+  obj->oop_iterate_backwards(&_scanner, klass);
+  return obj;
+}
+
 // Private inline function, for direct internal use and providing the
 // implementation of the public not-inline function.
 MAYBE_INLINE_EVACUATION
@@ -671,6 +740,8 @@ void G1ParScanThreadState::initialize_numa_stats() {
       // Record only if there are multiple active nodes.
       _obj_alloc_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes, mtGC);
       memset(_obj_alloc_stat, 0, sizeof(size_t) * num_nodes);
+      _old_alloc_stat = NEW_C_HEAP_ARRAY(size_t, num_nodes * num_nodes, mtGC);
+      memset(_old_alloc_stat, 0, sizeof(size_t) * num_nodes * num_nodes);
     }
   }
 }
@@ -680,6 +751,12 @@ void G1ParScanThreadState::flush_numa_stats() {
     uint node_index = _numa->index_of_current_thread();
     _numa->copy_statistics(G1NUMAStats::LocalObjProcessAtCopyToSurv, node_index, _obj_alloc_stat);
   }
+  if (_old_alloc_stat != nullptr) {
+    uint num_nodes = _numa->num_active_nodes();
+    for (uint i = 0; i < num_nodes; i++) {
+      _numa->copy_statistics(G1NUMAStats::LocalObjCopyToOld, i, &_old_alloc_stat[i * num_nodes]);
+    }
+  }
 }
 
 void G1ParScanThreadState::update_numa_stats(uint node_index) {
@@ -688,6 +765,16 @@ void G1ParScanThreadState::update_numa_stats(uint node_index) {
   }
 }
 
+void G1ParScanThreadState::update_numa_old_stats(uint node_index, HeapWord* obj_ptr) {
+  if (_old_alloc_stat != nullptr) {
+    uint num_nodes = _numa->num_active_nodes();
+    uint alloc_node_index = _g1h->heap_region_containing(obj_ptr)->node_index();
+    if (node_index < num_nodes && alloc_node_index < num_nodes) {
+      _old_alloc_stat[node_index * num_nodes + alloc_node_index]++;
+    }
+  }
+}
+
 G1ParScanThreadStateSet::G1ParScanThreadStateSet(G1CollectedHeap* g1h,
                                                  uint num_workers,
                                                  G1CollectionSet* collection_set,
@@ -86,6 +86,9 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   // Indicates whether in the last generation (old) there is no more space
   // available for allocation.
   bool _old_gen_is_full;
+  // Maximum size in words of objects copied using the fast path; zero if the
+  // fast path is disabled.
+  size_t _fast_copy_max_word_size;
   // Size (in elements) of a partial objArray task chunk.
   int _partial_objarray_chunk_size;
   PartialArrayTaskStepper _partial_array_stepper;
@@ -102,6 +105,10 @@ class G1ParScanThreadState : public CHeapObj<mtGC> {
   // Only starts recording when log of gc+heap+numa is enabled and its data is
   // transferred when flushed.
   size_t* _obj_alloc_stat;
+  // Records, per node of the source region, how many PLABs and direct allocations
+  // during copy to old regions ended up at each node. Recorded and transferred
+  // like _obj_alloc_stat.
+  size_t* _old_alloc_stat;
 
   // Per-thread evacuation failure data structures.
   EVAC_FAILURE_INJECTOR_ONLY(size_t _evac_failure_inject_counter;)
@@ -177,6 +184,15 @@ private:
                                 oop obj,
                                 markWord old_mark);
 
+  // Fast path of do_copy_to_survivor_space() for the common case of small
+  // non-array objects copied from young to survivor regions. Returns null
+  // without side effects if the object needs the general path, e.g. because of
+  // its size or kind, because it is a string deduplication candidate or when
+  // allocating the copy in the PLAB fails.
+  oop try_copy_small_to_survivor_space(G1HeapRegionAttr region_attr,
+                                       oop obj,
+                                       markWord old_mark);
+
   // This method is applied to the fields of the objects that have just been copied.
   template <class T> void do_oop_evac(T* p);
 
@@ -207,6 +223,7 @@ private:
   void initialize_numa_stats();
   void flush_numa_stats();
   inline void update_numa_stats(uint node_index);
+  void update_numa_old_stats(uint node_index, HeapWord* obj_ptr);
 
 public:
   oop copy_to_survivor_space(G1HeapRegionAttr region_attr, oop obj, markWord old_mark);
@@ -35,9 +35,11 @@
 #include "gc/g1/g1ConcurrentRefineStats.hpp"
 #include "gc/g1/g1CollectionSetChooser.hpp"
 #include "gc/g1/g1IHOPControl.hpp"
+#include "gc/g1/g1LateRemSetRebuildTask.hpp"
 #include "gc/g1/g1GCPhaseTimes.hpp"
 #include "gc/g1/g1Policy.hpp"
 #include "gc/g1/g1SurvivorRegions.hpp"
+#include "gc/g1/g1Trace.hpp"
 #include "gc/g1/g1YoungGenSizer.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionRemSet.inline.hpp"
@@ -536,6 +538,9 @@ void G1Policy::record_full_collection_start() {
   // Release the future to-space so that it is available for compaction into.
   collector_state()->set_in_young_only_phase(false);
   collector_state()->set_in_full_gc(true);
+  if (_g1h->late_remset_rebuild_task() != nullptr) {
+    _g1h->late_remset_rebuild_task()->record_full_collection_start();
+  }
   _collection_set->abandon_all_candidates();
   _pending_cards_at_gc_start = 0;
 }
@@ -571,12 +576,14 @@ void G1Policy::record_full_collection_end() {
 static void log_refinement_stats(const char* kind, const G1ConcurrentRefineStats& stats) {
   log_debug(gc, refine, stats)
            ("%s refinement: %.2fms, refined: " SIZE_FORMAT
-            ", precleaned: " SIZE_FORMAT ", dirtied: " SIZE_FORMAT,
+            ", precleaned: " SIZE_FORMAT ", dirtied: " SIZE_FORMAT
+            ", deferred: " SIZE_FORMAT,
             kind,
             stats.refinement_time().seconds() * MILLIUNITS,
             stats.refined_cards(),
             stats.precleaned_cards(),
-            stats.dirtied_cards());
+            stats.dirtied_cards(),
+            stats.deferred_cards());
 }
 
 void G1Policy::record_concurrent_refinement_stats(size_t pending_cards,
@@ -809,6 +816,14 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
     assert(is_young_only_pause, "must be");
   }
 
+  // The collector state now reflects whether the next collection is mixed.
+  if (_g1h->late_remset_rebuild_task() != nullptr) {
+    _g1h->late_remset_rebuild_task()->record_young_collection_end();
+  }
+  // This pause already removed the regions it evacuated from the candidates,
+  // so the budget goes to the regions the next mixed collection takes.
+  update_refinement_deferral_budget();
+
   _eden_surv_rate_group->start_adding_regions();
 
   if (update_stats) {
@@ -820,24 +835,25 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
     size_t const total_cards_merged = merged_cards_from_rs +
                                       merged_cards_from_log_buffers;
 
+    double avg_time_merge_cards = average_time_ms(G1GCPhaseTimes::MergeER) +
+                                  average_time_ms(G1GCPhaseTimes::MergeRS) +
+                                  average_time_ms(G1GCPhaseTimes::MergeLB) +
+                                  average_time_ms(G1GCPhaseTimes::OptMergeRS);
     if (total_cards_merged >= G1NumCardsCostSampleThreshold) {
-      double avg_time_merge_cards = average_time_ms(G1GCPhaseTimes::MergeER) +
-                                    average_time_ms(G1GCPhaseTimes::MergeRS) +
-                                    average_time_ms(G1GCPhaseTimes::MergeLB) +
-                                    average_time_ms(G1GCPhaseTimes::OptMergeRS);
       _analytics->report_cost_per_card_merge_ms(avg_time_merge_cards / total_cards_merged, is_young_only_pause);
     }
+    record_work_time(G1Analytics::WorkKind::MergeCards, total_cards_merged, avg_time_merge_cards, is_young_only_pause);
 
     // Update prediction for card scan
     size_t const total_cards_scanned = p->sum_thread_work_items(G1GCPhaseTimes::ScanHR, G1GCPhaseTimes::ScanHRScannedCards) +
                                        p->sum_thread_work_items(G1GCPhaseTimes::OptScanHR, G1GCPhaseTimes::ScanHRScannedCards);
 
+    double avg_time_dirty_card_scan = average_time_ms(G1GCPhaseTimes::ScanHR) +
+                                      average_time_ms(G1GCPhaseTimes::OptScanHR);
     if (total_cards_scanned >= G1NumCardsCostSampleThreshold) {
-      double avg_time_dirty_card_scan = average_time_ms(G1GCPhaseTimes::ScanHR) +
-                                        average_time_ms(G1GCPhaseTimes::OptScanHR);
-
       _analytics->report_cost_per_card_scan_ms(avg_time_dirty_card_scan / total_cards_scanned, is_young_only_pause);
     }
+    record_work_time(G1Analytics::WorkKind::ScanCards, total_cards_scanned, avg_time_dirty_card_scan, is_young_only_pause);
 
     // Update prediction for the ratio between cards from the remembered
     // sets and actually scanned cards from the remembered sets.
@@ -853,10 +869,12 @@ void G1Policy::record_young_collection_end(bool concurrent_operation_is_full_mar
     // Update prediction for copy cost per byte
     size_t copied_bytes = p->sum_thread_work_items(G1GCPhaseTimes::MergePSS, G1GCPhaseTimes::MergePSSCopiedBytes);
 
+    double avg_time_object_copy = average_time_ms(G1GCPhaseTimes::ObjCopy) + average_time_ms(G1GCPhaseTimes::OptObjCopy);
     if (copied_bytes > 0) {
-      double cost_per_byte_ms = (average_time_ms(G1GCPhaseTimes::ObjCopy) + average_time_ms(G1GCPhaseTimes::OptObjCopy)) / copied_bytes;
+      double cost_per_byte_ms = avg_time_object_copy / copied_bytes;
       _analytics->report_cost_per_byte_ms(cost_per_byte_ms, is_young_only_pause);
     }
+    record_work_time(G1Analytics::WorkKind::CopyObjects, copied_bytes, avg_time_object_copy, is_young_only_pause);
 
     if (_collection_set->young_region_length() > 0) {
       _analytics->report_young_other_cost_per_region_ms(young_other_time_ms() /
@@ -992,6 +1010,28 @@ void G1Policy::record_young_gc_pause_end(bool evacuation_failed) {
   phase_times()->print(evacuation_failed);
 }
 
+void G1Policy::record_work_time(G1Analytics::WorkKind kind, size_t amount, double time_ms, bool is_young_only_pause) {
+  // Compare the predictions of both cost models for this pause before adding
+  // the sample.
+  typedef G1Analytics::CostModel CostModel;
+  double average_prediction_ms =
+    _analytics->predict_fixed_work_time_ms(kind, is_young_only_pause, CostModel::AverageCostPerUnit) +
+    _analytics->predict_work_time_ms(kind, amount, is_young_only_pause, CostModel::AverageCostPerUnit);
+  bool has_regression_model = _analytics->has_regression_model(kind, is_young_only_pause);
+  double regression_prediction_ms =
+    _analytics->predict_fixed_work_time_ms(kind, is_young_only_pause, CostModel::Regression) +
+    _analytics->predict_work_time_ms(kind, amount, is_young_only_pause, CostModel::Regression);
+
+  _g1h->gc_tracer_stw()->report_work_cost_prediction(G1Analytics::work_kind_to_string(kind),
+                                                     amount,
+                                                     time_ms,
+                                                     average_prediction_ms,
+                                                     regression_prediction_ms,
+                                                     has_regression_model);
+
+  _analytics->report_work_time_ms(kind, amount, time_ms, is_young_only_pause);
+}
+
 double G1Policy::predict_base_time_ms(size_t pending_cards,
                                       size_t rs_length) const {
   bool in_young_only_phase = collector_state()->in_young_only_phase();
@@ -1005,13 +1045,20 @@ double G1Policy::predict_base_time_ms(size_t pending_cards,
   double card_scan_time = _analytics->predict_card_scan_time_ms(effective_scanned_cards, in_young_only_phase);
   double constant_other_time = _analytics->predict_constant_other_time_ms();
   double survivor_evac_time = predict_survivor_regions_evac_time();
+  // Fixed cost of the work kinds above, added only once per pause.
+  double fixed_work_time = 0.0;
+  for (uint i = 0; i < (uint)G1Analytics::WorkKind::NumKinds; i++) {
+    fixed_work_time += _analytics->predict_fixed_work_time_ms((G1Analytics::WorkKind)i, in_young_only_phase);
+  }
 
-  double total_time = card_merge_time + card_scan_time + constant_other_time + survivor_evac_time;
+  double total_time = card_merge_time + card_scan_time + constant_other_time + survivor_evac_time + fixed_work_time;
 
   log_trace(gc, ergo, heap)("Predicted base time: total %f lb_cards %zu rs_length %zu effective_scanned_cards %zu "
-                            "card_merge_time %f card_scan_time %f constant_other_time %f survivor_evac_time %f",
+                            "card_merge_time %f card_scan_time %f constant_other_time %f survivor_evac_time %f "
+                            "fixed_work_time %f",
                             total_time, pending_cards, rs_length, effective_scanned_cards,
-                            card_merge_time, card_scan_time, constant_other_time, survivor_evac_time);
+                            card_merge_time, card_scan_time, constant_other_time, survivor_evac_time,
+                            fixed_work_time);
   return total_time;
 }
 
@@ -1246,6 +1293,17 @@ void G1Policy::decide_on_concurrent_start_pause() {
   assert(!collector_state()->mark_or_rebuild_in_progress() || collector_state()->in_young_only_phase(), "sanity");
 }
 
+void G1Policy::update_refinement_deferral_budget() {
+  uint num_regions = 0;
+  if (!collector_state()->in_young_only_phase()) {
+    // The next collection is a mixed collection; it evacuates at least the
+    // minimum number of old regions from the front of the candidates.
+    num_regions = MIN2(calc_min_old_cset_length(candidates()->last_marking_candidates_length()),
+                       candidates()->marking_regions_length());
+  }
+  candidates()->set_refinement_deferral_budget(num_regions, G1RefineDeferredCardsPerRegion);
+}
+
 void G1Policy::record_concurrent_mark_cleanup_end(bool has_rebuilt_remembered_sets) {
   bool mixed_gc_pending = false;
   if (has_rebuilt_remembered_sets) {
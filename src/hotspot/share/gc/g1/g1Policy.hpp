@@ -25,6 +25,7 @@
 #ifndef SHARE_GC_G1_G1POLICY_HPP
 #define SHARE_GC_G1_G1POLICY_HPP
 
+#include "gc/g1/g1Analytics.hpp"
 #include "gc/g1/g1CollectorState.hpp"
 #include "gc/g1/g1ConcurrentStartToMixedTimeTracker.hpp"
 #include "gc/g1/g1GCPhaseTimes.hpp"
@@ -51,7 +52,6 @@ class G1CollectionSetCandidates;
 class G1CollectionSetChooser;
 class G1CollectionCandidateRegionList;
 class G1IHOPControl;
-class G1Analytics;
 class G1SurvivorRegions;
 class GCPolicyCounters;
 class STWGCTimer;
@@ -192,6 +192,10 @@ private:
   double non_young_other_time_ms() const;
   double constant_other_time_ms(double pause_time_ms) const;
 
+  // Report the time taken for the given amount of work of the given kind to
+  // analytics, and the predictions of the cost models for it to JFR.
+  void record_work_time(G1Analytics::WorkKind kind, size_t amount, double time_ms, bool is_young_only_pause);
+
   G1CollectionSetChooser* cset_chooser() const;
 
   // Stash a pointer to the g1 heap.
@@ -285,6 +289,10 @@ private:
   // Indicate that we aborted marking before doing any mixed GCs.
   void abort_time_to_mixed_tracking();
 
+  // Let concurrent refinement defer cards in the old regions the next mixed
+  // collection is going to evacuate, if any.
+  void update_refinement_deferral_budget();
+
 public:
 
   G1Policy(STWGCTimer* gc_timer);
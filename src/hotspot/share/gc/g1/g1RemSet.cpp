@@ -28,6 +28,7 @@
 #include "gc/g1/g1BlockOffsetTable.inline.hpp"
 #include "gc/g1/g1CardSet.inline.hpp"
 #include "gc/g1/g1CardTable.inline.hpp"
+#include "gc/g1/g1CardTableChunkScanner.hpp"
 #include "gc/g1/g1CardTableEntryClosure.hpp"
 #include "gc/g1/g1CollectedHeap.inline.hpp"
 #include "gc/g1/g1ConcurrentRefine.hpp"
@@ -546,104 +547,6 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
     _cards_scanned += num_cards;
   }
 
-  // To locate consecutive dirty cards inside a chunk.
-  class ChunkScanner {
-    using Word = size_t;
-
-    CardValue* const _start_card;
-    CardValue* const _end_card;
-
-    static const size_t ExpandedToScanMask = G1CardTable::WordAlreadyScanned;
-    static const size_t ToScanMask = G1CardTable::g1_card_already_scanned;
-
-    static bool is_card_dirty(const CardValue* const card) {
-      return (*card & ToScanMask) == 0;
-    }
-
-    static bool is_word_aligned(const void* const addr) {
-      return ((uintptr_t)addr) % sizeof(Word) == 0;
-    }
-
-    CardValue* find_first_dirty_card(CardValue* i_card) const {
-      while (!is_word_aligned(i_card)) {
-        if (is_card_dirty(i_card)) {
-          return i_card;
-        }
-        i_card++;
-      }
-
-      for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
-        Word word_value = *reinterpret_cast<Word*>(i_card);
-        bool has_dirty_cards_in_word = (~word_value & ExpandedToScanMask) != 0;
-
-        if (has_dirty_cards_in_word) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
-        }
-      }
-
-      return _end_card;
-    }
-
-    CardValue* find_first_non_dirty_card(CardValue* i_card) const {
-      while (!is_word_aligned(i_card)) {
-        if (!is_card_dirty(i_card)) {
-          return i_card;
-        }
-        i_card++;
-      }
-
-      for (/* empty */; i_card < _end_card; i_card += sizeof(Word)) {
-        Word word_value = *reinterpret_cast<Word*>(i_card);
-        bool all_cards_dirty = (word_value == G1CardTable::WordAllDirty);
-
-        if (!all_cards_dirty) {
-          for (uint i = 0; i < sizeof(Word); ++i) {
-            if (!is_card_dirty(i_card)) {
-              return i_card;
-            }
-            i_card++;
-          }
-          assert(false, "should have early-returned");
-        }
-      }
-
-      return _end_card;
-    }
-
-  public:
-    ChunkScanner(CardValue* const start_card, CardValue* const end_card) :
-      _start_card(start_card),
-      _end_card(end_card) {
-        assert(is_word_aligned(start_card), "precondition");
-        assert(is_word_aligned(end_card), "precondition");
-      }
-
-    template<typename Func>
-    void on_dirty_cards(Func&& f) {
-      for (CardValue* cur_card = _start_card; cur_card < _end_card; /* empty */) {
-        CardValue* dirty_l = find_first_dirty_card(cur_card);
-        CardValue* dirty_r = find_first_non_dirty_card(dirty_l);
-
-        assert(dirty_l <= dirty_r, "inv");
-
-        if (dirty_l == dirty_r) {
-          assert(dirty_r == _end_card, "finished the entire chunk");
-          return;
-        }
-
-        f(dirty_l, dirty_r);
-
-        cur_card = dirty_r + 1;
-      }
-    }
-  };
-
   void scan_heap_roots(HeapRegion* r) {
     uint const region_idx = r->hrm_index();
 
@@ -665,7 +568,7 @@ class G1ScanHRForRegionClosure : public HeapRegionClosure {
       CardValue* const start_card = _ct->byte_for_index(region_card_base_idx);
       CardValue* const end_card = start_card + claim.size();
 
-      ChunkScanner chunk_scanner{start_card, end_card};
+      G1CardTableChunkScanner chunk_scanner{start_card, end_card};
       chunk_scanner.on_dirty_cards([&] (CardValue* dirty_l, CardValue* dirty_r) {
                                      do_claimed_block(region_idx, dirty_l, dirty_r);
                                    });
@@ -192,6 +192,9 @@ private:
   size_t _max_rs_mem_sz;
   HeapRegion* _max_rs_mem_sz_region;
 
+  // Card set memory per memory object (card set container) type.
+  G1MonotonicArenaMemoryStats _card_set_mem_stats;
+
   size_t total_rs_unused_mem_sz() const     { return _all.rs_unused_mem_size(); }
   size_t total_rs_mem_sz() const            { return _all.rs_mem_size(); }
   size_t total_cards_occupied() const       { return _all.cards_occupied(); }
@@ -212,6 +215,7 @@ public:
   HRRSStatsIter() : _young("Young"), _humongous("Humongous"),
     _free("Free"), _old("Old"), _all("All"),
     _max_rs_mem_sz(0), _max_rs_mem_sz_region(nullptr),
+    _card_set_mem_stats(),
     _max_code_root_mem_sz(0), _max_code_root_mem_sz_region(nullptr)
   {}
 
@@ -227,6 +231,7 @@ public:
       _max_rs_mem_sz_region = r;
     }
     size_t occupied_cards = hrrs->occupied();
+    _card_set_mem_stats.add(hrrs->card_set_memory_stats());
     size_t code_root_mem_sz = hrrs->code_roots_mem_size();
     if (code_root_mem_sz > max_code_root_mem_sz()) {
       _max_code_root_mem_sz = code_root_mem_sz;
@@ -254,6 +259,25 @@ public:
     return false;
   }
 
+  void print_card_set_mem_info_on(outputStream* out) {
+    size_t total = 0;
+    for (uint i = 0; i < _card_set_mem_stats.num_pools(); i++) {
+      total += _card_set_mem_stats._num_mem_sizes[i];
+    }
+    out->print_cr("  Card set container memory sizes = " SIZE_FORMAT "%s",
+                  byte_size_in_proper_unit(total), proper_unit_for_byte_size(total));
+    // Runs of Cards containers are allocated as Howl memory objects.
+    for (uint i = 0; i < _card_set_mem_stats.num_pools(); i++) {
+      size_t mem_size = _card_set_mem_stats._num_mem_sizes[i];
+      out->print_cr("    " SIZE_FORMAT_W(8) "%s (%5.1f%%) in " SIZE_FORMAT " segments by %s",
+                    byte_size_in_proper_unit(mem_size),
+                    proper_unit_for_byte_size(mem_size),
+                    percent_of(mem_size, total),
+                    _card_set_mem_stats._num_segments[i],
+                    G1CardSetConfiguration::mem_object_type_name_str(i));
+    }
+  }
+
   void print_summary_on(outputStream* out) {
     RegionTypeCounter* counters[] = { &_young, &_humongous, &_free, &_old, nullptr };
 
@@ -281,6 +305,8 @@ public:
                   rem_set->mem_size(),
                   rem_set->occupied());
 
+    print_card_set_mem_info_on(out);
+
     HeapRegionRemSet::print_static_mem_size(out);
     G1CollectedHeap* g1h = G1CollectedHeap::heap();
     g1h->card_set_freelist_pool()->print_on(out);
@@ -23,7 +23,9 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/g1/g1CollectedHeap.hpp"
 #include "gc/g1/g1CollectionSetChooser.hpp"
+#include "gc/g1/g1LateRemSetRebuildTask.hpp"
 #include "gc/g1/g1RemSetTrackingPolicy.hpp"
 #include "gc/g1/heapRegion.inline.hpp"
 #include "gc/g1/heapRegionRemSet.inline.hpp"
@@ -53,7 +55,11 @@ void G1RemSetTrackingPolicy::update_at_allocate(HeapRegion* r) {
 }
 
 void G1RemSetTrackingPolicy::update_at_free(HeapRegion* r) {
-  /* nothing to do */
+  G1LateRemSetRebuildTask* late_rebuild = G1CollectedHeap::heap()->late_remset_rebuild_task();
+  if (late_rebuild != nullptr) {
+    // A freed region never needs to be scanned for a late rebuild.
+    late_rebuild->note_region_freed(r);
+  }
 }
 
 static void print_before_rebuild(HeapRegion* r, bool selected_for_rebuild, size_t total_live_bytes, size_t live_bytes) {
@@ -80,8 +86,9 @@ bool G1RemSetTrackingPolicy::update_humongous_before_rebuild(HeapRegion* r, bool
   bool selected_for_rebuild = false;
   // For humongous regions, to be of interest for rebuilding the remembered set the following must apply:
   // - We always try to update the remembered sets of humongous regions containing
-  // type arrays as they might have been reset after full gc.
-  if (is_live && cast_to_oop(r->humongous_start_region()->bottom())->is_typeArray() && !r->rem_set()->is_tracked()) {
+  // type or object arrays as they might have been reset after full gc.
+  oop obj = cast_to_oop(r->humongous_start_region()->bottom());
+  if (is_live && (obj->is_typeArray() || obj->is_objArray()) && !r->rem_set()->is_tracked()) {
     r->rem_set()->set_state_updating();
     selected_for_rebuild = true;
   }
@@ -127,6 +127,20 @@ void G1NewTracer::report_adaptive_ihop_statistics(size_t threshold,
                                 prediction_active);
 }
 
+void G1NewTracer::report_work_cost_prediction(const char* work,
+                                              size_t amount,
+                                              double actual_time_ms,
+                                              double average_prediction_ms,
+                                              double regression_prediction_ms,
+                                              bool regression_model_available) {
+  send_work_cost_prediction(work,
+                            amount,
+                            actual_time_ms,
+                            average_prediction_ms,
+                            regression_prediction_ms,
+                            regression_model_available);
+}
+
 void G1NewTracer::send_g1_young_gc_event() {
   // Check that the pause type has been updated to something valid for this event.
   G1GCPauseTypeHelper::assert_is_young_pause(_pause);
@@ -248,6 +262,25 @@ void G1NewTracer::send_adaptive_ihop_statistics(size_t threshold,
   }
 }
 
+void G1NewTracer::send_work_cost_prediction(const char* work,
+                                            size_t amount,
+                                            double actual_time_ms,
+                                            double average_prediction_ms,
+                                            double regression_prediction_ms,
+                                            bool regression_model_available) {
+  EventG1PauseWorkCostPrediction evt;
+  if (evt.should_commit()) {
+    evt.set_gcId(GCId::current());
+    evt.set_work(work);
+    evt.set_amount(amount);
+    evt.set_actualTime(actual_time_ms * NANOSECS_PER_MILLISEC);
+    evt.set_averagePrediction(average_prediction_ms * NANOSECS_PER_MILLISEC);
+    evt.set_regressionPrediction(regression_prediction_ms * NANOSECS_PER_MILLISEC);
+    evt.set_regressionModelAvailable(regression_model_available);
+    evt.commit();
+  }
+}
+
 void G1OldTracer::report_gc_start_impl(GCCause::Cause cause, const Ticks& timestamp) {
   _shared_gc_info.set_start_timestamp(timestamp);
 }
@@ -63,6 +63,12 @@ public:
                                        double predicted_allocation_rate,
                                        double predicted_marking_length,
                                        bool prediction_active);
+  void report_work_cost_prediction(const char* work,
+                                   size_t amount,
+                                   double actual_time_ms,
+                                   double average_prediction_ms,
+                                   double regression_prediction_ms,
+                                   bool regression_model_available);
 private:
   void send_g1_young_gc_event();
   void send_evacuation_info_event(G1EvacInfo* info);
@@ -84,6 +90,12 @@ private:
                                      double predicted_allocation_rate,
                                      double predicted_marking_length,
                                      bool prediction_active);
+  void send_work_cost_prediction(const char* work,
+                                 size_t amount,
+                                 double actual_time_ms,
+                                 double average_prediction_ms,
+                                 double regression_prediction_ms,
+                                 bool regression_model_available);
 };
 
 class G1OldTracer : public OldGCTracer, public CHeapObj<mtGC> {
@@ -334,23 +334,36 @@ class G1PrepareEvacuationTask : public WorkerTask {
       // structures don't support efficiently performing the needed
       // additional tests or scrubbing of the mark stack.
       //
-      // However, we presently only nominate is_typeArray() objects.
-      // A humongous object containing references induces remembered
-      // set entries on other regions.  In order to reclaim such an
-      // object, those remembered sets would need to be cleaned up.
-      //
-      // We also treat is_typeArray() objects specially, allowing them
-      // to be reclaimed even if allocated before the start of
-      // concurrent mark.  For this we rely on mark stack insertion to
-      // exclude is_typeArray() objects, preventing reclaiming an object
-      // that is in the mark stack.  We also rely on the metadata for
-      // such objects to be built-in and so ensured to be kept live.
+      // We treat is_typeArray() objects specially, allowing them to be
+      // reclaimed even if allocated before the start of concurrent mark.
+      // For this we rely on mark stack insertion to exclude is_typeArray()
+      // objects, preventing reclaiming an object that is in the mark stack.
+      // We also rely on the metadata for such objects to be built-in and
+      // so ensured to be kept live.
       // Frequent allocation and drop of large binary blobs is an
       // important use case for eager reclaim, and this special handling
       // may reduce needed headroom.
-
-      return obj->is_typeArray() &&
-             _g1h->is_potential_eager_reclaim_candidate(region);
+      //
+      // Humongous object arrays are nominated too. Such an object induces
+      // remembered set entries in other regions that become stale when it is
+      // reclaimed. G1 already copes with such stale entries, as they are also
+      // left behind by regions freed after evacuation: cards are only scanned
+      // in old or humongous regions up to their top at the start of the
+      // collection, which is valid memory to parse. References from the object
+      // into the collection set are found via its cards and keep the referents
+      // alive for this collection only.
+      // During concurrent mark, object arrays are only nominated if allocated
+      // after the start of marking, as explained above.
+
+      if (obj->is_typeArray()) {
+        return _g1h->is_potential_eager_reclaim_candidate(region);
+      }
+      if (obj->is_objArray()) {
+        bool allocated_after_mark_start = region->top_at_mark_start() == region->bottom();
+        return (!_g1h->collector_state()->mark_or_rebuild_in_progress() || allocated_after_mark_start) &&
+               _g1h->is_potential_eager_reclaim_candidate(region);
+      }
+      return false;
     }
 
   public:
@@ -385,7 +398,7 @@ class G1PrepareEvacuationTask : public WorkerTask {
       } else {
         _g1h->register_region_with_region_attr(hr);
       }
-      log_debug(gc, humongous)("Humongous region %u (object size %zu @ " PTR_FORMAT ") remset %zu code roots %zu marked %d reclaim candidate %d type array %d",
+      log_debug(gc, humongous)("Humongous region %u (object size %zu @ " PTR_FORMAT ") remset %zu code roots %zu marked %d reclaim candidate %d type array %d obj array %d",
                                index,
                                cast_to_oop(hr->bottom())->size() * HeapWordSize,
                                p2i(hr->bottom()),
@@ -393,7 +406,8 @@ class G1PrepareEvacuationTask : public WorkerTask {
                                hr->rem_set()->code_roots_list_length(),
                                _g1h->concurrent_mark()->mark_bitmap()->is_marked(hr->bottom()),
                                _g1h->is_humongous_reclaim_candidate(index),
-                               cast_to_oop(hr->bottom())->is_typeArray()
+                               cast_to_oop(hr->bottom())->is_typeArray(),
+                               cast_to_oop(hr->bottom())->is_objArray()
                               );
       _worker_humongous_total++;
 
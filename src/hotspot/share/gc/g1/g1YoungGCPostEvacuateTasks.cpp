@@ -165,10 +165,11 @@ class G1FreeHumongousRegionClosure : public HeapRegionIndexClosure {
   // So there is no need to re-check remembered set size of the humongous region.
   //
   // Other implementation considerations:
-  // - never consider object arrays at this time because they would pose
-  // considerable effort for cleaning up the remembered sets. This is
-  // required because stale remembered sets might reference locations that
-  // are currently allocated into.
+  // - object arrays leave stale remembered set entries and possibly redirtied
+  // cards behind in other regions' remembered sets and the card table. These
+  // are not cleaned up: both merging remembered sets and refinement already
+  // need to cope with stale cards, because regions freed after evacuation
+  // leave such entries behind too.
   bool is_reclaimable(uint region_idx) const {
     return G1CollectedHeap::heap()->is_humongous_reclaim_candidate(region_idx);
   }
@@ -189,8 +190,8 @@ public:
     HeapRegion* r = _g1h->region_at(region_index);
 
     oop obj = cast_to_oop(r->bottom());
-    guarantee(obj->is_typeArray(),
-              "Only eagerly reclaiming type arrays is supported, but the object "
+    guarantee(obj->is_typeArray() || obj->is_objArray(),
+              "Only eagerly reclaiming type and object arrays is supported, but the object "
               PTR_FORMAT " is not.", p2i(r->bottom()));
 
     log_debug(gc, humongous)("Reclaimed humongous region %u (object size " SIZE_FORMAT " @ " PTR_FORMAT ")",
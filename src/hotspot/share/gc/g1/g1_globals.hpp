@@ -47,6 +47,12 @@
                                        range,                               \
                                        constraint)                          \
                                                                             \
+  product(uint, G1FastCopyMaxObjectWords, 64, EXPERIMENTAL,                 \
+          "Maximum size in words of non-array objects copied from young "   \
+          "to survivor regions in a dedicated fast path during evacuation. "\
+          "Zero disables the fast path.")                                   \
+          range(0, 1024)                                                    \
+                                                                            \
   product(bool, G1EvacuationFailureALot, false,                             \
           "Force use of evacuation failure handling during certain "        \
           "evacuation pauses")                                              \
@@ -164,10 +170,22 @@
           "When expanding, % of uncommitted space to claim.")               \
           range(0, 100)                                                     \
                                                                             \
+  product(bool, G1CommitAhead, false, EXPERIMENTAL,                         \
+          "Commit, and with AlwaysPreTouch pre-touch, the regions the heap "\
+          "is predicted to expand by on the service thread, so that the "   \
+          "expansion itself does not need to commit memory.")               \
+                                                                            \
   product(size_t, G1UpdateBufferSize, 256,                                  \
           "Size of an update buffer")                                       \
           range(1, NOT_LP64(32*M) LP64_ONLY(1*G))                           \
                                                                             \
+  product(uint, G1RefineDeferredCardsPerRegion, 0, EXPERIMENTAL,            \
+          "Maximum number of dirty cards per old region that concurrent "   \
+          "refinement leaves to the next garbage collection because the "   \
+          "region is likely to be evacuated by it. 0 disables deferring "   \
+          "refinement.")                                                    \
+          range(0, max_juint)                                               \
+                                                                            \
   product(intx, G1RSetUpdatingPauseTimePercent, 10,                         \
           "A target percentage of time that is allowed to be spend on "     \
           "processing remembered set update buffers during the collection " \
@@ -213,6 +231,11 @@
           "set container.")                                                 \
           range(1, 100)                                                     \
                                                                             \
+  product(bool, G1RemSetUseHowlRuns, false, EXPERIMENTAL,                   \
+          "Within Howl card set containers, coarsen Array of Cards "        \
+          "containers with clustered cards into containers storing "        \
+          "runs of cards before using bitmaps.")                            \
+                                                                            \
   develop(size_t, G1MaxVerifyFailures, SIZE_MAX,                            \
           "The maximum number of liveness and remembered set verification " \
           "failures to print per thread.")                                  \
@@ -228,6 +251,12 @@
           range(0, NOT_LP64(32*M) LP64_ONLY(512*M))                         \
           constraint(G1HeapRegionSizeConstraintFunc,AfterMemoryInit)        \
                                                                             \
+  product(size_t, G1ExpectedMaxWorkingSetSize, 0, EXPERIMENTAL,             \
+          "Expected maximum heap occupancy of the application. If set, "    \
+          "the region size is selected ergonomically based on this value "  \
+          "(capped by MaxHeapSize) instead of MaxHeapSize. Ignored if "     \
+          "G1HeapRegionSize is set.")                                       \
+                                                                            \
   product(uint, G1ConcRefinementThreads, 0,                                 \
           "The number of parallel remembered set update threads. "          \
           "Will be set ergonomically by default.")                          \
@@ -269,6 +298,22 @@
           "Chunk size used for rebuilding the remembered set.")             \
           range(4 * K, 32 * M)                                              \
                                                                             \
+  product(bool, G1UseLateRemSetRebuild, false, EXPERIMENTAL,                \
+          "Rebuild remembered sets of additional old regions in the "       \
+          "background during the mixed phase so that they can be added "    \
+          "to the collection set candidates without another marking.")      \
+                                                                            \
+  product(uintx, G1LateRemSetRebuildLiveThresholdPercent, 95, EXPERIMENTAL, \
+          "Threshold for old regions not selected at Remark to be "         \
+          "considered for late remembered set rebuild. Regions with "       \
+          "live bytes exceeding this will not be selected.")                \
+          range(0, 100)                                                     \
+                                                                            \
+  product(double, G1LateRemSetRebuildStepDurationMillis, 5.0, EXPERIMENTAL, \
+          "The amount of time the late remembered set rebuild task "        \
+          "spends scanning the heap before yielding the service thread.")   \
+          range(1e-3, 1e+6)                                                 \
+                                                                            \
   product(uintx, G1OldCSetRegionThresholdPercent, 10, EXPERIMENTAL,         \
           "An upper bound for the number of old CSet regions expressed "    \
           "as a percentage of the heap size.")                              \
@@ -323,6 +368,16 @@
           "related prediction sample. That sample must involve the same or "\
           "more than that number of cards to be used.")                     \
                                                                             \
+  product(bool, G1UseRegressionPausePrediction, false, EXPERIMENTAL,        \
+          "Predict card merge, card scan and object copy times from a "     \
+          "linear regression over recent pauses instead of the average "    \
+          "cost per card or byte.")                                         \
+                                                                            \
+  product(bool, G1NUMAPreserveOldNode, false, EXPERIMENTAL,                 \
+          "When NUMA is enabled, copy objects into old regions on the "     \
+          "memory node of the region they are evacuated from, instead of "  \
+          "into any old region.")                                           \
+                                                                            \
   GC_G1_EVACUATION_FAILURE_FLAGS(develop,                                   \
                     develop_pd,                                             \
                     product,                                                \
@@ -66,6 +66,7 @@ HeapRegionManager::HeapRegionManager() :
   _cardtable_mapper(nullptr),
   _committed_map(),
   _allocated_heapregions_length(0),
+  _num_committed_ahead(0),
   _regions(), _heap_mapper(nullptr),
   _bitmap_mapper(nullptr),
   _free_list("Free list", new MasterFreeRegionListChecker())
@@ -161,6 +162,11 @@ HeapRegion* HeapRegionManager::new_heap_region(uint hrm_index) {
 }
 
 void HeapRegionManager::expand(uint start, uint num_regions, WorkerThreads* pretouch_workers) {
+  commit_and_allocate_regions(start, num_regions, pretouch_workers);
+  activate_regions(start, num_regions);
+}
+
+void HeapRegionManager::commit_and_allocate_regions(uint start, uint num_regions, WorkerThreads* pretouch_workers) {
   commit_regions(start, num_regions, pretouch_workers);
   for (uint i = start; i < start + num_regions; i++) {
     HeapRegion* hr = _regions.get_by_index(i);
@@ -172,7 +178,6 @@ void HeapRegionManager::expand(uint start, uint num_regions, WorkerThreads* pret
     }
     G1CollectedHeap::heap()->hr_printer()->commit(hr);
   }
-  activate_regions(start, num_regions);
 }
 
 void HeapRegionManager::commit_regions(uint index, size_t num_regions, WorkerThreads* pretouch_workers) {
@@ -237,6 +242,9 @@ void HeapRegionManager::reactivate_regions(uint start, uint num_regions) {
 
   clear_auxiliary_data_structures(start, num_regions);
 
+  // Regions committed ahead are indistinguishable from other inactive regions,
+  // so account any reactivation against them first.
+  _num_committed_ahead -= MIN2(_num_committed_ahead, num_regions);
   _committed_map.reactivate(start, start + num_regions);
   initialize_regions(start, num_regions);
 }
@@ -253,6 +261,9 @@ void HeapRegionManager::deactivate_regions(uint start, uint num_regions) {
     G1CollectedHeap::heap()->hr_printer()->inactive(hr);
   }
 
+  // The heap is shrinking, so do not keep any regions committed ahead of
+  // expansion.
+  _num_committed_ahead = 0;
   _committed_map.deactivate(start, end);
 }
 
@@ -280,7 +291,7 @@ MemoryUsage HeapRegionManager::get_auxiliary_data_memory_usage() const {
 }
 
 bool HeapRegionManager::has_inactive_regions() const {
-  return _committed_map.num_inactive() > 0;
+  return _committed_map.num_inactive() > _num_committed_ahead;
 }
 
 uint HeapRegionManager::uncommit_inactive_regions(uint limit) {
@@ -293,12 +304,13 @@ uint HeapRegionManager::uncommit_inactive_regions(uint limit) {
     HeapRegionRange range = _committed_map.next_inactive_range(offset);
     // No more regions available for uncommit. Return the number of regions
     // already uncommitted or 0 if there were no longer any inactive regions.
-    if (range.length() == 0) {
+    if (range.length() == 0 || !has_inactive_regions()) {
       return uncommitted;
     }
 
     uint start = range.start();
-    uint num_regions = MIN2(range.length(), limit - uncommitted);
+    uint uncommittable = _committed_map.num_inactive() - _num_committed_ahead;
+    uint num_regions = MIN3(range.length(), limit - uncommitted, uncommittable);
     uncommitted += num_regions;
     uncommit_regions(start, num_regions);
   } while (uncommitted < limit);
@@ -307,6 +319,39 @@ uint HeapRegionManager::uncommit_inactive_regions(uint limit) {
   return uncommitted;
 }
 
+uint HeapRegionManager::commit_ahead(uint num_regions, WorkerThreads* pretouch_workers) {
+  assert(num_regions > 0, "Must commit at least 1 region");
+
+  // Serializes with concurrent uncommit and humongous allocation expanding
+  // the heap.
+  MutexLocker uc(Uncommit_lock, Mutex::_no_safepoint_check_flag);
+
+  uint offset = 0;
+  uint committed = 0;
+
+  do {
+    HeapRegionRange regions = _committed_map.next_uncommitted_range(offset);
+    if (regions.length() == 0) {
+      // No more uncommitted regions.
+      break;
+    }
+
+    uint to_commit = MIN2(num_regions - committed, regions.length());
+    commit_and_allocate_regions(regions.start(), to_commit, pretouch_workers);
+    _committed_map.commit_inactive(regions.start(), regions.start() + to_commit);
+    committed += to_commit;
+    offset = regions.end();
+  } while (committed < num_regions);
+
+  _num_committed_ahead += committed;
+  return committed;
+}
+
+void HeapRegionManager::limit_committed_ahead(uint num_regions) {
+  assert_at_safepoint();
+  _num_committed_ahead = MIN2(_num_committed_ahead, num_regions);
+}
+
 uint HeapRegionManager::expand_inactive(uint num_regions) {
   uint offset = 0;
   uint expanded = 0;
@@ -370,22 +415,19 @@ void HeapRegionManager::expand_exact(uint start, uint num_regions, WorkerThreads
   uint end = start + num_regions;
 
   for (uint i = start; i < end; i++) {
-    // First check inactive. If the regions is inactive, try to reactivate it
-    // before it get uncommitted by the G1SeriveThread.
-    if (_committed_map.inactive(i)) {
+    if (!_committed_map.active(i)) {
       // Need to grab the lock since this can be called by a java thread
-      // doing humongous allocations.
+      // doing humongous allocations, while the G1ServiceThread uncommits
+      // inactive regions or commits regions ahead of expansion.
       MutexLocker uc(Uncommit_lock, Mutex::_no_safepoint_check_flag);
-      // State might change while getting the lock.
+      // First check inactive. If the region is inactive, reactivate it
+      // before it gets uncommitted.
       if (_committed_map.inactive(i)) {
         reactivate_regions(i, 1);
+      } else {
+        expand(i, 1, pretouch_workers);
       }
     }
-    // Not else-if to catch the case where the inactive region was uncommitted
-    // while waiting to get the lock.
-    if (!_committed_map.active(i)) {
-      expand(i, 1, pretouch_workers);
-    }
 
     assert(at(i)->is_free(), "Region must be free at this point");
   }
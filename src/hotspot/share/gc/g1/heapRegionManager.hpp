@@ -84,11 +84,17 @@ class HeapRegionManager: public CHeapObj<mtGC> {
   // Internal only. The highest heap region +1 we allocated a HeapRegion instance for.
   uint _allocated_heapregions_length;
 
+  // The number of inactive regions that are kept committed ahead of heap
+  // expansion instead of being uncommitted, see commit_ahead().
+  uint _num_committed_ahead;
+
   HeapWord* heap_bottom() const { return _regions.bottom_address_mapped(); }
   HeapWord* heap_end() const {return _regions.end_address_mapped(); }
 
   // Pass down commit calls to the VirtualSpace.
   void commit_regions(uint index, size_t num_regions = 1, WorkerThreads* pretouch_workers = nullptr);
+  // Commit the given regions and allocate the HeapRegion instances for them.
+  void commit_and_allocate_regions(uint index, uint num_regions, WorkerThreads* pretouch_workers);
 
   // Initialize the HeapRegions in the range and put them on the free list.
   void initialize_regions(uint start, uint num_regions);
@@ -281,13 +287,26 @@ public:
   // empty, and free. The regions are marked inactive and can later be uncommitted.
   void shrink_at(uint index, size_t num_regions);
 
-  // Check if there are any inactive regions that can be uncommitted.
+  // Check if there are any inactive regions that can be uncommitted, i.e. more
+  // than the regions committed ahead.
   bool has_inactive_regions() const;
 
   // Uncommit inactive regions. Limit the number of regions to uncommit and return
-  // actual number uncommitted.
+  // actual number uncommitted. Keeps num_committed_ahead() inactive regions.
   uint uncommit_inactive_regions(uint limit);
 
+  // Commit up to num_regions uncommitted regions, pre-touching them using the
+  // given workers if enabled, and mark them inactive. Expanding the heap later
+  // activates them without committing memory. Returns the number of regions
+  // committed.
+  uint commit_ahead(uint num_regions, WorkerThreads* pretouch_workers);
+  // The number of inactive regions kept committed ahead of heap expansion.
+  uint num_committed_ahead() const { return _num_committed_ahead; }
+  // Keep at most num_regions inactive regions committed ahead of expansion,
+  // leaving any others to be uncommitted.
+  // precondition: at safepoint.
+  void limit_committed_ahead(uint num_regions);
+
   void verify();
 
   // Do some sanity checking.
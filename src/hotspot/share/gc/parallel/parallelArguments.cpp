@@ -89,6 +89,16 @@ void ParallelArguments::initialize() {
   if (FLAG_IS_DEFAULT(ParallelRefProcEnabled) && ParallelGCThreads > 1) {
     FLAG_SET_DEFAULT(ParallelRefProcEnabled, true);
   }
+
+  if (PSNUMALocalPromotion) {
+    if (!UseNUMA) {
+      FLAG_SET_DEFAULT(PSNUMALocalPromotion, false);
+    } else if (FLAG_IS_DEFAULT(OldPLABSize)) {
+      // Pages are placed per promotion LAB, so make them large enough to
+      // span many pages and amortize the cost of the placement.
+      FLAG_SET_ERGO(OldPLABSize, 32 * K);
+    }
+  }
 }
 
 // The alignment used for boundary between young gen and old gen
@@ -56,7 +56,12 @@
           range(0, 100)                                                     \
                                                                             \
   product(bool, PSChunkLargeArrays, true,                                   \
-          "Process large arrays in chunks")
+          "Process large arrays in chunks")                                 \
+                                                                            \
+  product(bool, PSNUMALocalPromotion, false, EXPERIMENTAL,                  \
+          "With UseNUMA, place the memory of old generation promotion "     \
+          "LABs on the NUMA node of the promoting thread instead of "       \
+          "interleaving it across all nodes")
 
 // end of GC_PARALLEL_FLAGS
 
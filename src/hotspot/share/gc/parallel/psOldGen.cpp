@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2001, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2001, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -35,6 +35,7 @@
 #include "logging/log.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/java.hpp"
+#include "runtime/os.hpp"
 #include "utilities/align.hpp"
 
 PSOldGen::PSOldGen(ReservedSpace rs, size_t initial_size, size_t min_size,
@@ -180,6 +181,21 @@ bool PSOldGen::expand_for_allocate(size_t word_size) {
   return result;
 }
 
+void PSOldGen::numa_make_local(HeapWord* start, size_t word_size) {
+  assert(UseNUMA, "only with NUMA");
+  // Bind at the granularity of the pages backing the heap. The space alignment
+  // is much larger than a typical promotion LAB, so using it would bind nothing.
+  const size_t page_size = UseLargePages ? os::large_page_size() : os::vm_page_size();
+  char* const beg = align_up((char*)start, page_size);
+  char* const end = align_down((char*)(start + word_size), page_size);
+  if (beg < end) {
+    const int lgrp_id = os::numa_get_group_id();
+    os::numa_make_local(beg, pointer_delta(end, beg, sizeof(char)), lgrp_id);
+    log_trace(gc, numa)("Bound old gen range [" PTR_FORMAT ", " PTR_FORMAT ") to node %d",
+                        p2i(beg), p2i(end), lgrp_id);
+  }
+}
+
 bool PSOldGen::expand(size_t bytes) {
   assert_lock_strong(PSOldGenExpand_lock);
   assert_locked_or_safepoint(Heap_lock);
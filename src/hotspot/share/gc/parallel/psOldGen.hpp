@@ -120,6 +120,10 @@ class PSOldGen : public CHeapObj<mtGC> {
   }
 
   MutableSpace*         object_space() const      { return _object_space; }
+
+  // Prefer the NUMA node of the current thread for the pages completely
+  // covered by [start, start + word_size) that have not been touched yet.
+  void numa_make_local(HeapWord* start, size_t word_size);
   ObjectStartArray*     start_array()             { return &_start_array; }
   PSVirtualSpace*       virtual_space() const     { return _virtual_space;}
 
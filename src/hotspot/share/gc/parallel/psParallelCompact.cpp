@@ -89,6 +89,7 @@
 #include "utilities/formatBuffer.hpp"
 #include "utilities/macros.hpp"
 #include "utilities/stack.inline.hpp"
+#include "utilities/ticks.hpp"
 #if INCLUDE_JVMCI
 #include "jvmci/jvmci.hpp"
 #endif
@@ -705,69 +706,21 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
 
   HeapWord *dest_addr = target_beg;
   while (cur_region < end_region) {
-    // The destination must be set even if the region has no data.
-    _region_data[cur_region].set_destination(dest_addr);
-
     size_t words = _region_data[cur_region].data_size();
-    if (words > 0) {
-      // If cur_region does not fit entirely into the target space, find a point
-      // at which the source space can be 'split' so that part is copied to the
-      // target space and the rest is copied elsewhere.
-      if (dest_addr + words > target_end) {
-        assert(source_next != nullptr, "source_next is null when splitting");
-        *source_next = summarize_split_space(cur_region, split_info, dest_addr,
-                                             target_end, target_next);
-        return false;
-      }
-
-      // Compute the destination_count for cur_region, and if necessary, update
-      // source_region for a destination region.  The source_region field is
-      // updated if cur_region is the first (left-most) region to be copied to a
-      // destination region.
-      //
-      // The destination_count calculation is a bit subtle.  A region that has
-      // data that compacts into itself does not count itself as a destination.
-      // This maintains the invariant that a zero count means the region is
-      // available and can be claimed and then filled.
-      uint destination_count = 0;
-      if (split_info.is_split(cur_region)) {
-        // The current region has been split:  the partial object will be copied
-        // to one destination space and the remaining data will be copied to
-        // another destination space.  Adjust the initial destination_count and,
-        // if necessary, set the source_region field if the partial object will
-        // cross a destination region boundary.
-        destination_count = split_info.destination_count();
-        if (destination_count == 2) {
-          size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
-          _region_data[dest_idx].set_source_region(cur_region);
-        }
-      }
-
-      HeapWord* const last_addr = dest_addr + words - 1;
-      const size_t dest_region_1 = addr_to_region_idx(dest_addr);
-      const size_t dest_region_2 = addr_to_region_idx(last_addr);
-
-      // Initially assume that the destination regions will be the same and
-      // adjust the value below if necessary.  Under this assumption, if
-      // cur_region == dest_region_2, then cur_region will be compacted
-      // completely into itself.
-      destination_count += cur_region == dest_region_2 ? 0 : 1;
-      if (dest_region_1 != dest_region_2) {
-        // Destination regions differ; adjust destination_count.
-        destination_count += 1;
-        // Data from cur_region will be copied to the start of dest_region_2.
-        _region_data[dest_region_2].set_source_region(cur_region);
-      } else if (is_region_aligned(dest_addr)) {
-        // Data from cur_region will be copied to the start of the destination
-        // region.
-        _region_data[dest_region_1].set_source_region(cur_region);
-      }
-
-      _region_data[cur_region].set_destination_count(destination_count);
-      _region_data[cur_region].set_data_location(region_to_addr(cur_region));
-      dest_addr += words;
+    // If cur_region does not fit entirely into the target space, find a point
+    // at which the source space can be 'split' so that part is copied to the
+    // target space and the rest is copied elsewhere.
+    if (words > 0 && dest_addr + words > target_end) {
+      // The destination must be set even if the region has no data.
+      _region_data[cur_region].set_destination(dest_addr);
+      assert(source_next != nullptr, "source_next is null when splitting");
+      *source_next = summarize_split_space(cur_region, split_info, dest_addr,
+                                           target_end, target_next);
+      return false;
     }
 
+    summarize_region(cur_region, split_info, dest_addr);
+    dest_addr += words;
     ++cur_region;
   }
 
@@ -775,6 +728,84 @@ bool ParallelCompactData::summarize(SplitInfo& split_info,
   return true;
 }
 
+void ParallelCompactData::summarize_region(size_t cur_region,
+                                           SplitInfo& split_info,
+                                           HeapWord* dest_addr)
+{
+  // The destination must be set even if the region has no data.
+  _region_data[cur_region].set_destination(dest_addr);
+
+  size_t words = _region_data[cur_region].data_size();
+  if (words == 0) {
+    return;
+  }
+
+  // Compute the destination_count for cur_region, and if necessary, update
+  // source_region for a destination region.  The source_region field is
+  // updated if cur_region is the first (left-most) region to be copied to a
+  // destination region.
+  //
+  // The destination_count calculation is a bit subtle.  A region that has
+  // data that compacts into itself does not count itself as a destination.
+  // This maintains the invariant that a zero count means the region is
+  // available and can be claimed and then filled.
+  uint destination_count = 0;
+  if (split_info.is_split(cur_region)) {
+    // The current region has been split:  the partial object will be copied
+    // to one destination space and the remaining data will be copied to
+    // another destination space.  Adjust the initial destination_count and,
+    // if necessary, set the source_region field if the partial object will
+    // cross a destination region boundary.
+    destination_count = split_info.destination_count();
+    if (destination_count == 2) {
+      size_t dest_idx = addr_to_region_idx(split_info.dest_region_addr());
+      _region_data[dest_idx].set_source_region(cur_region);
+    }
+  }
+
+  HeapWord* const last_addr = dest_addr + words - 1;
+  const size_t dest_region_1 = addr_to_region_idx(dest_addr);
+  const size_t dest_region_2 = addr_to_region_idx(last_addr);
+
+  // Initially assume that the destination regions will be the same and
+  // adjust the value below if necessary.  Under this assumption, if
+  // cur_region == dest_region_2, then cur_region will be compacted
+  // completely into itself.
+  destination_count += cur_region == dest_region_2 ? 0 : 1;
+  if (dest_region_1 != dest_region_2) {
+    // Destination regions differ; adjust destination_count.
+    destination_count += 1;
+    // Data from cur_region will be copied to the start of dest_region_2.
+    _region_data[dest_region_2].set_source_region(cur_region);
+  } else if (is_region_aligned(dest_addr)) {
+    // Data from cur_region will be copied to the start of the destination
+    // region.
+    _region_data[dest_region_1].set_source_region(cur_region);
+  }
+
+  _region_data[cur_region].set_destination_count(destination_count);
+  _region_data[cur_region].set_data_location(region_to_addr(cur_region));
+}
+
+size_t ParallelCompactData::data_size_in_regions(size_t beg_region, size_t end_region) const
+{
+  size_t words = 0;
+  for (size_t cur_region = beg_region; cur_region < end_region; ++cur_region) {
+    words += _region_data[cur_region].data_size();
+  }
+  return words;
+}
+
+void ParallelCompactData::summarize_regions(SplitInfo& split_info,
+                                            size_t beg_region, size_t end_region,
+                                            HeapWord* dest_addr)
+{
+  for (size_t cur_region = beg_region; cur_region < end_region; ++cur_region) {
+    summarize_region(cur_region, split_info, dest_addr);
+    dest_addr += _region_data[cur_region].data_size();
+  }
+}
+
 HeapWord* ParallelCompactData::calc_new_pointer(HeapWord* addr, ParCompactionManager* cm) const {
   assert(addr != nullptr, "Should detect null oop earlier");
   assert(ParallelScavengeHeap::heap()->is_in(addr), "not in heap");
@@ -1420,14 +1451,170 @@ PSParallelCompact::compute_dense_prefix(const SpaceId id,
   return sd.region_to_addr(best_cp);
 }
 
-void PSParallelCompact::summarize_spaces_quick()
+// Accumulates the time each worker spent doing useful work in a parallel
+// phase, to report how well the work was balanced across the workers.
+class PCWorkerUtilization : public StackObj {
+  const char* const _phase;
+  const uint _num_workers;
+  double* _busy_time;
+  Tickspan _wall_time;
+
+public:
+  PCWorkerUtilization(const char* phase, uint num_workers) :
+    _phase(phase),
+    _num_workers(num_workers),
+    _busy_time(NEW_C_HEAP_ARRAY(double, num_workers, mtGC)),
+    _wall_time() {
+    for (uint i = 0; i < _num_workers; i++) {
+      _busy_time[i] = 0.0;
+    }
+  }
+
+  ~PCWorkerUtilization() {
+    FREE_C_HEAP_ARRAY(double, _busy_time);
+  }
+
+  void add_busy_time(uint worker_id, Tickspan time) {
+    assert(worker_id < _num_workers, "out of range");
+    _busy_time[worker_id] += time.seconds();
+  }
+
+  void add_wall_time(Tickspan time) {
+    _wall_time += time;
+  }
+
+  void print() const {
+    double wall = _wall_time.seconds();
+    if (!log_is_enabled(Debug, gc, phases) || wall <= 0.0) {
+      return;
+    }
+    double sum = 0.0;
+    double max = 0.0;
+    for (uint i = 0; i < _num_workers; i++) {
+      sum += _busy_time[i];
+      max = MAX2(max, _busy_time[i]);
+    }
+    log_debug(gc, phases)("%s Workers: %u, Busy Avg: %.3fms, Max: %.3fms, Wall: %.3fms, Utilization: %.1f%%",
+                          _phase, _num_workers,
+                          sum / _num_workers * MILLIUNITS, max * MILLIUNITS, wall * MILLIUNITS,
+                          sum / (wall * _num_workers) * 100.0);
+  }
+};
+
+// Summarizes a range of regions that fits into the target space entirely in
+// parallel. The destination of each region is the target start plus the data
+// size of all regions before it, so this is a parallel prefix sum: the first
+// pass computes the data size of fixed size chunks of regions, the prefix sum
+// over the chunks is done serially, and the second pass summarizes each chunk
+// starting at its destination.
+class PCSummarizeTask : public WorkerTask {
+  SplitInfo& _split_info;
+  const size_t _beg_region;
+  const size_t _end_region;
+  const size_t _num_chunks;
+  size_t* _chunk_words;
+  HeapWord* _target_beg;
+  bool _compute_sizes;
+  volatile size_t _claimed;
+  PCWorkerUtilization* _utilization;
+
+  size_t chunk_beg(size_t chunk) const { return _beg_region + chunk * ChunkRegions; }
+  size_t chunk_end(size_t chunk) const { return MIN2(chunk_beg(chunk) + ChunkRegions, _end_region); }
+
+public:
+  static const size_t ChunkRegions = 512;
+
+  PCSummarizeTask(SplitInfo& split_info, size_t beg_region, size_t end_region,
+                  HeapWord* target_beg, PCWorkerUtilization* utilization) :
+    WorkerTask("PCSummarizeTask"),
+    _split_info(split_info),
+    _beg_region(beg_region),
+    _end_region(end_region),
+    _num_chunks(align_up(end_region - beg_region, ChunkRegions) / ChunkRegions),
+    _chunk_words(NEW_C_HEAP_ARRAY(size_t, _num_chunks, mtGC)),
+    _target_beg(target_beg),
+    _compute_sizes(true),
+    _claimed(0),
+    _utilization(utilization) {}
+
+  ~PCSummarizeTask() {
+    FREE_C_HEAP_ARRAY(size_t, _chunk_words);
+  }
+
+  // Turn the per chunk data sizes into chunk destinations, and prepare for
+  // the second pass. Returns the total amount of data.
+  size_t compute_destinations() {
+    assert(_compute_sizes, "sizes must be computed first");
+    size_t total = 0;
+    for (size_t i = 0; i < _num_chunks; i++) {
+      size_t words = _chunk_words[i];
+      _chunk_words[i] = total;
+      total += words;
+    }
+    _compute_sizes = false;
+    _claimed = 0;
+    return total;
+  }
+
+  void work(uint worker_id) {
+    ParallelCompactData& sd = PSParallelCompact::summary_data();
+    Ticks start = Ticks::now();
+    for (size_t i = Atomic::fetch_then_add(&_claimed, (size_t)1);
+         i < _num_chunks;
+         i = Atomic::fetch_then_add(&_claimed, (size_t)1)) {
+      if (_compute_sizes) {
+        _chunk_words[i] = sd.data_size_in_regions(chunk_beg(i), chunk_end(i));
+      } else {
+        sd.summarize_regions(_split_info, chunk_beg(i), chunk_end(i), _target_beg + _chunk_words[i]);
+      }
+    }
+    _utilization->add_busy_time(worker_id, Ticks::now() - start);
+  }
+};
+
+bool PSParallelCompact::summarize_fitting(SplitInfo& split_info,
+                                          HeapWord* source_beg, HeapWord* source_end,
+                                          HeapWord* target_beg, HeapWord* target_end,
+                                          HeapWord** target_next,
+                                          PCWorkerUtilization* utilization)
+{
+  const size_t beg_region = _summary_data.addr_to_region_idx(source_beg);
+  const size_t end_region = _summary_data.addr_to_region_idx(_summary_data.region_align_up(source_end));
+  WorkerThreads& workers = ParallelScavengeHeap::heap()->workers();
+
+  if (workers.active_workers() == 1 ||
+      end_region - beg_region < 2 * PCSummarizeTask::ChunkRegions) {
+    return _summary_data.summarize(split_info,
+                                   source_beg, source_end, nullptr,
+                                   target_beg, target_end, target_next);
+  }
+
+  Ticks start = Ticks::now();
+  PCSummarizeTask task(split_info, beg_region, end_region, target_beg, utilization);
+  workers.run_task(&task);
+  size_t total = task.compute_destinations();
+  if (pointer_delta(target_end, target_beg) < total) {
+    // Does not fit, let the serial version deal with it.
+    utilization->add_wall_time(Ticks::now() - start);
+    return _summary_data.summarize(split_info,
+                                   source_beg, source_end, nullptr,
+                                   target_beg, target_end, target_next);
+  }
+  workers.run_task(&task);
+  *target_next = target_beg + total;
+  utilization->add_wall_time(Ticks::now() - start);
+  return true;
+}
+
+void PSParallelCompact::summarize_spaces_quick(PCWorkerUtilization* utilization)
 {
   for (unsigned int i = 0; i < last_space_id; ++i) {
     const MutableSpace* space = _space_info[i].space();
     HeapWord** nta = _space_info[i].new_top_addr();
-    bool result = _summary_data.summarize(_space_info[i].split_info(),
-                                          space->bottom(), space->top(), nullptr,
-                                          space->bottom(), space->end(), nta);
+    bool result = summarize_fitting(_space_info[i].split_info(),
+                                    space->bottom(), space->top(),
+                                    space->bottom(), space->end(), nta,
+                                    utilization);
     assert(result, "space must fit into itself");
     _space_info[i].set_dense_prefix(space->bottom());
   }
@@ -1501,7 +1688,8 @@ void PSParallelCompact::fill_dense_prefix_end(SpaceId id)
 }
 
 void
-PSParallelCompact::summarize_space(SpaceId id, bool maximum_compaction)
+PSParallelCompact::summarize_space(SpaceId id, bool maximum_compaction,
+                                   PCWorkerUtilization* utilization)
 {
   assert(id < last_space_id, "id out of range");
   assert(_space_info[id].dense_prefix() == _space_info[id].space()->bottom(),
@@ -1534,10 +1722,11 @@ PSParallelCompact::summarize_space(SpaceId id, bool maximum_compaction)
 
       // Compute the destination of each Region, and thus each object.
       _summary_data.summarize_dense_prefix(space->bottom(), dense_prefix_end);
-      _summary_data.summarize(_space_info[id].split_info(),
-                              dense_prefix_end, space->top(), nullptr,
-                              dense_prefix_end, space->end(),
-                              _space_info[id].new_top_addr());
+      summarize_fitting(_space_info[id].split_info(),
+                        dense_prefix_end, space->top(),
+                        dense_prefix_end, space->end(),
+                        _space_info[id].new_top_addr(),
+                        utilization);
     }
   }
 
@@ -1586,8 +1775,11 @@ void PSParallelCompact::summary_phase(bool maximum_compaction)
 {
   GCTraceTime(Info, gc, phases) tm("Summary Phase", &_gc_timer);
 
+  PCWorkerUtilization utilization("Summary Phase",
+                                  ParallelScavengeHeap::heap()->workers().active_workers());
+
   // Quick summarization of each space into itself, to see how much is live.
-  summarize_spaces_quick();
+  summarize_spaces_quick(&utilization);
 
   log_develop_trace(gc, compaction)("summary phase:  after summarizing each space to self");
   NOT_PRODUCT(print_region_ranges());
@@ -1608,7 +1800,7 @@ void PSParallelCompact::summary_phase(bool maximum_compaction)
   }
 
   // Old generations.
-  summarize_space(old_space_id, maximum_compaction);
+  summarize_space(old_space_id, maximum_compaction, &utilization);
 
   // Summarize the remaining spaces in the young gen.  The initial target space
   // is the old gen.  If a space does not fit entirely into the target, then the
@@ -1627,11 +1819,11 @@ void PSParallelCompact::summary_phase(bool maximum_compaction)
                                   SpaceId(id), space->bottom(), space->top());)
     if (live > 0 && live <= available) {
       // All the live data will fit.
-      bool done = _summary_data.summarize(_space_info[id].split_info(),
-                                          space->bottom(), space->top(),
-                                          nullptr,
-                                          *new_top_addr, dst_space_end,
-                                          new_top_addr);
+      bool done = summarize_fitting(_space_info[id].split_info(),
+                                    space->bottom(), space->top(),
+                                    *new_top_addr, dst_space_end,
+                                    new_top_addr,
+                                    &utilization);
       assert(done, "space must fit into old gen");
 
       // Reset the new_top value for the space.
@@ -1665,6 +1857,8 @@ void PSParallelCompact::summary_phase(bool maximum_compaction)
     }
   }
 
+  utilization.print();
+
   log_develop_trace(gc, compaction)("Summary_phase:  after final summarization");
   NOT_PRODUCT(print_region_ranges());
   NOT_PRODUCT(print_initial_summary_data(_summary_data, _space_info));
@@ -2276,7 +2470,11 @@ public:
   }
 };
 
-#define PAR_OLD_DENSE_PREFIX_OVER_PARTITIONING 4
+// The cost of updating a dense prefix region depends on the number of live
+// objects in it, which varies a lot. Hand out small tasks so that workers stay
+// busy until the dense prefix is done; region filling balances itself by
+// stealing from the ParCompactionManager region stacks.
+#define PAR_OLD_DENSE_PREFIX_OVER_PARTITIONING 16
 
 void PSParallelCompact::enqueue_dense_prefix_tasks(TaskQueue& task_queue,
                                                    uint parallel_gc_threads) {
@@ -2400,7 +2598,8 @@ void PSParallelCompact::write_block_fill_histogram()
 }
 #endif // #ifdef ASSERT
 
-static void compaction_with_stealing_work(TaskTerminator* terminator, uint worker_id) {
+static void compaction_with_stealing_work(TaskTerminator* terminator, uint worker_id,
+                                          Tickspan& termination_time) {
   assert(ParallelScavengeHeap::heap()->is_stw_gc_active(), "called outside gc");
 
   ParCompactionManager* cm =
@@ -2424,7 +2623,10 @@ static void compaction_with_stealing_work(TaskTerminator* terminator, uint worke
       PSParallelCompact::fill_and_update_shadow_region(cm, region_index);
       cm->drain_region_stacks();
     } else {
-      if (terminator->offer_termination()) {
+      Ticks start = Ticks::now();
+      bool terminated = terminator->offer_termination();
+      termination_time += Ticks::now() - start;
+      if (terminated) {
         break;
       }
       // Go around again.
@@ -2435,15 +2637,20 @@ static void compaction_with_stealing_work(TaskTerminator* terminator, uint worke
 class UpdateDensePrefixAndCompactionTask: public WorkerTask {
   TaskQueue& _tq;
   TaskTerminator _terminator;
+  PCWorkerUtilization* _utilization;
 
 public:
-  UpdateDensePrefixAndCompactionTask(TaskQueue& tq, uint active_workers) :
+  UpdateDensePrefixAndCompactionTask(TaskQueue& tq, uint active_workers,
+                                     PCWorkerUtilization* utilization) :
       WorkerTask("UpdateDensePrefixAndCompactionTask"),
       _tq(tq),
-      _terminator(active_workers, ParCompactionManager::region_task_queues()) {
+      _terminator(active_workers, ParCompactionManager::region_task_queues()),
+      _utilization(utilization) {
   }
   virtual void work(uint worker_id) {
     ParCompactionManager* cm = ParCompactionManager::gc_thread_compaction_manager(worker_id);
+    Ticks start = Ticks::now();
+    Tickspan termination_time;
 
     for (PSParallelCompact::UpdateDensePrefixTask task; _tq.try_claim(task); /* empty */) {
       PSParallelCompact::update_and_deadwood_in_dense_prefix(cm,
@@ -2454,11 +2661,13 @@ public:
 
     // Once a thread has drained it's stack, it should try to steal regions from
     // other threads.
-    compaction_with_stealing_work(&_terminator, worker_id);
+    compaction_with_stealing_work(&_terminator, worker_id, termination_time);
 
     // At this point all regions have been compacted, so it's now safe
     // to update the deferred objects that cross region boundaries.
     cm->drain_deferred_objects();
+
+    _utilization->add_busy_time(worker_id, (Ticks::now() - start) - termination_time);
   }
 };
 
@@ -2484,8 +2693,12 @@ void PSParallelCompact::compact() {
   {
     GCTraceTime(Trace, gc, phases) tm("Par Compact", &_gc_timer);
 
-    UpdateDensePrefixAndCompactionTask task(task_queue, active_gc_threads);
+    PCWorkerUtilization utilization("Compaction Phase", active_gc_threads);
+    Ticks start = Ticks::now();
+    UpdateDensePrefixAndCompactionTask task(task_queue, active_gc_threads, &utilization);
     ParallelScavengeHeap::heap()->workers().run_task(&task);
+    utilization.add_wall_time(Ticks::now() - start);
+    utilization.print();
 
 #ifdef  ASSERT
     // Verify that all regions have been processed.
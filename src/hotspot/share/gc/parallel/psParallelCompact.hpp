@@ -434,6 +434,18 @@ public:
                  HeapWord* target_beg, HeapWord* target_end,
                  HeapWord** target_next);
 
+  // Compute the destination of region cur_region, whose data is copied to
+  // dest_addr, and its contribution to the destination regions' bookkeeping.
+  void summarize_region(size_t cur_region, SplitInfo& split_info, HeapWord* dest_addr);
+
+  // Building blocks for summarizing a range of regions in parallel, when the
+  // range is known to fit into the target: the amount of data in the regions
+  // [beg_region, end_region), and summarizing them to start at dest_addr.
+  size_t data_size_in_regions(size_t beg_region, size_t end_region) const;
+  void summarize_regions(SplitInfo& split_info,
+                         size_t beg_region, size_t end_region,
+                         HeapWord* dest_addr);
+
   void clear();
   void clear_range(size_t beg_region, size_t end_region);
   void clear_range(HeapWord* beg, HeapWord* end) {
@@ -973,6 +985,7 @@ inline void ParMarkBitMapClosure::decrement_words_remaining(size_t words) {
 // https://doi.org/10.1145/3313808.3313820
 
 class TaskQueue;
+class PCWorkerUtilization;
 
 class PSParallelCompact : AllStatic {
  public:
@@ -1111,8 +1124,16 @@ class PSParallelCompact : AllStatic {
   // non-empty.
   static void fill_dense_prefix_end(SpaceId id);
 
-  static void summarize_spaces_quick();
-  static void summarize_space(SpaceId id, bool maximum_compaction);
+  // Summarize [source_beg, source_end) into [target_beg, target_end), where the
+  // source is expected to fit. Large ranges are summarized in parallel.
+  static bool summarize_fitting(SplitInfo& split_info,
+                                HeapWord* source_beg, HeapWord* source_end,
+                                HeapWord* target_beg, HeapWord* target_end,
+                                HeapWord** target_next,
+                                PCWorkerUtilization* utilization);
+  static void summarize_spaces_quick(PCWorkerUtilization* utilization);
+  static void summarize_space(SpaceId id, bool maximum_compaction,
+                              PCWorkerUtilization* utilization);
   static void summary_phase(bool maximum_compaction);
 
   // Adjust addresses in roots.  Does not adjust addresses in heap.
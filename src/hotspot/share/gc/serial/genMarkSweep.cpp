@@ -161,6 +161,8 @@ void GenMarkSweep::mark_sweep_phase1(bool clear_all_softrefs) {
 
   ClassLoaderDataGraph::verify_claimed_marks_cleared(ClassLoaderData::_claim_stw_fullgc_mark);
 
+  clear_marks();
+
   ref_processor()->start_discovery(clear_all_softrefs);
 
   {
@@ -173,6 +175,10 @@ void GenMarkSweep::mark_sweep_phase1(bool clear_all_softrefs) {
                        &follow_cld_closure,
                        weak_cld_closure,
                        &mark_code_closure);
+
+    // Complete marking from the CLD roots, which may still be waiting in the
+    // prefetch queue, before reference processing queries liveness.
+    follow_stack();
   }
 
   // Process reference objects found during marking
@@ -188,6 +194,7 @@ void GenMarkSweep::mark_sweep_phase1(bool clear_all_softrefs) {
 
   // This is the point where the entire marking should have completed.
   assert(_marking_stack.is_empty(), "Marking should have completed");
+  assert(prefetch_queue_is_empty(), "Marking should have completed");
 
   {
     GCTraceTime(Debug, gc, phases) tm_m("Weak Processing", gc_timer());
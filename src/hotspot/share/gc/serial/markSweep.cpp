@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -29,6 +29,11 @@
 #include "gc/shared/gcTimer.hpp"
 #include "gc/shared/gcTrace.hpp"
 #include "gc/shared/gc_globals.hpp"
+#include "gc/shared/genCollectedHeap.hpp"
+#include "gc/shared/generation.hpp"
+#include "gc/shared/markBitMap.inline.hpp"
+#include "gc/shared/prefetchQueue.inline.hpp"
+#include "gc/shared/space.hpp"
 #include "memory/iterator.inline.hpp"
 #include "memory/universe.hpp"
 #include "oops/access.inline.hpp"
@@ -37,12 +42,19 @@
 #include "oops/objArrayKlass.inline.hpp"
 #include "oops/oop.inline.hpp"
 #include "oops/typeArrayOop.inline.hpp"
+#include "runtime/java.hpp"
+#include "runtime/os.hpp"
+#include "services/memTracker.hpp"
 #include "utilities/stack.inline.hpp"
 
 uint                    MarkSweep::_total_invocations = 0;
 
+MarkBitMap                    MarkSweep::_mark_bitmap;
+MemRegion                     MarkSweep::_mark_bitmap_storage;
+bool                          MarkSweep::_mark_bitmap_committed = false;
 Stack<oop, mtGC>              MarkSweep::_marking_stack;
 Stack<ObjArrayTask, mtGC>     MarkSweep::_objarray_stack;
+PrefetchQueue<oop, MarkSweep::PrefetchQueueSize> MarkSweep::_prefetch_queue;
 
 Stack<PreservedMark, mtGC>    MarkSweep::_preserved_overflow_stack;
 size_t                  MarkSweep::_preserved_count = 0;
@@ -81,7 +93,7 @@ void MarkSweep::follow_array(objArrayOop array) {
 }
 
 void MarkSweep::follow_object(oop obj) {
-  assert(obj->is_gc_marked(), "should be marked");
+  assert(is_marked(obj), "should be marked");
   if (obj->is_objArray()) {
     // Handle object arrays explicitly to allow them to
     // be split into chunks if needed.
@@ -110,7 +122,7 @@ void MarkSweep::follow_stack() {
   do {
     while (!_marking_stack.is_empty()) {
       oop obj = _marking_stack.pop();
-      assert (obj->is_gc_marked(), "p must be marked");
+      assert (is_marked(obj), "p must be marked");
       follow_object(obj);
     }
     // Process ObjArrays one at a time to avoid marking stack bloat.
@@ -118,6 +130,11 @@ void MarkSweep::follow_stack() {
       ObjArrayTask task = _objarray_stack.pop();
       follow_array_chunk(objArrayOop(task.obj()), task.index());
     }
+    // Nothing else to do, take the objects still waiting for their prefetch.
+    oop obj;
+    while (_marking_stack.is_empty() && _prefetch_queue.pop(obj)) {
+      mark_and_push_object(obj);
+    }
   } while (!_marking_stack.is_empty() || !_objarray_stack.is_empty());
 }
 
@@ -131,7 +148,7 @@ template <class T> void MarkSweep::follow_root(T* p) {
   T heap_oop = RawAccess<>::oop_load(p);
   if (!CompressedOops::is_null(heap_oop)) {
     oop obj = CompressedOops::decode_not_null(heap_oop);
-    if (!obj->mark().is_marked()) {
+    if (!is_marked(obj)) {
       mark_object(obj);
       follow_object(obj);
     }
@@ -172,31 +189,87 @@ void MarkSweep::mark_object(oop obj) {
     _string_dedup_requests->add(obj);
   }
 
-  // some marks may contain information we need to preserve so we store them away
-  // and overwrite the mark.  We'll restore it at the end of markSweep.
-  markWord mark = obj->mark();
-  obj->set_mark(markWord::prototype().set_marked());
+  _mark_bitmap.mark(obj);
 
   ContinuationGCSupport::transform_stack_chunk(obj);
+}
 
+void MarkSweep::forward_to(oop obj, oop new_loc) {
+  assert(is_marked(obj), "only live objects are moved");
+  // Some marks contain information we need to preserve, so we store them away
+  // and overwrite the mark with the forwarding pointer. We'll restore it at the
+  // end of markSweep. Objects that do not move keep their mark as is.
+  markWord mark = obj->mark();
   if (obj->mark_must_be_preserved(mark)) {
     preserve_mark(obj, mark);
   }
+  obj->forward_to(new_loc);
+}
+
+class MarkSweepClearMarksClosure : public SpaceClosure {
+  MarkBitMap* const _bitmap;
+public:
+  MarkSweepClearMarksClosure(MarkBitMap* bitmap) : _bitmap(bitmap) {}
+
+  void do_space(Space* s) {
+    MemRegion used = s->used_region();
+    if (!used.is_empty()) {
+      _bitmap->clear_range_large(used);
+    }
+  }
+};
+
+void MarkSweep::commit_mark_bitmap() {
+  if (_mark_bitmap_committed) {
+    return;
+  }
+  os::commit_memory_or_exit((char*)_mark_bitmap_storage.start(), _mark_bitmap_storage.byte_size(), false,
+                            "Could not commit the mark bitmap");
+  _mark_bitmap_committed = true;
+}
+
+void MarkSweep::clear_marks() {
+  commit_mark_bitmap();
+
+  // All objects are below top, so marks left over above top by the previous
+  // collection are never looked at.
+  GenCollectedHeap* gch = GenCollectedHeap::heap();
+  MarkSweepClearMarksClosure cl(&_mark_bitmap);
+  gch->young_gen()->space_iterate(&cl, true);
+  gch->old_gen()->space_iterate(&cl, true);
+}
+
+inline void MarkSweep::mark_and_push_object(oop obj) {
+  if (!is_marked(obj)) {
+    mark_object(obj);
+    _marking_stack.push(obj);
+  }
 }
 
 template <class T> void MarkSweep::mark_and_push(T* p) {
   T heap_oop = RawAccess<>::oop_load(p);
   if (!CompressedOops::is_null(heap_oop)) {
     oop obj = CompressedOops::decode_not_null(heap_oop);
-    if (!obj->mark().is_marked()) {
-      mark_object(obj);
-      _marking_stack.push(obj);
+    mark_and_push_object(obj);
+  }
+}
+
+// Objects in the prefetch queue are not marked yet, so the queue must be
+// drained by follow_stack() before liveness is queried. Closures used during
+// reference processing (keep_alive) therefore mark right away.
+template <class T> void MarkSweep::mark_and_push_prefetch(T* p) {
+  T heap_oop = RawAccess<>::oop_load(p);
+  if (!CompressedOops::is_null(heap_oop)) {
+    oop obj = CompressedOops::decode_not_null(heap_oop);
+    oop evicted;
+    if (_prefetch_queue.push(obj, cast_from_oop<HeapWord*>(obj), evicted)) {
+      mark_and_push_object(evicted);
     }
   }
 }
 
 template <typename T>
-void MarkAndPushClosure::do_oop_work(T* p)            { MarkSweep::mark_and_push(p); }
+void MarkAndPushClosure::do_oop_work(T* p)            { MarkSweep::mark_and_push_prefetch(p); }
 void MarkAndPushClosure::do_oop(      oop* p)         { do_oop_work(p); }
 void MarkAndPushClosure::do_oop(narrowOop* p)         { do_oop_work(p); }
 
@@ -233,7 +306,7 @@ void MarkSweep::restore_marks() {
 
 MarkSweep::IsAliveClosure   MarkSweep::is_alive;
 
-bool MarkSweep::IsAliveClosure::do_object_b(oop p) { return p->is_gc_marked(); }
+bool MarkSweep::IsAliveClosure::do_object_b(oop p) { return MarkSweep::is_marked(p); }
 
 MarkSweep::KeepAliveClosure MarkSweep::keep_alive;
 
@@ -241,12 +314,28 @@ void MarkSweep::KeepAliveClosure::do_oop(oop* p)       { MarkSweep::KeepAliveClo
 void MarkSweep::KeepAliveClosure::do_oop(narrowOop* p) { MarkSweep::KeepAliveClosure::do_oop_work(p); }
 
 void MarkSweep::initialize() {
+  MemRegion heap = GenCollectedHeap::heap()->reserved_region();
+  size_t bitmap_size = MarkBitMap::compute_size(heap.byte_size());
+  ReservedSpace bitmap_rs(bitmap_size);
+  if (!bitmap_rs.is_reserved()) {
+    vm_exit_during_initialization("Could not reserve space for the mark bitmap");
+  }
+  MemTracker::record_virtual_memory_type((address)bitmap_rs.base(), mtGC);
+  _mark_bitmap_storage = MemRegion((HeapWord*)bitmap_rs.base(), bitmap_rs.size() / HeapWordSize);
+  _mark_bitmap.initialize(heap, _mark_bitmap_storage);
+
   MarkSweep::_gc_timer = new STWGCTimer();
   MarkSweep::_gc_tracer = new SerialOldTracer();
   MarkSweep::_string_dedup_requests = new StringDedup::Requests();
 
   // The Full GC operates on the entire heap so all objects should be subject
-  // to discovery, hence the _always_true_closure.
-  MarkSweep::_ref_processor = new ReferenceProcessor(&_always_true_closure);
+  // to discovery, hence the _always_true_closure. Marks are kept in the
+  // bitmap rather than in the headers, so discovery has to ask is_alive
+  // whether a referent is already marked.
+  MarkSweep::_ref_processor = new ReferenceProcessor(&_always_true_closure,
+                                                     1,     // mt processing degree
+                                                     1,     // mt discovery degree
+                                                     false, // concurrent discovery
+                                                     &is_alive);
   mark_and_push_closure.set_ref_discoverer(_ref_processor);
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,8 @@
 #define SHARE_GC_SERIAL_MARKSWEEP_HPP
 
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/markBitMap.hpp"
+#include "gc/shared/prefetchQueue.hpp"
 #include "gc/shared/referenceProcessor.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
 #include "gc/shared/taskqueue.hpp"
@@ -94,10 +96,27 @@ class MarkSweep : AllStatic {
   // Total invocations of a MarkSweep collection
   static uint _total_invocations;
 
+  // Live objects are marked in a bitmap rather than in their headers, so
+  // marks only need to be preserved for objects that end up moving.
+  static MarkBitMap                            _mark_bitmap;
+  // The bitmap storage is reserved at startup but only committed by the
+  // first full collection, so VMs that never run one don't pay for it.
+  static MemRegion                             _mark_bitmap_storage;
+  static bool                                  _mark_bitmap_committed;
+
+  static void commit_mark_bitmap();
+
   // Traversal stacks used during phase1
   static Stack<oop, mtGC>                      _marking_stack;
   static Stack<ObjArrayTask, mtGC>             _objarray_stack;
 
+  // Objects found while following objects wait here, not yet marked, while
+  // the start of the object (header, klass and first fields) is prefetched.
+  // Marking itself only touches the bitmap, the prefetch is for following
+  // the object, which usually happens soon after it leaves the queue.
+  static const uint PrefetchQueueSize = 8;
+  static PrefetchQueue<oop, PrefetchQueueSize> _prefetch_queue;
+
   // Space for storing/restoring mark word
   static Stack<PreservedMark, mtGC>      _preserved_overflow_stack;
   static size_t                          _preserved_count;
@@ -136,6 +155,19 @@ class MarkSweep : AllStatic {
   static STWGCTimer* gc_timer() { return _gc_timer; }
   static SerialOldTracer* gc_tracer() { return _gc_tracer; }
 
+  static bool is_marked(oop obj) { return _mark_bitmap.is_marked(obj); }
+  static bool is_marked(HeapWord* addr) { return _mark_bitmap.is_marked(addr); }
+
+  // Clear the marks of all objects in the heap.
+  static void clear_marks();
+
+  // Mark a filler object that takes the place of dead objects that are kept.
+  static inline void mark_dead_space(oop filler);
+
+  // Record the location obj will be moved to, saving its mark word first if
+  // it carries information that must survive the move.
+  static void forward_to(oop obj, oop new_loc);
+
   static void preserve_mark(oop p, markWord mark);
                                 // Save the mark word so it can be restored later
   static void adjust_marks();   // Adjust the pointers in the preserved marks table
@@ -150,9 +182,16 @@ class MarkSweep : AllStatic {
   // Check mark and maybe push on marking stack
   template <class T> static void mark_and_push(T* p);
 
+  // As mark_and_push, but passes the object through the prefetch queue first,
+  // so that its start is likely in the cache by the time it is followed.
+  template <class T> static void mark_and_push_prefetch(T* p);
+
+  static bool prefetch_queue_is_empty() { return _prefetch_queue.is_empty(); }
+
  private:
   // Call backs for marking
   static void mark_object(oop obj);
+  static inline void mark_and_push_object(oop obj);
   // Mark pointer and follow contents.  Empty marking stack afterwards.
   template <class T> static inline void follow_root(T* p);
 
@@ -31,6 +31,7 @@
 #include "classfile/javaClasses.inline.hpp"
 #include "gc/shared/continuationGCSupport.inline.hpp"
 #include "gc/serial/serialStringDedup.hpp"
+#include "gc/shared/markBitMap.inline.hpp"
 #include "memory/universe.hpp"
 #include "oops/markWord.hpp"
 #include "oops/access.inline.hpp"
@@ -39,6 +40,10 @@
 #include "utilities/align.hpp"
 #include "utilities/stack.inline.hpp"
 
+inline void MarkSweep::mark_dead_space(oop filler) {
+  _mark_bitmap.mark(filler);
+}
+
 template <class T> inline void MarkSweep::adjust_pointer(T* p) {
   T heap_oop = RawAccess<>::oop_load(p);
   if (!CompressedOops::is_null(heap_oop)) {
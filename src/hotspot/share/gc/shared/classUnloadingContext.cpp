@@ -25,8 +25,11 @@
 #include "precompiled.hpp"
 
 #include "classfile/classLoaderData.inline.hpp"
+#include "code/codeCache.hpp"
 #include "code/nmethod.hpp"
 #include "gc/shared/classUnloadingContext.hpp"
+#include "logging/log.hpp"
+#include "logging/logStream.hpp"
 #include "runtime/mutexLocker.hpp"
 #include "utilities/growableArray.hpp"
 
@@ -158,6 +161,14 @@ void ClassUnloadingContext::free_code_blobs() {
   };
   nmethod_set->sort(sort_nmethods);
 
+  LogTarget(Debug, codecache) lt;
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    MutexLocker ml(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    ls.print_cr("Freeing %d unloaded nmethods, before:", nmethod_set->length());
+    CodeCache::print_fragmentation(&ls);
+  }
+
   // And free. Duplicate loop for clarity depending on where we want the locking.
   if (_lock_codeblob_free_separately) {
     for (nmethod* nm : *nmethod_set) {
@@ -171,6 +182,13 @@ void ClassUnloadingContext::free_code_blobs() {
     }
   }
 
+  if (lt.is_enabled()) {
+    LogStream ls(lt);
+    MutexLocker ml(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    ls.print_cr("After freeing unloaded nmethods:");
+    CodeCache::print_fragmentation(&ls);
+  }
+
   if (is_parallel) {
     delete nmethod_set;
   }
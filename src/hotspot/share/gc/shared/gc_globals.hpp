@@ -225,6 +225,11 @@
   product(bool, ParallelRefProcBalancingEnabled, true,                      \
           "Enable balancing of reference processing queues")                \
                                                                             \
+  product(bool, RefProcMergePhantomPhase, false, EXPERIMENTAL,              \
+          "Process PhantomReferences together with Soft, Weak and Final "   \
+          "References if no FinalReferences have been discovered, saving "  \
+          "a separate round of reference processing work")                  \
+                                                                            \
   product(size_t, ReferencesPerThread, 1000, EXPERIMENTAL,                  \
                "Ergonomically start one thread for this amount of "         \
                "references for reference processing if "                    \
@@ -687,6 +692,16 @@
           "during parallel gc")                                             \
           range(0, max_juint)                                               \
                                                                             \
+  product(uint, GCStealBatchLimit, 0, EXPERIMENTAL,                         \
+          "After a successful steal, move up to this many more tasks, but " \
+          "at most half of the tasks of the victim, into the task queue "   \
+          "of the stealing worker. 0 steals one task at a time.")           \
+          range(0, max_juint)                                               \
+                                                                            \
+  product(bool, GCStealPreferLocalNode, false, EXPERIMENTAL,                \
+          "Prefer stealing tasks from workers that run on the same NUMA "   \
+          "node as the stealing worker. Only used with UseNUMA.")           \
+                                                                            \
   product(uint, GCCardSizeInBytes, 512,                                     \
           "Card table entry size (in bytes) for card based collectors")     \
           range(128, NOT_LP64(512) LP64_ONLY(1024))                         \
@@ -433,8 +433,33 @@ OopStorage::Block::block_for_ptr(const OopStorage* owner, const oop* ptr) {
 // full.  The block is moved to the end of the _allocation_list if the bitmask
 // is empty, for ease of empty block deletion processing.
 
+// Locks _allocation_mutex for an allocation, recording whether another
+// thread had to be waited for.
+class OopStorage::AllocationLocker : public StackObj {
+  OopStorage* _storage;
+
+  NONCOPYABLE(AllocationLocker);
+
+public:
+  AllocationLocker(OopStorage* storage) : _storage(storage) {
+    Mutex* mutex = _storage->_allocation_mutex;
+    bool contended = !mutex->try_lock();
+    if (contended) {
+      mutex->lock_without_safepoint_check();
+    }
+    _storage->_allocation_lock_count++;
+    if (contended) {
+      _storage->_allocation_lock_contended_count++;
+    }
+  }
+
+  ~AllocationLocker() {
+    _storage->_allocation_mutex->unlock();
+  }
+};
+
 oop* OopStorage::allocate() {
-  MutexLocker ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+  AllocationLocker al(this);
 
   Block* block = block_for_allocation();
   if (block == nullptr) return nullptr; // Block allocation failed.
@@ -470,7 +495,7 @@ size_t OopStorage::allocate(oop** ptrs, size_t size) {
   Block* block;
   uintx taken;
   {
-    MutexLocker ml(_allocation_mutex, Mutex::_no_safepoint_check_flag);
+    AllocationLocker al(this);
     block = block_for_allocation();
     if (block == nullptr) return 0; // Block allocation failed.
     // Taking all remaining entries, so remove from list.
@@ -830,7 +855,9 @@ OopStorage::OopStorage(const char* name, MEMFLAGS memflags) :
   _allocation_count(0),
   _concurrent_iteration_count(0),
   _memflags(memflags),
-  _needs_cleanup(false)
+  _needs_cleanup(false),
+  _allocation_lock_count(0),
+  _allocation_lock_contended_count(0)
 {
   _active_array->increment_refcount();
   assert(_active_mutex->rank() < _allocation_mutex->rank(),
@@ -1050,6 +1077,14 @@ size_t OopStorage::total_memory_usage() const {
 
 MEMFLAGS OopStorage::memflags() const { return _memflags; }
 
+size_t OopStorage::allocation_lock_count() const {
+  return Atomic::load(&_allocation_lock_count);
+}
+
+size_t OopStorage::allocation_lock_contended_count() const {
+  return Atomic::load(&_allocation_lock_contended_count);
+}
+
 // Parallel iteration support
 
 uint OopStorage::BasicParState::default_estimated_thread_count(bool concurrent) {
@@ -92,6 +92,11 @@ public:
   // The memory type for allocations.
   MEMFLAGS memflags() const;
 
+  // The number of times _allocation_mutex has been locked by allocations,
+  // and how many of those had to wait for another thread holding it.
+  size_t allocation_lock_count() const;
+  size_t allocation_lock_contended_count() const;
+
   enum EntryStatus {
     INVALID_ENTRY,
     UNALLOCATED_ENTRY,
@@ -279,10 +284,16 @@ private:
   // Flag indicating this storage object is a candidate for empty block deletion.
   volatile bool _needs_cleanup;
 
+  // Allocation lock statistics, only updated while holding _allocation_mutex.
+  size_t _allocation_lock_count;
+  size_t _allocation_lock_contended_count;
+
   // Clients construct via "create" factory function.
   OopStorage(const char* name, MEMFLAGS memflags);
   NONCOPYABLE(OopStorage);
 
+  class AllocationLocker;       // RAII helper for allocation locking.
+
   bool try_add_block();
   Block* block_for_allocation();
   void  log_block_transition(Block* block, const char* new_state) const;
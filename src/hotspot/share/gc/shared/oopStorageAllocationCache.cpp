@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#include "precompiled.hpp"
+#include "gc/shared/oopStorage.hpp"
+#include "gc/shared/oopStorageAllocationCache.hpp"
+#include "utilities/debug.hpp"
+
+OopStorageAllocationCache::OopStorageAllocationCache() :
+  _entries(),
+  _count(0)
+  DEBUG_ONLY(COMMA _storage(nullptr))
+{}
+
+#ifdef ASSERT
+void OopStorageAllocationCache::verify_storage(OopStorage* storage) {
+  if (_storage == nullptr) {
+    _storage = storage;
+  }
+  assert(_storage == storage, "cache used with storages %s and %s",
+         _storage->name(), storage->name());
+}
+#endif // ASSERT
+
+oop* OopStorageAllocationCache::allocate(OopStorage* storage) {
+  verify_storage(storage);
+  if (_count == 0) {
+    // Refill with a single lock of the allocation mutex.
+    _count = storage->allocate(_entries, Capacity);
+    if (_count == 0) {
+      return nullptr;
+    }
+  }
+  oop* result = _entries[--_count];
+  assert(*result == nullptr, "cached entries must be null");
+  return result;
+}
+
+void OopStorageAllocationCache::release(OopStorage* storage, oop* ptr) {
+  verify_storage(storage);
+  assert(*ptr == nullptr, "precondition");
+  if (_count == Capacity) {
+    // Return the older half of the entries to the storage, keeping the more
+    // recently used ones.
+    const size_t num_released = Capacity / 2;
+    storage->release(_entries, num_released);
+    for (size_t i = num_released; i < Capacity; i++) {
+      _entries[i - num_released] = _entries[i];
+    }
+    _count -= num_released;
+  }
+  _entries[_count++] = ptr;
+}
+
+void OopStorageAllocationCache::flush(OopStorage* storage) {
+  if (_count > 0) {
+    verify_storage(storage);
+    storage->release(_entries, _count);
+    _count = 0;
+  }
+}
@@ -0,0 +1,72 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+
+#ifndef SHARE_GC_SHARED_OOPSTORAGEALLOCATIONCACHE_HPP
+#define SHARE_GC_SHARED_OOPSTORAGEALLOCATIONCACHE_HPP
+
+#include "memory/allocation.hpp"
+#include "oops/oopsHierarchy.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class OopStorage;
+
+// A small cache of entries of an OopStorage, owned by a single thread.
+//
+// Entries are obtained from the storage in bulk, and released entries are
+// kept for reuse by the owner instead of being returned to their block right
+// away. This reduces locking of the storage's allocation mutex and updates of
+// shared block state for clients that create and drop entries at high rates.
+//
+// Entries in the cache are allocated entries of the storage whose value is
+// always null, so they are harmless to iteration over the storage. They are
+// returned to the storage by flush(), which must be called before the owner
+// stops using the cache.
+class OopStorageAllocationCache {
+  static const size_t Capacity = 16;
+
+  oop* _entries[Capacity];
+  size_t _count;
+  DEBUG_ONLY(OopStorage* _storage;)
+
+  NONCOPYABLE(OopStorageAllocationCache);
+
+  void verify_storage(OopStorage* storage) NOT_DEBUG_RETURN;
+
+public:
+  OopStorageAllocationCache();
+
+  // Returns a new entry from storage, or null if memory allocation failed.
+  // postcondition: result == nullptr or *result == nullptr.
+  oop* allocate(OopStorage* storage);
+
+  // Releases ptr, an entry of storage, possibly keeping it for reuse.
+  // precondition: *ptr == nullptr.
+  void release(OopStorage* storage, oop* ptr);
+
+  // Returns all cached entries to storage.
+  void flush(OopStorage* storage);
+};
+
+#endif // SHARE_GC_SHARED_OOPSTORAGEALLOCATIONCACHE_HPP
@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "gc/shared/oopStorage.hpp"
 #include "gc/shared/oopStorageSet.hpp"
+#include "logging/log.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/globalDefinitions.hpp"
 #include "utilities/macros.hpp"
@@ -90,3 +91,17 @@ void OopStorageSet::verify_initialized(uint index) {
 }
 
 #endif // ASSERT
+
+void OopStorageSet::log_statistics() {
+  if (!log_is_enabled(Info, oopstorage)) {
+    return;
+  }
+  for (OopStorage* storage : Range<Id>()) {
+    size_t locks = storage->allocation_lock_count();
+    size_t contended = storage->allocation_lock_contended_count();
+    log_info(oopstorage)("%s: " SIZE_FORMAT " entries in " SIZE_FORMAT " blocks, "
+                         SIZE_FORMAT " allocation locks, " SIZE_FORMAT " contended (%.1f%%)",
+                         storage->name(), storage->allocation_count(), storage->block_count(),
+                         locks, contended, percent_of(contended, locks));
+  }
+}
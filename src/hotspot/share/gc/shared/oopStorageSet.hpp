@@ -89,6 +89,10 @@ public:
   template <typename Closure>
   static void strong_oops_do(Closure* cl);
 
+  // Logs usage and allocation lock contention of all storages to
+  // oopstorage=info.
+  static void log_statistics();
+
 };
 
 ENUMERATOR_VALUE_RANGE(OopStorageSet::StrongId,
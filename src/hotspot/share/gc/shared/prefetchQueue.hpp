@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_PREFETCHQUEUE_HPP
+#define SHARE_GC_SHARED_PREFETCHQUEUE_HPP
+
+#include "memory/allocation.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "utilities/powerOfTwo.hpp"
+
+// A small FIFO of elements whose memory has been prefetched.
+//
+// Graph traversals that examine an object as soon as a reference to it is
+// found stall on a cache miss for almost every object. Passing the references
+// through a PrefetchQueue instead issues the prefetch when the reference is
+// found, and hands the element back only after Capacity other elements have
+// been added, by which time the memory is hopefully in the cache.
+template <typename E, uint Capacity>
+class PrefetchQueue {
+  STATIC_ASSERT(is_power_of_2(Capacity));
+  static const uint Mask = Capacity - 1;
+
+  E _elems[Capacity];
+  uint _head;
+  uint _count;
+
+public:
+  PrefetchQueue() : _head(0), _count(0) {}
+
+  bool is_empty() const { return _count == 0; }
+
+  // Prefetch addr and append elem. If the queue is full, the oldest element
+  // is removed and returned in evicted, and true is returned.
+  inline bool push(E elem, const void* addr, E& evicted);
+
+  // Remove the oldest element, if any.
+  inline bool pop(E& elem);
+};
+
+#endif // SHARE_GC_SHARED_PREFETCHQUEUE_HPP
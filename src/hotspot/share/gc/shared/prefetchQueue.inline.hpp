@@ -0,0 +1,57 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHARED_PREFETCHQUEUE_INLINE_HPP
+#define SHARE_GC_SHARED_PREFETCHQUEUE_INLINE_HPP
+
+#include "gc/shared/prefetchQueue.hpp"
+
+#include "runtime/prefetch.inline.hpp"
+
+template <typename E, uint Capacity>
+inline bool PrefetchQueue<E, Capacity>::push(E elem, const void* addr, E& evicted) {
+  Prefetch::read(addr, 0);
+  if (_count < Capacity) {
+    _elems[(_head + _count) & Mask] = elem;
+    _count++;
+    return false;
+  }
+  evicted = _elems[_head];
+  _elems[_head] = elem;
+  _head = (_head + 1) & Mask;
+  return true;
+}
+
+template <typename E, uint Capacity>
+inline bool PrefetchQueue<E, Capacity>::pop(E& elem) {
+  if (_count == 0) {
+    return false;
+  }
+  elem = _elems[_head];
+  _head = (_head + 1) & Mask;
+  _count--;
+  return true;
+}
+
+#endif // SHARE_GC_SHARED_PREFETCHQUEUE_INLINE_HPP
@@ -258,7 +258,8 @@ private:
   // Drop Soft/Weak/Final references with a null or live referent, and clear
   // and enqueue non-Final references.
   void process_soft_weak_final_refs(RefProcProxyTask& proxy_task,
-                                    ReferenceProcessorPhaseTimes& phase_times);
+                                    ReferenceProcessorPhaseTimes& phase_times,
+                                    bool include_phantom_refs);
 
   // Keep alive followers of Final references, and enqueue.
   void process_final_keep_alive(RefProcProxyTask& proxy_task,
@@ -266,7 +267,8 @@ private:
 
   // Drop and keep alive live Phantom references, or clear and enqueue if dead.
   void process_phantom_refs(RefProcProxyTask& proxy_task,
-                            ReferenceProcessorPhaseTimes& phase_times);
+                            ReferenceProcessorPhaseTimes& phase_times,
+                            bool already_processed);
 
   // Work methods used by the process_* methods. All methods return the number of
   // removed elements.
@@ -158,6 +158,7 @@ ReferenceProcessorPhaseTimes::ReferenceProcessorPhaseTimes(GCTimer* gc_timer, ui
   assert(gc_timer != nullptr, "pre-condition");
   for (uint i = 0; i < ReferenceProcessor::RefSubPhaseMax; i++) {
     _sub_phases_worker_time_sec[i] = new WorkerDataArray<double>(nullptr, SubPhasesParWorkTitle[i], max_gc_threads);
+    _sub_phases_worker_time_sec[i]->create_thread_work_items("References:");
   }
   _soft_weak_final_refs_phase_worker_time_sec = new WorkerDataArray<double>(nullptr, SoftWeakFinalRefsPhaseParWorkTitle, max_gc_threads);
 
@@ -173,6 +174,13 @@ WorkerDataArray<double>* ReferenceProcessorPhaseTimes::sub_phase_worker_time_sec
   return _sub_phases_worker_time_sec[sub_phase];
 }
 
+void ReferenceProcessorPhaseTimes::add_worker_refs(ReferenceProcessor::RefProcSubPhases sub_phase,
+                                                   uint worker_id,
+                                                   size_t count) {
+  ASSERT_SUB_PHASE(sub_phase);
+  _sub_phases_worker_time_sec[sub_phase]->set_or_add_thread_work_item(worker_id, count);
+}
+
 double ReferenceProcessorPhaseTimes::phase_time_ms(ReferenceProcessor::RefProcPhases phase) const {
   ASSERT_PHASE(phase);
   return _phases_time_ms[phase];
@@ -336,7 +344,14 @@ void ReferenceProcessorPhaseTimes::print_balance_time(LogStream* ls, ReferencePr
 }
 
 void ReferenceProcessorPhaseTimes::print_sub_phase(LogStream* ls, ReferenceProcessor::RefProcSubPhases sub_phase, uint indent) const {
-  print_worker_time(ls, _sub_phases_worker_time_sec[sub_phase], SubPhasesSerWorkTitle[sub_phase], indent);
+  WorkerDataArray<double>* worker_time = _sub_phases_worker_time_sec[sub_phase];
+  print_worker_time(ls, worker_time, SubPhasesSerWorkTitle[sub_phase], indent);
+  // Show how evenly the references have been distributed across workers.
+  if (_processing_is_mt) {
+    WorkerDataArray<size_t>* refs = worker_time->thread_work_items();
+    ls->print("%s", Indents[indent + 1]);
+    refs->print_summary_on(ls, true);
+  }
 }
 
 void ReferenceProcessorPhaseTimes::print_worker_time(LogStream* ls, WorkerDataArray<double>* worker_time, const char* ser_title, uint indent) const {
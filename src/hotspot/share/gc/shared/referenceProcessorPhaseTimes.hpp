@@ -83,6 +83,9 @@ public:
 
   void set_total_time_ms(double total_time_ms) { _total_time_ms = total_time_ms; }
 
+  // Records the number of references the worker processed in the sub phase.
+  void add_worker_refs(ReferenceProcessor::RefProcSubPhases sub_phase, uint worker_id, size_t count);
+
   void add_ref_dropped(ReferenceType ref_type, size_t count);
   void set_ref_discovered(ReferenceType ref_type, size_t count);
   size_t ref_discovered(ReferenceType ref_type);
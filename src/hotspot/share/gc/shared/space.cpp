@@ -269,12 +269,11 @@ HeapWord* ContiguousSpace::forward(oop q, size_t size,
 
   // store the forwarding pointer into the mark word
   if (cast_from_oop<HeapWord*>(q) != compact_top) {
-    q->forward_to(cast_to_oop(compact_top));
-    assert(q->is_gc_marked(), "encoding the pointer should preserve the mark");
+    MarkSweep::forward_to(q, cast_to_oop(compact_top));
+    assert(q->is_forwarded(), "must be forwarded");
   } else {
-    // if the object isn't moving we can just set the mark to the default
-    // mark and handle it specially later on.
-    q->init_mark();
+    // if the object isn't moving its mark is left alone, and it is handled
+    // specially later on.
     assert(!q->is_forwarded(), "should not be forwarded");
   }
 
@@ -318,7 +317,7 @@ void ContiguousSpace::prepare_for_compaction(CompactPoint* cp) {
   HeapWord* scan_limit = top();
 
   while (cur_obj < scan_limit) {
-    if (cast_to_oop(cur_obj)->is_gc_marked()) {
+    if (MarkSweep::is_marked(cur_obj)) {
       // prefetch beyond cur_obj
       Prefetch::write(cur_obj, interval);
       size_t size = cast_to_oop(cur_obj)->size();
@@ -332,7 +331,7 @@ void ContiguousSpace::prepare_for_compaction(CompactPoint* cp) {
         // prefetch beyond end
         Prefetch::write(end, interval);
         end += cast_to_oop(end)->size();
-      } while (end < scan_limit && !cast_to_oop(end)->is_gc_marked());
+      } while (end < scan_limit && !MarkSweep::is_marked(end));
 
       // see if we might want to pretend this object is alive so that
       // we don't have to compact quite as often.
@@ -389,7 +388,7 @@ void ContiguousSpace::adjust_pointers() {
   debug_only(HeapWord* prev_obj = nullptr);
   while (cur_obj < end_of_live) {
     Prefetch::write(cur_obj, interval);
-    if (cur_obj < first_dead || cast_to_oop(cur_obj)->is_gc_marked()) {
+    if (cur_obj < first_dead || MarkSweep::is_marked(cur_obj)) {
       // cur_obj is alive
       // point all the oops to the new location
       size_t size = MarkSweep::adjust_pointers(cast_to_oop(cur_obj));
@@ -416,7 +415,7 @@ void ContiguousSpace::compact() {
   HeapWord* const end_of_live = _end_of_live;
 
   assert(_first_dead <= end_of_live, "Invariant. _first_dead: " PTR_FORMAT " <= end_of_live: " PTR_FORMAT, p2i(_first_dead), p2i(end_of_live));
-  if (_first_dead == end_of_live && (start == end_of_live || !cast_to_oop(start)->is_gc_marked())) {
+  if (_first_dead == end_of_live && (start == end_of_live || !cast_to_oop(start)->is_forwarded())) {
     // Nothing to compact. The space is either empty or all live object should be left in place.
     clear_empty_region(this);
     return;
@@ -427,7 +426,7 @@ void ContiguousSpace::compact() {
 
   assert(start < end_of_live, "bottom: " PTR_FORMAT " should be < end_of_live: " PTR_FORMAT, p2i(start), p2i(end_of_live));
   HeapWord* cur_obj = start;
-  if (_first_dead > cur_obj && !cast_to_oop(cur_obj)->is_gc_marked()) {
+  if (_first_dead > cur_obj && !cast_to_oop(cur_obj)->is_forwarded()) {
     // All object before _first_dead can be skipped. They should not be moved.
     // A pointer to the first live object is stored at the memory location for _first_dead.
     cur_obj = *(HeapWord**)(_first_dead);
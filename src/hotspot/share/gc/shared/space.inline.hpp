@@ -112,7 +112,7 @@ public:
       _allowed_deadspace_words -= dead_length;
       CollectedHeap::fill_with_object(dead_start, dead_length);
       oop obj = cast_to_oop(dead_start);
-      obj->set_mark(obj->mark().set_marked());
+      MarkSweep::mark_dead_space(obj);
 
       assert(dead_length == obj->size(), "bad filler object size");
       log_develop_trace(gc, compaction)("Inserting object to dead space: " PTR_FORMAT ", " PTR_FORMAT ", " SIZE_FORMAT "b",
@@ -130,15 +130,14 @@ public:
 inline void ContiguousSpace::verify_up_to_first_dead(ContiguousSpace* space) {
   HeapWord* cur_obj = space->bottom();
 
-  if (cur_obj < space->_end_of_live && space->_first_dead > cur_obj && !cast_to_oop(cur_obj)->is_gc_marked()) {
-     // we have a chunk of the space which hasn't moved and we've reinitialized
-     // the mark word during the previous pass, so we can't use is_gc_marked for
-     // the traversal.
+  if (cur_obj < space->_end_of_live && space->_first_dead > cur_obj && !cast_to_oop(cur_obj)->is_forwarded()) {
+     // we have a chunk of the space which hasn't moved, so none of the objects
+     // in it have been forwarded.
      HeapWord* prev_obj = nullptr;
 
      while (cur_obj < space->_first_dead) {
        size_t size = cast_to_oop(cur_obj)->size();
-       assert(!cast_to_oop(cur_obj)->is_gc_marked(), "should be unmarked (special dense prefix handling)");
+       assert(!cast_to_oop(cur_obj)->is_forwarded(), "should not be forwarded (special dense prefix handling)");
        prev_obj = cur_obj;
        cur_obj += size;
      }
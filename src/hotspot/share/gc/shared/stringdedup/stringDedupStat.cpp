@@ -33,6 +33,7 @@ StringDedup::Stat::Stat() :
   _known_shared(0),
   _new(0),
   _new_bytes(0),
+  _hashed_bytes(0),
   _deduped(0),
   _deduped_bytes(0),
   _replaced(0),
@@ -60,6 +61,7 @@ void StringDedup::Stat::add(const Stat* const stat) {
   _known_shared        += stat->_known_shared;
   _new                 += stat->_new;
   _new_bytes           += stat->_new_bytes;
+  _hashed_bytes        += stat->_hashed_bytes;
   _deduped             += stat->_deduped;
   _deduped_bytes       += stat->_deduped_bytes;
   _replaced            += stat->_replaced;
@@ -229,4 +231,12 @@ void StringDedup::Stat::log_statistics(bool total) const {
                          _deduped, deduped_percent, STRDEDUP_BYTES_PARAM(_deduped_bytes), deduped_bytes_percent);
   log_debug(stringdedup)("    Skipped: %zu (dead), %zu (incomplete), %zu (shared)",
                          _skipped_dead, _skipped_incomplete, _skipped_shared);
+  // Hashing is part of processing, so the rate is an upper bound on the
+  // time spent hashing.
+  double process_secs = _process_elapsed.seconds();
+  double hashed_bytes_per_sec = (process_secs > 0.0) ? (_hashed_bytes / process_secs) : 0.0;
+  log_debug(stringdedup)("    Hashed:       " STRDEDUP_BYTES_FORMAT " (" STRDEDUP_BYTES_FORMAT_NS "/s)",
+                         STRDEDUP_BYTES_PARAM(_hashed_bytes),
+                         byte_size_in_proper_unit(hashed_bytes_per_sec),
+                         proper_unit_for_byte_size((size_t)hashed_bytes_per_sec));
 }
@@ -41,6 +41,7 @@ private:
   size_t _known_shared;
   size_t _new;
   size_t _new_bytes;
+  size_t _hashed_bytes;
   size_t _deduped;
   size_t _deduped_bytes;
   size_t _replaced;
@@ -112,6 +113,11 @@ public:
     _new_bytes += bytes;
   }
 
+  // Track number of bytes of string values fed to the hash function.
+  void inc_hashed(size_t bytes) {
+    _hashed_bytes += bytes;
+  }
+
   // Track number of inspected strings dedup'ed and accumulated savings.
   void inc_deduped(size_t bytes) {
     _deduped++;
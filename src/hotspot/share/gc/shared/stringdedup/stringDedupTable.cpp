@@ -616,6 +616,7 @@ void StringDedup::Table::deduplicate(oop java_string) {
   }
   typeArrayOop value = java_lang_String::value(java_string);
   uint hash_code = compute_hash(value);
+  _cur_stat.inc_hashed(value->length());
   TableValue tv = find(value, hash_code);
   if (tv.is_empty()) {
     // Not in table.  Create a new table entry.
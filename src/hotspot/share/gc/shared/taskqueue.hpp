@@ -61,6 +61,8 @@ public:
     steal_success,    // number of successful steals
     steal_max_contended_in_a_row, // maximum number of contended steals in a row
     steal_bias_drop,  // number of times the bias has been dropped
+    steal_batch,      // number of tasks stolen in addition to the first one of a steal
+    steal_local,      // number of successful steals from a victim on the same node
     overflow,         // number of overflow pushes
     overflow_max_len, // max length of overflow stack
     last_stat_id
@@ -82,6 +84,8 @@ public:
     }
   }
   inline void record_bias_drop() { ++_stats[steal_bias_drop]; }
+  inline void record_steal_batch() { ++_stats[steal_batch]; }
+  inline void record_steal_local() { ++_stats[steal_local]; }
   inline void record_overflow(size_t new_length);
 
   TaskQueueStats & operator +=(const TaskQueueStats & addend);
@@ -404,10 +408,18 @@ private:
 
   int _seed; // Current random seed used for selecting a random queue during stealing.
 
-  DEFINE_PAD_MINUS_SIZE(2, DEFAULT_CACHE_LINE_SIZE, sizeof(uint) + sizeof(int));
+  // The NUMA node the owner last stole on. Read by other threads as a hint for
+  // selecting victims, so updates are not synchronized.
+  int _locality_id;
+
+  DEFINE_PAD_MINUS_SIZE(2, DEFAULT_CACHE_LINE_SIZE, sizeof(uint) + 2 * sizeof(int));
 public:
   int next_random_queue_id();
 
+  static const int InvalidLocalityId = -1;
+  void set_locality_id(int id)               { _locality_id = id; }
+  int locality_id() const                    { return _locality_id; }
+
   void set_last_stolen_queue_id(uint id)     { _last_stolen_queue_id = id; }
   uint last_stolen_queue_id() const          { return _last_stolen_queue_id; }
   bool is_last_stolen_queue_id_valid() const { return _last_stolen_queue_id != InvalidQueueId; }
@@ -485,6 +497,14 @@ private:
   // as for the last pop_global() operation.
   PopResult steal_best_of_2(uint queue_num, E& t);
 
+  // Returns a random queue on the same node as queue_num, or k if none has been
+  // found after a few attempts.
+  uint select_local_victim(uint queue_num, uint k);
+
+  // After a successful steal from queue victim_num, moves up to half of the
+  // remaining tasks of the victim into the queue of the thief.
+  void steal_batch(uint queue_num, uint victim_num);
+
 public:
   GenericTaskQueueSet(uint n);
   ~GenericTaskQueueSet();
@@ -27,13 +27,16 @@
 
 #include "gc/shared/taskqueue.hpp"
 
+#include "gc/shared/gc_globals.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/allocation.inline.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/oop.inline.hpp"
 #include "runtime/atomic.hpp"
+#include "runtime/globals.hpp"
 #include "runtime/orderAccess.hpp"
+#include "runtime/os.hpp"
 #include "utilities/debug.hpp"
 #include "utilities/ostream.hpp"
 #include "utilities/stack.inline.hpp"
@@ -101,7 +104,8 @@ template<class E, MEMFLAGS F, unsigned int N>
 inline GenericTaskQueue<E, F, N>::GenericTaskQueue() :
   _elems(ArrayAllocator<E>::allocate(N, F)),
   _last_stolen_queue_id(InvalidQueueId),
-  _seed(17 /* random number */) {}
+  _seed(17 /* random number */),
+  _locality_id(InvalidLocalityId) {}
 
 template<class E, MEMFLAGS F, unsigned int N>
 inline GenericTaskQueue<E, F, N>::~GenericTaskQueue() {
@@ -329,6 +333,9 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
       while (k1 == queue_num) {
         k1 = local_queue->next_random_queue_id() % _n;
       }
+      if (GCStealPreferLocalNode && UseNUMA) {
+        k1 = select_local_victim(queue_num, k1);
+      }
     }
 
     uint k2 = queue_num;
@@ -354,6 +361,12 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
 
     if (suc == PopResult::Success) {
       local_queue->set_last_stolen_queue_id(sel_k);
+      TASKQUEUE_STATS_ONLY(
+        if (local_queue->locality_id() != T::InvalidLocalityId &&
+            local_queue->locality_id() == queue(sel_k)->locality_id()) {
+          local_queue->stats.record_steal_local();
+        }
+      )
     } else {
       local_queue->invalidate_last_stolen_queue_id();
     }
@@ -372,14 +385,64 @@ typename GenericTaskQueueSet<T, F>::PopResult GenericTaskQueueSet<T, F>::steal_b
   }
 }
 
+template<class T, MEMFLAGS F>
+uint GenericTaskQueueSet<T, F>::select_local_victim(uint queue_num, uint k) {
+  const uint NumSamples = 4;
+
+  T* const local_queue = queue(queue_num);
+  const int locality_id = local_queue->locality_id();
+  if (locality_id == T::InvalidLocalityId) {
+    return k;
+  }
+  for (uint i = 0; i < NumSamples; i++) {
+    if (queue(k)->locality_id() == locality_id) {
+      return k;
+    }
+    uint next = local_queue->next_random_queue_id() % _n;
+    if (next != queue_num) {
+      k = next;
+    }
+  }
+  return k;
+}
+
+template<class T, MEMFLAGS F>
+void GenericTaskQueueSet<T, F>::steal_batch(uint queue_num, uint victim_num) {
+  T* const local_queue = queue(queue_num);
+  T* const victim = queue(victim_num);
+
+  // Tasks are moved one at a time: the queue protocol only allows a thief to
+  // take a single element per successful update of the victim's age.
+  uint const batch = MIN2(victim->size() / 2, GCStealBatchLimit);
+  for (uint i = 0; i < batch && local_queue->size() < local_queue->max_elems(); i++) {
+    E t;
+    PopResult res = victim->pop_global(t);
+    TASKQUEUE_STATS_ONLY(local_queue->record_steal_attempt(res);)
+    if (res != PopResult::Success) {
+      return;
+    }
+    bool pushed = local_queue->push(t);
+    assert(pushed, "queue of the thief must have room");
+    TASKQUEUE_STATS_ONLY(local_queue->stats.record_steal_batch();)
+  }
+}
+
 template<class T, MEMFLAGS F>
 bool GenericTaskQueueSet<T, F>::steal(uint queue_num, E& t) {
   uint const num_retries = 2 * _n;
 
+  if (GCStealPreferLocalNode && UseNUMA) {
+    queue(queue_num)->set_locality_id(os::numa_get_group_id());
+  }
+
   TASKQUEUE_STATS_ONLY(uint contended_in_a_row = 0;)
   for (uint i = 0; i < num_retries; i++) {
     PopResult sr = steal_best_of_2(queue_num, t);
     if (sr == PopResult::Success) {
+      if (GCStealBatchLimit > 0 && _n > 1) {
+        uint victim_num = (_n == 2) ? (queue_num + 1) % 2 : queue(queue_num)->last_stolen_queue_id();
+        steal_batch(queue_num, victim_num);
+      }
       return true;
     } else if (sr == PopResult::Contended) {
       TASKQUEUE_STATS_ONLY(
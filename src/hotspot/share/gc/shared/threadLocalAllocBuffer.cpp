@@ -58,7 +58,8 @@ ThreadLocalAllocBuffer::ThreadLocalAllocBuffer() :
   _allocated_size(0),
   _allocation_fraction(TLABAllocationWeight) {
 
-  // do nothing. TLABs must be inited by initialize() calls
+  clear_slow_allocation_histogram();
+  // TLABs must be inited by initialize() calls
 }
 
 size_t ThreadLocalAllocBuffer::initial_refill_waste_limit()     { return desired_size() / TLABRefillWasteFraction; }
@@ -159,14 +160,26 @@ void ThreadLocalAllocBuffer::resize() {
                           (Universe::heap()->tlab_capacity(thread()) / HeapWordSize));
   size_t new_size = alloc / _target_refills;
 
+  size_t slow_size = 0;
+  if (TLABSizeFromSlowAllocations) {
+    // An allocation that does not fit into the tlab refills it instead of
+    // going to the shared space if the remaining free space is within the
+    // refill waste limit. Size the tlab so that this limit covers most of
+    // the allocation sizes this thread recently did outside of the tlab.
+    slow_size = slow_allocation_size_percentile(90);
+    size_t max_slow_size = max_size() / TLABRefillWasteFraction;
+    new_size = MAX2(new_size, MIN2(slow_size, max_slow_size) * TLABRefillWasteFraction);
+    clear_slow_allocation_histogram();
+  }
+
   new_size = clamp(new_size, min_size(), max_size());
 
   size_t aligned_new_size = align_object_size(new_size);
 
   log_trace(gc, tlab)("TLAB new size: thread: " PTR_FORMAT " [id: %2d]"
-                      " refills %d  alloc: %8.6f desired_size: " SIZE_FORMAT " -> " SIZE_FORMAT,
+                      " refills %d  alloc: %8.6f slow: " SIZE_FORMAT " desired_size: " SIZE_FORMAT " -> " SIZE_FORMAT,
                       p2i(thread()), thread()->osthread()->thread_id(),
-                      _target_refills, _allocation_fraction.average(), desired_size(), aligned_new_size);
+                      _target_refills, _allocation_fraction.average(), slow_size, desired_size(), aligned_new_size);
 
   set_desired_size(aligned_new_size);
   set_refill_waste_limit(initial_refill_waste_limit());
@@ -180,6 +193,37 @@ void ThreadLocalAllocBuffer::reset_statistics() {
   _allocated_size    = 0;
 }
 
+void ThreadLocalAllocBuffer::clear_slow_allocation_histogram() {
+  for (uint i = 0; i < SlowAllocationHistogramBuckets; i++) {
+    _slow_allocation_histogram[i] = 0;
+  }
+}
+
+size_t ThreadLocalAllocBuffer::slow_allocation_size_percentile(uint percent) const {
+  // Ignore a few occasional slow allocations; they are not worth growing
+  // the tlab for.
+  const size_t min_samples = 8;
+
+  size_t total = 0;
+  for (uint i = 0; i < SlowAllocationHistogramBuckets; i++) {
+    total += _slow_allocation_histogram[i];
+  }
+  if (total < min_samples) {
+    return 0;
+  }
+
+  size_t const target = (total * percent + 99) / 100;
+  size_t count = 0;
+  for (uint i = 0; i < SlowAllocationHistogramBuckets; i++) {
+    count += _slow_allocation_histogram[i];
+    if (count >= target) {
+      return (size_t)2 << i;
+    }
+  }
+  ShouldNotReachHere();
+  return 0;
+}
+
 void ThreadLocalAllocBuffer::fill(HeapWord* start,
                                   HeapWord* top,
                                   size_t    new_size) {
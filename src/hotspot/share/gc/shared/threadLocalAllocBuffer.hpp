@@ -70,8 +70,18 @@ private:
 
   AdaptiveWeightedAverage _allocation_fraction;  // fraction of eden allocated in tlabs
 
+  // Histogram of the sizes of allocations done outside of the tlab since the
+  // last resize, with power of two buckets (in words).
+  static const uint SlowAllocationHistogramBuckets = 16;
+  unsigned  _slow_allocation_histogram[SlowAllocationHistogramBuckets];
+
   void reset_statistics();
 
+  void clear_slow_allocation_histogram();
+  // Upper bound of the allocation size (in words) that covers the given
+  // percentage of recorded slow allocations, or 0 if there were too few.
+  size_t slow_allocation_size_percentile(uint percent) const;
+
   void set_start(HeapWord* start)                { _start = start; }
   void set_end(HeapWord* end)                    { _end = end; }
   void set_allocation_end(HeapWord* ptr)         { _allocation_end = ptr; }
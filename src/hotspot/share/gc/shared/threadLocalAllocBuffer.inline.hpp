@@ -34,6 +34,7 @@
 #include "runtime/javaThread.hpp"
 #include "runtime/osThread.hpp"
 #include "utilities/copy.hpp"
+#include "utilities/powerOfTwo.hpp"
 
 inline HeapWord* ThreadLocalAllocBuffer::allocate(size_t size) {
   invariants();
@@ -85,6 +86,11 @@ void ThreadLocalAllocBuffer::record_slow_allocation(size_t obj_size) {
 
   _slow_allocations++;
 
+  if (TLABSizeFromSlowAllocations) {
+    uint bucket = MIN2((uint)log2i(obj_size), SlowAllocationHistogramBuckets - 1);
+    _slow_allocation_histogram[bucket]++;
+  }
+
   log_develop_trace(gc, tlab)("TLAB: %s thread: " PTR_FORMAT " [id: %2d]"
                               " obj: " SIZE_FORMAT
                               " free: " SIZE_FORMAT
@@ -88,6 +88,11 @@
           range(0, max_jint)                                                \
           constraint(TLABWasteIncrementConstraintFunc,AfterMemoryInit)      \
                                                                             \
+  product(bool, TLABSizeFromSlowAllocations, false, EXPERIMENTAL,           \
+          "When resizing TLABs, make each thread's TLAB large enough that " \
+          "most of the allocations it recently did outside of the TLAB "    \
+          "would refill the TLAB instead")                                  \
+                                                                            \
 
 // end of TLAB_FLAGS
 
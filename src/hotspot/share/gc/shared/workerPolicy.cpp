@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -87,7 +87,8 @@ uint WorkerPolicy::parallel_worker_threads() {
 //  Else
 //    Calculate the number of GC threads based on the number of Java threads.
 //    Calculate the number of GC threads based on the size of the heap.
-//    Use the larger.
+//    Use the larger, but no more than the number of currently available
+//    processors.
 uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
                                                const uintx min_workers,
                                                uintx active_workers,
@@ -102,6 +103,7 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
   uintx prev_active_workers = active_workers;
   uintx active_workers_by_JT = 0;
   uintx active_workers_by_heap_size = 0;
+  uintx active_workers_by_cpus = 0;
 
   // Always use at least min_workers but use up to
   // GCThreadsPerJavaThreads * application threads.
@@ -119,7 +121,13 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
   uintx max_active_workers =
     MAX2(active_workers_by_JT, active_workers_by_heap_size);
 
-  new_active_workers = MIN2(max_active_workers, (uintx) total_workers);
+  // The number of available processors may have decreased since startup,
+  // e.g. by lowering the CPU quota of the container. Do not use more
+  // workers than there are processors to run them.
+  active_workers_by_cpus =
+    MAX2((uintx) os::active_processor_count(), min_workers);
+
+  new_active_workers = MIN3(max_active_workers, active_workers_by_cpus, (uintx) total_workers);
 
   // Increase GC workers instantly but decrease them more
   // slowly.
@@ -136,9 +144,10 @@ uint WorkerPolicy::calc_default_active_workers(uintx total_workers,
   log_trace(gc, task)("WorkerPolicy::calc_default_active_workers() : "
     "active_workers(): " UINTX_FORMAT "  new_active_workers: " UINTX_FORMAT "  "
     "prev_active_workers: " UINTX_FORMAT "\n"
-    " active_workers_by_JT: " UINTX_FORMAT "  active_workers_by_heap_size: " UINTX_FORMAT,
+    " active_workers_by_JT: " UINTX_FORMAT "  active_workers_by_heap_size: " UINTX_FORMAT
+    "  active_workers_by_cpus: " UINTX_FORMAT,
     active_workers, new_active_workers, prev_active_workers,
-    active_workers_by_JT, active_workers_by_heap_size);
+    active_workers_by_JT, active_workers_by_heap_size, active_workers_by_cpus);
   assert(new_active_workers > 0, "Always need at least 1");
   return new_active_workers;
 }
@@ -74,7 +74,9 @@ void ShenandoahPeriodicTask::task() {
 
 void ShenandoahPeriodicPacerNotify::task() {
   assert(ShenandoahPacing, "Should not be here otherwise");
-  ShenandoahHeap::heap()->pacer()->notify_waiters();
+  ShenandoahPacer* pacer = ShenandoahHeap::heap()->pacer();
+  pacer->update_tax_rate();
+  pacer->notify_waiters();
 }
 
 void ShenandoahControlThread::run_service() {
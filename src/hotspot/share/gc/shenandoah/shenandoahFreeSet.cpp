@@ -28,22 +28,31 @@
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahHeapRegionSet.hpp"
 #include "gc/shenandoah/shenandoahMarkingContext.inline.hpp"
+#include "gc/shenandoah/shenandoahNUMA.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/orderAccess.hpp"
+#include "utilities/spinYield.hpp"
 
 ShenandoahFreeSet::ShenandoahFreeSet(ShenandoahHeap* heap, size_t max_regions) :
   _heap(heap),
   _mutator_free_bitmap(max_regions, mtGC),
   _collector_free_bitmap(max_regions, mtGC),
-  _max(max_regions)
+  _max(max_regions),
+  _alloc_regions(NEW_C_HEAP_ARRAY(AllocRegion, ShenandoahNUMA::count(), mtGC))
 {
+  for (uint i = 0; i < ShenandoahNUMA::count(); i++) {
+    _alloc_regions[i]._region = nullptr;
+    _alloc_regions[i]._users = 0;
+  }
   clear_internal();
 }
 
 void ShenandoahFreeSet::increase_used(size_t num_bytes) {
   shenandoah_assert_heaplocked();
-  _used += num_bytes;
+  // Lock-free TLAB allocations update used concurrently
+  Atomic::add(&_used, num_bytes, memory_order_relaxed);
 
   assert(_used <= _capacity, "must not use more than we have: used: " SIZE_FORMAT
          ", capacity: " SIZE_FORMAT ", num_bytes: " SIZE_FORMAT, _used, _capacity, num_bytes);
@@ -61,6 +70,52 @@ bool ShenandoahFreeSet::is_collector_free(size_t idx) const {
   return _collector_free_bitmap.at(idx);
 }
 
+HeapWord* ShenandoahFreeSet::allocate_mutator_in(size_t beg, size_t end, ShenandoahAllocRequest& req, bool& in_new_region) {
+  // Walk the mutator view of [beg; end) from left to right
+  for (size_t idx = MAX2(beg, _mutator_leftmost); idx < MIN2(end, _mutator_rightmost + 1); idx++) {
+    if (is_mutator_free(idx)) {
+      HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
+      if (result != nullptr) {
+        return result;
+      }
+    }
+  }
+  return nullptr;
+}
+
+HeapWord* ShenandoahFreeSet::allocate_collector_in(size_t beg, size_t end, ShenandoahAllocRequest& req, bool& in_new_region) {
+  // Walk the collector view of [beg; end) from right to left.
+  // size_t is unsigned, need to dodge underflow when _leftmost = 0
+  for (size_t c = MIN2(end, _collector_rightmost + 1); c > MAX2(beg, _collector_leftmost); c--) {
+    size_t idx = c - 1;
+    if (is_collector_free(idx)) {
+      HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
+      if (result != nullptr) {
+        return result;
+      }
+    }
+  }
+  return nullptr;
+}
+
+HeapWord* ShenandoahFreeSet::steal_mutator_in(size_t beg, size_t end, ShenandoahAllocRequest& req, bool& in_new_region) {
+  // Walk the mutator view of [beg; end) from right to left, stealing empty regions
+  for (size_t c = MIN2(end, _mutator_rightmost + 1); c > MAX2(beg, _mutator_leftmost); c--) {
+    size_t idx = c - 1;
+    if (is_mutator_free(idx)) {
+      ShenandoahHeapRegion* r = _heap->get_region(idx);
+      if (can_allocate_from(r)) {
+        flip_to_gc(r);
+        HeapWord *result = try_allocate_in(r, req, in_new_region);
+        if (result != nullptr) {
+          return result;
+        }
+      }
+    }
+  }
+  return nullptr;
+}
+
 HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool& in_new_region) {
   // Scan the bitmap looking for a first fit.
   //
@@ -73,19 +128,30 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
   //
   // Free set maintains mutator and collector views, and normally they allocate in their views only,
   // unless we special cases for stealing and mixed allocations.
+  //
+  // With NUMA allocation, the regions of every node are walked the same way, and requests try the
+  // regions of the node of the requesting thread before the regions of the entire heap.
+
+  const bool numa = ShenandoahNUMA::is_enabled();
+  const uint node = numa ? ShenandoahNUMA::current_index() : 0;
+  const size_t node_beg = numa ? ShenandoahNUMA::region_begin(node) : 0;
+  const size_t node_end = numa ? ShenandoahNUMA::region_end(node) : _max;
 
   switch (req.type()) {
     case ShenandoahAllocRequest::_alloc_tlab:
     case ShenandoahAllocRequest::_alloc_shared: {
 
       // Try to allocate in the mutator view
-      for (size_t idx = _mutator_leftmost; idx <= _mutator_rightmost; idx++) {
-        if (is_mutator_free(idx)) {
-          HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
-          if (result != nullptr) {
-            return result;
-          }
+      HeapWord* result = allocate_mutator_in(node_beg, node_end, req, in_new_region);
+      if (result == nullptr && numa) {
+        result = allocate_mutator_in(0, _max, req, in_new_region);
+      }
+      if (result != nullptr) {
+        if (ShenandoahLockFreeTLABRefill && req.type() == ShenandoahAllocRequest::_alloc_tlab) {
+          // Following TLAB refills allocate in this region without the lock
+          set_alloc_region(_heap->heap_region_containing(result));
         }
+        return result;
       }
 
       // There is no recovery. Mutator does not touch collector view at all.
@@ -93,17 +159,13 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
     }
     case ShenandoahAllocRequest::_alloc_gclab:
     case ShenandoahAllocRequest::_alloc_shared_gc: {
-      // size_t is unsigned, need to dodge underflow when _leftmost = 0
-
       // Fast-path: try to allocate in the collector view first
-      for (size_t c = _collector_rightmost + 1; c > _collector_leftmost; c--) {
-        size_t idx = c - 1;
-        if (is_collector_free(idx)) {
-          HeapWord* result = try_allocate_in(_heap->get_region(idx), req, in_new_region);
-          if (result != nullptr) {
-            return result;
-          }
-        }
+      HeapWord* result = allocate_collector_in(node_beg, node_end, req, in_new_region);
+      if (result == nullptr && numa) {
+        result = allocate_collector_in(0, _max, req, in_new_region);
+      }
+      if (result != nullptr) {
+        return result;
       }
 
       // No dice. Can we borrow space from mutator view?
@@ -112,18 +174,12 @@ HeapWord* ShenandoahFreeSet::allocate_single(ShenandoahAllocRequest& req, bool&
       }
 
       // Try to steal the empty region from the mutator view
-      for (size_t c = _mutator_rightmost + 1; c > _mutator_leftmost; c--) {
-        size_t idx = c - 1;
-        if (is_mutator_free(idx)) {
-          ShenandoahHeapRegion* r = _heap->get_region(idx);
-          if (can_allocate_from(r)) {
-            flip_to_gc(r);
-            HeapWord *result = try_allocate_in(r, req, in_new_region);
-            if (result != nullptr) {
-              return result;
-            }
-          }
-        }
+      result = steal_mutator_in(node_beg, node_end, req, in_new_region);
+      if (result == nullptr && numa) {
+        result = steal_mutator_in(0, _max, req, in_new_region);
+      }
+      if (result != nullptr) {
+        return result;
       }
 
       // No dice. Do not try to mix mutator and GC allocations, because
@@ -210,6 +266,83 @@ HeapWord* ShenandoahFreeSet::try_allocate_in(ShenandoahHeapRegion* r, Shenandoah
   return result;
 }
 
+HeapWord* ShenandoahFreeSet::par_allocate_tlab(ShenandoahAllocRequest& req) {
+  assert(req.type() == ShenandoahAllocRequest::_alloc_tlab, "Only for TLABs");
+  AllocRegion* const ar = &_alloc_regions[ShenandoahNUMA::current_index()];
+
+  // Register as user before looking at the region, to prevent it from
+  // being retired while we allocate in it
+  Atomic::inc(&ar->_users);
+
+  HeapWord* result = nullptr;
+  ShenandoahHeapRegion* const r = Atomic::load_acquire(&ar->_region);
+  if (r != nullptr) {
+    size_t actual = 0;
+    result = r->par_allocate_tlab(req.size(), req.min_size(), &actual);
+    if (result != nullptr) {
+      req.set_actual_size(actual);
+      Atomic::add(&_used, actual * HeapWordSize, memory_order_relaxed);
+    }
+  }
+
+  Atomic::dec(&ar->_users);
+  return result;
+}
+
+void ShenandoahFreeSet::set_alloc_region(ShenandoahHeapRegion* r) {
+  shenandoah_assert_heaplocked();
+
+  const size_t idx = r->index();
+  if (!is_mutator_free(idx)) {
+    // Region was retired by the allocation
+    return;
+  }
+
+  AllocRegion* const ar = &_alloc_regions[ShenandoahNUMA::current_index()];
+  retire_alloc_region(ar);
+
+  // Take the region out of the mutator view
+  _mutator_free_bitmap.clear_bit(idx);
+  if (touches_bounds(idx)) {
+    adjust_bounds();
+  }
+  assert_bounds();
+
+  Atomic::release_store(&ar->_region, r);
+}
+
+void ShenandoahFreeSet::retire_alloc_region(AllocRegion* ar) {
+  shenandoah_assert_heaplocked();
+
+  ShenandoahHeapRegion* const r = ar->_region;
+  if (r == nullptr) {
+    return;
+  }
+
+  // Unpublish the region, and wait for lock-free allocations in it to finish.
+  // They never block, so this wait is short.
+  Atomic::release_store_fence(&ar->_region, (ShenandoahHeapRegion*)nullptr);
+  SpinYield spin;
+  while (Atomic::load_acquire(&ar->_users) != 0) {
+    spin.wait();
+  }
+
+  // Return the remainder of the region to the mutator view, from where
+  // it is retired the usual way once it can not satisfy allocations.
+  // A remainder too small for a TLAB is recorded as allocation waste, like
+  // try_allocate_in() does when it retires a region.
+  const size_t remainder = r->free();
+  if (remainder >= MinTLABSize) {
+    const size_t idx = r->index();
+    _mutator_free_bitmap.set_bit(idx);
+    _mutator_leftmost = MIN2(_mutator_leftmost, idx);
+    _mutator_rightmost = MAX2(_mutator_rightmost, idx);
+  } else if (remainder > 0) {
+    increase_used(remainder);
+    _heap->notify_mutator_alloc_words(remainder >> LogHeapWordSize, true);
+  }
+}
+
 bool ShenandoahFreeSet::touches_bounds(size_t num) const {
   return num == _collector_leftmost || num == _collector_rightmost || num == _mutator_leftmost || num == _mutator_rightmost;
 }
@@ -392,6 +525,12 @@ void ShenandoahFreeSet::clear() {
 }
 
 void ShenandoahFreeSet::clear_internal() {
+  // Lock-free allocations are only done by Java threads, and never
+  // during a safepoint
+  for (uint i = 0; i < ShenandoahNUMA::count(); i++) {
+    assert(Atomic::load(&_alloc_regions[i]._users) == 0, "No lock-free allocations expected");
+    _alloc_regions[i]._region = nullptr;
+  }
   _mutator_free_bitmap.clear();
   _collector_free_bitmap.clear();
   _mutator_leftmost = _max;
@@ -424,9 +563,30 @@ void ShenandoahFreeSet::rebuild() {
 
   // Evac reserve: reserve trailing space for evacuations
   size_t to_reserve = _heap->max_capacity() / 100 * ShenandoahEvacReserve;
+
+  if (ShenandoahNUMA::is_enabled()) {
+    // Reserve trailing space of every node, for GC workers to evacuate locally
+    const size_t to_reserve_per_node = to_reserve / ShenandoahNUMA::count();
+    size_t reserved = 0;
+    for (uint i = 0; i < ShenandoahNUMA::count(); i++) {
+      reserved += reserve_for_collector(ShenandoahNUMA::region_begin(i), ShenandoahNUMA::region_end(i), to_reserve_per_node);
+    }
+    // Nodes short of free regions leave the remainder to be reserved anywhere
+    if (reserved < to_reserve) {
+      reserve_for_collector(0, _heap->num_regions(), to_reserve - reserved);
+    }
+  } else {
+    reserve_for_collector(0, _heap->num_regions(), to_reserve);
+  }
+
+  recompute_bounds();
+  assert_bounds();
+}
+
+size_t ShenandoahFreeSet::reserve_for_collector(size_t beg, size_t end, size_t to_reserve) {
   size_t reserved = 0;
 
-  for (size_t idx = _heap->num_regions() - 1; idx > 0; idx--) {
+  for (size_t idx = end; idx-- > beg; ) {
     if (reserved >= to_reserve) break;
 
     ShenandoahHeapRegion* region = _heap->get_region(idx);
@@ -439,8 +599,7 @@ void ShenandoahFreeSet::rebuild() {
     }
   }
 
-  recompute_bounds();
-  assert_bounds();
+  return reserved;
 }
 
 void ShenandoahFreeSet::log_status() {
@@ -562,6 +721,13 @@ HeapWord* ShenandoahFreeSet::allocate(ShenandoahAllocRequest& req, bool& in_new_
 size_t ShenandoahFreeSet::unsafe_peek_free() const {
   // Deliberately not locked, this method is unsafe when free set is modified.
 
+  for (uint i = 0; i < ShenandoahNUMA::count(); i++) {
+    ShenandoahHeapRegion* const r = Atomic::load(&_alloc_regions[i]._region);
+    if (r != nullptr && r->free() >= MinTLABSize) {
+      return r->free();
+    }
+  }
+
   for (size_t index = _mutator_leftmost; index <= _mutator_rightmost; index++) {
     if (index < _max && is_mutator_free(index)) {
       ShenandoahHeapRegion* r = _heap->get_region(index);
@@ -27,6 +27,7 @@
 
 #include "gc/shenandoah/shenandoahHeapRegionSet.hpp"
 #include "gc/shenandoah/shenandoahHeap.hpp"
+#include "gc/shenandoah/shenandoahPadding.hpp"
 
 class ShenandoahFreeSet : public CHeapObj<mtGC> {
 private:
@@ -43,17 +44,36 @@ private:
   size_t _capacity;
   size_t _used;
 
+  // Mutator allocation regions, one per NUMA node, which TLABs are refilled from
+  // without taking the heap lock. Allocation regions are not part of the mutator
+  // view. The users count makes retiring a region wait for the lock-free
+  // allocations that might still be using it.
+  struct AllocRegion {
+    ShenandoahHeapRegion* volatile _region;
+    volatile uint                  _users;
+    shenandoah_padding_minus_size(0, sizeof(ShenandoahHeapRegion*) + sizeof(uint));
+  };
+  AllocRegion* _alloc_regions;
+
+  void set_alloc_region(ShenandoahHeapRegion* r);
+  void retire_alloc_region(AllocRegion* ar);
+
   void assert_bounds() const NOT_DEBUG_RETURN;
 
   bool is_mutator_free(size_t idx) const;
   bool is_collector_free(size_t idx) const;
 
   HeapWord* try_allocate_in(ShenandoahHeapRegion* region, ShenandoahAllocRequest& req, bool& in_new_region);
+  HeapWord* allocate_mutator_in(size_t beg, size_t end, ShenandoahAllocRequest& req, bool& in_new_region);
+  HeapWord* allocate_collector_in(size_t beg, size_t end, ShenandoahAllocRequest& req, bool& in_new_region);
+  HeapWord* steal_mutator_in(size_t beg, size_t end, ShenandoahAllocRequest& req, bool& in_new_region);
   HeapWord* allocate_single(ShenandoahAllocRequest& req, bool& in_new_region);
   HeapWord* allocate_contiguous(ShenandoahAllocRequest& req);
 
   void flip_to_gc(ShenandoahHeapRegion* r);
 
+  size_t reserve_for_collector(size_t beg, size_t end, size_t to_reserve);
+
   void recompute_bounds();
   void adjust_bounds();
   bool touches_bounds(size_t num) const;
@@ -88,6 +108,9 @@ public:
   }
 
   HeapWord* allocate(ShenandoahAllocRequest& req, bool& in_new_region);
+
+  // Lock-free TLAB allocation in the allocation region of the current NUMA node
+  HeapWord* par_allocate_tlab(ShenandoahAllocRequest& req);
   size_t unsafe_peek_free() const;
 
   double internal_fragmentation();
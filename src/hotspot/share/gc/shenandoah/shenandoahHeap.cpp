@@ -53,6 +53,7 @@
 #include "gc/shenandoah/shenandoahMemoryPool.hpp"
 #include "gc/shenandoah/shenandoahMetrics.hpp"
 #include "gc/shenandoah/shenandoahMonitoringSupport.hpp"
+#include "gc/shenandoah/shenandoahNUMA.hpp"
 #include "gc/shenandoah/shenandoahOopClosures.inline.hpp"
 #include "gc/shenandoah/shenandoahPacer.inline.hpp"
 #include "gc/shenandoah/shenandoahPadding.hpp"
@@ -317,6 +318,8 @@ jint ShenandoahHeap::initialize() {
     }
   }
 
+  ShenandoahNUMA::initialize(_num_regions);
+
   _regions = NEW_C_HEAP_ARRAY(ShenandoahHeapRegion*, _num_regions, mtGC);
   _free_set = new ShenandoahFreeSet(this, _num_regions);
 
@@ -331,6 +334,10 @@ jint ShenandoahHeap::initialize() {
       ShenandoahHeapRegion* r = new (loc) ShenandoahHeapRegion(start, i, is_committed);
       assert(is_aligned(r, SHENANDOAH_CACHE_LINE_SIZE), "Sanity");
 
+      if (is_committed && !_heap_region_special) {
+        ShenandoahNUMA::make_local(r);
+      }
+
       _marking_context->initialize_top_at_mark_start(r);
       _regions[i] = r;
       assert(!collection_set()->is_in(i), "New region should not be in collection set");
@@ -829,7 +836,13 @@ HeapWord* ShenandoahHeap::allocate_memory(ShenandoahAllocRequest& req) {
     }
 
     if (!ShenandoahAllocFailureALot || !should_inject_alloc_failure()) {
-      result = allocate_memory_under_lock(req, in_new_region);
+      if (ShenandoahLockFreeTLABRefill && req.type() == ShenandoahAllocRequest::_alloc_tlab) {
+        // Try to refill without taking the lock first
+        result = _free_set->par_allocate_tlab(req);
+      }
+      if (result == nullptr) {
+        result = allocate_memory_under_lock(req, in_new_region);
+      }
     }
 
     // Allocation failed, block until control thread reacted, then retry allocation.
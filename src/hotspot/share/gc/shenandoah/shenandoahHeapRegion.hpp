@@ -337,6 +337,9 @@ public:
   // Allocation (return null if full)
   inline HeapWord* allocate(size_t word_size, ShenandoahAllocRequest::Type type);
 
+  // Lock-free TLAB allocation, only used for the allocation regions of the free set
+  inline HeapWord* par_allocate_tlab(size_t word_size, size_t min_word_size, size_t* actual_word_size);
+
   inline void clear_live_data();
   void set_live_data(size_t s);
 
@@ -52,6 +52,31 @@ HeapWord* ShenandoahHeapRegion::allocate(size_t size, ShenandoahAllocRequest::Ty
   }
 }
 
+HeapWord* ShenandoahHeapRegion::par_allocate_tlab(size_t size, size_t min_size, size_t* actual_size) {
+  assert(is_regular() || is_pinned(), "Allocation region should be regular: " SIZE_FORMAT, index());
+
+  HeapWord* obj = Atomic::load(&_top);
+  for (;;) {
+    const size_t free = align_down(pointer_delta(end(), obj), MinObjAlignment);
+    const size_t actual = MIN2(size, free);
+    if (actual < min_size) {
+      return nullptr;
+    }
+
+    HeapWord* const new_top = obj + actual;
+    HeapWord* const prev_top = Atomic::cmpxchg(&_top, obj, new_top, memory_order_relaxed);
+    if (prev_top == obj) {
+      // Success
+      Atomic::add(&_tlab_allocs, actual, memory_order_relaxed);
+      *actual_size = actual;
+      return obj;
+    }
+
+    // Retry
+    obj = prev_top;
+  }
+}
+
 inline void ShenandoahHeapRegion::adjust_alloc_metadata(ShenandoahAllocRequest::Type type, size_t size) {
   switch (type) {
     case ShenandoahAllocRequest::_alloc_shared:
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+
+#include "gc/shenandoah/shenandoahHeapRegion.hpp"
+#include "gc/shenandoah/shenandoahNUMA.hpp"
+#include "gc/shenandoah/shenandoah_globals.hpp"
+#include "logging/log.hpp"
+#include "memory/allocation.hpp"
+#include "runtime/globals.hpp"
+#include "runtime/os.hpp"
+#include "utilities/debug.hpp"
+
+uint   ShenandoahNUMA::_count            = 1;
+int*   ShenandoahNUMA::_node_ids         = nullptr;
+size_t ShenandoahNUMA::_num_regions      = 0;
+size_t ShenandoahNUMA::_regions_per_node = 0;
+
+void ShenandoahNUMA::initialize(size_t num_regions) {
+  _num_regions = num_regions;
+  _regions_per_node = num_regions;
+
+  if (!UseNUMA || !ShenandoahNUMAAllocation) {
+    return;
+  }
+
+  const size_t max_count = os::numa_get_groups_num();
+  _node_ids = NEW_C_HEAP_ARRAY(int, max_count, mtGC);
+  const uint count = (uint)os::numa_get_leaf_groups(_node_ids, max_count);
+
+  if (count <= 1 || num_regions < count) {
+    // Nothing to partition
+    FREE_C_HEAP_ARRAY(int, _node_ids);
+    _node_ids = nullptr;
+    return;
+  }
+
+  _count = count;
+  _regions_per_node = num_regions / count;
+
+  log_info(gc, init)("NUMA Allocation: %u nodes, " SIZE_FORMAT " regions per node", _count, _regions_per_node);
+}
+
+uint ShenandoahNUMA::current_index() {
+  if (!is_enabled()) {
+    return 0;
+  }
+
+  const int id = os::numa_get_group_id();
+  for (uint i = 0; i < _count; i++) {
+    if (_node_ids[i] == id) {
+      return i;
+    }
+  }
+
+  // Unknown node, e.g. after a topology change
+  return 0;
+}
+
+uint ShenandoahNUMA::index_for_region(size_t region_idx) {
+  // Trailing regions that do not divide evenly belong to the last node
+  return MIN2((uint)(region_idx / _regions_per_node), _count - 1);
+}
+
+size_t ShenandoahNUMA::region_begin(uint index) {
+  assert(index < _count, "Invalid index");
+  return index * _regions_per_node;
+}
+
+size_t ShenandoahNUMA::region_end(uint index) {
+  assert(index < _count, "Invalid index");
+  if (index == _count - 1) {
+    return _num_regions;
+  }
+  return (index + 1) * _regions_per_node;
+}
+
+void ShenandoahNUMA::make_local(ShenandoahHeapRegion* r) {
+  if (is_enabled()) {
+    const int id = _node_ids[index_for_region(r->index())];
+    os::numa_make_local((char*)r->bottom(), ShenandoahHeapRegion::region_size_bytes(), id);
+  }
+}
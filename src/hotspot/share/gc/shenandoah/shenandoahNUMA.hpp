@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#ifndef SHARE_GC_SHENANDOAH_SHENANDOAHNUMA_HPP
+#define SHARE_GC_SHENANDOAH_SHENANDOAHNUMA_HPP
+
+#include "memory/allStatic.hpp"
+#include "utilities/globalDefinitions.hpp"
+
+class ShenandoahHeapRegion;
+
+// Partitions the heap regions between the NUMA nodes. Every node owns a
+// contiguous range of regions, whose memory is bound to the node when the
+// regions are committed. The free set lets mutators and GC workers allocate
+// from the regions of their own node first.
+class ShenandoahNUMA : public AllStatic {
+private:
+  static uint   _count;
+  static int*   _node_ids;
+  static size_t _num_regions;
+  static size_t _regions_per_node;
+
+public:
+  static void initialize(size_t num_regions);
+
+  static bool is_enabled() { return _count > 1; }
+  static uint count()      { return _count; }
+
+  // Node index of the calling thread
+  static uint current_index();
+
+  // Node index owning the given region
+  static uint index_for_region(size_t region_idx);
+
+  // [region_begin, region_end) is the range of regions owned by a node
+  static size_t region_begin(uint index);
+  static size_t region_end(uint index);
+
+  // Bind the memory of a committed region to the node owning it
+  static void make_local(ShenandoahHeapRegion* r);
+};
+
+#endif // SHARE_GC_SHENANDOAH_SHENANDOAHNUMA_HPP
@@ -28,6 +28,7 @@
 #include "gc/shenandoah/shenandoahHeap.inline.hpp"
 #include "gc/shenandoah/shenandoahPacer.hpp"
 #include "gc/shenandoah/shenandoahPhaseTimings.hpp"
+#include "jfr/jfrEvents.hpp"
 #include "runtime/atomic.hpp"
 #include "runtime/javaThread.inline.hpp"
 #include "runtime/mutexLocker.hpp"
@@ -55,6 +56,11 @@
  *
  * The allocatable space when GC is running is "free" at the start of phase, but the
  * accounted budget is based on "used". So, we need to adjust the tax knowing that.
+ *
+ * The tax rate computed at the start of the phase is only as good as the estimates it
+ * was based on. With ShenandoahPacingAdaptive, the rate is re-evaluated periodically
+ * as the ratio of the remaining work to the remaining taxable space, so that the pacer
+ * tightens when GC falls behind the allocations, and relaxes when GC is ahead of them.
  */
 
 void ShenandoahPacer::setup_for_mark() {
@@ -71,6 +77,7 @@ void ShenandoahPacer::setup_for_mark() {
   tax *= ShenandoahPacingSurcharge;  // additional surcharge to help unclutter heap
 
   restart_with(non_taxable, tax);
+  adapt_with(live, taxable, 1, 0);
 
   log_info(gc, ergo)("Pacer for Mark. Expected Live: " SIZE_FORMAT "%s, Free: " SIZE_FORMAT "%s, "
                      "Non-Taxable: " SIZE_FORMAT "%s, Alloc Tax Rate: %.1fx",
@@ -95,6 +102,7 @@ void ShenandoahPacer::setup_for_evac() {
   tax *= ShenandoahPacingSurcharge;  // additional surcharge to help unclutter heap
 
   restart_with(non_taxable, tax);
+  adapt_with(used, taxable, 2, ShenandoahPacingSurcharge);
 
   log_info(gc, ergo)("Pacer for Evacuation. Used CSet: " SIZE_FORMAT "%s, Free: " SIZE_FORMAT "%s, "
                      "Non-Taxable: " SIZE_FORMAT "%s, Alloc Tax Rate: %.1fx",
@@ -119,6 +127,7 @@ void ShenandoahPacer::setup_for_updaterefs() {
   tax *= ShenandoahPacingSurcharge;  // additional surcharge to help unclutter heap
 
   restart_with(non_taxable, tax);
+  adapt_with(used, taxable, 1, ShenandoahPacingSurcharge);
 
   log_info(gc, ergo)("Pacer for Update Refs. Used: " SIZE_FORMAT "%s, Free: " SIZE_FORMAT "%s, "
                      "Non-Taxable: " SIZE_FORMAT "%s, Alloc Tax Rate: %.1fx",
@@ -185,10 +194,70 @@ void ShenandoahPacer::restart_with(size_t non_taxable_bytes, double tax_rate) {
   Atomic::store(&_tax_rate, tax_rate);
   Atomic::inc(&_epoch);
 
+  // Phases that want adaptive pacing opt in with adapt_with() after this.
+  _phase_work = 0;
+  _phase_taxable = 0;
+  Atomic::store(&_phase_progress, (intptr_t)0);
+  Atomic::store(&_phase_allocs, (intptr_t)0);
+
   // Shake up stalled waiters after budget update.
   _need_notify_waiters.try_set();
 }
 
+void ShenandoahPacer::adapt_with(size_t work_bytes, size_t taxable_bytes, double phase_factor, double min_tax_rate) {
+  if (!ShenandoahPacingAdaptive) {
+    return;
+  }
+  _phase_work = work_bytes >> LogHeapWordSize;
+  _phase_taxable = taxable_bytes >> LogHeapWordSize;
+  _phase_factor = phase_factor;
+  _min_tax_rate = min_tax_rate;
+}
+
+void ShenandoahPacer::update_tax_rate() {
+  assert(ShenandoahPacing, "Only be here when pacing is enabled");
+
+  if (!ShenandoahPacingAdaptive || _phase_work == 0 || _phase_taxable == 0) {
+    // Phase does not have a useful notion of remaining work.
+    return;
+  }
+
+  size_t progress = (size_t)MAX2<intptr_t>(0, Atomic::load(&_phase_progress));
+  size_t allocs   = (size_t)MAX2<intptr_t>(0, Atomic::load(&_phase_allocs));
+
+  if (progress >= _phase_work) {
+    // Marking found more live objects than expected. Assume there is at least
+    // as much work left as the surplus discovered so far.
+    _phase_work = progress + progress / 10;
+  }
+
+  size_t remaining_work    = _phase_work - progress;
+  size_t remaining_taxable = (_phase_taxable > allocs) ? (_phase_taxable - allocs) : 0;
+
+  const double max_tax = 100;
+  double target;
+  if (remaining_taxable == 0) {
+    // Allocations ran out of taxable space, GC has to catch up.
+    target = max_tax;
+  } else {
+    target = 1.0 * remaining_work / remaining_taxable;
+    target *= _phase_factor;
+    target *= ShenandoahPacingSurcharge;
+  }
+  target = clamp(target, _min_tax_rate, max_tax);
+
+  // Smooth out the transients, since progress is reported in chunks.
+  double cur = Atomic::load(&_tax_rate);
+  double tax = (cur + target) / 2;
+  Atomic::store(&_tax_rate, tax);
+
+  log_trace(gc, ergo)("Pacer adapted. Remaining Work: " SIZE_FORMAT "%s, Remaining Taxable: " SIZE_FORMAT "%s, "
+                      "Alloc Tax Rate: %.2fx",
+                      byte_size_in_proper_unit(remaining_work * HeapWordSize),    proper_unit_for_byte_size(remaining_work * HeapWordSize),
+                      byte_size_in_proper_unit(remaining_taxable * HeapWordSize), proper_unit_for_byte_size(remaining_taxable * HeapWordSize),
+                      tax);
+}
+
 bool ShenandoahPacer::claim_for_alloc(size_t words, bool force) {
   assert(ShenandoahPacing, "Only be here when pacing is enabled");
 
@@ -204,6 +273,10 @@ bool ShenandoahPacer::claim_for_alloc(size_t words, bool force) {
     }
     new_val = cur - tax;
   } while (Atomic::cmpxchg(&_budget, cur, new_val, memory_order_relaxed) != cur);
+
+  if (ShenandoahPacingAdaptive) {
+    Atomic::add(&_phase_allocs, (intptr_t)words, memory_order_relaxed);
+  }
   return true;
 }
 
@@ -217,6 +290,10 @@ void ShenandoahPacer::unpace_for_alloc(intptr_t epoch, size_t words) {
 
   size_t tax = MAX2<size_t>(1, words * Atomic::load(&_tax_rate));
   add_budget(tax);
+
+  if (ShenandoahPacingAdaptive) {
+    Atomic::sub(&_phase_allocs, (intptr_t)words, memory_order_relaxed);
+  }
 }
 
 intptr_t ShenandoahPacer::epoch() {
@@ -252,6 +329,7 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
     return;
   }
 
+  EventShenandoahPacingStall event;
   double start = os::elapsedTime();
 
   size_t max_ms = ShenandoahPacingMaxDelay;
@@ -272,6 +350,7 @@ void ShenandoahPacer::pace_for_alloc(size_t words) {
       //     and start Degenerated GC cycle.
       //  b) The budget had been replenished, which means our claim is satisfied.
       ShenandoahThreadLocalData::add_paced_time(JavaThread::current(), end - start);
+      event.commit(words * HeapWordSize, Atomic::load(&_tax_rate));
       break;
     }
   }
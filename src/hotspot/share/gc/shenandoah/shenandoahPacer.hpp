@@ -39,6 +39,9 @@ class ShenandoahHeap;
  *
  * Currently it implements simple tax-and-spend pacing policy: GC threads provide
  * credit, allocating thread spend the credit, or stall when credit is not available.
+ *
+ * With ShenandoahPacingAdaptive, the tax rate estimated at the start of the phase is
+ * periodically corrected from the GC progress and the allocations observed so far.
  */
 class ShenandoahPacer : public CHeapObj<mtGC> {
 private:
@@ -62,6 +65,23 @@ private:
   volatile intptr_t _progress;
   shenandoah_padding(3);
 
+  // Adaptive pacing: expected work and taxable allocations for the phase, and
+  // the work done and allocations made so far, all in words.
+  size_t _phase_work;
+  size_t _phase_taxable;
+  double _phase_factor;
+  double _min_tax_rate;
+
+  // Heavily updated, protect from accidental false sharing
+  shenandoah_padding(4);
+  volatile intptr_t _phase_progress;
+  shenandoah_padding(5);
+
+  // Heavily updated, protect from accidental false sharing
+  shenandoah_padding(6);
+  volatile intptr_t _phase_allocs;
+  shenandoah_padding(7);
+
 public:
   ShenandoahPacer(ShenandoahHeap* heap) :
           _heap(heap),
@@ -71,7 +91,13 @@ public:
           _epoch(0),
           _tax_rate(1),
           _budget(0),
-          _progress(PACING_PROGRESS_UNINIT) {}
+          _progress(PACING_PROGRESS_UNINIT),
+          _phase_work(0),
+          _phase_taxable(0),
+          _phase_factor(1),
+          _min_tax_rate(1),
+          _phase_progress(0),
+          _phase_allocs(0) {}
 
   void setup_for_idle();
   void setup_for_mark();
@@ -91,6 +117,7 @@ public:
   void unpace_for_alloc(intptr_t epoch, size_t words);
 
   void notify_waiters();
+  void update_tax_rate();
 
   intptr_t epoch();
 
@@ -100,9 +127,11 @@ public:
 private:
   inline void report_internal(size_t words);
   inline void report_progress_internal(size_t words);
+  inline void report_phase_progress(size_t words);
 
   inline void add_budget(size_t words);
   void restart_with(size_t non_taxable_bytes, double tax_rate);
+  void adapt_with(size_t work_bytes, size_t taxable_bytes, double phase_factor, double min_tax_rate);
 
   size_t update_and_get_progress_history();
 
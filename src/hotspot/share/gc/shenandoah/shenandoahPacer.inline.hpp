@@ -32,14 +32,17 @@
 inline void ShenandoahPacer::report_mark(size_t words) {
   report_internal(words);
   report_progress_internal(words);
+  report_phase_progress(words);
 }
 
 inline void ShenandoahPacer::report_evac(size_t words) {
   report_internal(words);
+  report_phase_progress(words);
 }
 
 inline void ShenandoahPacer::report_updaterefs(size_t words) {
   report_internal(words);
+  report_phase_progress(words);
 }
 
 inline void ShenandoahPacer::report_alloc(size_t words) {
@@ -57,6 +60,12 @@ inline void ShenandoahPacer::report_progress_internal(size_t words) {
   Atomic::add(&_progress, (intptr_t)words, memory_order_relaxed);
 }
 
+inline void ShenandoahPacer::report_phase_progress(size_t words) {
+  if (ShenandoahPacingAdaptive) {
+    Atomic::add(&_phase_progress, (intptr_t)words, memory_order_relaxed);
+  }
+}
+
 inline void ShenandoahPacer::add_budget(size_t words) {
   STATIC_ASSERT(sizeof(size_t) <= sizeof(intptr_t));
   intptr_t inc = (intptr_t) words;
@@ -235,6 +235,16 @@
           "reserve/waste is incorrect, at the risk that application "       \
           "runs out of memory too early.")                                  \
                                                                             \
+  product(bool, ShenandoahNUMAAllocation, false, EXPERIMENTAL,              \
+          "Partition heap regions between NUMA nodes, and let mutators "    \
+          "and GC workers allocate in regions of their own node first. "    \
+          "Requires UseNUMA.")                                              \
+                                                                            \
+  product(bool, ShenandoahLockFreeTLABRefill, false, EXPERIMENTAL,          \
+          "Refill TLABs from a dedicated allocation region without taking " \
+          "the heap lock. The lock is only taken when a new allocation "    \
+          "region has to be claimed.")                                      \
+                                                                            \
   product(bool, ShenandoahPacing, true, EXPERIMENTAL,                       \
           "Pace application allocations to give GC chance to start "        \
           "and complete before allocation failure is reached.")             \
@@ -269,6 +279,11 @@
           "the beginning of it.")                                           \
           range(1.0, 100.0)                                                 \
                                                                             \
+  product(bool, ShenandoahPacingAdaptive, false, EXPERIMENTAL,              \
+          "Periodically re-evaluate the pacing tax rate during the GC "     \
+          "cycle from the observed GC progress and allocations, instead "   \
+          "of keeping the rate estimated at the start of each phase.")      \
+                                                                            \
   product(uintx, ShenandoahCriticalFreeThreshold, 1, EXPERIMENTAL,          \
           "How much of the heap needs to be free after recovery cycles, "   \
           "either Degenerated or Full GC to be claimed successful. If this "\
@@ -115,6 +115,11 @@ void ZArguments::select_max_gc_threads() {
   } else if (ZOldGCThreads == 0) {
     vm_exit_during_initialization("The flag -XX:ZOldGCThreads can't be lower than 1");
   }
+
+  if (ZConcGCCPUBudget > 0 && !UseDynamicNumberOfGCThreads) {
+    warning("The flag -XX:ZConcGCCPUBudget requires -XX:+UseDynamicNumberOfGCThreads, ignoring");
+    FLAG_SET_DEFAULT(ZConcGCCPUBudget, 0);
+  }
 }
 
 void ZArguments::initialize() {
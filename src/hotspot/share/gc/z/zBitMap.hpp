@@ -30,6 +30,8 @@ class ZMovableBitMap : public CHeapBitMap {
 public:
   ZMovableBitMap();
   ZMovableBitMap(ZMovableBitMap&& bitmap);
+
+  void prefetch_bit(idx_t bit);
 };
 
 class ZBitMap : public CHeapBitMap {
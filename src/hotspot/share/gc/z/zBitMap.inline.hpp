@@ -27,6 +27,7 @@
 #include "gc/z/zBitMap.hpp"
 
 #include "runtime/atomic.hpp"
+#include "runtime/prefetch.inline.hpp"
 #include "utilities/bitMap.inline.hpp"
 #include "utilities/debug.hpp"
 
@@ -39,6 +40,10 @@ inline ZMovableBitMap::ZMovableBitMap(ZMovableBitMap&& bitmap)
   bitmap.update(nullptr, 0);
 }
 
+inline void ZMovableBitMap::prefetch_bit(idx_t bit) {
+  Prefetch::write(word_addr(bit), 0);
+}
+
 inline ZBitMap::ZBitMap(idx_t size_in_bits)
   : CHeapBitMap(size_in_bits, mtGC, false /* clear */) {}
 
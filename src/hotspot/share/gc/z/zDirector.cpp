@@ -22,6 +22,7 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/shared/gcLogPrecious.hpp"
 #include "gc/shared/gc_globals.hpp"
 #include "gc/z/zCollectedHeap.hpp"
 #include "gc/z/zDirector.hpp"
@@ -32,6 +33,7 @@
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "logging/log.hpp"
+#include "runtime/os.hpp"
 
 ZDirector* ZDirector::_director;
 
@@ -70,11 +72,44 @@ struct ZDirectorStats {
   ZDirectorGenerationStats   _old_stats;
 };
 
+// CPU budget
+
+static bool has_cpu_budget() {
+  return ZConcGCCPUBudget > 0;
+}
+
+static double cpu_budget() {
+  // Number of processors concurrent GC may use on average
+  return os::active_processor_count() * (ZConcGCCPUBudget / 100.0);
+}
+
+static uint conc_workers_limit() {
+  if (!has_cpu_budget()) {
+    return ConcGCThreads;
+  }
+
+  return clamp<uint>(ceil(cpu_budget()), 1, ConcGCThreads);
+}
+
+static uint young_workers_limit() {
+  return MIN2(ZYoungGCThreads, conc_workers_limit());
+}
+
+static uint old_workers_limit() {
+  return MIN2(ZOldGCThreads, conc_workers_limit());
+}
+
 ZDirector::ZDirector()
   : _monitor(),
     _stopped(false) {
   _director = this;
   set_name("ZDirector");
+
+  if (has_cpu_budget()) {
+    log_info_p(gc, init)("Concurrent GC CPU Budget: %u%% (%.1f CPUs, %u GC Workers)",
+                         ZConcGCCPUBudget, cpu_budget(), conc_workers_limit());
+  }
+
   create_and_start();
 }
 
@@ -102,13 +137,13 @@ static double estimated_gc_workers(double serial_gc_time, double parallelizable_
 }
 
 static uint discrete_young_gc_workers(double gc_workers) {
-  return clamp<uint>(ceil(gc_workers), 1, ZYoungGCThreads);
+  return clamp<uint>(ceil(gc_workers), 1, young_workers_limit());
 }
 
 static double select_young_gc_workers(const ZDirectorStats& stats, double serial_gc_time, double parallelizable_gc_time, double alloc_rate_sd_percent, double time_until_oom) {
   // Use all workers until we're warm
   if (!stats._old_stats._cycle._is_warm) {
-    const double not_warm_gc_workers = ZYoungGCThreads;
+    const double not_warm_gc_workers = young_workers_limit();
     log_debug(gc, director)("Select Minor GC Workers (Not Warm), GCWorkers: %.3f", not_warm_gc_workers);
     return not_warm_gc_workers;
   }
@@ -444,6 +479,27 @@ static double gc_time(ZDirectorGenerationStats generation_stats) {
   return serial_gc_time + parallelizable_gc_time;
 }
 
+static bool is_major_within_cpu_budget(const ZDirectorStats& stats) {
+  if (!has_cpu_budget()) {
+    return true;
+  }
+
+  // Calculate the average number of processors used by concurrent GC, if
+  // a major collection is started now. The GC time of old collections is
+  // spread over the time since the last old collection, and the GC time of
+  // young collections over their average interval.
+  const double young_interval = MAX2(stats._young_stats._cycle._avg_cycle_interval, 0.001);
+  const double old_interval = MAX2(stats._old_stats._cycle._time_since_last, 0.001);
+  const double young_cpu_usage = gc_time(stats._young_stats) / young_interval;
+  const double old_cpu_usage = gc_time(stats._old_stats) / old_interval;
+  const double budget = cpu_budget();
+
+  log_debug(gc, director)("CPU Budget: %.1f, YoungCPUUsage: %.3f, OldCPUUsage: %.3f",
+                          budget, young_cpu_usage, old_cpu_usage);
+
+  return young_cpu_usage + old_cpu_usage <= budget;
+}
+
 static double calculate_extra_young_gc_time(const ZDirectorStats& stats) {
   if (!stats._old_stats._cycle._is_time_trustable) {
     return 0.0;
@@ -589,7 +645,7 @@ static bool rule_major_proactive(const ZDirectorStats& stats) {
   log_debug(gc, director)("Rule Major: Proactive, AcceptableGCInterval: %.3fs, TimeSinceLastGC: %.3fs, TimeUntilGC: %.3fs",
                           acceptable_gc_interval, time_since_last_gc, time_until_gc);
 
-  return time_until_gc <= 0;
+  return time_until_gc <= 0 && is_major_within_cpu_budget(stats);
 }
 
 static GCCause::Cause make_minor_gc_decision(const ZDirectorStats& stats) {
@@ -687,15 +743,19 @@ static ZWorkerCounts select_worker_threads(const ZDirectorStats& stats, uint you
     return {active_young_workers, active_old_workers};
   }
 
+  // Limit the GC threads of both generations together to ConcGCThreads, or
+  // rather to the number of threads within the CPU budget, if any.
+  const uint conc_workers = conc_workers_limit();
+
   const double young_to_old_ratio = calculate_young_to_old_worker_ratio(stats);
-  uint old_workers = clamp(uint(young_workers * young_to_old_ratio), 1u, ZOldGCThreads);
+  uint old_workers = clamp(uint(young_workers * young_to_old_ratio), 1u, old_workers_limit());
 
-  if (type != ZWorkerSelectionType::normal && old_workers + young_workers > ConcGCThreads) {
-    // We need to somehow clamp the GC threads so the two generations don't exceed ConcGCThreads
+  if (type != ZWorkerSelectionType::normal && old_workers + young_workers > conc_workers) {
+    // We need to somehow clamp the GC threads so the two generations don't exceed the limit
     const double old_ratio = (young_to_old_ratio / (1.0 + young_to_old_ratio));
     const double young_ratio = 1.0 - old_ratio;
-    const uint young_workers_clamped = clamp(uint(ConcGCThreads * young_ratio), 1u, ZYoungGCThreads);
-    const uint old_workers_clamped = clamp(ConcGCThreads - young_workers_clamped, 1u, ZOldGCThreads);
+    const uint young_workers_clamped = clamp(uint(conc_workers * young_ratio), 1u, young_workers_limit());
+    const uint old_workers_clamped = clamp(conc_workers - young_workers_clamped, 1u, old_workers_limit());
 
     if (type == ZWorkerSelectionType::start_major) {
       // Adjust down the old workers so the next minor during major will be less sad
@@ -704,7 +764,7 @@ static ZWorkerCounts select_worker_threads(const ZDirectorStats& stats, uint you
       // finishing, we don't want it to have fewer workers than the old generation.
       young_workers = MAX2(old_workers, young_workers);
     } else if (type == ZWorkerSelectionType::minor_during_old) {
-      // Adjust young and old workers for minor during old to fit within ConcGCThreads
+      // Adjust young and old workers for minor during old to fit within the limit
       young_workers = young_workers_clamped;
       old_workers = old_workers_clamped;
     }
@@ -748,7 +808,7 @@ static void adjust_gc(const ZDirectorStats& stats) {
     // We want to increase by more than the minimum amount to ensure that
     // there are enough margins, but also to avoid too frequent resizing.
     const uint desired_young_increase = needed_young_increase * 2;
-    desired_young_workers = MIN2(young_resize_stats._nworkers_current + desired_young_increase, ZYoungGCThreads);
+    desired_young_workers = MIN2(young_resize_stats._nworkers_current + desired_young_increase, young_workers_limit());
   }
 
   const uint young_current_workers = young_resize_stats._nworkers_current;
@@ -815,7 +875,8 @@ static bool start_gc(const ZDirectorStats& stats) {
 
   const GCCause::Cause minor_cause = make_minor_gc_decision(stats);
   if (minor_cause != GCCause::_no_gc) {
-    if (!ZDriver::major()->is_busy() && rule_major_allocation_rate(stats)) {
+    if (!ZDriver::major()->is_busy() && rule_major_allocation_rate(stats) &&
+        (is_major_within_cpu_budget(stats) || is_major_urgent(stats))) {
       // Merge minor GC into major GC
       start_major_gc(stats, GCCause::_z_allocation_rate);
     } else {
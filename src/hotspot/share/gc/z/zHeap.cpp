@@ -223,8 +223,8 @@ void ZHeap::out_of_memory() {
   log_info(gc)("Out Of Memory (%s)", Thread::current()->name());
 }
 
-ZPage* ZHeap::alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age) {
-  ZPage* const page = _page_allocator.alloc_page(type, size, flags, age);
+ZPage* ZHeap::alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age, uint32_t numa_id) {
+  ZPage* const page = _page_allocator.alloc_page(type, size, flags, age, numa_id);
   if (page != nullptr) {
     // Insert page table entry
     _page_table.insert(page);
@@ -25,6 +25,7 @@
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zHeuristics.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zObjectAllocator.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageTable.inline.hpp"
@@ -57,7 +58,7 @@ ZPage* const* ZObjectAllocator::shared_small_page_addr() const {
 }
 
 ZPage* ZObjectAllocator::alloc_page(ZPageType type, size_t size, ZAllocationFlags flags) {
-  ZPage* const page = ZHeap::heap()->alloc_page(type, size, flags, _age);
+  ZPage* const page = ZHeap::heap()->alloc_page(type, size, flags, _age, ZNUMA::id());
   if (page != nullptr) {
     // Increment used bytes
     Atomic::add(_used.addr(), size);
@@ -66,8 +67,8 @@ ZPage* ZObjectAllocator::alloc_page(ZPageType type, size_t size, ZAllocationFlag
   return page;
 }
 
-ZPage* ZObjectAllocator::alloc_page_for_relocation(ZPageType type, size_t size, ZAllocationFlags flags) {
-  return ZHeap::heap()->alloc_page(type, size, flags, _age);
+ZPage* ZObjectAllocator::alloc_page_for_relocation(ZPageType type, size_t size, ZAllocationFlags flags, uint32_t numa_id) {
+  return ZHeap::heap()->alloc_page(type, size, flags, _age, numa_id);
 }
 
 void ZObjectAllocator::undo_alloc_page(ZPage* page) {
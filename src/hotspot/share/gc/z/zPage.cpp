@@ -225,6 +225,15 @@ ZPage* ZPage::split_committed() {
   return split_with_pmem(type_from_size(pmem.size()), pmem);
 }
 
+bool ZPage::is_mergable(const ZPage* next) const {
+  // The next page must directly follow this page in the address space, and
+  // its physical memory must be located after the physical memory of this
+  // page. Physical memory segments are kept in address order, so the current
+  // mapping of both pages is then also the mapping of the merged page.
+  return end() == next->start() &&
+         _physical.segment(_physical.nsegments() - 1).end() <= next->_physical.segment(0).start();
+}
+
 class ZFindBaseOopClosure : public ObjectClosure {
 private:
   volatile zpointer* _p;
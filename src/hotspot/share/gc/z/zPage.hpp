@@ -139,6 +139,8 @@ public:
   ZPage* split(ZPageType type, size_t split_of_size);
   ZPage* split_committed();
 
+  bool is_mergable(const ZPage* next) const;
+
   bool is_in(zoffset offset) const;
   bool is_in(zaddress addr) const;
 
@@ -166,6 +168,7 @@ public:
   void object_iterate(Function function);
 
   void remember(volatile zpointer* p);
+  void prefetch_remembered(volatile zpointer* p);
 
   // In-place relocation support
   void clear_remset_bit_non_par_current(uintptr_t l_offset);
@@ -184,6 +187,10 @@ public:
   template <typename Function>
   void oops_do_remembered(Function function);
 
+  // Only visits remembered set entries in the given range of the page
+  template <typename Function>
+  void oops_do_remembered_limited(uintptr_t l_offset, size_t size, Function function);
+
   // Only visits remembered set entries for live objects
   template <typename Function>
   void oops_do_remembered_in_live(Function function);
@@ -199,6 +206,7 @@ public:
 
   void clear_remset_current();
   void clear_remset_previous();
+  void clear_remset_range_non_par_previous(uintptr_t l_offset, size_t size);
 
   void* remset_current();
 
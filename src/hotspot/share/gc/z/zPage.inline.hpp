@@ -361,10 +361,20 @@ inline void ZPage::remember(volatile zpointer* p) {
   _remembered_set.set_current(l_offset);
 }
 
+inline void ZPage::prefetch_remembered(volatile zpointer* p) {
+  const zaddress addr = to_zaddress((uintptr_t)p);
+  const uintptr_t l_offset = local_offset(addr);
+  _remembered_set.prefetch_current(l_offset);
+}
+
 inline void ZPage::clear_remset_bit_non_par_current(uintptr_t l_offset) {
   _remembered_set.unset_non_par_current(l_offset);
 }
 
+inline void ZPage::clear_remset_range_non_par_previous(uintptr_t l_offset, size_t size) {
+  _remembered_set.unset_range_non_par_previous(l_offset, size);
+}
+
 inline void ZPage::clear_remset_range_non_par_current(uintptr_t l_offset, size_t size) {
   _remembered_set.unset_range_non_par_current(l_offset, size);
 }
@@ -427,6 +437,17 @@ inline void ZPage::oops_do_remembered(Function function) {
   });
 }
 
+template <typename Function>
+inline void ZPage::oops_do_remembered_limited(uintptr_t l_offset, size_t size, Function function) {
+  BitMap::Iterator iter = remset_iterator_limited_previous(l_offset, size);
+  for (BitMap::idx_t index : iter) {
+    const zoffset offset = start() + ZRememberedSet::to_offset(index);
+    const zaddress addr = ZOffset::address(offset);
+
+    function((volatile zpointer*)addr);
+  }
+}
+
 template <typename Function>
 inline void ZPage::oops_do_remembered_in_live(Function function) {
   assert(!is_allocating(), "Must have liveness information");
@@ -31,6 +31,7 @@
 #include "gc/z/zGenerationId.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zLock.inline.hpp"
+#include "gc/z/zNUMA.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAge.hpp"
 #include "gc/z/zPageAllocator.inline.hpp"
@@ -51,6 +52,7 @@
 
 static const ZStatCounter       ZCounterMutatorAllocationRate("Memory", "Allocation Rate", ZStatUnitBytesPerSecond);
 static const ZStatCounter       ZCounterPageCacheFlush("Memory", "Page Cache Flush", ZStatUnitBytesPerSecond);
+static const ZStatCounter       ZCounterPageCacheMerge("Memory", "Page Cache Merge", ZStatUnitOpsPerSecond);
 static const ZStatCounter       ZCounterDefragment("Memory", "Defragment", ZStatUnitOpsPerSecond);
 static const ZStatCriticalPhase ZCriticalPhaseAllocationStall("Allocation Stall");
 
@@ -103,6 +105,7 @@ private:
   const ZPageType            _type;
   const size_t               _size;
   const ZAllocationFlags     _flags;
+  const uint32_t             _numa_id;
   const uint32_t             _young_seqnum;
   const uint32_t             _old_seqnum;
   size_t                     _flushed;
@@ -112,10 +115,11 @@ private:
   ZFuture<bool>              _stall_result;
 
 public:
-  ZPageAllocation(ZPageType type, size_t size, ZAllocationFlags flags)
+  ZPageAllocation(ZPageType type, size_t size, ZAllocationFlags flags, uint32_t numa_id)
     : _type(type),
       _size(size),
       _flags(flags),
+      _numa_id(numa_id),
       _young_seqnum(ZGeneration::young()->seqnum()),
       _old_seqnum(ZGeneration::old()->seqnum()),
       _flushed(0),
@@ -136,6 +140,10 @@ public:
     return _flags;
   }
 
+  uint32_t numa_id() const {
+    return _numa_id;
+  }
+
   uint32_t young_seqnum() const {
     return _young_seqnum;
   }
@@ -264,7 +272,7 @@ bool ZPageAllocator::prime_cache(ZWorkers* workers, size_t size) {
   flags.set_non_blocking();
   flags.set_low_address();
 
-  ZPage* const page = alloc_page(ZPageType::large, size, flags, ZPageAge::eden);
+  ZPage* const page = alloc_page(ZPageType::large, size, flags, ZPageAge::eden, ZNUMA::id());
   if (page == nullptr) {
     return false;
   }
@@ -467,14 +475,14 @@ bool ZPageAllocator::is_alloc_allowed(size_t size) const {
   return available >= size;
 }
 
-bool ZPageAllocator::alloc_page_common_inner(ZPageType type, size_t size, ZList<ZPage>* pages) {
+bool ZPageAllocator::alloc_page_common_inner(ZPageType type, size_t size, uint32_t numa_id, ZList<ZPage>* pages) {
   if (!is_alloc_allowed(size)) {
     // Out of memory
     return false;
   }
 
-  // Try allocate from the page cache
-  ZPage* const page = _cache.alloc_page(type, size);
+  // Try allocate from the page cache, preferring pages on the given NUMA node
+  ZPage* const page = _cache.alloc_page(type, size, numa_id);
   if (page != nullptr) {
     // Success
     pages->insert_last(page);
@@ -483,6 +491,11 @@ bool ZPageAllocator::alloc_page_common_inner(ZPageType type, size_t size, ZList<
 
   // Try increase capacity
   const size_t increased = increase_capacity(size);
+  if (increased == 0 && _cache.flush_for_merge(size, pages)) {
+    // Success, the flushed pages can be merged without remapping
+    return true;
+  }
+
   if (increased < size) {
     // Could not increase capacity enough to satisfy the allocation
     // completely. Flush the page cache to satisfy the remainder.
@@ -497,10 +510,10 @@ bool ZPageAllocator::alloc_page_common_inner(ZPageType type, size_t size, ZList<
 bool ZPageAllocator::alloc_page_common(ZPageAllocation* allocation) {
   const ZPageType type = allocation->type();
   const size_t size = allocation->size();
-  const ZAllocationFlags flags = allocation->flags();
+  const uint32_t numa_id = allocation->numa_id();
   ZList<ZPage>* const pages = allocation->pages();
 
-  if (!alloc_page_common_inner(type, size, pages)) {
+  if (!alloc_page_common_inner(type, size, numa_id, pages)) {
     // Out of memory
     return false;
   }
@@ -662,12 +675,67 @@ bool ZPageAllocator::is_alloc_satisfied(ZPageAllocation* allocation) const {
   return true;
 }
 
+bool ZPageAllocator::is_alloc_mergable(ZPageAllocation* allocation) const {
+  // The allocation can be satisfied by merging the pages in the list of
+  // pages, if they cover the complete allocation and are already mapped
+  // contiguously, in list order.
+  if (allocation->pages()->size() < 2) {
+    // Nothing to merge
+    return false;
+  }
+
+  size_t size = 0;
+  const ZPage* prev = nullptr;
+
+  ZListIterator<ZPage> iter(allocation->pages());
+  for (ZPage* page; iter.next(&page);) {
+    if (prev != nullptr && !prev->is_mergable(page)) {
+      // Not contiguous
+      return false;
+    }
+
+    size += page->size();
+    prev = page;
+  }
+
+  return size == allocation->size();
+}
+
+ZPage* ZPageAllocator::alloc_page_merge(ZPageAllocation* allocation) {
+  const ZPage* const first = allocation->pages()->first();
+  const ZVirtualMemory vmem(first->start(), allocation->size());
+  ZPhysicalMemory pmem;
+
+  // Harvest physical memory from the pages, keeping their mapping
+  ZListRemoveIterator<ZPage> iter(allocation->pages());
+  for (ZPage* page; iter.next(&page);) {
+    ZPhysicalMemory& fmem = page->physical_memory();
+    pmem.add_segments(fmem);
+    fmem.remove_segments();
+
+    // Destroy page, its virtual memory is part of the merged page
+    safe_destroy_page(page);
+  }
+
+  // Update statistics
+  ZStatInc(ZCounterPageCacheMerge);
+  log_debug(gc, heap)("Page Cache Merged: " SIZE_FORMAT "M", vmem.size() / M);
+
+  // Create new page
+  return new ZPage(allocation->type(), vmem, pmem);
+}
+
 ZPage* ZPageAllocator::alloc_page_finalize(ZPageAllocation* allocation) {
   // Fast path
   if (is_alloc_satisfied(allocation)) {
     return allocation->pages()->remove_first();
   }
 
+  // Merge already mapped pages
+  if (is_alloc_mergable(allocation)) {
+    return alloc_page_merge(allocation);
+  }
+
   // Slow path
   ZPage* const page = alloc_page_create(allocation);
   if (page == nullptr) {
@@ -696,11 +764,11 @@ ZPage* ZPageAllocator::alloc_page_finalize(ZPageAllocation* allocation) {
   return nullptr;
 }
 
-ZPage* ZPageAllocator::alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age) {
+ZPage* ZPageAllocator::alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age, uint32_t numa_id) {
   EventZPageAllocation event;
 
 retry:
-  ZPageAllocation allocation(type, size, flags);
+  ZPageAllocation allocation(type, size, flags, numa_id);
 
   // Allocate one or more pages from the page cache. If the allocation
   // succeeds but the returned pages don't cover the complete allocation,
@@ -858,7 +926,7 @@ void ZPageAllocator::free_pages_alloc_failed(ZPageAllocation* allocation) {
   satisfy_stalled();
 }
 
-size_t ZPageAllocator::uncommit(uint64_t* timeout) {
+size_t ZPageAllocator::uncommit(uint64_t delay, uint64_t* timeout) {
   // We need to join the suspendible thread set while manipulating capacity and
   // used, to make sure GC safepoints will have a consistent view.
   ZList<ZPage> pages;
@@ -877,7 +945,7 @@ size_t ZPageAllocator::uncommit(uint64_t* timeout) {
     const size_t flush = MIN2(release, limit);
 
     // Flush pages to uncommit
-    flushed = _cache.flush_for_uncommit(flush, &pages, timeout);
+    flushed = _cache.flush_for_uncommit(flush, &pages, delay, timeout);
     if (flushed == 0) {
       // Nothing flushed
       return 0;
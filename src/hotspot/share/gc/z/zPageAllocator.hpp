@@ -106,19 +106,21 @@ private:
 
   bool is_alloc_allowed(size_t size) const;
 
-  bool alloc_page_common_inner(ZPageType type, size_t size, ZList<ZPage>* pages);
+  bool alloc_page_common_inner(ZPageType type, size_t size, uint32_t numa_id, ZList<ZPage>* pages);
   bool alloc_page_common(ZPageAllocation* allocation);
   bool alloc_page_stall(ZPageAllocation* allocation);
   bool alloc_page_or_stall(ZPageAllocation* allocation);
   bool should_defragment(const ZPage* page) const;
   bool is_alloc_satisfied(ZPageAllocation* allocation) const;
+  bool is_alloc_mergable(ZPageAllocation* allocation) const;
+  ZPage* alloc_page_merge(ZPageAllocation* allocation);
   ZPage* alloc_page_create(ZPageAllocation* allocation);
   ZPage* alloc_page_finalize(ZPageAllocation* allocation);
   void free_pages_alloc_failed(ZPageAllocation* allocation);
 
   void satisfy_stalled();
 
-  size_t uncommit(uint64_t* timeout);
+  size_t uncommit(uint64_t delay, uint64_t* timeout);
 
   void notify_out_of_memory();
   void restart_gc() const;
@@ -148,7 +150,7 @@ public:
 
   void reset_statistics(ZGenerationId id);
 
-  ZPage* alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age);
+  ZPage* alloc_page(ZPageType type, size_t size, ZAllocationFlags flags, ZPageAge age, uint32_t numa_id);
   void recycle_page(ZPage* page);
   void safe_destroy_page(ZPage* page);
   void free_page(ZPage* page);
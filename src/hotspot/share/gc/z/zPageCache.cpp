@@ -22,6 +22,7 @@
  */
 
 #include "precompiled.hpp"
+#include "gc/z/zArray.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zList.inline.hpp"
 #include "gc/z/zNUMA.hpp"
@@ -60,8 +61,7 @@ ZPageCache::ZPageCache()
     _large(),
     _last_commit(0) {}
 
-ZPage* ZPageCache::alloc_small_page() {
-  const uint32_t numa_id = ZNUMA::id();
+ZPage* ZPageCache::alloc_small_page(uint32_t numa_id) {
   const uint32_t numa_count = ZNUMA::count();
 
   // Try NUMA local page cache
@@ -151,12 +151,12 @@ ZPage* ZPageCache::alloc_oversized_page(size_t size) {
   return page;
 }
 
-ZPage* ZPageCache::alloc_page(ZPageType type, size_t size) {
+ZPage* ZPageCache::alloc_page(ZPageType type, size_t size, uint32_t numa_id) {
   ZPage* page;
 
   // Try allocate exact page
   if (type == ZPageType::small) {
-    page = alloc_small_page();
+    page = alloc_small_page(numa_id);
   } else if (type == ZPageType::medium) {
     page = alloc_medium_page();
   } else {
@@ -198,6 +198,17 @@ void ZPageCache::free_page(ZPage* page) {
   }
 }
 
+void ZPageCache::remove_page(ZPage* page) {
+  const ZPageType type = page->type();
+  if (type == ZPageType::small) {
+    _small.get(page->numa_id()).remove(page);
+  } else if (type == ZPageType::medium) {
+    _medium.remove(page);
+  } else {
+    _large.remove(page);
+  }
+}
+
 bool ZPageCache::flush_list_inner(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to) {
   ZPage* const page = from->last();
   if (page == nullptr || !cl->do_page(page)) {
@@ -274,22 +285,99 @@ void ZPageCache::flush_for_allocation(size_t requested, ZList<ZPage>* to) {
   flush(&cl, to);
 }
 
+static int compare_page_start(ZPage** p1, ZPage** p2) {
+  const zoffset start1 = (*p1)->start();
+  const zoffset start2 = (*p2)->start();
+  return start1 < start2 ? -1 : (start1 == start2 ? 0 : 1);
+}
+
+bool ZPageCache::flush_for_merge(size_t requested, ZList<ZPage>* to) {
+  assert(to->is_empty(), "Should be empty");
+
+  // Collect all cached pages
+  ZArray<ZPage*> pages;
+  size_t cached = 0;
+
+  const auto collect = [&](ZList<ZPage>* list) {
+    ZListIterator<ZPage> iter(list);
+    for (ZPage* page; iter.next(&page);) {
+      pages.push(page);
+      cached += page->size();
+    }
+  };
+
+  for (uint32_t i = 0; i < ZNUMA::count(); i++) {
+    collect(_small.addr(i));
+  }
+  collect(&_medium);
+  collect(&_large);
+
+  if (cached < requested) {
+    // Not enough memory cached
+    return false;
+  }
+
+  // Find a run of cached pages, in address order, that can be
+  // merged into a page of the requested size without remapping.
+  pages.sort(compare_page_start);
+
+  int first = 0;
+  size_t run = 0;
+  for (int i = 0; i < pages.length(); i++) {
+    if (i > first && !pages.at(i - 1)->is_mergable(pages.at(i))) {
+      // Start new run
+      first = i;
+      run = 0;
+    }
+
+    run += pages.at(i)->size();
+    if (run < requested) {
+      continue;
+    }
+
+    // Drop pages from the start of the run that are not needed
+    while (run - pages.at(first)->size() >= requested) {
+      run -= pages.at(first)->size();
+      first++;
+    }
+
+    // Flush pages
+    for (int j = first; j <= i; j++) {
+      remove_page(pages.at(j));
+      to->insert_last(pages.at(j));
+    }
+
+    if (run > requested) {
+      // Re-insert the start of the first page into the cache
+      ZPage* const reinsert = to->first()->split(run - requested);
+      free_page(reinsert);
+    }
+
+    return true;
+  }
+
+  // No run found
+  return false;
+}
+
 class ZPageCacheFlushForUncommitClosure : public ZPageCacheFlushClosure {
 private:
   const uint64_t _now;
+  const uint64_t _delay;
   uint64_t*      _timeout;
 
 public:
-  ZPageCacheFlushForUncommitClosure(size_t requested, uint64_t now, uint64_t* timeout)
+  ZPageCacheFlushForUncommitClosure(size_t requested, uint64_t now, uint64_t delay, uint64_t* timeout)
     : ZPageCacheFlushClosure(requested),
       _now(now),
+      _delay(delay),
       _timeout(timeout) {
     // Set initial timeout
     *_timeout = ZUncommitDelay;
   }
 
   virtual bool do_page(const ZPage* page) {
-    const uint64_t expires = page->last_used() + ZUncommitDelay;
+    const uint64_t expires = page->last_used() + _delay;
     if (expires > _now) {
       // Don't flush page, record shortest non-expired timeout
       *_timeout = MIN2(*_timeout, expires - _now);
@@ -307,9 +395,9 @@ public:
   }
 };
 
-size_t ZPageCache::flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64_t* timeout) {
+size_t ZPageCache::flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64_t delay, uint64_t* timeout) {
   const uint64_t now = os::elapsedTime();
-  const uint64_t expires = _last_commit + ZUncommitDelay;
+  const uint64_t expires = _last_commit + delay;
   if (expires > now) {
     // Delay uncommit, set next timeout
     *timeout = expires - now;
@@ -322,7 +410,7 @@ size_t ZPageCache::flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64
     return 0;
   }
 
-  ZPageCacheFlushForUncommitClosure cl(requested, now, timeout);
+  ZPageCacheFlushForUncommitClosure cl(requested, now, delay, timeout);
   flush(&cl, to);
 
   return cl._flushed;
@@ -38,7 +38,7 @@ private:
   ZList<ZPage>            _large;
   uint64_t                _last_commit;
 
-  ZPage* alloc_small_page();
+  ZPage* alloc_small_page(uint32_t numa_id);
   ZPage* alloc_medium_page();
   ZPage* alloc_large_page(size_t size);
 
@@ -46,6 +46,8 @@ private:
   ZPage* alloc_oversized_large_page(size_t size);
   ZPage* alloc_oversized_page(size_t size);
 
+  void remove_page(ZPage* page);
+
   bool flush_list_inner(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
   void flush_list(ZPageCacheFlushClosure* cl, ZList<ZPage>* from, ZList<ZPage>* to);
   void flush_per_numa_lists(ZPageCacheFlushClosure* cl, ZPerNUMA<ZList<ZPage> >* from, ZList<ZPage>* to);
@@ -54,11 +56,12 @@ private:
 public:
   ZPageCache();
 
-  ZPage* alloc_page(ZPageType type, size_t size);
+  ZPage* alloc_page(ZPageType type, size_t size, uint32_t numa_id);
   void free_page(ZPage* page);
 
   void flush_for_allocation(size_t requested, ZList<ZPage>* to);
-  size_t flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64_t* timeout);
+  bool flush_for_merge(size_t requested, ZList<ZPage>* to);
+  size_t flush_for_uncommit(size_t requested, ZList<ZPage>* to, uint64_t delay, uint64_t* timeout);
 
   void set_last_commit();
 };
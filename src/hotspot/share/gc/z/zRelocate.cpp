@@ -34,6 +34,7 @@
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zIndexDistributor.inline.hpp"
 #include "gc/z/zIterator.inline.hpp"
+#include "gc/z/zNUMA.inline.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageAge.hpp"
 #include "gc/z/zRelocate.hpp"
@@ -50,6 +51,7 @@
 #include "utilities/debug.hpp"
 
 static const ZStatCriticalPhase ZCriticalPhaseRelocationStall("Relocation Stall");
+static const ZStatCounter ZCounterRelocationNUMARemote("Memory", "Relocation NUMA Remote", ZStatUnitBytesPerSecond);
 static const ZStatSubPhase ZSubPhaseConcurrentRelocateRememberedSetFlipPromotedYoung("Concurrent Relocate Remset FP", ZGenerationId::young);
 
 static uintptr_t forwarding_index(ZForwarding* forwarding, zoffset from_offset) {
@@ -373,6 +375,10 @@ static zaddress relocate_object_inner(ZForwarding* forwarding, zaddress from_add
   if (to_addr_final != to_addr) {
     // Already relocated, try undo allocation
     allocator->undo_alloc_object(to_addr, size);
+  } else if (ZNUMA::is_enabled() && ZHeap::heap()->page(to_addr)->numa_id() != forwarding->page()->numa_id()) {
+    // Relocated to a page on the NUMA node of this thread,
+    // which is not the NUMA node of the page being relocated.
+    ZStatInc(ZCounterRelocationNUMARemote, size);
   }
 
   return to_addr_final;
@@ -415,7 +421,7 @@ zaddress ZRelocate::forward_object(ZForwarding* forwarding, zaddress_unsafe from
   return to_addr;
 }
 
-static ZPage* alloc_page(ZAllocatorForRelocation* allocator, ZPageType type, size_t size) {
+static ZPage* alloc_page(ZAllocatorForRelocation* allocator, ZPageType type, size_t size, uint32_t numa_id) {
   if (ZStressRelocateInPlace) {
     // Simulate failure to allocate a new page. This will
     // cause the page being relocated to be relocated in-place.
@@ -426,7 +432,7 @@ static ZPage* alloc_page(ZAllocatorForRelocation* allocator, ZPageType type, siz
   flags.set_non_blocking();
   flags.set_gc_relocation();
 
-  return allocator->alloc_page_for_relocation(type, size, flags);
+  return allocator->alloc_page_for_relocation(type, size, flags, numa_id);
 }
 
 static void retire_target_page(ZGeneration* generation, ZPage* page) {
@@ -445,19 +451,32 @@ static void retire_target_page(ZGeneration* generation, ZPage* page) {
   }
 }
 
+// Small pages are relocated to target pages on the NUMA node of the page
+// being relocated, as far as the page cache can provide such pages. Each
+// worker therefore keeps one set of target pages per NUMA node.
 class ZRelocateSmallAllocator {
 private:
   ZGeneration* const _generation;
   volatile size_t    _in_place_count;
+  volatile size_t    _numa_remote;
 
 public:
   ZRelocateSmallAllocator(ZGeneration* generation)
     : _generation(generation),
-      _in_place_count(0) {}
+      _in_place_count(0),
+      _numa_remote(0) {}
+
+  uint numa_targets() const {
+    return ZNUMA::count();
+  }
+
+  uint numa_target(ZForwarding* forwarding) const {
+    return forwarding->page()->numa_id();
+  }
 
   ZPage* alloc_and_retire_target_page(ZForwarding* forwarding, ZPage* target) {
     ZAllocatorForRelocation* const allocator = ZAllocator::relocation(forwarding->to_age());
-    ZPage* const page = alloc_page(allocator, forwarding->type(), forwarding->size());
+    ZPage* const page = alloc_page(allocator, forwarding->type(), forwarding->size(), numa_target(forwarding));
     if (page == nullptr) {
       Atomic::inc(&_in_place_count);
     }
@@ -488,9 +507,17 @@ public:
     page->undo_alloc_object(addr, size);
   }
 
+  void increase_numa_remote(size_t size) {
+    Atomic::add(&_numa_remote, size);
+  }
+
   const size_t in_place_count() const {
     return _in_place_count;
   }
+
+  const size_t numa_remote() const {
+    return _numa_remote;
+  }
 };
 
 class ZRelocateMediumAllocator {
@@ -521,6 +548,16 @@ public:
     return _shared[static_cast<uint>(age) - 1];
   }
 
+  // Medium pages are shared between workers and are not cached per
+  // NUMA node, so there is a single set of target pages.
+  uint numa_targets() const {
+    return 1;
+  }
+
+  uint numa_target(ZForwarding* forwarding) const {
+    return 0;
+  }
+
   void set_shared(ZPageAge age, ZPage* page) {
     _shared[static_cast<uint>(age) - 1] = page;
   }
@@ -540,7 +577,7 @@ public:
     const ZPageAge to_age = forwarding->to_age();
     if (shared(to_age) == target) {
       ZAllocatorForRelocation* const allocator = ZAllocator::relocation(forwarding->to_age());
-      ZPage* const to_page = alloc_page(allocator, forwarding->type(), forwarding->size());
+      ZPage* const to_page = alloc_page(allocator, forwarding->type(), forwarding->size(), ZNUMA::id());
       set_shared(to_age, to_page);
       if (to_page == nullptr) {
         Atomic::inc(&_in_place_count);
@@ -582,6 +619,10 @@ public:
     page->undo_alloc_object_atomic(addr, size);
   }
 
+  void increase_numa_remote(size_t size) {
+    // Does nothing
+  }
+
   const size_t in_place_count() const {
     return _in_place_count;
   }
@@ -592,17 +633,24 @@ class ZRelocateWork : public StackObj {
 private:
   Allocator* const   _allocator;
   ZForwarding*       _forwarding;
-  ZPage*             _target[ZAllocator::_relocation_allocators];
+  const uint         _numa_targets;
+  uint               _numa_target;
+  ZPage**            _target;
   ZGeneration* const _generation;
   size_t             _other_promoted;
   size_t             _other_compacted;
+  size_t             _numa_remote;
+
+  static uint target_index(uint numa_target, ZPageAge age) {
+    return numa_target * ZAllocator::_relocation_allocators + static_cast<uint>(age) - 1;
+  }
 
   ZPage* target(ZPageAge age) {
-    return _target[static_cast<uint>(age) - 1];
+    return _target[target_index(_numa_target, age)];
   }
 
   void set_target(ZPageAge age, ZPage* page) {
-    _target[static_cast<uint>(age) - 1] = page;
+    _target[target_index(_numa_target, age)] = page;
   }
 
   size_t object_alignment() const {
@@ -655,6 +703,10 @@ private:
       // Already relocated, undo allocation
       _allocator->undo_alloc_object(to_page, to_addr, size);
       increase_other_forwarded(size);
+    } else if (_numa_targets > 1 && to_page->numa_id() != _numa_target) {
+      // The page cache could not provide a target page on the
+      // NUMA node of the page being relocated.
+      _numa_remote += size;
     }
 
     return to_addr;
@@ -915,18 +967,32 @@ public:
   ZRelocateWork(Allocator* allocator, ZGeneration* generation)
     : _allocator(allocator),
       _forwarding(nullptr),
-      _target(),
+      _numa_targets(allocator->numa_targets()),
+      _numa_target(0),
+      _target(NEW_C_HEAP_ARRAY(ZPage*, _numa_targets * ZAllocator::_relocation_allocators, mtGC)),
       _generation(generation),
       _other_promoted(0),
-      _other_compacted(0) {}
+      _other_compacted(0),
+      _numa_remote(0) {
+    for (uint i = 0; i < _numa_targets * ZAllocator::_relocation_allocators; ++i) {
+      _target[i] = nullptr;
+    }
+  }
 
   ~ZRelocateWork() {
-    for (uint i = 0; i < ZAllocator::_relocation_allocators; ++i) {
+    for (uint i = 0; i < _numa_targets * ZAllocator::_relocation_allocators; ++i) {
       _allocator->free_target_page(_target[i]);
     }
+    FREE_C_HEAP_ARRAY(ZPage*, _target);
+
     // Report statistics on-behalf of non-worker threads
     _generation->increase_promoted(_other_promoted);
     _generation->increase_compacted(_other_compacted);
+
+    if (_numa_remote > 0) {
+      _allocator->increase_numa_remote(_numa_remote);
+      ZStatInc(ZCounterRelocationNUMARemote, _numa_remote);
+    }
   }
 
   bool active_remset_is_current() const {
@@ -995,6 +1061,7 @@ public:
 
   void do_forwarding(ZForwarding* forwarding) {
     _forwarding = forwarding;
+    _numa_target = _allocator->numa_target(forwarding);
 
     _forwarding->page()->log_msg(" (relocate page)");
 
@@ -1102,7 +1169,7 @@ public:
       _medium_allocator(_generation) {}
 
   ~ZRelocateTask() {
-    _generation->stat_relocation()->at_relocate_end(_small_allocator.in_place_count(), _medium_allocator.in_place_count());
+    _generation->stat_relocation()->at_relocate_end(_small_allocator.in_place_count(), _medium_allocator.in_place_count(), _small_allocator.numa_remote());
 
     // Signal that we're not using the queue anymore. Used mostly for asserts.
     _queue->deactivate();
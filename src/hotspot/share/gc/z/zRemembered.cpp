@@ -23,10 +23,12 @@
 
 #include "precompiled.hpp"
 #include "gc/z/zAddress.inline.hpp"
+#include "gc/z/zArray.inline.hpp"
 #include "gc/z/zForwarding.inline.hpp"
 #include "gc/z/zGeneration.inline.hpp"
 #include "gc/z/zHeap.inline.hpp"
 #include "gc/z/zIterator.inline.hpp"
+#include "gc/z/zLock.inline.hpp"
 #include "gc/z/zMark.hpp"
 #include "gc/z/zPage.inline.hpp"
 #include "gc/z/zPageTable.hpp"
@@ -154,6 +156,53 @@ bool ZRemembered::scan_page(ZPage* page) const {
   return result;
 }
 
+// Remembered set entries of large pages are scanned in segments of this size
+static const size_t ZRememberedScanSegmentSize = 1 * M;
+
+bool ZRemembered::should_scan_page_segmented(ZPage* page) const {
+  // Large pages are never part of a relocation set, so a large page is never
+  // concurrently relocated while its segments are scanned. It is also not
+  // destroyed while the scanning task has safe destroy enabled.
+  return page->is_large() && page->size() >= 2 * ZRememberedScanSegmentSize;
+}
+
+bool ZRemembered::scan_page_segment(ZPage* page, uintptr_t l_offset, size_t size) const {
+  assert(page->is_large(), "Only large pages are scanned in segments");
+
+  const bool can_trust_live_bits =
+      page->is_relocatable() && !ZGeneration::old()->is_phase_mark();
+
+  bool result = false;
+
+  if (!can_trust_live_bits) {
+    // We don't have full liveness info - scan all remset entries
+    page->oops_do_remembered_limited(l_offset, size, [&](volatile zpointer* p) {
+      result |= scan_field(p);
+    });
+  } else if (page->is_marked()) {
+    // We have full liveness info - Only scan remset entries in the single
+    // live object of the page
+    const size_t used = page->used();
+    const size_t live_size = l_offset < used ? MIN2(size, used - l_offset) : 0;
+    page->oops_do_remembered_limited(l_offset, live_size, [&](volatile zpointer* p) {
+      result |= scan_field(p);
+    });
+  } else {
+    // All objects are dead - do nothing
+  }
+
+  // ... and as a side-effect clear the previous entries of the segment
+  if (ZVerifyRemembered) {
+    // Make sure self healing of pointers is ordered before clearing of
+    // the previous bits so that ZVerify::after_scan can detect missing
+    // remset entries accurately.
+    OrderAccess::storestore();
+  }
+  page->clear_remset_range_non_par_previous(l_offset, size);
+
+  return result;
+}
+
 static void fill_containing(GrowableArrayCHeap<ZRememberedSetContaining, mtGC>* array, ZPage* page) {
   page->log_msg(" (fill_remembered_containing)");
 
@@ -443,6 +492,78 @@ public:
   }
 };
 
+struct ZRemsetSegment {
+  ZPage*    _page;
+  uintptr_t _l_offset;
+  size_t    _size;
+};
+
+// Large old pages, e.g. containing big object arrays, can have a lot more
+// remembered set entries than other pages. To not have a single worker do
+// most of the scanning, such pages are split into segments that are pushed
+// onto a shared queue. All workers claim segments from the queue before they
+// claim more pages from the remset table iterator.
+class ZRemsetSegmentQueue {
+private:
+  struct Entry {
+    ZPage* _page;
+    size_t _nsegments;
+    size_t _claimed;
+  };
+
+  ZLock         _lock;
+  ZArray<Entry> _entries;
+  int           _cursor;
+  volatile bool _has_unclaimed;
+
+public:
+  ZRemsetSegmentQueue()
+    : _lock(),
+      _entries(),
+      _cursor(0),
+      _has_unclaimed(false) {}
+
+  ~ZRemsetSegmentQueue() {
+    log_debug(gc, remset)("Remset segmented pages: %d", _entries.length());
+  }
+
+  void push(ZPage* page) {
+    const size_t nsegments = align_up(page->size(), ZRememberedScanSegmentSize) / ZRememberedScanSegmentSize;
+
+    ZLocker<ZLock> locker(&_lock);
+    _entries.append({ page, nsegments, 0 });
+    Atomic::store(&_has_unclaimed, true);
+  }
+
+  bool claim(ZRemsetSegment* segment) {
+    if (!Atomic::load(&_has_unclaimed)) {
+      // Nothing to claim
+      return false;
+    }
+
+    ZLocker<ZLock> locker(&_lock);
+
+    while (_cursor < _entries.length()) {
+      Entry* const entry = _entries.adr_at(_cursor);
+      if (entry->_claimed == entry->_nsegments) {
+        // All segments claimed
+        _cursor++;
+        continue;
+      }
+
+      const uintptr_t l_offset = entry->_claimed * ZRememberedScanSegmentSize;
+      segment->_page = entry->_page;
+      segment->_l_offset = l_offset;
+      segment->_size = MIN2(ZRememberedScanSegmentSize, entry->_page->size() - l_offset);
+      entry->_claimed++;
+      return true;
+    }
+
+    Atomic::store(&_has_unclaimed, false);
+    return false;
+  }
+};
+
 // This task scans the remembered set and follows pointers when possible.
 // Interleaving remembered set scanning with marking makes the marking times
 // lower and more predictable.
@@ -451,13 +572,25 @@ private:
   ZRemembered* const   _remembered;
   ZMark* const         _mark;
   ZRemsetTableIterator _remset_table_iterator;
+  ZRemsetSegmentQueue  _remset_segment_queue;
+
+  bool claim_next(ZRemsetTableEntry* entry, ZRemsetSegment* segment) {
+    // Help scanning segments of already claimed pages first
+    if (_remset_segment_queue.claim(segment)) {
+      return true;
+    }
+
+    segment->_page = nullptr;
+    return _remset_table_iterator.next(entry);
+  }
 
 public:
   ZRememberedScanMarkFollowTask(ZRemembered* remembered, ZMark* mark)
     : ZRestartableTask("ZRememberedScanMarkFollowTask"),
       _remembered(remembered),
       _mark(mark),
-      _remset_table_iterator(remembered)  {
+      _remset_table_iterator(remembered),
+      _remset_segment_queue() {
     _mark->prepare_work();
     _remembered->_page_allocator->enable_safe_destroy();
     _remembered->_page_allocator->enable_safe_recycle();
@@ -481,8 +614,27 @@ public:
       return;
     }
 
-    for (ZRemsetTableEntry entry; _remset_table_iterator.next(&entry);) {
+    ZRemsetTableEntry entry;
+    for (ZRemsetSegment segment; claim_next(&entry, &segment);) {
       bool left_marking = false;
+
+      // Scan page segment
+      if (segment._page != nullptr) {
+        bool found_roots = _remembered->scan_page_segment(segment._page, segment._l_offset, segment._size);
+        if (found_roots) {
+          // Follow remembered set when possible
+          left_marking = !_mark->follow_work_partial();
+        }
+
+        SuspendibleThreadSet::yield();
+        if (left_marking) {
+          // Bail
+          return;
+        }
+
+        continue;
+      }
+
       ZForwarding* forwarding = entry._forwarding;
       ZPage* page = entry._page;
 
@@ -498,7 +650,10 @@ public:
 
       // Scan page
       if (page != nullptr) {
-        if (_remembered->should_scan_page(page)) {
+        if (_remembered->should_scan_page_segmented(page)) {
+          // Let all workers scan the segments of the page
+          _remset_segment_queue.push(page);
+        } else if (_remembered->should_scan_page(page)) {
           // Visit all entries pointing into young gen
           bool found_roots = _remembered->scan_page(page);
 
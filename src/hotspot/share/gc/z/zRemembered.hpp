@@ -39,6 +39,7 @@ struct ZRememberedSetContaining;
 
 class ZRemembered {
   friend class ZRememberedScanMarkFollowTask;
+  friend class ZRemsetSegmentQueue;
   friend class ZRemsetTableIterator;
 
 private:
@@ -74,6 +75,8 @@ private:
   bool should_scan_page(ZPage* page) const;
 
   bool scan_page(ZPage* page) const;
+  bool should_scan_page_segmented(ZPage* page) const;
+  bool scan_page_segment(ZPage* page, uintptr_t l_offset, size_t size) const;
   bool scan_forwarding(ZForwarding* forwarding, void* context) const;
 
 public:
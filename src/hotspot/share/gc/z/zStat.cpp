@@ -31,6 +31,7 @@
 #include "gc/z/zGeneration.inline.hpp"
 #include "gc/z/zGlobals.hpp"
 #include "gc/z/zNMethodTable.hpp"
+#include "gc/z/zNUMA.inline.hpp"
 #include "gc/z/zPageAllocator.inline.hpp"
 #include "gc/z/zRelocationSetSelector.inline.hpp"
 #include "gc/z/zStat.hpp"
@@ -1465,7 +1466,8 @@ ZStatRelocation::ZStatRelocation()
     _small_selected(),
     _small_in_place_count(),
     _medium_selected(),
-    _medium_in_place_count() {}
+    _medium_in_place_count(),
+    _small_numa_remote() {}
 
 void ZStatRelocation::at_select_relocation_set(const ZRelocationSetSelectorStats& selector_stats) {
   _selector_stats = selector_stats;
@@ -1475,9 +1477,10 @@ void ZStatRelocation::at_install_relocation_set(size_t forwarding_usage) {
   _forwarding_usage = forwarding_usage;
 }
 
-void ZStatRelocation::at_relocate_end(size_t small_in_place_count, size_t medium_in_place_count) {
+void ZStatRelocation::at_relocate_end(size_t small_in_place_count, size_t medium_in_place_count, size_t small_numa_remote) {
   _small_in_place_count = small_in_place_count;
   _medium_in_place_count = medium_in_place_count;
+  _small_numa_remote = small_numa_remote;
 }
 
 void ZStatRelocation::print_page_summary() {
@@ -1539,6 +1542,10 @@ void ZStatRelocation::print_page_summary() {
   print_summary("Large", large_summary, 0 /* in_place_count */);
 
   lt.print("Forwarding Usage: " SIZE_FORMAT "M", _forwarding_usage / M);
+
+  if (ZNUMA::is_enabled()) {
+    lt.print("NUMA Remote Relocated: " SIZE_FORMAT "M", _small_numa_remote / M);
+  }
 }
 
 void ZStatRelocation::print_age_table() {
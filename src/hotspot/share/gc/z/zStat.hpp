@@ -530,6 +530,7 @@ private:
   size_t                      _small_in_place_count;
   size_t                      _medium_selected;
   size_t                      _medium_in_place_count;
+  size_t                      _small_numa_remote;
 
   void print(const char* name,
              ZStatRelocationSummary selector_group,
@@ -540,7 +541,7 @@ public:
 
   void at_select_relocation_set(const ZRelocationSetSelectorStats& selector_stats);
   void at_install_relocation_set(size_t forwarding_usage);
-  void at_relocate_end(size_t small_in_place_count, size_t medium_in_place_count);
+  void at_relocate_end(size_t small_in_place_count, size_t medium_in_place_count, size_t small_numa_remote);
 
   void print_page_summary();
   void print_age_table();
@@ -26,6 +26,9 @@
 #include "gc/z/zAddress.inline.hpp"
 #include "gc/z/zBarrier.inline.hpp"
 #include "gc/z/zGeneration.inline.hpp"
+#include "gc/z/zHeap.inline.hpp"
+#include "gc/z/zPage.inline.hpp"
+#include "gc/z/zStat.hpp"
 #include "gc/z/zStoreBarrierBuffer.inline.hpp"
 #include "gc/z/zUncoloredRoot.inline.hpp"
 #include "memory/resourceArea.hpp"
@@ -33,6 +36,9 @@
 #include "utilities/ostream.hpp"
 #include "utilities/vmError.hpp"
 
+static const ZStatCounter ZCounterStoreBarrierBufferFlush("Memory", "Store Barrier Buffer Flush", ZStatUnitOpsPerSecond);
+static const ZStatCounter ZCounterStoreBarrierBufferFlushPages("Memory", "Store Barrier Buffer Flush Pages", ZStatUnitOpsPerSecond);
+
 ByteSize ZStoreBarrierEntry::p_offset() {
   return byte_offset_of(ZStoreBarrierEntry, _p);
 }
@@ -268,20 +274,76 @@ void ZStoreBarrierBuffer::on_error(outputStream* st) {
   }
 }
 
+void ZStoreBarrierBuffer::flush_batched() {
+  // Look up the page of each buffered field first, and prefetch the remembered
+  // set bits of the fields on old pages. The lookups are shared by consecutive
+  // entries on the same page, which is common for stores into the same object
+  // or array. The remembered set updates are then done after all previous values
+  // have been marked, by which time the prefetched bitmap words have arrived.
+  ZPage* pages[_buffer_length];
+  ZPage* page = nullptr;
+  size_t npages = 0;
+
+  for (int i = current(); i < (int)_buffer_length; ++i) {
+    volatile zpointer* const p = _buffer[i]._p;
+
+    if (page == nullptr || !page->is_in(to_zaddress((uintptr_t)p))) {
+      page = ZHeap::heap()->page(p);
+      assert(page != nullptr, "Page missing in page table");
+      if (page->is_old()) {
+        npages++;
+      }
+    }
+
+    if (page->is_old()) {
+      page->prefetch_remembered(p);
+      pages[i] = page;
+    } else {
+      // Only need remset entries for old objects
+      pages[i] = nullptr;
+    }
+  }
+
+  for (int i = current(); i < (int)_buffer_length; ++i) {
+    const zaddress addr = ZBarrier::make_load_good(_buffer[i]._prev);
+    if (!is_null(addr)) {
+      ZBarrier::mark<ZMark::DontResurrect, ZMark::AnyThread, ZMark::Follow, ZMark::Strong>(addr);
+    }
+  }
+
+  for (int i = current(); i < (int)_buffer_length; ++i) {
+    if (pages[i] != nullptr) {
+      pages[i]->remember(_buffer[i]._p);
+    }
+  }
+
+  ZStatInc(ZCounterStoreBarrierBufferFlushPages, npages);
+}
+
 void ZStoreBarrierBuffer::flush() {
   if (!ZBufferStoreBarriers) {
     return;
   }
 
+  if (is_empty()) {
+    return;
+  }
+
   OnError on_error(this);
   VMErrorCallbackMark mark(&on_error);
 
-  for (int i = current(); i < (int)_buffer_length; ++i) {
-    const ZStoreBarrierEntry& entry = _buffer[i];
-    const zaddress addr = ZBarrier::make_load_good(entry._prev);
-    ZBarrier::mark_and_remember(entry._p, addr);
+  if (ZBatchStoreBarrierFlush) {
+    flush_batched();
+  } else {
+    for (int i = current(); i < (int)_buffer_length; ++i) {
+      const ZStoreBarrierEntry& entry = _buffer[i];
+      const zaddress addr = ZBarrier::make_load_good(entry._prev);
+      ZBarrier::mark_and_remember(entry._p, addr);
+    }
   }
 
+  ZStatInc(ZCounterStoreBarrierBufferFlush);
+
   clear();
 }
 
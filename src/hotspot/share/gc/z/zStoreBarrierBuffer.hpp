@@ -72,6 +72,8 @@ private:
 
   void install_base_pointers_inner();
 
+  void flush_batched();
+
   void on_error(outputStream* st);
   class OnError;
 
@@ -27,8 +27,10 @@
 #include "gc/z/zLock.inline.hpp"
 #include "gc/z/zStat.hpp"
 #include "gc/z/zUncommitter.hpp"
+#include "gc/z/z_globals.hpp"
 #include "jfr/jfrEvents.hpp"
 #include "logging/log.hpp"
+#include "runtime/os.hpp"
 
 static const ZStatCounter ZCounterUncommit("Memory", "Uncommit", ZStatUnitBytesPerSecond);
 
@@ -59,6 +61,38 @@ bool ZUncommitter::should_continue() const {
   return !_stop;
 }
 
+bool ZUncommitter::is_memory_pressure() const {
+  if (ZUncommitMemoryPressure == 0) {
+    // Disabled
+    return false;
+  }
+
+  // When running in a container, these are the limit and the
+  // available memory of the container
+  const julong physical = os::physical_memory();
+  const julong available = MIN2(os::available_memory(), physical);
+  const julong used = physical - available;
+
+  return percent_of(used, physical) >= ZUncommitMemoryPressure;
+}
+
+bool ZUncommitter::pace(size_t uncommitted) const {
+  if (ZUncommitRate == 0) {
+    // Not paced
+    return should_continue();
+  }
+
+  // Wait long enough for the uncommitted memory to match the target rate
+  const uint64_t pause = (uint64_t)(uncommitted * MILLIUNITS / (ZUncommitRate * M));
+
+  ZLocker<ZConditionLock> locker(&_lock);
+  if (!_stop && pause > 0) {
+    _lock.wait(pause);
+  }
+
+  return !_stop;
+}
+
 void ZUncommitter::run_thread() {
   uint64_t timeout = 0;
 
@@ -66,15 +100,33 @@ void ZUncommitter::run_thread() {
     EventZUncommit event;
     size_t uncommitted = 0;
 
-    while (should_continue()) {
+    for (;;) {
+      // Under memory pressure, uncommit all unused memory as fast as
+      // possible, instead of waiting for it to become old enough
+      const bool memory_pressure = is_memory_pressure();
+      const uint64_t delay = memory_pressure ? 0 : ZUncommitDelay;
+
       // Uncommit chunk
-      const size_t flushed = _page_allocator->uncommit(&timeout);
+      const size_t flushed = _page_allocator->uncommit(delay, &timeout);
       if (flushed == 0) {
         // Done
         break;
       }
 
       uncommitted += flushed;
+
+      if (memory_pressure) {
+        if (!should_continue()) {
+          break;
+        }
+      } else if (!pace(flushed)) {
+        break;
+      }
+    }
+
+    if (ZUncommitMemoryPressure > 0) {
+      // Check for memory pressure at least once per second
+      timeout = MIN2(timeout, (uint64_t)1);
     }
 
     if (uncommitted > 0) {
@@ -38,6 +38,9 @@ private:
   bool wait(uint64_t timeout) const;
   bool should_continue() const;
 
+  bool is_memory_pressure() const;
+  bool pace(size_t uncommitted) const;
+
 protected:
   virtual void run_thread();
   virtual void terminate();
@@ -48,9 +48,29 @@
   product(bool, ZCollectionIntervalOnly, false,                             \
           "Only use timers for GC heuristics")                              \
                                                                             \
+  product(uint, ZConcGCCPUBudget, 0, EXPERIMENTAL,                          \
+          "Percentage of the available processors that concurrent GC "      \
+          "of both generations together should use at most. Limits the "    \
+          "number of GC threads, and defers proactive and opportunistic "   \
+          "major collections exceeding the budget. 0 means no budget")      \
+          range(0, 100)                                                     \
+                                                                            \
+  product(size_t, ZUncommitRate, 0, EXPERIMENTAL,                           \
+          "Gradually uncommit unused memory at most at the specified "      \
+          "rate (in MB/s). 0 means no pacing")                              \
+                                                                            \
+  product(uint, ZUncommitMemoryPressure, 0, EXPERIMENTAL,                   \
+          "Uncommit unused memory without delay and pacing when the "       \
+          "memory usage of the machine or container exceeds the "           \
+          "specified percentage. 0 means disabled")                         \
+          range(0, 100)                                                     \
+                                                                            \
   product(bool, ZBufferStoreBarriers, true, DIAGNOSTIC,                     \
           "Buffer store barriers")                                          \
                                                                             \
+  product(bool, ZBatchStoreBarrierFlush, true, DIAGNOSTIC,                  \
+          "Flush buffered store barriers in batches grouped by page")       \
+                                                                            \
   product(uint, ZYoungGCThreads, 0, DIAGNOSTIC,                             \
           "Number of GC threads for the young generation")                  \
                                                                             \
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -118,7 +118,7 @@ void BFSClosure::closure_impl(UnifiedOopRef reference, const oop pointee) {
   assert(!reference.is_null(), "invariant");
   assert(reference.dereference() == pointee, "invariant");
 
-  if (GranularTimer::is_finished()) {
+  if (GranularTimer::is_finished() || _edge_store->has_all_chains()) {
      return;
   }
 
@@ -157,7 +157,7 @@ void BFSClosure::dfs_fallback() {
   assert(_edge_queue->is_full(), "invariant");
   _use_dfs = true;
   _dfs_fallback_idx = _edge_queue->bottom();
-  while (!_edge_queue->is_empty()) {
+  while (!_edge_queue->is_empty() && !_edge_store->has_all_chains()) {
     const Edge* edge = _edge_queue->remove();
     if (edge->pointee() != nullptr) {
       DFSClosure::find_leaks_from_edge(_edge_store, _mark_bits, edge);
@@ -184,6 +184,10 @@ void BFSClosure::step_frontier() const {
 }
 
 bool BFSClosure::is_complete() const {
+  if (_edge_store->has_all_chains()) {
+    // no need to traverse the rest of the heap
+    return true;
+  }
   if (_edge_queue->bottom() < _next_frontier_idx) {
     return false;
   }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -219,7 +219,7 @@ bool EdgeStore::put_edges(StoredEdge** previous, const Edge** current, size_t li
 
 static GrowableArray<const StoredEdge*>* _leak_context_edges = nullptr;
 
-EdgeStore::EdgeStore() : _edges(new EdgeHashTable(this)) {}
+EdgeStore::EdgeStore() : _edges(new EdgeHashTable(this)), _nof_candidates(SIZE_MAX), _nof_chains(0) {}
 
 EdgeStore::~EdgeStore() {
   assert(_edges != nullptr, "invariant");
@@ -317,6 +317,7 @@ StoredEdge* EdgeStore::associate_leak_context_with_candidate(const Edge* edge) {
 void EdgeStore::put_chain(const Edge* chain, size_t length) {
   assert(chain != nullptr, "invariant");
   assert(chain->distance_to_root() + 1 == length, "invariant");
+  ++_nof_chains;
   StoredEdge* const leak_context_edge = associate_leak_context_with_candidate(chain);
   assert(leak_context_edge != nullptr, "invariant");
   assert(leak_context_edge->parent() == nullptr, "invariant");
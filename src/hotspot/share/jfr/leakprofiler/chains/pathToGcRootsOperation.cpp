@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2019, 2021, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2019, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -101,10 +101,13 @@ void PathToGcRootsOperation::doit() {
   // Save the original markWord for the potential leak objects,
   // to be restored on function exit
   ObjectSampleMarker marker;
-  if (ObjectSampleCheckpoint::save_mark_words(_sampler, marker, _emit_all) == 0) {
+  const int nof_candidates = ObjectSampleCheckpoint::save_mark_words(_sampler, marker, _emit_all);
+  if (nof_candidates == 0) {
     // no valid samples to process
     return;
   }
+  // Stop searching the heap once all candidates are found
+  _edge_store->set_nof_candidates((size_t)nof_candidates);
 
   // Necessary condition for attempting a root set iteration
   Universe::heap()->ensure_parsability(false);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2012, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2012, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -507,6 +507,17 @@ static int64_t get_monotonic_ms() {
   return os::javaTimeNanos() / 1000000;
 }
 
+// Returns the scheduled start of the sampling period that just ended. Periods
+// are measured from one scheduled start to the next, so that the time spent
+// sampling does not lower the sampling rate, which matters for short periods.
+// If we fell behind by a whole period, e.g. because sampling took long, the
+// schedule is restarted from now instead of sampling in a burst to catch up.
+static int64_t next_sample_start(int64_t last_ms, int64_t period_millis) {
+  const int64_t now_ms = get_monotonic_ms();
+  const int64_t scheduled_ms = last_ms + period_millis;
+  return now_ms - scheduled_ms >= period_millis ? now_ms : scheduled_ms;
+}
+
 void JfrThreadSampler::run() {
   assert(_sampler_thread == nullptr, "invariant");
 
@@ -556,11 +567,11 @@ void JfrThreadSampler::run() {
 
     if ((next_j - sleep_to_next) <= 0) {
       task_stacktrace(JAVA_SAMPLE, &_last_thread_java);
-      last_java_ms = get_monotonic_ms();
+      last_java_ms = next_sample_start(last_java_ms, java_period_millis);
     }
     if ((next_n - sleep_to_next) <= 0) {
       task_stacktrace(NATIVE_SAMPLE, &_last_thread_native);
-      last_native_ms = get_monotonic_ms();
+      last_native_ms = next_sample_start(last_native_ms, native_period_millis);
     }
   }
 }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -28,13 +28,20 @@
 #include "jfr/recorder/repository/jfrChunkWriter.hpp"
 #include "jfr/recorder/stacktrace/jfrStackTraceRepository.hpp"
 #include "jfr/support/jfrThreadLocal.hpp"
+#include "runtime/atomic.hpp"
 #include "runtime/mutexLocker.hpp"
+#include "utilities/globalCounter.inline.hpp"
 
 /*
  * There are two separate repository instances.
  * One instance is dedicated to stacktraces taken as part of the leak profiler subsystem.
  * It is kept separate because at the point of insertion, it is unclear if a trace will be serialized,
  * which is a decision postponed and taken during rotation.
+ *
+ * Entries are only added under the JfrStacktrace_lock, but the table is looked up lock-free
+ * inside a GlobalCounter critical section. Entries are published with release semantics
+ * and never change their next link. When the table is cleared, the entries are unlinked
+ * first and only deleted once no concurrent lookup can still see them.
  */
 
 static JfrStackTraceRepository* _instance = nullptr;
@@ -97,51 +104,76 @@ bool JfrStackTraceRepository::is_modified() const {
   return _last_entries != _entries;
 }
 
-size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  if (_entries == 0) {
-    return 0;
+// Moves all entries out of the table. Must be called with the JfrStacktrace_lock held.
+// The returned table is handed to delete_unlinked() once the lock has been released.
+JfrStackTrace** JfrStackTraceRepository::unlink_all() {
+  assert_lock_strong(JfrStacktrace_lock);
+  JfrStackTrace** const unlinked = JfrCHeapObj::new_array<JfrStackTrace*>(TABLE_SIZE);
+  for (u4 i = 0; i < TABLE_SIZE; ++i) {
+    unlinked[i] = _table[i];
+    Atomic::store(&_table[i], (JfrStackTrace*)nullptr);
   }
-  int count = 0;
+  _entries = 0;
+  _last_entries = 0;
+  return unlinked;
+}
+
+void JfrStackTraceRepository::delete_unlinked(JfrStackTrace** unlinked) {
+  if (unlinked == nullptr) {
+    return;
+  }
+  // Wait for lock-free lookups that might still traverse the unlinked entries.
+  GlobalCounter::write_synchronize();
   for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = _table[i];
+    JfrStackTrace* stacktrace = unlinked[i];
     while (stacktrace != nullptr) {
       JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      if (stacktrace->should_write()) {
-        stacktrace->write(sw);
-        ++count;
-      }
-      if (clear) {
-        delete stacktrace;
-      }
+      delete stacktrace;
       stacktrace = next;
     }
   }
-  if (clear) {
-    memset(_table, 0, sizeof(_table));
-    _entries = 0;
+  JfrCHeapObj::free(unlinked, sizeof(JfrStackTrace*) * TABLE_SIZE);
+}
+
+size_t JfrStackTraceRepository::write(JfrChunkWriter& sw, bool clear) {
+  JfrStackTrace** unlinked = nullptr;
+  int count = 0;
+  {
+    MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+    if (_entries == 0) {
+      return 0;
+    }
+    for (u4 i = 0; i < TABLE_SIZE; ++i) {
+      const JfrStackTrace* stacktrace = _table[i];
+      while (stacktrace != nullptr) {
+        if (stacktrace->should_write()) {
+          stacktrace->write(sw);
+          ++count;
+        }
+        stacktrace = stacktrace->next();
+      }
+    }
+    if (clear) {
+      unlinked = unlink_all();
+    }
+    _last_entries = _entries;
   }
-  _last_entries = _entries;
+  delete_unlinked(unlinked);
   return count;
 }
 
 size_t JfrStackTraceRepository::clear(JfrStackTraceRepository& repo) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  if (repo._entries == 0) {
-    return 0;
-  }
-  for (u4 i = 0; i < TABLE_SIZE; ++i) {
-    JfrStackTrace* stacktrace = repo._table[i];
-    while (stacktrace != nullptr) {
-      JfrStackTrace* next = const_cast<JfrStackTrace*>(stacktrace->next());
-      delete stacktrace;
-      stacktrace = next;
+  JfrStackTrace** unlinked = nullptr;
+  size_t processed = 0;
+  {
+    MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+    if (repo._entries == 0) {
+      return 0;
     }
+    processed = repo._entries;
+    unlinked = repo.unlink_all();
   }
-  memset(repo._table, 0, sizeof(repo._table));
-  const size_t processed = repo._entries;
-  repo._entries = 0;
-  repo._last_entries = 0;
+  delete_unlinked(unlinked);
   return processed;
 }
 
@@ -197,25 +229,42 @@ void JfrStackTraceRepository::record_for_leak_profiler(JavaThread* current_threa
   }
 }
 
-traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
-  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
-  assert(stacktrace._nr_of_frames > 0, "invariant");
-  const size_t index = stacktrace._hash % TABLE_SIZE;
-  const JfrStackTrace* table_entry = _table[index];
-
+traceid JfrStackTraceRepository::lookup(size_t index, const JfrStackTrace& stacktrace) const {
+  const JfrStackTrace* table_entry = Atomic::load_acquire(&_table[index]);
   while (table_entry != nullptr) {
     if (table_entry->equals(stacktrace)) {
       return table_entry->id();
     }
     table_entry = table_entry->next();
   }
+  return 0;
+}
+
+traceid JfrStackTraceRepository::add_trace(const JfrStackTrace& stacktrace) {
+  assert(stacktrace._nr_of_frames > 0, "invariant");
+  const size_t index = stacktrace._hash % TABLE_SIZE;
+  {
+    // Most recorded stack traces are already in the table, look them up without locking.
+    GlobalCounter::CriticalSection cs(Thread::current());
+    const traceid id = lookup(index, stacktrace);
+    if (id != 0) {
+      return id;
+    }
+  }
+
+  MutexLocker lock(JfrStacktrace_lock, Mutex::_no_safepoint_check_flag);
+  // Look up again, the stack trace might have been added concurrently.
+  traceid id = lookup(index, stacktrace);
+  if (id != 0) {
+    return id;
+  }
 
   if (!stacktrace.have_lineno()) {
     return 0;
   }
 
-  traceid id = ++_next_id;
-  _table[index] = new JfrStackTrace(id, stacktrace, _table[index]);
+  id = ++_next_id;
+  Atomic::release_store(&_table[index], new JfrStackTrace(id, stacktrace, _table[index]));
   ++_entries;
   return id;
 }
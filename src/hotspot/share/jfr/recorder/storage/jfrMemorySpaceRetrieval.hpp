@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,6 +26,7 @@
 #define SHARE_JFR_RECORDER_STORAGE_JFRMEMORYSPACERETRIEVAL_HPP
 
 #include "jfr/utilities/jfrIterator.hpp"
+#include "utilities/globalDefinitions.hpp"
 
 /* Some policy classes for getting mspace memory. */
 
@@ -36,17 +37,36 @@ class JfrMspaceRetrieval {
   static Node* acquire(Mspace* mspace, bool free_list, Thread* thread, size_t size, bool previous_epoch) {
     if (free_list) {
       StopOnNullCondition<typename Mspace::FreeList> iterator(mspace->free_list());
-      return acquire(mspace, iterator, thread, size);
+      return acquire(mspace, iterator, thread, size, 0, max_uintx);
     }
+    // Start the search at a thread specific position in the live list, so that
+    // threads acquiring nodes concurrently (e.g. for promotion of thread local
+    // buffers) mostly try different nodes instead of all contending on the first ones.
+    const size_t start = start_position(thread);
     StopOnNullCondition<typename Mspace::LiveList> iterator(mspace->live_list(previous_epoch));
-    return acquire(mspace, iterator, thread, size);
+    Node* const node = acquire(mspace, iterator, thread, size, start, max_uintx);
+    if (node != nullptr || start == 0) {
+      return node;
+    }
+    // Wrap around.
+    StopOnNullCondition<typename Mspace::LiveList> wrapped(mspace->live_list(previous_epoch));
+    return acquire(mspace, wrapped, thread, size, 0, start);
   }
  private:
+  static const size_t start_position_spread = 8;
+
+  static size_t start_position(const Thread* thread) {
+    // Thread objects are large, so the low bits of their addresses carry no information.
+    return (size_t)((p2i(thread) >> 8) % start_position_spread);
+  }
+
+  // Try to acquire one of the nodes at positions [from, to) in the list.
   template <typename Iterator>
-  static Node* acquire(Mspace* mspace, Iterator& iterator, Thread* thread, size_t size) {
+  static Node* acquire(Mspace* mspace, Iterator& iterator, Thread* thread, size_t size, size_t from, size_t to) {
     assert(mspace != nullptr, "invariant");
-    while (iterator.has_next()) {
+    for (size_t position = 0; iterator.has_next() && position < to; ++position) {
       Node* const node = iterator.next();
+      if (position < from) continue;
       if (node->retired()) continue;
       if (node->try_acquire(thread)) {
         assert(!node->retired(), "invariant");
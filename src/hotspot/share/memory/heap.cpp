@@ -556,6 +556,17 @@ size_t CodeHeap::allocated_capacity() const {
   return segments_to_size(_next_segment - _freelist_segments);
 }
 
+// Returns the size of the largest block on the freelist or of the unallocated
+// space at the end of the heap, whichever is larger. Together with
+// unallocated_capacity() this tells how fragmented the free space is.
+size_t CodeHeap::largest_free_block() const {
+  size_t largest = _number_of_reserved_segments - _next_segment;
+  for (FreeBlock* b = _freelist; b != nullptr; b = b->link()) {
+    largest = MAX2(largest, b->length());
+  }
+  return segments_to_size(largest);
+}
+
 // Returns size of the unallocated heap block
 size_t CodeHeap::heap_unallocated_capacity() const {
   // Total number of segments - number currently used
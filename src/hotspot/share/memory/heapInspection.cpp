@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2002, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2002, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -171,6 +171,8 @@ public:
 KlassInfoTable::KlassInfoTable(bool add_all_classes) {
   _size_of_instances_in_words = 0;
   _ref = (HeapWord*) Universe::boolArrayKlassObj();
+  _last_klass = nullptr;
+  _last_entry = nullptr;
   _buckets =
     (KlassInfoBucket*)  AllocateHeap(sizeof(KlassInfoBucket) * _num_buckets,
        mtInternal, CURRENT_PC, AllocFailStrategy::RETURN_NULL);
@@ -214,13 +216,16 @@ KlassInfoEntry* KlassInfoTable::lookup(Klass* k) {
 // of running out of space required to create a new entry.
 bool KlassInfoTable::record_instance(const oop obj) {
   Klass*        k = obj->klass();
-  KlassInfoEntry* elt = lookup(k);
+  KlassInfoEntry* elt = (k == _last_klass) ? _last_entry : lookup(k);
   // elt may be null if it's a new klass for which we
   // could not allocate space for a new entry in the hashtable.
   if (elt != nullptr) {
+    _last_klass = k;
+    _last_entry = elt;
+    const size_t words = obj->size();
     elt->set_count(elt->count() + 1);
-    elt->set_words(elt->words() + obj->size());
-    _size_of_instances_in_words += obj->size();
+    elt->set_words(elt->words() + words);
+    _size_of_instances_in_words += words;
     return true;
   } else {
     return false;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2002, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2002, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -113,6 +113,12 @@ class KlassInfoTable: public StackObj {
   HeapWord* _ref;
 
   KlassInfoBucket* _buckets;
+
+  // Entry of the most recently recorded instance. Adjacent objects in the
+  // heap often have the same klass, which then avoids the table lookup.
+  Klass* _last_klass;
+  KlassInfoEntry* _last_entry;
+
   uint hash(const Klass* p);
   KlassInfoEntry* lookup(Klass* k); // allocates if not found!
 
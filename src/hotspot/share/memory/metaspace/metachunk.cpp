@@ -177,6 +177,13 @@ MetaWord* Metachunk::allocate(size_t request_word_size) {
   return p;
 }
 
+void Metachunk::deallocate_at_top(MetaWord* p, size_t word_size) {
+  assert(p + word_size == top(), "Not the most recent allocation.");
+  assert(used_words() >= word_size, "Sanity");
+  _used_words -= word_size;
+  SOMETIMES(verify();)
+}
+
 #ifdef ASSERT
 
 // Zap this structure.
@@ -322,6 +322,10 @@ public:
   //
   MetaWord* allocate(size_t request_word_size);
 
+  // Return the most recent allocation from this chunk, which must end at top(),
+  // to the chunk.
+  void deallocate_at_top(MetaWord* p, size_t word_size);
+
   // Initialize structure for reuse.
   void initialize(VirtualSpaceNode* node, MetaWord* base, chunklevel_t lvl) {
     clear();
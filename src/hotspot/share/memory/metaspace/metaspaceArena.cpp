@@ -352,8 +352,9 @@ MetaWord* MetaspaceArena::allocate_inner(size_t requested_word_size) {
   return p;
 }
 
-// Prematurely returns a metaspace allocation to the _block_freelists
-// because it is not needed anymore (requires CLD lock to be active).
+// Prematurely returns a metaspace allocation to the _block_freelists, or to the
+// current chunk if it was the most recent allocation from it, because it is not
+// needed anymore (requires CLD lock to be active).
 void MetaspaceArena::deallocate_locked(MetaWord* p, size_t word_size) {
   assert_lock_strong(lock());
   // At this point a current chunk must exist since we only deallocate if we did allocate before.
@@ -366,7 +367,17 @@ void MetaspaceArena::deallocate_locked(MetaWord* p, size_t word_size) {
       p2i(p), word_size);
 
   size_t raw_word_size = get_raw_word_size_for_requested_word_size(word_size);
-  add_allocation_to_fbl(p, raw_word_size);
+  if (current_chunk()->base() <= p && p + raw_word_size == current_chunk()->top()) {
+    // The block is the most recent allocation from the current chunk. Give it back to
+    // the chunk instead of the free block list, so that it can be reused for allocations
+    // of any size.
+    current_chunk()->deallocate_at_top(p, raw_word_size);
+    _total_used_words_counter->decrement_by(raw_word_size);
+    UL2(trace, "returned to current chunk " METACHUNK_FULL_FORMAT ".",
+        METACHUNK_FULL_FORMAT_ARGS(current_chunk()));
+  } else {
+    add_allocation_to_fbl(p, raw_word_size);
+  }
 
   SOMETIMES(verify_locked();)
 }
@@ -1586,6 +1586,9 @@ void PhaseBlockLayout::find_edges() {
       // We see a merge point, so stop search for the next block
       if (n->num_preds() != 1) break;
 
+      // Start a new trace where cold code begins or ends
+      if (crosses_cold_boundary(b, n)) break;
+
       i++;
       assert(n == _cfg.get_block(i), "expecting next block");
       tr->append(n);
@@ -1658,6 +1661,8 @@ void PhaseBlockLayout::grow_traces() {
     Block *src_block = e->from();
     Block *targ_block = e->to();
 
+    if (crosses_cold_boundary(src_block, targ_block)) continue;
+
     // Don't grow traces along backedges?
     if (!BlockLayoutRotateLoops) {
       if (targ_block->_rpo <= src_block->_rpo) {
@@ -1702,6 +1707,7 @@ void PhaseBlockLayout::merge_traces(bool fall_thru_only) {
     }
 
     Block *src_block = e->from();
+    if (crosses_cold_boundary(src_block, e->to())) continue;
     Trace *src_trace = trace(src_block);
     bool src_at_tail = src_trace->last_block() == src_block;
 
@@ -1783,6 +1789,25 @@ void PhaseBlockLayout::reorder_traces(int count) {
   // Sort the new trace list by frequency
   qsort(new_traces + 1, new_count - 1, sizeof(new_traces[0]), trace_frequency_order);
 
+  if (BlockLayoutSplitCold) {
+    // Move cold traces behind all other traces but the connector trace,
+    // keeping the frequency order within both groups.
+    Trace** sorted = NEW_RESOURCE_ARRAY(Trace*, new_count);
+    int n = 0;
+    sorted[n++] = new_traces[0];
+    for (int pass = 0; pass < 3; pass++) {
+      for (int i = 1; i < new_count; i++) {
+        Block* first = new_traces[i]->first_block();
+        int group = first->is_connector() ? 2 : (is_cold(first) ? 1 : 0);
+        if (group == pass) {
+          sorted[n++] = new_traces[i];
+        }
+      }
+    }
+    assert(n == new_count, "lost traces");
+    new_traces = sorted;
+  }
+
   // Collect all blocks from existing Traces
   _cfg.clear_blocks();
   for (int i = 0; i < new_count; i++) {
@@ -1810,6 +1835,14 @@ PhaseBlockLayout::PhaseBlockLayout(PhaseCFG &cfg)
   memset(next,   0, size*sizeof(Block*));
   prev = NEW_RESOURCE_ARRAY(Block*, size);
   memset(prev  , 0, size*sizeof(Block*));
+  cold = NEW_RESOURCE_ARRAY(bool, size);
+  memset(cold  , 0, size*sizeof(bool));
+  if (BlockLayoutSplitCold) {
+    for (uint i = 0; i < _cfg.number_of_blocks(); i++) {
+      Block* b = _cfg.get_block(i);
+      cold[b->_pre_order] = !b->is_connector() && _cfg.is_uncommon(b);
+    }
+  }
 
   // List of edges
   edges = new GrowableArray<CFGEdge*>;
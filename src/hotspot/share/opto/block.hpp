@@ -896,12 +896,19 @@ class PhaseBlockLayout : public Phase {
   Trace **traces;
   Block **next;
   Block **prev;
+  bool *cold;                   // Uncommon blocks, if BlockLayoutSplitCold
   UnionFind *uf;
 
   // Given a block, find its encompassing Trace
   Trace * trace(Block *b) {
     return traces[uf->Find_compress(b->_pre_order)];
   }
+
+  bool is_cold(Block* b) const { return cold[b->_pre_order]; }
+  // Blocks on both sides of a hot/cold boundary must not share a trace.
+  bool crosses_cold_boundary(Block* from, Block* to) const {
+    return is_cold(from) != is_cold(to);
+  }
  public:
   PhaseBlockLayout(PhaseCFG &cfg);
 
@@ -394,8 +394,9 @@ bool InlineTree::try_to_inline(ciMethod* callee_method, ciMethod* caller_method,
 
     // don't inline into giant methods
     if (C->over_inlining_cutoff()) {
-      if ((!callee_method->force_inline() && !caller_method->is_compiled_lambda_form())
-          || !IncrementalInline) {
+      bool can_delay = callee_method->force_inline() || caller_method->is_compiled_lambda_form() ||
+                       (IncrementalInlineByFrequency && !C->inlining_incrementally());
+      if (!can_delay || !IncrementalInline) {
         set_msg("NodeCountInliningCutoff");
         return false;
       } else {
@@ -393,6 +393,10 @@
   product(bool, UseOnlyInlinedBimorphic, true,                              \
           "Don't use BimorphicInlining if can't inline a second method")    \
                                                                             \
+  product(bool, UsePolymorphicInlining, false, EXPERIMENTAL,                \
+          "Profiling based inlining for up to TypeProfileWidth receivers "  \
+          "at call sites where all receiver types have been recorded")      \
+                                                                            \
   develop(bool, SubsumeLoads, true,                                         \
           "Attempt to compile while subsuming loads into machine "          \
           "instructions.")                                                  \
@@ -410,6 +414,11 @@
           "Set level of loop optimization for tier 1 compiles")             \
           range(5, 43)                                                      \
                                                                             \
+  product(uintx, C2CompileTimeBudget, 0, EXPERIMENTAL,                      \
+          "Milliseconds after which a compilation skips the remaining "     \
+          "rounds of incremental inlining, iterative escape analysis "      \
+          "and loop optimizations (0 means no budget)")                     \
+                                                                            \
   product(bool, OptimizeUnstableIf, true, DIAGNOSTIC,                       \
           "Optimize UnstableIf traps")                                      \
                                                                             \
@@ -489,6 +498,16 @@
   product(bool, EliminateAllocations, true,                                 \
           "Use escape analysis to eliminate allocations")                   \
                                                                             \
+  product(bool, TrapColdEscapingCalls, false, EXPERIMENTAL,                 \
+          "Replace rarely executed calls that are not inlined and take an " \
+          "object allocated in the compiled method by uncommon traps, so "  \
+          "that the object may be scalar replaced on the other paths")      \
+                                                                            \
+  product(uintx, ColdEscapingCallPercent, 1, EXPERIMENTAL,                  \
+          "A call site is cold for TrapColdEscapingCalls if it is executed "\
+          "in less than this percentage of invocations of its method")      \
+          range(0, 100)                                                     \
+                                                                            \
   notproduct(bool, PrintEliminateAllocations, false,                        \
           "Print out when allocations are eliminated")                      \
                                                                             \
@@ -530,6 +549,11 @@
   product(bool, BlockLayoutByFrequency, true,                               \
           "Use edge frequencies to drive block ordering")                   \
                                                                             \
+  product(bool, BlockLayoutSplitCold, false, EXPERIMENTAL,                  \
+          "With BlockLayoutByFrequency, keep uncommon blocks out of the "   \
+          "traces of frequent blocks and place them at the end of the "     \
+          "method code")                                                    \
+                                                                            \
   product(intx, BlockLayoutMinDiamondPercentage, 20,                        \
           "Minimum %% of a successor (predecessor) for which block "        \
           "layout a will allow a fork (join) in a single chain")            \
@@ -681,6 +705,11 @@
   product(bool, IncrementalInlineForceCleanup, false, DIAGNOSTIC,           \
           "do cleanup after every iteration of incremental inlining")       \
                                                                             \
+  product(bool, IncrementalInlineByFrequency, false, EXPERIMENTAL,          \
+          "Delay inlining beyond NodeCountInliningCutoff instead of "       \
+          "giving up, and do post parse inlining of the call sites with "   \
+          "the highest execution count per bytecode first")                 \
+                                                                            \
   product(intx, LiveNodeCountInliningCutoff, 40000,                         \
           "max number of live nodes in a method")                           \
           range(0, max_juint / 8)                                           \
@@ -688,6 +717,10 @@
   product(bool, OptimizeExpensiveOps, true, DIAGNOSTIC,                     \
           "Find best control for expensive operations")                     \
                                                                             \
+  product(bool, OptimizeLoopInvariantLoads, false, DIAGNOSTIC,              \
+          "Let loads bypass the memory Phi of a loop that does not store "  \
+          "to the loaded memory location")                                  \
+                                                                            \
   product(bool, UseMathExactIntrinsics, true, DIAGNOSTIC,                   \
           "Enables intrinsification of various java.lang.Math functions")   \
                                                                             \
@@ -752,6 +785,11 @@
           "Loop with fewer iterations are not strip mined")                 \
           range(0, max_juint)                                               \
                                                                             \
+  product(bool, UseAdaptiveLoopStripMining, false, EXPERIMENTAL,            \
+          "Scale the number of iterations in a strip mined loop by the "    \
+          "estimated cost of the loop body, so that loops with small "      \
+          "bodies poll for safepoints less often")                          \
+                                                                            \
   product(bool, UseProfiledLoopPredicate, true,                             \
           "Move predicates out of loops based on profiling data")           \
                                                                             \
@@ -74,6 +74,7 @@
 #include "opto/vector.hpp"
 #include "opto/vectornode.hpp"
 #include "runtime/globals_extension.hpp"
+#include "runtime/os.hpp"
 #include "runtime/sharedRuntime.hpp"
 #include "runtime/signature.hpp"
 #include "runtime/stubRoutines.hpp"
@@ -1033,6 +1034,9 @@ void Compile::Init(bool aliasing) {
 
   set_do_freq_based_layout(_directive->BlockLayoutByFrequencyOption);
   _loop_opts_cnt = LoopOptsCount;
+  _time_budget_end = (C2CompileTimeBudget == 0) ? 0 :
+                     os::javaTimeNanos() + (jlong)C2CompileTimeBudget * NANOSECS_PER_MILLISEC;
+  _time_budget_exceeded = false;
   set_do_inlining(Inline);
   set_max_inline_size(MaxInlineSize);
   set_freq_inline_size(FreqInlineSize);
@@ -2010,6 +2014,41 @@ void Compile::inline_boxing_calls(PhaseIterGVN& igvn) {
   }
 }
 
+// Benefit of inlining a late inline candidate relative to its size: the
+// profiled execution count of the call site per bytecode of the callee.
+static float late_inline_benefit(CallGenerator* cg) {
+  CallNode* call = cg->call_node();
+  if (call == nullptr || call->jvms() == nullptr || !cg->method()->is_loaded()) {
+    return 0.0f;
+  }
+  JVMState* jvms = call->jvms();
+  ciCallProfile profile = jvms->method()->call_profile_at_bci(jvms->bci());
+  return (float)MAX2(profile.count(), 0) / MAX2(cg->method()->code_size(), 1);
+}
+
+// Move the direct late inline candidate with the highest benefit to the front
+// of the list so that the node budget is spent on the hottest call sites first.
+static void prioritize_late_inlines(GrowableArray<CallGenerator*>* inlines) {
+  int best = -1;
+  float best_benefit = 0.0f;
+  for (int i = 0; i < inlines->length(); i++) {
+    CallGenerator* cg = inlines->at(i);
+    if (cg->is_virtual_late_inline() || cg->is_mh_late_inline()) {
+      continue;
+    }
+    float benefit = late_inline_benefit(cg);
+    if (best == -1 || benefit > best_benefit) {
+      best = i;
+      best_benefit = benefit;
+    }
+  }
+  if (best > 0) {
+    CallGenerator* cg = inlines->at(best);
+    inlines->remove_at(best);
+    inlines->insert_before(0, cg);
+  }
+}
+
 bool Compile::inline_incrementally_one() {
   assert(IncrementalInline, "incremental inlining should be on");
 
@@ -2018,6 +2057,10 @@ bool Compile::inline_incrementally_one() {
   set_inlining_progress(false);
   set_do_cleanup(false);
 
+  if (IncrementalInlineByFrequency && inlining_incrementally()) {
+    prioritize_late_inlines(&_late_inlines);
+  }
+
   for (int i = 0; i < _late_inlines.length(); i++) {
     _late_inlines_pos = i+1;
     CallGenerator* cg = _late_inlines.at(i);
@@ -2066,6 +2109,35 @@ void Compile::inline_incrementally_cleanup(PhaseIterGVN& igvn) {
   print_method(PHASE_INCREMENTAL_INLINE_CLEANUP, 3);
 }
 
+void Compile::print_late_inline_failures(const char* msg) {
+  bool do_print_inlining = print_inlining() || print_intrinsics();
+  if (do_print_inlining || log() != nullptr) {
+    for (int i = 0; i < _late_inlines.length(); i++) {
+      CallGenerator* cg = _late_inlines.at(i);
+      if (do_print_inlining) {
+        cg->print_inlining_late(msg);
+      }
+      log_late_inline_failure(cg, msg);
+    }
+  }
+}
+
+// Once C2CompileTimeBudget is used up, the remaining rounds of optimizations
+// that are not needed for correct code are skipped.
+bool Compile::over_time_budget() {
+  if (_time_budget_end == 0 || _time_budget_exceeded) {
+    return _time_budget_exceeded;
+  }
+  if (os::javaTimeNanos() > _time_budget_end) {
+    _time_budget_exceeded = true;
+    _loop_opts_cnt = 0;
+    if (log() != nullptr) {
+      log()->elem("time_budget_exceeded nodes='%d' live='%d'", unique(), live_nodes());
+    }
+  }
+  return _time_budget_exceeded;
+}
+
 // Perform incremental inlining until bound on number of live nodes is reached
 void Compile::inline_incrementally(PhaseIterGVN& igvn) {
   TracePhase tp("incrementalInline", &timers[_t_incrInline]);
@@ -2087,22 +2159,17 @@ void Compile::inline_incrementally(PhaseIterGVN& igvn) {
       }
 
       if (live_nodes() > (uint)LiveNodeCountInliningCutoff) {
-        bool do_print_inlining = print_inlining() || print_intrinsics();
-        if (do_print_inlining || log() != nullptr) {
-          // Print inlining message for candidates that we couldn't inline for lack of space.
-          for (int i = 0; i < _late_inlines.length(); i++) {
-            CallGenerator* cg = _late_inlines.at(i);
-            const char* msg = "live nodes > LiveNodeCountInliningCutoff";
-            if (do_print_inlining) {
-              cg->print_inlining_late(msg);
-            }
-            log_late_inline_failure(cg, msg);
-          }
-        }
+        // Print inlining message for candidates that we couldn't inline for lack of space.
+        print_late_inline_failures("live nodes > LiveNodeCountInliningCutoff");
         break; // finish
       }
     }
 
+    if (over_time_budget()) {
+      print_late_inline_failures("C2CompileTimeBudget exceeded");
+      break; // finish
+    }
+
     igvn_worklist()->ensure_empty(); // should be done with igvn
 
     while (inline_incrementally_one()) {
@@ -2159,7 +2226,7 @@ void Compile::process_late_inline_calls_no_inline(PhaseIterGVN& igvn) {
 
 bool Compile::optimize_loops(PhaseIterGVN& igvn, LoopOptsMode mode) {
   if (_loop_opts_cnt > 0) {
-    while (major_progress() && (_loop_opts_cnt > 0)) {
+    while (major_progress() && !over_time_budget() && (_loop_opts_cnt > 0)) {
       TracePhase tp("idealLoop", &timers[_t_idealLoop]);
       PhaseIdealLoop::optimize(igvn, mode);
       _loop_opts_cnt--;
@@ -2337,6 +2404,7 @@ void Compile::Optimize() {
         if (failing())  return;
       }
       progress = do_iterative_escape_analysis() &&
+                 !over_time_budget() &&
                  (macro_count() < mcount) &&
                  ConnectionGraph::has_candidates(this);
       // Try again if candidates exist and made progress
@@ -2348,7 +2416,7 @@ void Compile::Optimize() {
   // peeling, unrolling, etc.
 
   // Set loop opts counter
-  if((_loop_opts_cnt > 0) && (has_loops() || has_split_ifs())) {
+  if (!over_time_budget() && (_loop_opts_cnt > 0) && (has_loops() || has_split_ifs())) {
     {
       TracePhase tp("idealLoop", &timers[_t_idealLoop]);
       PhaseIdealLoop::optimize(igvn, LoopOptsDefault);
@@ -2357,7 +2425,7 @@ void Compile::Optimize() {
       if (failing())  return;
     }
     // Loop opts pass if partial peeling occurred in previous pass
-    if(PartialPeelLoop && major_progress() && (_loop_opts_cnt > 0)) {
+    if(PartialPeelLoop && major_progress() && !over_time_budget() && (_loop_opts_cnt > 0)) {
       TracePhase tp("idealLoop", &timers[_t_idealLoop]);
       PhaseIdealLoop::optimize(igvn, LoopOptsSkipSplitIf);
       _loop_opts_cnt--;
@@ -2365,7 +2433,7 @@ void Compile::Optimize() {
       if (failing())  return;
     }
     // Loop opts pass for loop-unrolling before CCP
-    if(major_progress() && (_loop_opts_cnt > 0)) {
+    if(major_progress() && !over_time_budget() && (_loop_opts_cnt > 0)) {
       TracePhase tp("idealLoop", &timers[_t_idealLoop]);
       PhaseIdealLoop::optimize(igvn, LoopOptsSkipSplitIf);
       _loop_opts_cnt--;
@@ -4342,6 +4410,9 @@ Compile::TracePhase::TracePhase(const char* name, elapsedTimer* accumulator)
   : TraceTime(name, accumulator, CITime, CITimeVerbose),
     _phase_name(name), _dolog(CITimeVerbose)
 {
+  if (EventCompilerTimerPhase::is_enabled()) {
+    _start_time = Ticks::now();
+  }
   if (_dolog) {
     C = Compile::current();
     _log = C->log();
@@ -4379,6 +4450,11 @@ Compile::TracePhase::~TracePhase() {
   if (_log != nullptr) {
     _log->done("phase name='%s' nodes='%d' live='%d'", _phase_name, C->unique(), C->live_nodes());
   }
+
+  EventCompilerTimerPhase event;
+  if (event.should_commit() && _start_time.value() != 0 && _phase_name[0] != '\0') {
+    CompilerEvent::TimerPhaseEvent::post(event, _start_time, _phase_name, C->compile_id(), C->live_nodes());
+  }
 }
 
 //----------------------------static_subtype_check-----------------------------
@@ -229,6 +229,7 @@ class Compile : public Phase {
     CompileLog* _log;
     const char* _phase_name;
     bool _dolog;
+    Ticks _start_time;          // For the CompilerTimerPhase event
    public:
     TracePhase(const char* name, elapsedTimer* accumulator);
     ~TracePhase();
@@ -342,6 +343,8 @@ class Compile : public Phase {
   bool                  _has_monitors;          // Metadata transfered to nmethod to enable Continuations lock-detection fastpath
   RTMState              _rtm_state;             // State of Restricted Transactional Memory usage
   int                   _loop_opts_cnt;         // loop opts round
+  jlong                 _time_budget_end;       // os::javaTimeNanos() at which C2CompileTimeBudget is used up, or 0
+  bool                  _time_budget_exceeded;  // Remaining optimization rounds are skipped
   bool                  _clinit_barrier_on_entry; // True if clinit barrier is needed on nmethod entry
   uint                  _stress_seed;           // Seed for stress testing
 
@@ -923,6 +926,9 @@ class Compile : public Phase {
   CallGenerator*    call_generator(ciMethod* call_method, int vtable_index, bool call_does_dispatch,
                                    JVMState* jvms, bool allow_inline, float profile_factor, ciKlass* speculative_receiver_type = nullptr,
                                    bool allow_intrinsics = true);
+  CallGenerator*    call_generator_for_polymorphic_site(ciMethod* caller, int bci, ciMethod* callee, int vtable_index,
+                                                        JVMState* jvms, bool allow_inline, float prof_factor,
+                                                        ciCallProfile& profile);
   bool should_delay_inlining(ciMethod* call_method, JVMState* jvms) {
     return should_delay_string_inlining(call_method, jvms) ||
            should_delay_boxing_inlining(call_method, jvms) ||
@@ -1042,6 +1048,8 @@ class Compile : public Phase {
   void dec_number_of_mh_late_inlines() { assert(_number_of_mh_late_inlines > 0, "_number_of_mh_late_inlines < 0 !"); _number_of_mh_late_inlines--; }
   bool has_mh_late_inlines() const     { return _number_of_mh_late_inlines > 0; }
 
+  bool over_time_budget();
+  void print_late_inline_failures(const char* msg);
   bool inline_incrementally_one();
   void inline_incrementally_cleanup(PhaseIterGVN& igvn);
   void inline_incrementally(PhaseIterGVN& igvn);
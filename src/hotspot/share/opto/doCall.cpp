@@ -232,6 +232,16 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
           speculative_receiver_type = nullptr;
         }
       }
+      if (speculative_receiver_type == nullptr && morphism > 2 && UsePolymorphicInlining) {
+        // All receiver types seen at this call site are recorded in the
+        // profile: dispatch with a chain of exact type checks, one for
+        // each receiver, instead of a vtable or itable call.
+        CallGenerator* cg = call_generator_for_polymorphic_site(caller, bci, callee, vtable_index,
+                                                                jvms, allow_inline, prof_factor, profile);
+        if (cg != nullptr) {
+          return cg;
+        }
+      }
       if (receiver_method == nullptr &&
           (have_major_receiver || morphism == 1 ||
            (morphism == 2 && UseBimorphicInlining))) {
@@ -382,6 +392,54 @@ CallGenerator* Compile::call_generator(ciMethod* callee, int vtable_index, bool
   }
 }
 
+// Build a chain of predicted calls, one for each receiver type in a complete
+// call profile, with the most frequent receiver checked first. The final miss
+// path traps, or falls back to a virtual call if that trap happened too often.
+// Returns null if any of the receivers does not resolve to a method.
+CallGenerator* Compile::call_generator_for_polymorphic_site(ciMethod* caller, int bci, ciMethod* callee, int vtable_index,
+                                                            JVMState* jvms, bool allow_inline, float prof_factor,
+                                                            ciCallProfile& profile) {
+  int morphism = profile.morphism();
+  assert(morphism > 2, "monomorphic and bimorphic call sites are handled separately");
+
+  CallGenerator* hit_cgs[ciCallProfile::MorphismLimit];
+  for (int i = 0; i < morphism; i++) {
+    ciMethod* receiver_method = callee->resolve_invoke(jvms->method()->holder(), profile.receiver(i));
+    if (receiver_method == nullptr) {
+      return nullptr;
+    }
+    hit_cgs[i] = call_generator(receiver_method, vtable_index, false /* call_does_dispatch */,
+                                jvms, allow_inline, prof_factor);
+    if (hit_cgs[i] == nullptr) {
+      return nullptr;
+    }
+  }
+
+  CallGenerator* miss_cg;
+  // Reason_bimorphic covers type check failures at all call sites with a complete profile.
+  if (!too_many_traps_or_recompiles(caller, bci, Deoptimization::Reason_bimorphic)) {
+    miss_cg = CallGenerator::for_uncommon_trap(callee, Deoptimization::Reason_bimorphic,
+                                               Deoptimization::Action_maybe_recompile);
+  } else {
+    miss_cg = (IncrementalInlineVirtual ? CallGenerator::for_late_inline_virtual(callee, vtable_index, prof_factor)
+                                        : CallGenerator::for_virtual_call(callee, vtable_index));
+  }
+
+  // Build the chain from the least frequent receiver up, so that each check's
+  // probability is relative to the receivers remaining after the earlier checks.
+  int remaining_count = 0;
+  for (int i = morphism - 1; i >= 0 && miss_cg != nullptr; i--) {
+    int receiver_count = profile.receiver_count(i);
+    remaining_count = saturated_add(remaining_count, receiver_count);
+    float hit_prob = (i == morphism - 1) ? PROB_MAX : (float)receiver_count / (float)remaining_count;
+    trace_type_profile(C, jvms->method(), jvms->depth() - 1, jvms->bci(), hit_cgs[i]->method(),
+                       profile.receiver(i), profile.count(), receiver_count);
+    // The dependency on the receiver is recorded by Parse::Parse() when inlining.
+    miss_cg = CallGenerator::for_predicted_call(profile.receiver(i), miss_cg, hit_cgs[i], hit_prob);
+  }
+  return miss_cg;
+}
+
 // Return true for methods that shouldn't be inlined early so that
 // they are easier to analyze and optimize as intrinsics.
 bool Compile::should_delay_string_inlining(ciMethod* call_method, JVMState* jvms) {
@@ -492,6 +550,42 @@ static bool check_call_consistency(JVMState* jvms, CallGenerator* cg) {
 }
 #endif // ASSERT
 
+//---------------------------should_trap_cold_escaping_call--------------------
+// All objects passed to a call that is not inlined escape, even if the call is
+// only executed rarely, e.g. on an error path. If such a cold call takes an
+// object allocated in this compilation, replace the call by an uncommon trap:
+// escape analysis may then scalar replace the object, and deoptimization
+// materializes it (see SafePointScalarObjectNode) if the cold path is taken.
+bool Parse::should_trap_cold_escaping_call(CallGenerator* cg, int nargs) {
+  if (!TrapColdEscapingCalls || !DoEscapeAnalysis || !EliminateAllocations) {
+    return false;
+  }
+  if (cg->is_inline() || cg->is_late_inline() || cg->is_intrinsic() || cg->is_trap()) {
+    return false; // Arguments do not necessarily escape
+  }
+  if (too_many_traps(Deoptimization::Reason_unreached)) {
+    return false;
+  }
+  ciMethodData* md = method()->method_data_or_null();
+  if (md == nullptr || !md->is_mature()) {
+    return false;
+  }
+  int invocations = method()->interpreter_invocation_count();
+  int site_count = method()->call_profile_at_bci(bci()).count();
+  if (invocations <= 0 || site_count < 0 ||
+      (double)site_count * 100 >= (double)invocations * ColdEscapingCallPercent) {
+    return false;
+  }
+  for (int i = 0; i < nargs; i++) {
+    Node* arg = argument(i);
+    if (_gvn.type(arg)->isa_oopptr() != nullptr &&
+        AllocateNode::Ideal_allocation(arg, &_gvn) != nullptr) {
+      return true;
+    }
+  }
+  return false;
+}
+
 //------------------------------do_call----------------------------------------
 // Handle your basic call.  Inline if we can & want to, else just setup call.
 void Parse::do_call() {
@@ -630,6 +724,14 @@ void Parse::do_call() {
   // NOTE:  Don't use orig_callee and callee after this point!  Use cg->method() instead.
   orig_callee = callee = nullptr;
 
+  if (should_trap_cold_escaping_call(cg, nargs)) {
+    inc_sp(nargs);              // The interpreter re-executes the call with its args
+    uncommon_trap(Deoptimization::Reason_unreached,
+                  Deoptimization::Action_reinterpret,
+                  nullptr, "cold escaping call");
+    return;
+  }
+
   // ---------------------
   // Round double arguments before call
   round_double_arguments(cg->method());
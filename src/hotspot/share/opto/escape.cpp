@@ -974,7 +974,17 @@ void ConnectionGraph::add_call_node(CallNode* call) {
         if (length < 0) {
           // Not scalar replaceable if the length is not constant.
           scalar_replaceable = false;
-          NOT_PRODUCT(nsr_reason = "has a non-constant length");
+#ifndef PRODUCT
+          // Distinguish lengths that are bounded by the size limit: such
+          // arrays would need the actual length recorded in the debug info
+          // to be scalar replaced.
+          const TypeInt* length_t = _igvn->type(call->in(AllocateNode::ALength))->isa_int();
+          if (length_t != nullptr && length_t->_hi <= EliminateAllocationArraySizeLimit) {
+            nsr_reason = "has a non-constant but bounded length";
+          } else {
+            nsr_reason = "has a non-constant length";
+          }
+#endif
         } else if (length > EliminateAllocationArraySizeLimit) {
           // Not scalar replaceable if the length is too big.
           scalar_replaceable = false;
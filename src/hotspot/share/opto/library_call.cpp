@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1999, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1999, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -26,10 +26,13 @@
 #include "asm/macroAssembler.hpp"
 #include "ci/ciUtilities.inline.hpp"
 #include "classfile/vmIntrinsics.hpp"
+#include "classfile/vmSymbols.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compileLog.hpp"
 #include "gc/shared/barrierSet.hpp"
 #include "jfr/support/jfrIntrinsics.hpp"
+#include "logging/log.hpp"
+#include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
 #include "oops/klass.inline.hpp"
 #include "oops/objArrayKlass.hpp"
@@ -162,6 +165,19 @@ JVMState* LibraryIntrinsic::generate(JVMState* jvms) {
       tty->print("%s", msg);
     }
   }
+  if (vmIntrinsics::class_for(intrinsic_id()) == VM_SYMBOL_ENUM_NAME(jdk_internal_vm_vector_VectorSupport)) {
+    // Vector API operations that are not intrinsified run the much slower Java
+    // fallback implementation. Make that visible without diagnostic flags; the
+    // reason for the rejection is printed with -XX:+PrintIntrinsics.
+    LogTarget(Info, jit, vectorization) lt;
+    if (lt.is_enabled()) {
+      ResourceMark rm;
+      LogStream ls(lt);
+      ls.print("Vector intrinsic %s not generated at bci:%d in ", vmIntrinsics::name_at(intrinsic_id()), bci);
+      (jvms->has_method() ? jvms->method() : callee)->print_short_name(&ls);
+      ls.print_cr(", using Java fallback");
+    }
+  }
   C->gather_intrinsic_statistics(intrinsic_id(), is_virtual(), Compile::_intrinsic_failed);
   C->print_inlining_update(this);
 
@@ -2934,6 +2934,26 @@ void OuterStripMinedLoopNode::fix_sunk_stores(CountedLoopEndNode* inner_cle, Loo
   }
 }
 
+// Number of iterations of the original loop body to run between safepoint
+// polls. LoopStripMiningIter is meant to bound the time to safepoint for a
+// typical loop body; a loop whose body is much smaller than the unrolling
+// limit runs the same number of iterations in a fraction of that time, so
+// with UseAdaptiveLoopStripMining its strips are made longer.
+jlong OuterStripMinedLoopNode::strip_mined_iters(CountedLoopNode* inner_cl) {
+  jlong iters = (jlong)LoopStripMiningIter;
+  if (UseAdaptiveLoopStripMining && inner_cl->node_count_before_unroll() > 0) {
+    // The node count was recorded before the last round of unrolling, when the
+    // body held half of the current copies of the original body.
+    int body_size = MAX2(inner_cl->node_count_before_unroll() * 2 / inner_cl->unrolled_count(), 1);
+    const int max_scale = 4;
+    int scale = MIN2((int)(LoopUnrollLimit / body_size), max_scale);
+    if (scale > 1) {
+      iters *= scale;
+    }
+  }
+  return iters;
+}
+
 void OuterStripMinedLoopNode::adjust_strip_mined_loop(PhaseIterGVN* igvn) {
   // Look for the outer & inner strip mined loop, reduce number of
   // iterations of the inner loop, set exit condition of outer loop,
@@ -2959,7 +2979,7 @@ void OuterStripMinedLoopNode::adjust_strip_mined_loop(PhaseIterGVN* igvn) {
   CountedLoopEndNode* inner_cle = inner_cl->loopexit();
 
   int stride = inner_cl->stride_con();
-  jlong scaled_iters_long = ((jlong)LoopStripMiningIter) * ABS(stride);
+  jlong scaled_iters_long = strip_mined_iters(inner_cl) * ABS(stride);
   int scaled_iters = (int)scaled_iters_long;
   int short_scaled_iters = LoopStripMiningIterShortLoop* ABS(stride);
   const TypeInt* inner_iv_t = igvn->type(inner_iv_phi)->is_int();
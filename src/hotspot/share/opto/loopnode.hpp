@@ -562,6 +562,7 @@ public:
   virtual IfFalseNode* outer_loop_exit() const;
   virtual SafePointNode* outer_safepoint() const;
   void adjust_strip_mined_loop(PhaseIterGVN* igvn);
+  static jlong strip_mined_iters(CountedLoopNode* inner_cl);
 
   void remove_outer_loop_and_safepoint(PhaseIterGVN* igvn) const;
 
@@ -1517,6 +1518,9 @@ public:
   // Attempt to use a conditional move instead of a phi/branch
   Node *conditional_move( Node *n );
 
+  // Attempt to turn a conditionally updated reduction into an unconditional one
+  Node* conditional_reduction(Node* region);
+
   // Check for aggressive application of 'split-if' optimization,
   // using basic block level info.
   void  split_if_with_blocks     ( VectorSet &visited, Node_Stack &nstack);
@@ -819,6 +819,130 @@ Node *PhaseIdealLoop::conditional_move( Node *region ) {
   return iff->in(1);
 }
 
+//------------------------------conditional_reduction--------------------------
+// Attempt to replace a Phi that merges a reduction of an innermost counted
+// loop with its conditional update by an unconditional reduction, so that
+// SuperWord can vectorize the loop:
+//
+//   if (c)     { s += x; }   =>   s += (c ? x : 0)
+//   if (x > s) { s = x; }    =>   s = max(s, x)
+//
+// In contrast to conditional_move, the branch probability does not matter:
+// a vectorized loop evaluates both arms anyway. This only holds if the loop
+// is vectorized, so the rewrite is restricted to main loops whose body passed
+// SuperWord's unrolling analysis and for which the new reduction (and CMove)
+// have vector forms at the analyzed vector length. Other loops are left to
+// conditional_move and its profitability checks. The conditional add needs
+// vectorized CMoves (UseVectorCmov).
+Node* PhaseIdealLoop::conditional_reduction(Node* region) {
+  assert(region->is_Region(), "sanity check");
+  if (!UseSuperWord || !SuperWordReductions || region->req() != 3) {
+    return nullptr;
+  }
+
+  // Check for CFG diamond without ops pinned in an arm
+  Node* lp = region->in(1);
+  Node* rp = region->in(2);
+  if (lp == nullptr || rp == nullptr) return nullptr;
+  Node* lp_c = lp->in(0);
+  if (lp_c == nullptr || lp_c != rp->in(0) || !lp_c->is_If()) return nullptr;
+  if (lp->outcnt() > 1 || rp->outcnt() > 1) return nullptr;
+  IfNode* iff = lp_c->as_If();
+  Node* bol = iff->in(1);
+  if (!bol->is_Bool()) return nullptr; // E.g. Opaque4 of loop predicates
+  int cmp_op = bol->in(1)->Opcode();
+  if (cmp_op != Op_CmpI && cmp_op != Op_CmpL) return nullptr;
+
+  IdealLoopTree* r_loop = get_loop(region);
+  if (!r_loop->_head->is_CountedLoop() || r_loop->_child != nullptr) return nullptr;
+  CountedLoopNode* head = r_loop->_head->as_CountedLoop();
+  if (!head->is_main_loop() || !head->has_passed_slp() || head->slp_max_unroll() < 2) {
+    return nullptr; // SuperWord is not expected to vectorize the loop
+  }
+  uint vlen = (uint)head->slp_max_unroll();
+
+  // The region must merge exactly one Phi: a reduction of the loop on one
+  // side and its update on the other.
+  PhiNode* phi = nullptr;
+  for (DUIterator_Fast imax, i = region->fast_outs(imax); i < imax; i++) {
+    Node* out = region->fast_out(i);
+    if (out->is_Phi()) {
+      if (phi != nullptr) return nullptr;
+      phi = out->as_Phi();
+    }
+  }
+  if (phi == nullptr) return nullptr;
+  BasicType bt = phi->type()->basic_type();
+  if (bt != T_INT && bt != T_LONG) return nullptr;
+  // The vectorized condition compares lanes of the width of the reduction,
+  // so the compared values must be of the type of the reduction.
+  if ((bt == T_INT) != (cmp_op == Op_CmpI)) return nullptr;
+
+  Node* cmov_ctrl = iff->in(0);
+  uint flip = (lp->Opcode() == Op_IfTrue);
+  Node* val_f = phi->in(1 + flip);
+  Node* val_t = phi->in(2 - flip);
+  bool s_is_f = val_f->is_Phi() && val_f->in(0) == head;
+  bool s_is_t = val_t->is_Phi() && val_t->in(0) == head;
+  if (s_is_f == s_is_t) return nullptr;
+  Node* s   = s_is_f ? val_f : val_t;
+  if (s == head->phi()) return nullptr;
+  Node* upd = s_is_f ? val_t : val_f;
+
+  Node* result = nullptr;
+  Node* cmp = bol->in(1);
+  BoolTest::mask test = bol->as_Bool()->_test._test;
+  if (bt == T_INT && cmp_op == Op_CmpI &&
+      ((cmp->in(1) == s && cmp->in(2) == upd) || (cmp->in(1) == upd && cmp->in(2) == s)) &&
+      (test == BoolTest::gt || test == BoolTest::ge || test == BoolTest::lt || test == BoolTest::le)) {
+    // Select between the compared values: (a > b) ? a : b is max(a, b).
+    bool true_is_first = (val_t == cmp->in(1));
+    bool greater = (test == BoolTest::gt || test == BoolTest::ge);
+    bool is_max = (greater == true_is_first);
+    if (!ReductionNode::implemented(is_max ? Op_MaxI : Op_MinI, vlen, T_INT)) {
+      return nullptr;
+    }
+    if (is_max) {
+      result = new MaxINode(s, upd);
+    } else {
+      result = new MinINode(s, upd);
+    }
+  } else if (UseVectorCmov && upd->Opcode() == (bt == T_INT ? Op_AddI : Op_AddL) &&
+             upd->outcnt() == 1 && (upd->in(1) == s || upd->in(2) == s)) {
+    if (!ReductionNode::implemented(upd->Opcode(), vlen, bt) ||
+        !VectorNode::implemented(bt == T_INT ? Op_CMoveI : Op_CMoveL, vlen, bt)) {
+      return nullptr;
+    }
+    Node* x = (upd->in(1) == s) ? upd->in(2) : upd->in(1);
+    if (!is_dominator(get_ctrl(x), cmov_ctrl)) {
+      return nullptr; // More than the add is computed in the arm
+    }
+    Node* zero = _igvn.zerocon(bt);
+    set_ctrl(zero, C->root());
+    const Type* t = (bt == T_INT) ? (const Type*)TypeInt::INT : (const Type*)TypeLong::LONG;
+    Node* cmov = CMoveNode::make(cmov_ctrl, bol, s_is_f ? zero : x, s_is_f ? x : zero, t);
+    register_new_node(cmov, cmov_ctrl);
+    result = AddNode::make(s, cmov, bt);
+  } else {
+    return nullptr;
+  }
+
+  register_new_node(result, cmov_ctrl);
+  _igvn.replace_node(phi, result);
+#ifndef PRODUCT
+  if (TraceLoopOpts) {
+    tty->print("CondReduction %s ", result->Name());
+    r_loop->dump_head();
+  }
+#endif
+
+  // The useless CFG diamond will fold up later; see the optimization in
+  // RegionNode::Ideal.
+  _igvn._worklist.push(region);
+
+  return bol;
+}
+
 static void enqueue_cfg_uses(Node* m, Unique_Node_List& wq) {
   for (DUIterator_Fast imax, i = m->fast_outs(imax); i < imax; i++) {
     Node* u = m->fast_out(i);
@@ -1046,7 +1170,10 @@ Node *PhaseIdealLoop::split_if_with_blocks_pre( Node *n ) {
   }
   // Attempt to use a conditional move instead of a phi/branch
   if (ConditionalMoveLimit > 0 && n_op == Op_Region) {
-    Node *cmov = conditional_move( n );
+    Node *cmov = conditional_reduction(n);
+    if (cmov == nullptr) {
+      cmov = conditional_move( n );
+    }
     if (cmov) {
       return cmov;
     }
@@ -1533,6 +1533,77 @@ static bool stable_phi(PhiNode* phi, PhaseGVN *phase) {
   }
   return true;
 }
+
+// Step from 'mem' through MergeMems and through stores that provably do not
+// write [offset, offset + size_in_bytes) of any object, and return the first
+// memory state that cannot be stepped over. Only precise offsets of non-raw
+// accesses are compared, so the result holds for arbitrary bases, in
+// particular for bases computed in different iterations of a loop.
+static Node* step_through_stores_to_other_offsets(Node* mem, intptr_t offset, intptr_t size_in_bytes,
+                                                  int alias_idx, PhaseGVN* phase) {
+  int cnt = 50;             // Cycle limiter
+  while (--cnt >= 0) {
+    if (mem->is_MergeMem()) {
+      mem = mem->as_MergeMem()->memory_at(alias_idx);
+    } else if (mem->is_Store()) {
+      if (mem->req() > MemNode::ValueIn + 1) {
+        return mem; // e.g. scatter stores
+      }
+      Node* st_adr = mem->in(MemNode::Address);
+      intptr_t st_offset = 0;
+      Node* st_base = AddPNode::Ideal_base_and_offset(st_adr, phase, st_offset);
+      if (st_base == nullptr || st_offset == Type::OffsetBot ||
+          MemNode::check_if_adr_maybe_raw(st_adr)) {
+        return mem;
+      }
+      const int MAX_STORE = MAX2(BytesPerLong, (int)MaxVectorSize);
+      if (st_offset >= offset + size_in_bytes ||
+          st_offset <= offset - MAX_STORE ||
+          st_offset <= offset - mem->as_Store()->memory_size()) {
+        mem = mem->in(MemNode::Memory);
+      } else {
+        return mem;
+      }
+    } else {
+      return mem;
+    }
+  }
+  return nullptr;
+}
+
+Node* LoadNode::find_loop_entry_memory(PhaseGVN* phase) {
+  if (req() > 3) {
+    return nullptr; // e.g. gather loads
+  }
+  Node* adr = in(MemNode::Address);
+  intptr_t offset = 0;
+  Node* base = AddPNode::Ideal_base_and_offset(adr, phase, offset);
+  if (base == nullptr || offset == Type::OffsetBot || check_if_adr_maybe_raw(adr)) {
+    return nullptr;
+  }
+  int alias_idx = phase->C->get_alias_index(adr_type());
+  if (alias_idx == Compile::AliasIdxBot || alias_idx == Compile::AliasIdxRaw) {
+    return nullptr;
+  }
+
+  Node* mem = step_through_stores_to_other_offsets(in(MemNode::Memory), offset, memory_size(), alias_idx, phase);
+  if (mem == nullptr || !mem->is_Phi() || mem->req() != 3 ||
+      mem->in(0) == nullptr || !mem->in(0)->is_Loop()) {
+    return nullptr;
+  }
+  PhiNode* phi = mem->as_Phi();
+  if (!stable_phi(phi, phase) || phase->is_IterGVN()->_worklist.member(phi)) {
+    return nullptr; // Wait stable graph
+  }
+  // All memory effects of one iteration must be stores to other offsets.
+  Node* backedge_mem = step_through_stores_to_other_offsets(phi->in(LoopNode::LoopBackControl), offset,
+                                                            memory_size(), alias_idx, phase);
+  if (backedge_mem != phi) {
+    return nullptr;
+  }
+  return phi->in(LoopNode::EntryControl);
+}
+
 //------------------------------split_through_phi------------------------------
 // Split instance or boxed field load through Phi.
 Node* LoadNode::split_through_phi(PhaseGVN* phase) {
@@ -1821,6 +1892,16 @@ Node *LoadNode::Ideal(PhaseGVN *phase, bool can_reshape) {
         if (result != nullptr) return result;
       }
     }
+
+    if (OptimizeLoopInvariantLoads) {
+      // Bypass the memory Phi of a loop that doesn't write the loaded location
+      // so that the load becomes loop invariant.
+      Node* entry_mem = find_loop_entry_memory(phase);
+      if (entry_mem != nullptr && entry_mem != mem) {
+        set_req_X(MemNode::Memory, entry_mem, phase);
+        return this;
+      }
+    }
   }
 
   // Is there a dominating load that loads the same value?  Leave
@@ -247,6 +247,10 @@ public:
   // Split instance field load through Phi.
   Node* split_through_phi(PhaseGVN *phase);
 
+  // Memory state on entry of the loop whose memory Phi this load depends on,
+  // if no store in the loop may write the loaded location.
+  Node* find_loop_entry_memory(PhaseGVN* phase);
+
   // Recover original value from boxed values
   Node *eliminate_autobox(PhaseIterGVN *igvn);
 
@@ -521,6 +521,10 @@ class Parse : public GraphKit {
   // Helper function to setup Ideal Call nodes
   void do_call();
 
+  // Helper function to decide if a rarely executed call should be replaced
+  // by an uncommon trap to keep its arguments from escaping
+  bool should_trap_cold_escaping_call(CallGenerator* cg, int nargs);
+
   // Helper function to uncommon-trap or bailout for non-compilable call-sites
   bool can_not_compile_call_site(ciMethod *dest_method, ciInstanceKlass *klass);
 
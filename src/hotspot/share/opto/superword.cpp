@@ -2063,7 +2063,11 @@ bool SuperWord::implemented(Node_List* p) {
       return false;
     } else if (p0->is_Cmp()) {
       // Cmp -> Bool -> Cmove
-      retValue = UseVectorCmov;
+      // VectorMaskCmp is created with the signed BoolTest of the Bool, so
+      // unsigned and pointer compares cannot be vectorized this way.
+      retValue = UseVectorCmov &&
+                 (opc == Op_CmpI || opc == Op_CmpL || opc == Op_CmpF || opc == Op_CmpD) &&
+                 Matcher::match_rule_supported_vector(Op_VectorMaskCmp, size, velt_basic_type(p0));
     } else if (requires_long_to_int_conversion(opc)) {
       // Java API for Long.bitCount/numberOfLeadingZeros/numberOfTrailingZeros
       // returns int type, but Vector API for them returns long type. To unify
@@ -2208,6 +2212,10 @@ bool SuperWord::profitable(Node_List* p) {
     if (cmp == nullptr || my_pack(cmp) == nullptr) {
       return false;
     }
+    // The mask from the compare must have the lane size of the blended values
+    if (type2aelembytes(velt_basic_type(cmp)) != type2aelembytes(velt_basic_type(p0))) {
+      return false;
+    }
   }
   return true;
 }
@@ -2672,12 +2680,11 @@ bool SuperWord::output() {
     return false;
   }
 
-  Node* vmask = nullptr;
+  Node* vmasks[4] = { nullptr, nullptr, nullptr, nullptr };
   if (cl->is_rce_post_loop() && do_reserve_copy()) {
-    // Create a vector mask node for post loop, bail out if not created
-    vmask = create_post_loop_vmask();
-    if (vmask == nullptr) {
-      // create_post_loop_vmask checks many conditions, any of them could fail
+    // Create the vector mask nodes for post loop, bail out if not created
+    if (!create_post_loop_vmasks(vmasks)) {
+      // create_post_loop_vmasks checks many conditions, any of them could fail
       return false; // and reverse to backup IG
     }
   }
@@ -2716,7 +2723,7 @@ bool SuperWord::output() {
         Node* adr = first->in(MemNode::Address);
         const TypePtr* atyp = n->adr_type();
         if (cl->is_rce_post_loop()) {
-          assert(vmask != nullptr, "vector mask should be generated");
+          Node* vmask = post_loop_vmask(vmasks, n);
           const TypeVect* vt = TypeVect::make(velt_basic_type(n), vlen);
           vn = new LoadVectorMaskedNode(ctl, mem, adr, atyp, vt, vmask);
         } else {
@@ -2740,8 +2747,7 @@ bool SuperWord::output() {
         Node* adr = first->in(MemNode::Address);
         const TypePtr* atyp = n->adr_type();
         if (cl->is_rce_post_loop()) {
-          assert(vmask != nullptr, "vector mask should be generated");
-          const TypeVect* vt = TypeVect::make(velt_basic_type(n), vlen);
+          Node* vmask = post_loop_vmask(vmasks, n);
           vn = new StoreVectorMaskedNode(ctl, mem, adr, val, atyp, vmask);
         } else {
           vn = StoreVectorNode::make(opc, ctl, mem, adr, atyp, val, vlen);
@@ -3036,10 +3042,10 @@ bool SuperWord::output() {
   return true;
 }
 
-//-------------------------create_post_loop_vmask-------------------------
-// Check the post loop vectorizability and create a vector mask if yes.
-// Return null to bail out if post loop is not vectorizable.
-Node* SuperWord::create_post_loop_vmask() {
+//-------------------------create_post_loop_vmasks-------------------------
+// Check the post loop vectorizability and create vector masks if yes.
+// Return false to bail out if post loop is not vectorizable.
+bool SuperWord::create_post_loop_vmasks(Node** vmasks) {
   CountedLoopNode *cl = lpt()->_head->as_CountedLoop();
   assert(cl->is_rce_post_loop(), "Must be an rce post loop");
   assert(!is_marked_reduction_loop(), "no vector reduction in post loop");
@@ -3059,7 +3065,7 @@ Node* SuperWord::create_post_loop_vmask() {
     Node* n = p->at(0);
     BasicType bt = velt_basic_type(n);
     if (!is_java_primitive(bt)) {
-      return nullptr;
+      return false;
     }
     if (n->is_Mem()) {
       SWPointer* mem_p = new (_arena) SWPointer(n->as_Mem(), this, nullptr, false);
@@ -3068,23 +3074,20 @@ Node* SuperWord::create_post_loop_vmask() {
       // With this, Only positive scales exist in counting-up loops and
       // negative scales exist in counting-down loops.
       if (mem_p->scale_in_bytes() != type2aelembytes(bt) * cl->stride_con()) {
-        return nullptr;
+        return false;
       }
       swptrs.append(mem_p);
     }
     stats.record_size(type2aelembytes(bt));
   }
 
-  // Find the vector data type for generating vector masks. Currently we
-  // don't support post loops with mixed vector data sizes
-  int unique_size = stats.unique_size();
-  BasicType vmask_bt;
-  switch (unique_size) {
-    case 1:  vmask_bt = T_BYTE; break;
-    case 2:  vmask_bt = T_SHORT; break;
-    case 4:  vmask_bt = T_INT; break;
-    case 8:  vmask_bt = T_LONG; break;
-    default: return nullptr;
+  // All vectors in the post loop have the same number of elements as the
+  // main loop vectors, so the largest element size determines the vector
+  // width. Smaller elements, e.g. of the bytes in a byte to int conversion
+  // loop, use correspondingly narrower vectors and masks.
+  int largest_size = stats.largest_size();
+  if (largest_size <= 0) {
+    return false;
   }
 
   // Currently we can't remove this MaxVectorSize constraint. Without it,
@@ -3093,20 +3096,29 @@ Node* SuperWord::create_post_loop_vmask() {
   // vectorized main loop. We should re-engineer PostLoopMultiversioning
   // to fix this problem.
   int vlen = cl->slp_max_unroll();
-  if (unique_size * vlen != MaxVectorSize) {
-    return nullptr;
+  if (largest_size * vlen != MaxVectorSize) {
+    return false;
   }
 
   // Bail out if target doesn't support mask generator or masked load/store
-  if (!Matcher::match_rule_supported_vector(Op_LoadVectorMasked, vlen, vmask_bt)  ||
-      !Matcher::match_rule_supported_vector(Op_StoreVectorMasked, vlen, vmask_bt) ||
-      !Matcher::match_rule_supported_vector(Op_VectorMaskGen, vlen, vmask_bt)) {
-    return nullptr;
+  // for any of the element sizes
+  static const BasicType vmask_bts[] = { T_BYTE, T_SHORT, T_INT, T_LONG };
+  for (int i = 0; i < 4; i++) {
+    BasicType vmask_bt = vmask_bts[i];
+    if (!stats.has_size(type2aelembytes(vmask_bt))) {
+      continue;
+    }
+    if (vlen < Matcher::min_vector_size(vmask_bt) ||
+        !Matcher::match_rule_supported_vector(Op_LoadVectorMasked, vlen, vmask_bt)  ||
+        !Matcher::match_rule_supported_vector(Op_StoreVectorMasked, vlen, vmask_bt) ||
+        !Matcher::match_rule_supported_vector(Op_VectorMaskGen, vlen, vmask_bt)) {
+      return false;
+    }
   }
 
   // Bail out if potential data dependence exists between memory accesses
   if (SWPointer::has_potential_dependence(swptrs)) {
-    return nullptr;
+    return false;
   }
 
   // Create vector mask with the post loop trip count. Note there's another
@@ -3127,13 +3139,25 @@ Node* SuperWord::create_post_loop_vmask() {
   _igvn.replace_node(cl->incr(), new_incr);
   Node* length = new ConvI2LNode(trip_cnt);
   _igvn.register_new_node_with_optimizer(length);
-  Node* vmask = VectorMaskGenNode::make(length, vmask_bt);
-  _igvn.register_new_node_with_optimizer(vmask);
+  for (int i = 0; i < 4; i++) {
+    BasicType vmask_bt = vmask_bts[i];
+    if (stats.has_size(type2aelembytes(vmask_bt))) {
+      Node* vmask = VectorMaskGenNode::make(length, vmask_bt, vlen);
+      _igvn.register_new_node_with_optimizer(vmask);
+      vmasks[i] = vmask;
+    }
+  }
 
   // Remove exit test to transform 1-iteration loop to straight-line code.
   // This results in redundant cmp+branch instructions been eliminated.
   Node *cl_exit = cl->loopexit();
   _igvn.replace_input_of(cl_exit, 1, _igvn.intcon(0));
+  return true;
+}
+
+Node* SuperWord::post_loop_vmask(Node** vmasks, Node* n) {
+  Node* vmask = vmasks[exact_log2(type2aelembytes(velt_basic_type(n)))];
+  assert(vmask != nullptr, "vector mask should be generated");
   return vmask;
 }
 
@@ -4280,7 +4304,9 @@ bool SWPointer::scaled_iv_plus_offset(Node* n) {
   }
 
   int opc = n->Opcode();
-  if (opc == Op_AddI) {
+  if (opc == Op_AddI || opc == Op_AddL) {
+    // AddL shows up for long indexed accesses in the int inner loop of a loop
+    // nest, e.g. ConvI2L(iv) + outer_phi (see PhaseIdealLoop::create_loop_nest).
     if (offset_plus_k(n->in(2)) && scaled_iv_plus_offset(n->in(1))) {
       NOT_PRODUCT(_tracer.scaled_iv_plus_offset_4(n);)
       return true;
@@ -4648,7 +4674,7 @@ void SWPointer::Tracer::scaled_iv_plus_offset_3(Node* n) {
 
 void SWPointer::Tracer::scaled_iv_plus_offset_4(Node* n) {
   if(_slp->is_trace_alignment()) {
-    print_depth(); tty->print_cr(" %d SWPointer::scaled_iv_plus_offset: Op_AddI PASSED", n->_idx);
+    print_depth(); tty->print_cr(" %d SWPointer::scaled_iv_plus_offset: Op_%s PASSED", n->_idx, n->Name());
     print_depth(); tty->print("  \\ %d SWPointer::scaled_iv_plus_offset: in(1) is scaled_iv: ", n->in(1)->_idx); n->in(1)->dump();
     print_depth(); tty->print("  \\ %d SWPointer::scaled_iv_plus_offset: in(2) is offset_plus_k: ", n->in(2)->_idx); n->in(2)->dump();
   }
@@ -4656,7 +4682,7 @@ void SWPointer::Tracer::scaled_iv_plus_offset_4(Node* n) {
 
 void SWPointer::Tracer::scaled_iv_plus_offset_5(Node* n) {
   if(_slp->is_trace_alignment()) {
-    print_depth(); tty->print_cr(" %d SWPointer::scaled_iv_plus_offset: Op_AddI PASSED", n->_idx);
+    print_depth(); tty->print_cr(" %d SWPointer::scaled_iv_plus_offset: Op_%s PASSED", n->_idx, n->Name());
     print_depth(); tty->print("  \\ %d SWPointer::scaled_iv_plus_offset: in(2) is scaled_iv: ", n->in(2)->_idx); n->in(2)->dump();
     print_depth(); tty->print("  \\ %d SWPointer::scaled_iv_plus_offset: in(1) is offset_plus_k: ", n->in(1)->_idx); n->in(1)->dump();
   }
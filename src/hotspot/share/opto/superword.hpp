@@ -261,6 +261,11 @@ class VectorElementSizeStats {
     return NO_SIZE;
   }
 
+  bool has_size(int size) {
+    assert(1 <= size && size <= 8 && is_power_of_2(size), "Illegal size");
+    return _stats[exact_log2(size)] > 0;
+  }
+
   int unique_size() {
     int small = smallest_size();
     int large = largest_size();
@@ -583,8 +588,11 @@ private:
 
   // Convert packs into vector node operations
   bool output();
-  // Create vector mask for post loop vectorization
-  Node* create_post_loop_vmask();
+  // Create vector masks for post loop vectorization, one per element size
+  // (indexed by log2 of the size) used in the loop
+  bool create_post_loop_vmasks(Node** vmasks);
+  // Vector mask from create_post_loop_vmasks for the element size of n
+  Node* post_loop_vmask(Node** vmasks, Node* n);
   // Create a vector operand for the nodes in pack p for operand: in(opd_idx)
   Node* vector_opd(Node_List* p, int opd_idx);
   // Can code be generated for pack p?
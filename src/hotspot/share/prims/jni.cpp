@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2024, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2012 Red Hat, Inc.
  * Copyright (c) 2021, Azul Systems, Inc. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
@@ -693,7 +693,9 @@ JNI_END
 JNI_ENTRY_NO_PRESERVE(void, jni_DeleteLocalRef(JNIEnv *env, jobject obj))
   HOTSPOT_JNI_DELETELOCALREF_ENTRY(env, obj);
 
-  JNIHandles::destroy_local(obj);
+  if (obj != nullptr) {
+    thread->active_handles()->release_handle(obj);
+  }
 
   HOTSPOT_JNI_DELETELOCALREF_RETURN();
 JNI_END
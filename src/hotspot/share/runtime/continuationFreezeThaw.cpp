@@ -388,6 +388,7 @@ public:
   void set_jvmti_event_collector(JvmtiSampledObjectAllocEventCollector* jsoaec) { _jvmti_event_collector = jsoaec; }
 
   inline int size_if_fast_freeze_available();
+  size_t fast_chunk_size();
 
 #ifdef ASSERT
   bool check_valid_fast_path();
@@ -535,7 +536,7 @@ freeze_result Freeze<ConfigT>::try_freeze_fast() {
   DEBUG_ONLY(_fast_freeze_size = size_if_fast_freeze_available();)
   assert(_fast_freeze_size == 0, "");
 
-  stackChunkOop chunk = allocate_chunk(cont_size() + frame::metadata_words, _cont.argsize() + frame::metadata_words_at_top);
+  stackChunkOop chunk = allocate_chunk(fast_chunk_size(), _cont.argsize() + frame::metadata_words_at_top);
   if (freeze_fast_new_chunk(chunk)) {
     return freeze_ok;
   }
@@ -549,6 +550,23 @@ freeze_result Freeze<ConfigT>::try_freeze_fast() {
   return freeze_slow();
 }
 
+// Returns the stack size of a chunk allocated by a fast freeze. The chunk is
+// made larger than the frames being frozen, so that the free room below its sp
+// lets later fast freezes reuse it (see size_if_fast_freeze_available()) when
+// the continuation yields with a somewhat deeper stack, or before all frames
+// have been lazily thawed, instead of allocating a new chunk.
+size_t FreezeBase::fast_chunk_size() {
+  const size_t needed = cont_size() + frame::metadata_words;
+  const size_t headroom = (size_t)cont_size() * StackChunkHeadroomPercent / 100;
+  if (headroom > 0 && CollectedHeap::stack_chunk_max_size() > 0) {
+    InstanceStackChunkKlass* klass = InstanceStackChunkKlass::cast(vmClasses::StackChunk_klass());
+    if (klass->instance_size(needed + headroom) >= CollectedHeap::stack_chunk_max_size()) {
+      return needed;
+    }
+  }
+  return needed + headroom;
+}
+
 // Returns size needed if the continuation fits, otherwise 0.
 int FreezeBase::size_if_fast_freeze_available() {
   stackChunkOop chunk = _cont.tail();
@@ -649,8 +667,8 @@ bool FreezeBase::freeze_fast_new_chunk(stackChunkOop chunk) {
 
   // in a fresh chunk, we freeze *with* the bottom-most frame's stack arguments.
   // They'll then be stored twice: in the chunk and in the parent chunk's top frame
-  const int chunk_start_sp = cont_size() + frame::metadata_words;
-  assert(chunk_start_sp == chunk->stack_size(), "");
+  const int chunk_start_sp = chunk->stack_size();
+  assert(chunk_start_sp >= cont_size() + frame::metadata_words, "");
 
   DEBUG_ONLY(_orig_chunk_sp = chunk->start_address() + chunk_start_sp;)
 
@@ -1575,9 +1593,14 @@ static inline int freeze_internal(JavaThread* current, intptr_t* const sp) {
          "Held monitor count and locks on stack invariant: " INT64_FORMAT " JNI: " INT64_FORMAT, (int64_t)current->held_monitor_count(), (int64_t)current->jni_monitor_count());
 
   if (entry->is_pinned() || current->held_monitor_count() > 0) {
-    log_develop_debug(continuations)("PINNED due to critical section/hold monitor");
     verify_continuation(cont.continuation());
     freeze_result res = entry->is_pinned() ? freeze_pinned_cs : freeze_pinned_monitor;
+    // Monitors are owned by the carrier JavaThread, so a continuation holding
+    // one cannot be unmounted. Report this in product builds, to help finding
+    // the synchronized code that pins virtual threads.
+    log_debug(continuations)("PINNED due to %s: held monitors: " INT64_FORMAT " JNI: " INT64_FORMAT,
+                             freeze_result_names[res], (int64_t)current->held_monitor_count(),
+                             (int64_t)current->jni_monitor_count());
     log_develop_trace(continuations)("=== end of freeze (fail %d)", res);
     return res;
   }
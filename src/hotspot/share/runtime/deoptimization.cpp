@@ -102,6 +102,7 @@
 uint64_t DeoptimizationScope::_committed_deopt_gen = 0;
 uint64_t DeoptimizationScope::_active_deopt_gen    = 1;
 bool     DeoptimizationScope::_committing_in_progress = false;
+GrowableArrayCHeap<CompiledMethod*, mtCode>* DeoptimizationScope::_marked_methods = nullptr;
 
 DeoptimizationScope::DeoptimizationScope() : _required_gen(0) {
   DEBUG_ONLY(_deopted = false;)
@@ -135,6 +136,13 @@ void DeoptimizationScope::mark(CompiledMethod* cm, bool inc_recompile_counts) {
 
   cm->_deoptimization_generation = DeoptimizationScope::_active_deopt_gen;
   _required_gen                  = DeoptimizationScope::_active_deopt_gen;
+
+  // Remember the method, so that making the marked methods not entrant does
+  // not need to walk the whole code cache.
+  if (_marked_methods == nullptr) {
+    _marked_methods = new GrowableArrayCHeap<CompiledMethod*, mtCode>(16);
+  }
+  _marked_methods->append(cm);
 }
 
 void DeoptimizationScope::dependent(CompiledMethod* cm) {
@@ -147,6 +155,25 @@ void DeoptimizationScope::dependent(CompiledMethod* cm) {
   }
 }
 
+GrowableArrayCHeap<CompiledMethod*, mtCode>* DeoptimizationScope::take_marked_methods() {
+  MutexLocker ml(CompiledMethod_lock->owned_by_self() ? nullptr : CompiledMethod_lock,
+                 Mutex::_no_safepoint_check_flag);
+  GrowableArrayCHeap<CompiledMethod*, mtCode>* marked = _marked_methods;
+  _marked_methods = nullptr;
+  return marked;
+}
+
+void DeoptimizationScope::unlink(CompiledMethod* cm) {
+  MutexLocker ml(CompiledMethod_lock->owned_by_self() ? nullptr : CompiledMethod_lock,
+                 Mutex::_no_safepoint_check_flag);
+  if (_marked_methods != nullptr && cm->is_marked_for_deoptimization()) {
+    int i = _marked_methods->find(cm);
+    if (i != -1) {
+      _marked_methods->delete_at(i);
+    }
+  }
+}
+
 void DeoptimizationScope::deoptimize_marked() {
   assert(!_deopted, "Already deopted");
 
@@ -39,6 +39,7 @@ class ScopeValue;
 class compiledVFrame;
 
 template<class E> class GrowableArray;
+template<typename E, MEMFLAGS F> class GrowableArrayCHeap;
 
 class DeoptimizationScope {
  private:
@@ -48,6 +49,8 @@ class DeoptimizationScope {
   static uint64_t _active_deopt_gen;
   // Indicate an in-progress deopt handshake.
   static bool     _committing_in_progress;
+  // Methods marked since the last time marked methods were made not entrant.
+  static GrowableArrayCHeap<CompiledMethod*, mtCode>* _marked_methods;
 
   // The required gen we need to execute/wait for
   uint64_t _required_gen;
@@ -64,6 +67,11 @@ class DeoptimizationScope {
   // Execute the deoptimization.
   // Make the nmethods not entrant, stackwalks and patch return pcs and sets post call nops.
   void deoptimize_marked();
+
+  // Returns the methods marked since the last call, the caller owns the array.
+  static GrowableArrayCHeap<CompiledMethod*, mtCode>* take_marked_methods();
+  // Forget the method if it is unlinked while marked, before it is made not entrant.
+  static void unlink(CompiledMethod* cm);
 };
 
 class Deoptimization : AllStatic {
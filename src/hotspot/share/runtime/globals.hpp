@@ -735,6 +735,11 @@ const int ObjectAlignmentInBytes = 8;
           "at one time (minimum is 1024).")                      \
           range(1024, max_jint)                                             \
                                                                             \
+  product(int, MonitorMaxSpinners, 0, DIAGNOSTIC,                           \
+          "The maximum number of threads that spin at the same time to "    \
+          "enter a contended monitor (0 is no limit)")                      \
+          range(0, max_jint)                                                \
+                                                                            \
   product(intx, MonitorUnlinkBatch, 500, DIAGNOSTIC,                        \
           "The maximum number of monitors to unlink in one batch. ")        \
           range(1, max_jint)                                                \
@@ -781,6 +786,10 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, CheckJNICalls, false,                                       \
           "Verify all arguments to JNI calls")                              \
                                                                             \
+  product(bool, UseJNIGlobalHandleCache, false, EXPERIMENTAL,               \
+          "Allocate and release JNI global and weak global references "     \
+          "through small per-thread caches of entries")                     \
+                                                                            \
   product(bool, UseFastJNIAccessors, true,                                  \
           "Use optimized versions of Get<Primitive>Field")                  \
                                                                             \
@@ -823,6 +832,12 @@ const int ObjectAlignmentInBytes = 8;
   product(bool, RestrictContended, true,                                    \
           "Restrict @Contended to trusted classes")                         \
                                                                             \
+  product(ccstrlist, ContendedFields, "", DIAGNOSTIC,                       \
+          "Comma separated list of instance fields to lay out as if "       \
+          "annotated with @Contended, e.g. write-hot fields found by "      \
+          "profiling. A field is given as <class>.<field>, with the "       \
+          "class name in internal form, e.g. java/lang/Thread.eetop")       \
+                                                                            \
   product(int, DiagnoseSyncOnValueBasedClasses, 0, DIAGNOSTIC,              \
              "Detect and take action upon identifying synchronization on "  \
              "value based classes. Modes: "                                 \
@@ -1297,6 +1312,13 @@ const int ObjectAlignmentInBytes = 8;
           "Delay in milliseconds for option SafepointTimeout")              \
           range(0, max_intx LP64_ONLY(/MICROUNITS))                         \
                                                                             \
+  product(intx, SafepointStragglerSampleDelay, 0, DIAGNOSTIC,               \
+          "Sample where threads are executing that have not reached a "     \
+          "safepoint after this many milliseconds, and report them with "   \
+          "-Xlog:safepoint+stragglers and the SafepointStraggler event. "   \
+          "0 means no sampling.")                                           \
+          range(0, max_intx LP64_ONLY(/MICROUNITS))                         \
+                                                                            \
   product(bool, UseSystemMemoryBarrier, false,                              \
           "Try to enable system memory barrier if supported by OS")         \
                                                                             \
@@ -1928,6 +1950,12 @@ const int ObjectAlignmentInBytes = 8;
   product_pd(bool, VMContinuations, EXPERIMENTAL,                           \
           "Enable VM continuations support")                                \
                                                                             \
+  product(uint, StackChunkHeadroomPercent, 0, EXPERIMENTAL,                 \
+          "Extra space, in percent of the frozen frames, to reserve in a "  \
+          "stack chunk allocated by a fast freeze, so that later freezes "  \
+          "of deeper stacks can reuse the chunk")                           \
+          range(0, 100)                                                     \
+                                                                            \
   develop(bool, LoomDeoptAfterThaw, false,                                  \
           "Deopt stack after thaw")                                         \
                                                                             \
@@ -436,6 +436,54 @@ void Handshake::execute(AsyncHandshakeClosure* hs_cl, JavaThread* target) {
   target->handshake_state()->add_operation(op);
 }
 
+void AsyncBatchHandshakeClosure::release() {
+  // Make the work of this thread visible to the thread doing the completion.
+  if (Atomic::sub(&_pending, 1) == 0) {
+    log_debug(handshake)("Asynchronous batch handshake %s completed", name());
+    do_completion();
+    delete this;
+  }
+}
+
+// The per-target part of an AsyncBatchHandshakeClosure. Its destructor is
+// run after the target executed the closure, or when the target exits with
+// the operation still queued, so it is the place to account for the target.
+class AsyncBatchHandshakeMember : public AsyncHandshakeClosure {
+  AsyncBatchHandshakeClosure* const _batch;
+ public:
+  AsyncBatchHandshakeMember(AsyncBatchHandshakeClosure* batch) :
+    AsyncHandshakeClosure(batch->name()), _batch(batch) {}
+  virtual ~AsyncBatchHandshakeMember()   { _batch->release(); }
+  virtual void do_thread(Thread* thread) { _batch->do_thread(thread); }
+};
+
+void AsyncBatchHandshakeClosure::submit(JavaThread* target) {
+  Atomic::inc(&_pending);
+  Handshake::execute(new AsyncBatchHandshakeMember(this), target);
+}
+
+void AsyncBatchHandshakeClosure::submitted(int count) {
+  log_debug(handshake)("Asynchronous batch handshake %s submitted to %d threads", name(), count);
+  // Done submitting; this completes the batch if all targets already finished.
+  release();
+}
+
+void Handshake::execute(AsyncBatchHandshakeClosure* hs_cl) {
+  int count = 0;
+  for (JavaThreadIteratorWithHandle jtiwh; JavaThread* target = jtiwh.next(); ) {
+    hs_cl->submit(target);
+    count++;
+  }
+  hs_cl->submitted(count);
+}
+
+void Handshake::execute(AsyncBatchHandshakeClosure* hs_cl, JavaThread* const* targets, int count) {
+  for (int i = 0; i < count; i++) {
+    hs_cl->submit(targets[i]);
+  }
+  hs_cl->submitted(count);
+}
+
 // Filters
 static bool non_self_executable_filter(HandshakeOperation* op) {
   return !op->is_async();
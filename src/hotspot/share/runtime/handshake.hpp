@@ -64,6 +64,31 @@ class AsyncHandshakeClosure : public HandshakeClosure {
    virtual bool is_async()          { return true; }
 };
 
+// An asynchronous handshake closure that is executed by a batch of target
+// threads. Like with AsyncHandshakeClosure, every target executes it itself
+// and the requester does not wait. do_completion() is called once all targets
+// have executed the closure or have exited without executing it, by whichever
+// thread finished last, so it should be short and must not block. The closure
+// is deleted after completion.
+class AsyncBatchHandshakeClosure : public CHeapObj<mtThread> {
+  friend class AsyncBatchHandshakeMember;
+  friend class Handshake;
+  const char* const _name;
+  // Number of targets that have not finished yet, plus one for the requester
+  // while it is still submitting.
+  volatile int32_t _pending;
+
+  void submit(JavaThread* target);
+  void submitted(int count);
+  void release();
+ public:
+  AsyncBatchHandshakeClosure(const char* name) : _name(name), _pending(1) {}
+  virtual ~AsyncBatchHandshakeClosure() {}
+  const char* name() const                         { return _name; }
+  virtual void do_thread(Thread* thread) = 0;
+  virtual void do_completion()                     {}
+};
+
 class Handshake : public AllStatic {
  public:
   // Execution of handshake operation
@@ -79,6 +104,11 @@ class Handshake : public AllStatic {
   // This version of execute() relies on a ThreadListHandle somewhere in
   // the caller's context to protect target (and we sanity check for that).
   static void execute(AsyncHandshakeClosure*  hs_cl, JavaThread* target);
+  // Submit hs_cl to all JavaThreads, without waiting for them.
+  static void execute(AsyncBatchHandshakeClosure* hs_cl);
+  // Submit hs_cl to the given targets, without waiting for them. This relies
+  // on a ThreadsListHandle in the caller's context to protect the targets.
+  static void execute(AsyncBatchHandshakeClosure* hs_cl, JavaThread* const* targets, int count);
 };
 
 class JvmtiRawMonitor;
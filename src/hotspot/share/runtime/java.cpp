@@ -31,9 +31,11 @@
 #include "classfile/symbolTable.hpp"
 #include "classfile/systemDictionary.hpp"
 #include "code/codeCache.hpp"
+#include "compiler/compilationPolicy.hpp"
 #include "compiler/compileBroker.hpp"
 #include "compiler/compilerOracle.hpp"
 #include "gc/shared/collectedHeap.hpp"
+#include "gc/shared/oopStorageSet.hpp"
 #include "gc/shared/stringdedup/stringDedup.hpp"
 #include "interpreter/bytecodeHistogram.hpp"
 #include "jfr/jfrEvents.hpp"
@@ -503,6 +505,10 @@ void before_exit(JavaThread* thread, bool halt) {
     BytecodeHistogram::print();
   }
 
+  if (HotMethodsAtExitFile != nullptr) {
+    CompilationPolicy::write_hot_methods_file();
+  }
+
 #ifdef LINUX
   if (DumpPerfMapAtExit) {
     CodeCache::write_perf_map();
@@ -525,6 +531,8 @@ void before_exit(JavaThread* thread, bool halt) {
   print_statistics();
   Universe::heap()->print_tracing_info();
 
+  OopStorageSet::log_statistics();
+
   { MutexLocker ml(BeforeExit_lock);
     _before_exit_status = BEFORE_EXIT_DONE;
     BeforeExit_lock->notify_all();
@@ -27,6 +27,7 @@
 #define SHARE_RUNTIME_JAVATHREAD_HPP
 
 #include "jni.h"
+#include "gc/shared/oopStorageAllocationCache.hpp"
 #include "memory/allocation.hpp"
 #include "oops/oop.hpp"
 #include "oops/oopHandle.hpp"
@@ -157,6 +158,10 @@ class JavaThread: public Thread {
   // One-element thread local free list
   JNIHandleBlock* _free_handle_block;
 
+  // Caches of JNI global and weak global handle entries, see UseJNIGlobalHandleCache.
+  OopStorageAllocationCache _jni_global_handle_cache;
+  OopStorageAllocationCache _jni_weak_global_handle_cache;
+
  public:
   volatile intptr_t _Stalled;
 
@@ -189,6 +194,8 @@ class JavaThread: public Thread {
   void set_active_handles(JNIHandleBlock* block) { _active_handles = block; }
   JNIHandleBlock* free_handle_block() const      { return _free_handle_block; }
   void set_free_handle_block(JNIHandleBlock* block) { _free_handle_block = block; }
+  OopStorageAllocationCache* jni_global_handle_cache()      { return &_jni_global_handle_cache; }
+  OopStorageAllocationCache* jni_weak_global_handle_cache() { return &_jni_weak_global_handle_cache; }
 
   void push_jni_handle_block();
   void pop_jni_handle_block();
@@ -1189,6 +1196,9 @@ inline JavaThread* JavaThread::current_or_null() {
   return current != nullptr ? JavaThread::cast(current) : nullptr;
 }
 
+// Returns the name of a JavaThreadState, for printing.
+const char* _get_thread_state_name(JavaThreadState _thread_state);
+
 class UnlockFlagSaver {
   private:
     JavaThread* _thread;
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1998, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1998, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 #include "precompiled.hpp"
 #include "gc/shared/collectedHeap.hpp"
 #include "gc/shared/oopStorage.inline.hpp"
+#include "gc/shared/oopStorageAllocationCache.hpp"
 #include "gc/shared/oopStorageSet.hpp"
 #include "logging/log.hpp"
 #include "memory/iterator.hpp"
@@ -59,6 +60,25 @@ jobject JNIHandles::make_local(oop obj) {
   return make_local(JavaThread::current(), obj);
 }
 
+// Returns the current thread if global handles should be allocated and
+// released through its caches, null otherwise. Handles released to a cache
+// stay allocated in the storage, so -Xcheck:jni could not tell them from live
+// handles; the caches are not used with CheckJNICalls.
+static JavaThread* global_handle_cache_thread() {
+  if (UseJNIGlobalHandleCache && !CheckJNICalls) {
+    Thread* thread = Thread::current_or_null();
+    if (thread != nullptr && thread->is_Java_thread()) {
+      return JavaThread::cast(thread);
+    }
+  }
+  return nullptr;
+}
+
+void JNIHandles::flush_global_handle_caches(JavaThread* thread) {
+  thread->jni_global_handle_cache()->flush(global_handles());
+  thread->jni_weak_global_handle_cache()->flush(weak_global_handles());
+}
+
 // Used by NewLocalRef which requires null on out-of-memory
 jobject JNIHandles::make_local(JavaThread* thread, oop obj, AllocFailType alloc_failmode) {
   if (obj == nullptr) {
@@ -89,7 +109,10 @@ jobject JNIHandles::make_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = global_handles()->allocate();
+    JavaThread* cache_thread = global_handle_cache_thread();
+    oop* ptr = (cache_thread != nullptr)
+               ? cache_thread->jni_global_handle_cache()->allocate(global_handles())
+               : global_handles()->allocate();
     // Return null on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
@@ -111,7 +134,10 @@ jweak JNIHandles::make_weak_global(Handle obj, AllocFailType alloc_failmode) {
   if (!obj.is_null()) {
     // ignore null handles
     assert(oopDesc::is_oop(obj()), "not an oop");
-    oop* ptr = weak_global_handles()->allocate();
+    JavaThread* cache_thread = global_handle_cache_thread();
+    oop* ptr = (cache_thread != nullptr)
+               ? cache_thread->jni_weak_global_handle_cache()->allocate(weak_global_handles())
+               : weak_global_handles()->allocate();
     // Return nullptr on allocation failure.
     if (ptr != nullptr) {
       assert(NativeAccess<AS_NO_KEEPALIVE>::oop_load(ptr) == oop(nullptr), "invariant");
@@ -148,7 +174,12 @@ void JNIHandles::destroy_global(jobject handle) {
   if (handle != nullptr) {
     oop* oop_ptr = global_ptr(handle);
     NativeAccess<>::oop_store(oop_ptr, (oop)nullptr);
-    global_handles()->release(oop_ptr);
+    JavaThread* cache_thread = global_handle_cache_thread();
+    if (cache_thread != nullptr) {
+      cache_thread->jni_global_handle_cache()->release(global_handles(), oop_ptr);
+    } else {
+      global_handles()->release(oop_ptr);
+    }
   }
 }
 
@@ -157,7 +188,12 @@ void JNIHandles::destroy_weak_global(jweak handle) {
   if (handle != nullptr) {
     oop* oop_ptr = weak_global_ptr(handle);
     NativeAccess<ON_PHANTOM_OOP_REF>::oop_store(oop_ptr, (oop)nullptr);
-    weak_global_handles()->release(oop_ptr);
+    JavaThread* cache_thread = global_handle_cache_thread();
+    if (cache_thread != nullptr) {
+      cache_thread->jni_weak_global_handle_cache()->release(weak_global_handles(), oop_ptr);
+    } else {
+      weak_global_handles()->release(oop_ptr);
+    }
   }
 }
 
@@ -482,6 +518,20 @@ jobject JNIHandleBlock::allocate_handle(JavaThread* caller, oop obj, AllocFailTy
   return allocate_handle(caller, obj, alloc_failmode);  // retry
 }
 
+void JNIHandleBlock::release_handle(jobject handle) {
+  // Locals are commonly deleted in reverse order of creation. Reuse the slot
+  // of the last handle right away instead of leaving a hole that is only
+  // reclaimed by rebuild_free_list. Slots below the last handle may be on
+  // the free list, so only that one slot is given back.
+  if (_top != 0) {
+    JNIHandleBlock* last = _last;
+    if (last->_top > 0 && (jobject)&(last->_handles)[last->_top - 1] == handle) {
+      --(last->_top);
+    }
+  }
+  JNIHandles::destroy_local(handle);
+}
+
 void JNIHandleBlock::rebuild_free_list() {
   assert(_allocate_before_rebuild == 0 && _free_list == nullptr, "just checking");
   int free = 0;
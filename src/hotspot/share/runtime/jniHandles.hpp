@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1998, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1998, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -106,6 +106,10 @@ public:
   static jweak make_weak_global(Handle obj,
                                 AllocFailType alloc_failmode = AllocFailStrategy::EXIT_OOM);
   static void destroy_weak_global(jweak handle);
+
+  // Returns the entries cached by thread for global and weak global handles
+  // to their storages.
+  static void flush_global_handle_caches(JavaThread* thread);
   static bool is_weak_global_cleared(jweak handle); // Test jweak without resolution
 
   // Debugging
@@ -169,6 +173,10 @@ class JNIHandleBlock : public CHeapObj<mtInternal> {
   // Handle allocation
   jobject allocate_handle(JavaThread* caller, oop obj, AllocFailType alloc_failmode = AllocFailStrategy::EXIT_OOM);
 
+  // Clear the given local handle of this chain. If it is the most recently
+  // allocated one, its slot is made available for the next allocation.
+  void release_handle(jobject handle);
+
   // Block allocation and block free list management
   static JNIHandleBlock* allocate_block(JavaThread* thread = nullptr, AllocFailType alloc_failmode = AllocFailStrategy::EXIT_OOM);
   static void release_block(JNIHandleBlock* block, JavaThread* thread = nullptr);
@@ -119,6 +119,23 @@ static int Knob_Poverty             = 1000;
 static int Knob_FixedSpin           = 0;
 static int Knob_PreSpin             = 10;      // 20-100 likely better
 
+// Counts a thread in the adaptive spin phase of TrySpin() in the spinner
+// count of the monitor, if there is one to maintain.
+class ObjectMonitorSpinnerMark : public StackObj {
+  volatile int* const _spinners;
+ public:
+  ObjectMonitorSpinnerMark(volatile int* spinners) : _spinners(spinners) {
+    if (_spinners != nullptr) {
+      Atomic::inc(_spinners, memory_order_relaxed);
+    }
+  }
+  ~ObjectMonitorSpinnerMark() {
+    if (_spinners != nullptr) {
+      Atomic::dec(_spinners, memory_order_relaxed);
+    }
+  }
+};
+
 DEBUG_ONLY(static volatile bool InitDone = false;)
 
 OopStorage* ObjectMonitor::_oop_storage = nullptr;
@@ -1846,9 +1863,19 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
   if (ctr <= 0) return 0;
 
   if (NotRunnable(current, static_cast<JavaThread*>(owner_raw()))) {
+    OM_PERFDATA_OP(SpinsSkipped, inc());
     return 0;
   }
 
+  // Don't let spinners take the processors the owners need to make progress,
+  // which happens first when the JVM runs with few CPUs, e.g. in a container.
+  if (MonitorMaxSpinners > 0 && Atomic::load(&_Spinner) >= MonitorMaxSpinners) {
+    OM_PERFDATA_OP(SpinsSkipped, inc());
+    return 0;
+  }
+  // The spinners are only counted when there is a limit.
+  ObjectMonitorSpinnerMark spinner_mark(MonitorMaxSpinners > 0 ? &_Spinner : nullptr);
+
   // We're good to spin ... spin ingress.
   // CONSIDER: use Prefetch::write() to avoid RTS->RTO upgrades
   // when preparing to LD...CAS _owner, etc and the CAS is likely
@@ -1916,6 +1943,7 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
           if (x < Knob_Poverty) x = Knob_Poverty;
           _SpinDuration = x + Knob_Bonus;
         }
+        OM_PERFDATA_OP(SpinSuccesses, inc());
         return 1;
       }
 
@@ -1968,8 +1996,12 @@ int ObjectMonitor::TrySpin(JavaThread* current) {
     // in the normal usage of TrySpin(), but it's safest
     // to make TrySpin() as foolproof as possible.
     OrderAccess::fence();
-    if (TryLock(current) > 0) return 1;
+    if (TryLock(current) > 0) {
+      OM_PERFDATA_OP(SpinSuccesses, inc());
+      return 1;
+    }
   }
+  OM_PERFDATA_OP(SpinFailures, inc());
   return 0;
 }
 
@@ -2115,6 +2147,9 @@ PerfCounter * ObjectMonitor::_sync_Parks                       = nullptr;
 PerfCounter * ObjectMonitor::_sync_Notifications               = nullptr;
 PerfCounter * ObjectMonitor::_sync_Inflations                  = nullptr;
 PerfCounter * ObjectMonitor::_sync_Deflations                  = nullptr;
+PerfCounter * ObjectMonitor::_sync_SpinSuccesses               = nullptr;
+PerfCounter * ObjectMonitor::_sync_SpinFailures                = nullptr;
+PerfCounter * ObjectMonitor::_sync_SpinsSkipped                = nullptr;
 PerfLongVariable * ObjectMonitor::_sync_MonExtant              = nullptr;
 
 // One-shot global initialization for the sync subsystem.
@@ -2126,7 +2161,9 @@ PerfLongVariable * ObjectMonitor::_sync_MonExtant              = nullptr;
 void ObjectMonitor::Initialize() {
   assert(!InitDone, "invariant");
 
-  if (!os::is_MP()) {
+  // Container CPU limits can restrict the JVM to a single processor on a
+  // multi-processor machine.
+  if (!os::is_MP() || os::active_processor_count() == 1) {
     Knob_SpinLimit = 0;
     Knob_PreSpin   = 0;
     Knob_FixedSpin = -1;
@@ -2150,6 +2187,9 @@ void ObjectMonitor::Initialize() {
     NEWPERFCOUNTER(_sync_FutileWakeups);
     NEWPERFCOUNTER(_sync_Parks);
     NEWPERFCOUNTER(_sync_Notifications);
+    NEWPERFCOUNTER(_sync_SpinSuccesses);
+    NEWPERFCOUNTER(_sync_SpinFailures);
+    NEWPERFCOUNTER(_sync_SpinsSkipped);
     NEWPERFVARIABLE(_sync_MonExtant);
 #undef NEWPERFCOUNTER
 #undef NEWPERFVARIABLE
@@ -178,7 +178,7 @@ private:
   JavaThread* volatile _succ;       // Heir presumptive thread - used for futile wakeup throttling
   JavaThread* volatile _Responsible;
 
-  volatile int _Spinner;            // for exit->spinner handoff optimization
+  volatile int _Spinner;            // number of threads in the adaptive spin phase of TrySpin()
   volatile int _SpinDuration;
 
   int _contentions;                 // Number of active contentions in enter(). It is used by is_busy()
@@ -213,6 +213,9 @@ private:
   static PerfCounter * _sync_Notifications;
   static PerfCounter * _sync_Inflations;
   static PerfCounter * _sync_Deflations;
+  static PerfCounter * _sync_SpinSuccesses;
+  static PerfCounter * _sync_SpinFailures;
+  static PerfCounter * _sync_SpinsSkipped;
   static PerfLongVariable * _sync_MonExtant;
 
   static int Knob_SpinLimit;
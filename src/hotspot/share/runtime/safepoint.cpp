@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -40,6 +40,7 @@
 #include "gc/shared/workerUtils.hpp"
 #include "interpreter/interpreter.hpp"
 #include "jfr/jfrEvents.hpp"
+#include "jfr/support/jfrThreadId.hpp"
 #include "logging/log.hpp"
 #include "logging/logStream.hpp"
 #include "memory/resourceArea.hpp"
@@ -62,6 +63,7 @@
 #include "runtime/stackWatermarkSet.inline.hpp"
 #include "runtime/stubCodeGenerator.hpp"
 #include "runtime/stubRoutines.hpp"
+#include "runtime/suspendedThreadTask.hpp"
 #include "runtime/synchronizer.hpp"
 #include "runtime/threads.hpp"
 #include "runtime/threadSMR.hpp"
@@ -70,6 +72,7 @@
 #include "services/runtimeService.hpp"
 #include "utilities/events.hpp"
 #include "utilities/macros.hpp"
+#include "utilities/powerOfTwo.hpp"
 #include "utilities/systemMemoryBarrier.hpp"
 
 static void post_safepoint_begin_event(EventSafepointBegin& event,
@@ -255,12 +258,24 @@ int SafepointSynchronize::synchronize_threads(jlong safepoint_limit_time, int no
   int iterations = 1; // The first iteration is above.
   int64_t start_time = os::javaTimeNanos();
 
+  jlong straggler_sample_time = 0;
+  if (SafepointStragglerSampleDelay > 0 && should_sample_stragglers()) {
+    straggler_sample_time = SafepointTracing::start_of_safepoint() +
+                            (jlong)SafepointStragglerSampleDelay * (NANOUNITS / MILLIUNITS);
+  }
+
   do {
     // Check if this has taken too long:
     if (SafepointTimeout && safepoint_limit_time < os::javaTimeNanos()) {
       print_safepoint_timeout();
     }
 
+    // Find out where the remaining threads are, once per safepoint.
+    if (straggler_sample_time != 0 && straggler_sample_time < os::javaTimeNanos()) {
+      sample_stragglers(tss_head);
+      straggler_sample_time = 0;
+    }
+
     p_prev = &tss_head;
     ThreadSafepointState *cur_tss = tss_head;
     while (cur_tss != nullptr) {
@@ -781,6 +796,104 @@ void SafepointSynchronize::handle_polling_page_exception(JavaThread *thread) {
 }
 
 
+bool SafepointSynchronize::should_sample_stragglers() {
+  return log_is_enabled(Info, safepoint, stragglers) || EventSafepointStraggler::is_enabled();
+}
+
+// Records the pc of a thread that has not reached the safepoint yet. The
+// thread is suspended while this runs, so only its registers are read here:
+// the thread may hold locks needed for looking up the code at that pc.
+class SafepointStragglerSampler : public SuspendedThreadTask {
+  address _pc;
+ public:
+  SafepointStragglerSampler(JavaThread* thread) : SuspendedThreadTask(thread), _pc(nullptr) {}
+
+  address pc() const { return _pc; }
+
+  void do_task(const SuspendedThreadTaskContext& context) {
+    JavaThread* thread = JavaThread::cast(context.thread());
+    if (thread->thread_state() == _thread_in_Java && context.ucontext() != nullptr) {
+      intptr_t* sp;
+      intptr_t* fp;
+      _pc = os::fetch_frame_from_context(context.ucontext(), &sp, &fp);
+    }
+  }
+};
+
+static void post_safepoint_straggler_event(JavaThread* thread, JavaThreadState state,
+                                           address pc, Method* method, int bci) {
+  EventSafepointStraggler event;
+  if (event.should_commit()) {
+    event.set_safepointId(SafepointSynchronize::safepoint_id() + 1);
+    event.set_straggler(JFR_THREAD_ID(thread));
+    event.set_state(_get_thread_state_name(state));
+    event.set_method(method);
+    event.set_bci(bci);
+    event.set_pc((u8)pc);
+    event.commit();
+  }
+}
+
+// Report the threads in the list that are still running, and for those
+// running compiled code the method and bytecode index of the next debug
+// info (call or safepoint poll) after the sampled pc. A thread stuck there
+// is typically in a counted loop without a safepoint poll.
+void SafepointSynchronize::sample_stragglers(ThreadSafepointState* tss_head) {
+  ResourceMark rm;
+  LogTarget(Info, safepoint, stragglers) lt;
+  LogStream ls(lt);
+  jlong delay_ms = (os::javaTimeNanos() - SafepointTracing::start_of_safepoint()) / (NANOUNITS / MILLIUNITS);
+
+  for (ThreadSafepointState* cur_tss = tss_head; cur_tss != nullptr; cur_tss = cur_tss->get_next()) {
+    JavaThread* thread = cur_tss->thread();
+    JavaThreadState state = thread->thread_state();
+    address pc = nullptr;
+    if (state == _thread_in_Java) {
+      SafepointStragglerSampler sampler(thread);
+      sampler.run();
+      pc = sampler.pc();
+    }
+
+    // Keep the code blob from being freed while it is inspected.
+    MutexLocker ml(CodeCache_lock, Mutex::_no_safepoint_check_flag);
+    CodeBlob* cb = (pc != nullptr) ? CodeCache::find_blob(pc) : nullptr;
+    Method* method = nullptr;
+    int bci = -1;
+    if (cb != nullptr && cb->is_compiled()) {
+      CompiledMethod* cm = cb->as_compiled_method();
+      PcDesc* pd = cm->pc_desc_near(pc);
+      if (pd != nullptr) {
+        ScopeDesc sd(cm, pd);
+        method = sd.method();
+        bci = sd.bci();
+      } else {
+        method = cm->method();
+      }
+    }
+
+    if (lt.is_enabled()) {
+      ls.print("Thread " INTPTR_FORMAT " \"%s\" still running after " JLONG_FORMAT " ms, %s",
+               p2i(thread), thread->name(), delay_ms, _get_thread_state_name(state));
+      if (cb == nullptr) {
+        if (pc != nullptr) {
+          ls.print(" at pc " INTPTR_FORMAT, p2i(pc));
+        }
+      } else if (method != nullptr) {
+        ls.print(" at pc " INTPTR_FORMAT " in %s method %s",
+                 p2i(pc), cb->is_compiled() ? cb->as_compiled_method()->compiler_name() : cb->name(),
+                 method->external_name());
+        if (bci >= 0) {
+          ls.print(" before bci %d", bci);
+        }
+      } else {
+        ls.print(" at pc " INTPTR_FORMAT " in %s", p2i(pc), cb->name());
+      }
+      ls.cr();
+    }
+    post_safepoint_straggler_event(thread, state, pc, method, bci);
+  }
+}
+
 void SafepointSynchronize::print_safepoint_timeout() {
   if (!timeout_error_printed) {
     timeout_error_printed = true;
@@ -1030,6 +1143,9 @@ jlong     SafepointTracing::_max_sync_time = 0;
 jlong     SafepointTracing::_max_cleanup_time = 0;
 jlong     SafepointTracing::_max_vmop_time = 0;
 uint64_t  SafepointTracing::_op_count[VM_Operation::VMOp_Terminating] = {0};
+jlong     SafepointTracing::_op_total_time[VM_Operation::VMOp_Terminating] = {0};
+jlong     SafepointTracing::_op_max_time[VM_Operation::VMOp_Terminating] = {0};
+uint64_t  SafepointTracing::_op_histogram[VM_Operation::VMOp_Terminating][SafepointTracing::HistogramBuckets] = {{0}};
 
 void SafepointTracing::init() {
   // Application start
@@ -1102,6 +1218,62 @@ void SafepointTracing::statistics_exit_log() {
   log_info(safepoint, stats)("Maximum vm operation time (except for Exit VM operation)  "
                               INT64_FORMAT " ns",
                               (int64_t)(_max_vmop_time));
+
+  LogStream ls(Log(safepoint, stats)::info());
+  print_statistics(&ls);
+}
+
+void SafepointTracing::record_op_time(jlong total_time_ns) {
+  int type = _current_type;
+  _op_total_time[type] += total_time_ns;
+  _op_max_time[type] = MAX2(_op_max_time[type], total_time_ns);
+
+  julong time_us = (julong)total_time_ns / (NANOUNITS / MICROUNITS);
+  int bucket = time_us == 0 ? 0 : log2i(time_us);
+  _op_histogram[type][MIN2(bucket, HistogramBuckets - 1)]++;
+}
+
+// Returns the upper bound in microseconds of the histogram bucket that holds
+// the given fraction of the safepoints of the given type. This is exact up to
+// a factor of two, and bounded by the maximum time.
+jlong SafepointTracing::percentile_us(int type, double fraction) {
+  uint64_t count = 0;
+  for (int i = 0; i < HistogramBuckets; i++) {
+    count += _op_histogram[type][i];
+  }
+  uint64_t target = (uint64_t)ceil(count * fraction);
+  uint64_t seen = 0;
+  jlong max_us = _op_max_time[type] / (NANOUNITS / MICROUNITS);
+  for (int i = 0; i < HistogramBuckets - 1; i++) {
+    seen += _op_histogram[type][i];
+    if (seen >= target) {
+      return MIN2(((jlong)2 << i) - 1, max_us);
+    }
+  }
+  return max_us;
+}
+
+void SafepointTracing::print_statistics(outputStream* st) {
+  // The statistics are updated by the VM thread at the end of each safepoint,
+  // and read here without synchronization; a concurrent reader may see the
+  // numbers of a safepoint partially applied.
+  st->print_cr("VM Operation                     count   total (ms)    avg (us)    p50 (us)    p99 (us)   p999 (us)    max (us)");
+  for (int index = 0; index < VM_Operation::VMOp_Terminating; index++) {
+    uint64_t count = _op_count[index];
+    if (count == 0) {
+      continue;
+    }
+    jlong total_us = _op_total_time[index] / (NANOUNITS / MICROUNITS);
+    st->print_cr("%-28s" UINT64_FORMAT_W(10) " " INT64_FORMAT_W(12) " " INT64_FORMAT_W(11) " "
+                 INT64_FORMAT_W(11) " " INT64_FORMAT_W(11) " " INT64_FORMAT_W(11) " " INT64_FORMAT_W(11),
+                 VM_Operation::name(index), count,
+                 (int64_t)(total_us / MILLIUNITS),
+                 (int64_t)(total_us / (jlong)count),
+                 (int64_t)percentile_us(index, 0.5),
+                 (int64_t)percentile_us(index, 0.99),
+                 (int64_t)percentile_us(index, 0.999),
+                 (int64_t)(_op_max_time[index] / (NANOUNITS / MICROUNITS)));
+  }
 }
 
 void SafepointTracing::begin(VM_Operation::VMOp_Type type) {
@@ -1143,6 +1315,7 @@ void SafepointTracing::end() {
   if (_max_vmop_time < (_last_safepoint_end_time_ns - _last_safepoint_sync_time_ns)) {
     _max_vmop_time = _last_safepoint_end_time_ns - _last_safepoint_sync_time_ns;
   }
+  record_op_time(_last_safepoint_end_time_ns - _last_safepoint_begin_time_ns);
   if (log_is_enabled(Info, safepoint, stats)) {
     statistics_log();
   }
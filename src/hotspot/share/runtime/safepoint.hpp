@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1997, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1997, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -114,6 +114,8 @@ class SafepointSynchronize : AllStatic {
   // Helper methods for safepoint procedure:
   static void arm_safepoint();
   static int synchronize_threads(jlong safepoint_limit_time, int nof_threads, int* initial_running);
+  static bool should_sample_stragglers();
+  static void sample_stragglers(ThreadSafepointState* tss_head);
   static void disarm_safepoint();
   static void increment_jni_active_count();
   static void decrement_waiting_to_block();
@@ -260,7 +262,18 @@ private:
   static jlong     _max_vmop_time;
   static uint64_t  _op_count[VM_Operation::VMOp_Terminating];
 
+  // Per VM operation type statistics of the total safepoint time. Bucket i
+  // of the histogram counts safepoints that took [2^i, 2^(i+1)) microseconds,
+  // bucket 0 also those under one microsecond, and the last bucket all longer
+  // ones.
+  static const int HistogramBuckets = 24;
+  static jlong     _op_total_time[VM_Operation::VMOp_Terminating];
+  static jlong     _op_max_time[VM_Operation::VMOp_Terminating];
+  static uint64_t  _op_histogram[VM_Operation::VMOp_Terminating][HistogramBuckets];
+
   static void statistics_log();
+  static void record_op_time(jlong total_time_ns);
+  static jlong percentile_us(int type, double fraction);
 
 public:
   static void init();
@@ -271,6 +284,8 @@ public:
   static void end();
 
   static void statistics_exit_log();
+  // Print the latency statistics per VM operation type.
+  static void print_statistics(outputStream* st);
 
   static jlong time_since_last_safepoint_ms() {
     return nanos_to_millis(os::javaTimeNanos() - _last_safepoint_end_time_ns);
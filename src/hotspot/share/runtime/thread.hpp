@@ -331,6 +331,10 @@ class Thread: public ThreadShadow {
   // Can this thread make Java upcalls
   virtual bool can_call_java() const                 { return false; }
 
+  // Called by Arena::set_size_in_bytes when an mtCompiler arena allocated
+  // or freed chunks on this thread. CompilerThreads account this per task.
+  virtual void compiler_arena_size_changed(ssize_t delta) {}
+
   // Is this a JavaThread that is on the VM's current ThreadsList?
   // If so it must participate in the safepoint protocol.
   virtual bool is_active_Java_thread() const         { return false; }
@@ -181,9 +181,7 @@ inline ThreadsList* ThreadsSMRSupport::xchg_java_thread_list(ThreadsList* new_li
 }
 
 // Hash table of pointers found by a scan. Used for collecting hazard
-// pointers (ThreadsList references). Also used for collecting JavaThreads
-// that are indirectly referenced by hazard ptrs. An instance of this
-// class only contains one type of pointer.
+// pointers (ThreadsList references).
 //
 class ThreadScanHashtable : public CHeapObj<mtThread> {
  private:
@@ -217,43 +215,27 @@ class ThreadScanHashtable : public CHeapObj<mtThread> {
   }
 };
 
-// Closure to gather JavaThreads indirectly referenced by hazard ptrs
-// (ThreadsList references) into a hash table. This closure handles part 2
-// of the dance - adding all the JavaThreads referenced by the hazard
-// pointer (ThreadsList reference) to the hash table.
-//
-class AddThreadHazardPointerThreadClosure : public ThreadClosure {
- private:
-  ThreadScanHashtable *_table;
-
- public:
-  AddThreadHazardPointerThreadClosure(ThreadScanHashtable *table) : _table(table) {}
-
-  virtual void do_thread(Thread *thread) {
-    if (!_table->has_entry((void*)thread)) {
-      // The same JavaThread might be on more than one ThreadsList or
-      // more than one thread might be using the same ThreadsList. In
-      // either case, we only need a single entry for a JavaThread.
-      _table->add_entry((void*)thread);
-    }
-  }
-};
-
-// Closure to gather JavaThreads indirectly referenced by hazard ptrs
-// (ThreadsList references) into a hash table. This closure handles part 1
-// of the dance - hazard ptr chain walking and dispatch to another
-// closure.
+// Closure to find out whether a JavaThread is indirectly referenced by
+// hazard ptrs (ThreadsList references). Each distinct stable ThreadsList
+// is only searched once, so the cost of the scan is proportional to the
+// number of threads plus the length of the few distinct ThreadsLists,
+// rather than to the number of threads times the ThreadsList length.
 //
 class ScanHazardPtrGatherProtectedThreadsClosure : public ThreadClosure {
  private:
-  ThreadScanHashtable *_table;
+  ThreadScanHashtable* _table;
+  JavaThread* const _target;
+  bool _found;
  public:
-  ScanHazardPtrGatherProtectedThreadsClosure(ThreadScanHashtable *table) : _table(table) {}
+  ScanHazardPtrGatherProtectedThreadsClosure(ThreadScanHashtable* table, JavaThread* target) :
+    _table(table), _target(target), _found(false) {}
+
+  bool found() const { return _found; }
 
   virtual void do_thread(Thread *thread) {
     assert_locked_or_safepoint(Threads_lock);
 
-    if (thread == nullptr) return;
+    if (thread == nullptr || _found) return;
 
     // This code races with ThreadsSMRSupport::acquire_stable_list() which
     // is lock-free so we have to handle some special situations.
@@ -287,9 +269,12 @@ class ScanHazardPtrGatherProtectedThreadsClosure : public ThreadClosure {
     // which might be _java_thread_list or it might be an older
     // ThreadsList that has been removed but not freed. In either case,
     // the hazard ptr is protecting all the JavaThreads on that
-    // ThreadsList.
-    AddThreadHazardPointerThreadClosure add_cl(_table);
-    current_list->threads_do(&add_cl);
+    // ThreadsList. Most hazard ptrs refer to the same few ThreadsLists
+    // so only search each of them once.
+    if (!_table->has_entry((void*)current_list)) {
+      _table->add_entry((void*)current_list);
+      _found = current_list->includes(_target);
+    }
   }
 };
 
@@ -963,32 +948,27 @@ void ThreadsSMRSupport::free_list(ThreadsList* threads) {
 bool ThreadsSMRSupport::is_a_protected_JavaThread(JavaThread *thread) {
   assert_locked_or_safepoint(Threads_lock);
 
-  // Gather a hash table of the JavaThreads indirectly referenced by
-  // hazard ptrs.
+  // Search the ThreadsLists referenced by hazard ptrs for the JavaThread.
   ThreadScanHashtable *scan_table = new ThreadScanHashtable();
-  ScanHazardPtrGatherProtectedThreadsClosure scan_cl(scan_table);
+  ScanHazardPtrGatherProtectedThreadsClosure scan_cl(scan_table, thread);
   threads_do(&scan_cl);
   OrderAccess::acquire(); // Must order reads of hazard ptr before reads of
                           // nested reference counters
 
+  bool thread_is_protected = scan_cl.found();
+
   // Walk through the linked list of pending freeable ThreadsLists
-  // and include the ones that are currently in use by a nested
-  // ThreadsListHandle in the search set.
+  // and search the ones that are currently in use by a nested
+  // ThreadsListHandle.
   ThreadsList* current = _to_delete_list;
-  while (current != nullptr) {
-    if (current->_nested_handle_cnt != 0) {
+  while (!thread_is_protected && current != nullptr) {
+    if (current->_nested_handle_cnt != 0 && !scan_table->has_entry((void*)current)) {
       // 'current' is in use by a nested ThreadsListHandle so the hazard
       // ptr is protecting all the JavaThreads on that ThreadsList.
-      AddThreadHazardPointerThreadClosure add_cl(scan_table);
-      current->threads_do(&add_cl);
+      thread_is_protected = current->includes(thread);
     }
     current = current->next_list();
   }
-
-  bool thread_is_protected = false;
-  if (scan_table->has_entry((void*)thread)) {
-    thread_is_protected = true;
-  }
   delete scan_table;
   return thread_is_protected;
 }
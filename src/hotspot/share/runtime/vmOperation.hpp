@@ -99,6 +99,7 @@
   template(ShenandoahFinalUpdateRefs)             \
   template(ShenandoahFinalRoots)                  \
   template(ShenandoahDegeneratedGC)               \
+  template(EpsilonResetHeap)                      \
   template(Exit)                                  \
   template(LinuxDllLoad)                          \
   template(WhiteBoxOperation)                     \
@@ -129,13 +130,19 @@ class VM_Operation : public StackObj {
   };
 
  private:
+  friend class VMThread;
   Thread*         _calling_thread;
 
+  // Support for batching, accessed by the VMThread under VMOperation_lock.
+  VM_Operation*   _next_batched;
+  bool            _batched;
+  bool            _batch_done;
+
   // The VM operation name array
   static const char* _names[];
 
  public:
-  VM_Operation() : _calling_thread(nullptr) {}
+  VM_Operation() : _calling_thread(nullptr), _next_batched(nullptr), _batched(false), _batch_done(false) {}
 
   // VM operation support (used by VM thread)
   Thread* calling_thread() const                 { return _calling_thread; }
@@ -167,6 +174,13 @@ class VM_Operation : public StackObj {
   // or concurrently with Java threads running.
   virtual bool evaluate_at_safepoint() const { return true; }
 
+  // A batchable safepoint operation that finds the VMThread busy is queued
+  // and evaluated in the next safepoint the VMThread executes, together with
+  // the other queued batchable operations, instead of waiting to get a
+  // safepoint of its own. It must not depend on running right after
+  // doit_prologue(), or on the state of the VM between other operations.
+  virtual bool is_batchable() const { return false; }
+
   // Debugging
   virtual void print_on_error(outputStream* st) const;
   virtual const char* name() const  { return _names[type()]; }
@@ -151,6 +151,7 @@ class VM_PrintThreads: public VM_Operation {
   VMOp_Type type() const {
     return VMOp_PrintThreads;
   }
+  bool is_batchable() const { return true; }
   void doit();
   bool doit_prologue();
   void doit_epilogue();
@@ -187,6 +188,7 @@ class VM_FindDeadlocks: public VM_Operation {
 
   DeadlockCycle* result()      { return _deadlocks; };
   VMOp_Type type() const       { return VMOp_FindDeadlocks; }
+  bool is_batchable() const    { return true; }
   void doit();
 };
 
@@ -220,6 +222,7 @@ class VM_ThreadDump : public VM_Operation {
                 bool with_locked_synchronizers);
 
   VMOp_Type type() const { return VMOp_ThreadDump; }
+  bool is_batchable() const { return true; }
   void doit();
   bool doit_prologue();
   void doit_epilogue();
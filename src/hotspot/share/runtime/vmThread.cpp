@@ -105,6 +105,7 @@ Monitor*          VMThread::_terminate_lock     = nullptr;
 VMThread*         VMThread::_vm_thread          = nullptr;
 VM_Operation*     VMThread::_cur_vm_operation   = nullptr;
 VM_Operation*     VMThread::_next_vm_operation  = &cleanup_op; // Prevent any thread from setting an operation until VM thread is ready.
+VM_Operation*     VMThread::_batched_operations = nullptr;
 PerfCounter*      VMThread::_perf_accumulated_vm_operation_time = nullptr;
 VMOperationTimeoutTask* VMThread::_timeout_task = nullptr;
 
@@ -350,6 +351,21 @@ bool VMThread::set_next_operation(VM_Operation *op) {
   return true;
 }
 
+void VMThread::add_batched_operation(VM_Operation* op) {
+  assert_lock_strong(VMOperation_lock);
+  log_debug(vmthread)("Adding batched VM operation: %s", op->name());
+  op->_batched = true;
+  op->_next_batched = _batched_operations;
+  _batched_operations = op;
+}
+
+VM_Operation* VMThread::take_batched_operations() {
+  assert_lock_strong(VMOperation_lock);
+  VM_Operation* batch = _batched_operations;
+  _batched_operations = nullptr;
+  return batch;
+}
+
 void VMThread::wait_until_executed(VM_Operation* op) {
   MonitorLocker ml(VMOperation_lock,
                    Thread::current()->is_Java_thread() ?
@@ -362,6 +378,15 @@ void VMThread::wait_until_executed(VM_Operation* op) {
         ml.notify_all();
         break;
       }
+      if (op->is_batchable() && op->evaluate_at_safepoint()) {
+        // Let the VM Thread evaluate it in the next safepoint it executes.
+        add_batched_operation(op);
+        ml.notify_all();
+        while (!op->_batch_done) {
+          ml.wait();
+        }
+        return;
+      }
       // Wait to install this operation as the next operation in the VM Thread
       log_trace(vmthread)("A VM operation already set, waiting");
       ml.wait();
@@ -434,6 +459,11 @@ void VMThread::inner_execute(VM_Operation* op) {
 
   evaluate_operation(_cur_vm_operation);
 
+  if (end_safepoint && !_cur_vm_operation->skip_thread_oop_barriers()) {
+    // Use this safepoint for the queued batchable operations, too.
+    evaluate_batched_operations();
+  }
+
   if (end_safepoint) {
     if (has_timeout_task) {
       _timeout_task->disarm();
@@ -444,12 +474,48 @@ void VMThread::inner_execute(VM_Operation* op) {
   _cur_vm_operation = prev_vm_operation;
 }
 
+// Evaluate the queued batchable operations in the current safepoint and
+// notify their requesters.
+void VMThread::evaluate_batched_operations() {
+  assert(SafepointSynchronize::is_at_safepoint(), "must be at a safepoint");
+  VM_Operation* batch;
+  {
+    MutexLocker ml(VMOperation_lock, Mutex::_no_safepoint_check_flag);
+    batch = take_batched_operations();
+  }
+  if (batch == nullptr) {
+    return;
+  }
+
+  VM_Operation* const prev_vm_operation = _cur_vm_operation;
+  for (VM_Operation* op = batch; op != nullptr; op = op->_next_batched) {
+    log_debug(vmthread)("Evaluating batched VM operation: %s", op->name());
+    EventMarkVMOperation em("Executing batched VM operation: %s", op->name());
+    _cur_vm_operation = op;
+    evaluate_operation(op);
+  }
+  _cur_vm_operation = prev_vm_operation;
+
+  MonitorLocker ml(VMOperation_lock, Mutex::_no_safepoint_check_flag);
+  for (VM_Operation* op = batch; op != nullptr; ) {
+    // The requester may return and destroy op as soon as it sees it is done.
+    VM_Operation* next = op->_next_batched;
+    op->_batch_done = true;
+    op = next;
+  }
+  ml.notify_all();
+}
+
 void VMThread::wait_for_operation() {
   assert(Thread::current()->is_VM_thread(), "Must be the VM thread");
   MonitorLocker ml_op_lock(VMOperation_lock, Mutex::_no_safepoint_check_flag);
 
   // Clear previous operation.
   // On first call this clears a dummy place-holder.
+  if (_next_vm_operation != nullptr && _next_vm_operation->_batched) {
+    // Taken from the queued batchable operations below.
+    _next_vm_operation->_batch_done = true;
+  }
   _next_vm_operation = nullptr;
   // Notify operation is done and notify a next operation can be installed.
   ml_op_lock.notify_all();
@@ -473,6 +539,16 @@ void VMThread::wait_for_operation() {
     assert(_next_vm_operation == nullptr, "Must be");
     assert(_cur_vm_operation  == nullptr, "Must be");
 
+    if (_batched_operations != nullptr) {
+      // No other operation to piggyback on; execute one of the queued ones,
+      // which also evaluates the rest of them in its safepoint.
+      VM_Operation* batch = take_batched_operations();
+      _next_vm_operation = batch;
+      _batched_operations = batch->_next_batched;
+      batch->_next_batched = nullptr;
+      return;
+    }
+
     setup_periodic_safepoint_if_needed();
     if (_next_vm_operation != nullptr) {
       return;
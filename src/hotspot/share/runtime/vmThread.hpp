@@ -74,6 +74,7 @@ class VMThread: public NamedThread {
   static void setup_periodic_safepoint_if_needed();
 
   void evaluate_operation(VM_Operation* op);
+  void evaluate_batched_operations();
   void inner_execute(VM_Operation* op);
   void wait_for_operation();
 
@@ -140,8 +141,11 @@ class VMThread: public NamedThread {
   // VM_Operation support
   static VM_Operation*     _cur_vm_operation;   // Current VM operation
   static VM_Operation*     _next_vm_operation;  // Next VM operation
+  static VM_Operation*     _batched_operations; // Queued batchable VM operations
 
   bool set_next_operation(VM_Operation *op);    // Set the _next_vm_operation if possible.
+  static void add_batched_operation(VM_Operation* op);
+  static VM_Operation* take_batched_operations();
 
   // Pointer to single-instance of VM thread
   static VMThread*     _vm_thread;
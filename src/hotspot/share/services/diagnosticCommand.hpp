@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2011, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2011, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -248,6 +248,19 @@ public:
   virtual void execute(DCmdSource source, TRAPS);
 };
 
+class SafepointStatsDCmd : public DCmd {
+public:
+  SafepointStatsDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
+  static const char* name() { return "VM.safepoint_stats"; }
+  static const char* description() {
+    return "Print safepoint latency statistics per VM operation type.";
+  }
+  static const char* impact() {
+    return "Low";
+  }
+  virtual void execute(DCmdSource source, TRAPS);
+};
+
 class SystemGCDCmd : public DCmd {
 public:
   SystemGCDCmd(outputStream* output, bool heap) : DCmd(output, heap) { }
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2005, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2005, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -703,6 +703,9 @@ class ParDumpWriter : public AbstractDumpWriter {
   CompressionBackend* _backend_ptr;
   char const * _err;
   ParWriterBufferQueue* _buffer_queue;
+  // Buffers already sent to the backend, kept to be reused as internal buffer.
+  // This avoids allocating (and page faulting in) a fresh buffer for every flush.
+  ParWriterBufferQueue* _free_queue;
   size_t _internal_buffer_used;
   char* _buffer_base;
   bool _split_data;
@@ -730,6 +733,7 @@ class ParDumpWriter : public AbstractDumpWriter {
     AbstractDumpWriter(),
     _backend_ptr(dw->backend_ptr()),
     _buffer_queue((new (std::nothrow) ParWriterBufferQueue())),
+    _free_queue((new (std::nothrow) ParWriterBufferQueue())),
     _buffer_base(nullptr),
     _split_data(false) {
     // prepare internal buffer
@@ -746,6 +750,14 @@ class ParDumpWriter : public AbstractDumpWriter {
      }
      delete _buffer_queue;
      _buffer_queue = nullptr;
+     assert(_free_queue != nullptr, "Sanity check");
+     while (!_free_queue->is_empty()) {
+       ParWriterBufferQueueElem* entry = _free_queue->dequeue();
+       os::free(entry->_buffer);
+       os::free(entry);
+     }
+     delete _free_queue;
+     _free_queue = nullptr;
   }
 
   // total number of bytes written to the disk
@@ -791,7 +803,13 @@ class ParDumpWriter : public AbstractDumpWriter {
   void allocate_internal_buffer() {
     assert(_buffer_queue != nullptr, "Internal buffer queue is not ready when allocate internal buffer");
     assert(_buffer == nullptr && _buffer_base == nullptr, "current buffer must be null before allocate");
-    _buffer_base = _buffer = (char*)os::malloc(io_buffer_max_size, mtInternal);
+    ParWriterBufferQueueElem* free_entry = _free_queue->dequeue();
+    if (free_entry != nullptr) {
+      _buffer_base = _buffer = free_entry->_buffer;
+      os::free(free_entry);
+    } else {
+      _buffer_base = _buffer = (char*)os::malloc(io_buffer_max_size, mtInternal);
+    }
     if (_buffer == nullptr) {
       set_error("Could not allocate buffer for writer");
       return;
@@ -841,9 +859,9 @@ class ParDumpWriter : public AbstractDumpWriter {
 
   void reclaim_entry(ParWriterBufferQueueElem* entry) {
     assert(entry != nullptr && entry->_buffer != nullptr, "Invalid entry to reclaim");
-    os::free(entry->_buffer);
-    entry->_buffer = nullptr;
-    os::free(entry);
+    // Keep the buffer for reuse by allocate_internal_buffer().
+    entry->_used = 0;
+    _free_queue->enqueue(entry);
   }
 
   void flush_buffer(char* buffer, size_t used) {
@@ -863,7 +881,7 @@ class ParDumpWriter : public AbstractDumpWriter {
     while (!_buffer_queue->is_empty()) {
       ParWriterBufferQueueElem* entry = _buffer_queue->dequeue();
       flush_buffer(entry->_buffer, entry->_used);
-      // Delete buffer and entry.
+      // Recycle buffer and entry.
       reclaim_entry(entry);
       entry = nullptr;
     }
@@ -871,12 +889,11 @@ class ParDumpWriter : public AbstractDumpWriter {
     // Flush internal buffer.
     if (_internal_buffer_used > 0) {
       flush_buffer(_buffer_base, _internal_buffer_used);
-      os::free(_buffer_base);
+      // The data has been copied to the backend, reuse the internal buffer.
+      _buffer = _buffer_base;
       _pos = 0;
       _internal_buffer_used = 0;
-      _buffer_base = _buffer = nullptr;
-      // Allocate internal buffer for future use.
-      allocate_internal_buffer();
+      _size = io_buffer_max_size;
     }
   }
 };
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2014, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2014, 2024, Oracle and/or its affiliates. All rights reserved.
  * Copyright (c) 2021, 2023 SAP SE. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
@@ -144,9 +144,10 @@ class MallocMemorySnapshot {
   friend class MallocMemorySummary;
 
  private:
+  // There is deliberately no counter for the totals: every malloc would have
+  // to update it atomically, making it a point of contention for all threads.
+  // The totals are summed up over the types instead.
   MallocMemory      _malloc[mt_number_of_types];
-  MemoryCounter     _all_mallocs;
-
 
  public:
   inline MallocMemory* by_type(MEMFLAGS flags) {
@@ -160,18 +161,14 @@ class MallocMemorySnapshot {
   }
 
   inline size_t malloc_overhead() const {
-    return _all_mallocs.count() * sizeof(MallocHeader);
+    return total_count() * sizeof(MallocHeader);
   }
 
   // Total malloc invocation count
-  size_t total_count() const {
-    return _all_mallocs.count();
-  }
+  size_t total_count() const;
 
   // Total malloc'd memory amount
-  size_t total() const {
-    return _all_mallocs.size() + malloc_overhead() + total_arena();
-  }
+  size_t total() const;
 
   // Total malloc'd memory used by arenas
   size_t total_arena() const;
@@ -181,7 +178,6 @@ class MallocMemorySnapshot {
     // copy is going on, because their size is adjusted using this
     // buffer in make_adjustment().
     ThreadCritical tc;
-    s->_all_mallocs = _all_mallocs;
     for (int index = 0; index < mt_number_of_types; index ++) {
       s->_malloc[index] = _malloc[index];
     }
@@ -214,12 +210,10 @@ class MallocMemorySummary : AllStatic {
 
    static inline void record_malloc(size_t size, MEMFLAGS flag) {
      as_snapshot()->by_type(flag)->record_malloc(size);
-     as_snapshot()->_all_mallocs.allocate(size);
    }
 
    static inline void record_free(size_t size, MEMFLAGS flag) {
      as_snapshot()->by_type(flag)->record_free(size);
-     as_snapshot()->_all_mallocs.deallocate(size);
    }
 
    static inline void record_new_arena(MEMFLAGS flag) {
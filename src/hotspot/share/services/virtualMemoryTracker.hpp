@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -405,6 +405,13 @@ class VirtualMemoryTracker : AllStatic {
 
  private:
   static SortedLinkedList<ReservedMemoryRegion, compare_reserved_region_base>* _reserved_regions;
+
+  // The reserved region of the most recent commit or uncommit. Most commits and
+  // uncommits are done within a few large reservations, e.g. the Java heap, while
+  // the list of reserved regions also has an entry for every thread stack.
+  static ReservedMemoryRegion* _last_committed_reserved_region;
+
+  static ReservedMemoryRegion* find_committed_reserved_region(address addr, size_t size);
 };
 
 #endif // SHARE_SERVICES_VIRTUALMEMORYTRACKER_HPP
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2006, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2006, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -78,7 +78,12 @@ public:
     address src_end = (address)src + byte_count;
 
     if (dst <= src || dst >= src_end) {
-      do_conjoint_swap<RIGHT,swap>(src, dst, byte_count, elem_size);
+      if (swap && elem_size < sizeof(uint64_t)) {
+        // Swap several small elements at once.
+        do_conjoint_swap_words(src, dst, byte_count, elem_size);
+      } else {
+        do_conjoint_swap<RIGHT,swap>(src, dst, byte_count, elem_size);
+      }
     } else {
       do_conjoint_swap<LEFT,swap>(src, dst, byte_count, elem_size);
     }
@@ -179,6 +184,58 @@ private:
   }
 
 
+  // Byte swap each of the 2 or 4 byte elements contained in the word.
+  // The elements are equally sized and aligned within the word, so this
+  // is independent of the platform's byte order.
+  template <typename T>
+  static uint64_t swap_elements_in_word(uint64_t word) {
+    STATIC_ASSERT(sizeof(T) == 2 || sizeof(T) == 4);
+    if (sizeof(T) == 2) {
+      const uint64_t even_bytes = UCONST64(0x00FF00FF00FF00FF);
+      return ((word & even_bytes) << 8) | ((word >> 8) & even_bytes);
+    } else {
+      // Reversing all bytes of the word also exchanges the two elements.
+      word = byteswap(word);
+      return (word << 32) | (word >> 32);
+    }
+  }
+
+  /**
+   * Copy and byte swap 2 or 4 byte elements a 64-bit word at a time, from
+   * lower to higher addresses. Remaining elements that do not fill a whole
+   * word are copied one at a time.
+   *
+   * <T> - type of element to copy
+   *
+   * @param src address of source
+   * @param dst address of destination
+   * @param byte_count number of bytes to copy
+   */
+  template <typename T>
+  static void do_conjoint_swap_words(const void* src, void* dst, size_t byte_count) {
+    const char* cur_src = (const char*)src;
+    char* cur_dst = (char*)dst;
+    const size_t word_bytes = align_down(byte_count, sizeof(uint64_t));
+
+    for (size_t i = 0; i < word_bytes; i += sizeof(uint64_t)) {
+      uint64_t tmp;
+      memcpy(&tmp, cur_src + i, sizeof(tmp));
+      tmp = swap_elements_in_word<T>(tmp);
+      memcpy(cur_dst + i, &tmp, sizeof(tmp));
+    }
+    if (word_bytes < byte_count) {
+      do_conjoint_swap<T,RIGHT,true>(cur_src + word_bytes, cur_dst + word_bytes, byte_count - word_bytes);
+    }
+  }
+
+  static void do_conjoint_swap_words(const void* src, void* dst, size_t byte_count, size_t elem_size) {
+    switch (elem_size) {
+    case 2: do_conjoint_swap_words<uint16_t>(src, dst, byte_count); break;
+    case 4: do_conjoint_swap_words<uint32_t>(src, dst, byte_count); break;
+    default: guarantee(false, "do_conjoint_swap_words: Invalid elem_size " SIZE_FORMAT "\n", elem_size);
+    }
+  }
+
   /**
    * Copy and byte swap elements
    *
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 1994, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 1994, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -57,6 +57,12 @@ readSingle(JNIEnv *env, jobject this, jfieldID fid) {
  */
 #define BUF_SIZE 8192
 
+/* The maximum size of a malloc'ed buffer. Larger transfers are done in
+ * chunks of this size, so that they neither allocate and fault in a fresh
+ * mapping of the full length nor hold on to that much native memory.
+ */
+#define MAX_MALLOC_SIZE (64 * 1024)
+
 /*
  * Returns true if the array slice defined by the given offset and length
  * is out of bounds.
@@ -92,6 +98,10 @@ readBytes(JNIEnv *env, jobject this, jbyteArray bytes,
     if (len == 0) {
         return 0;
     } else if (len > BUF_SIZE) {
+        /* A short read is permitted, do not read more than fits the buffer */
+        if (len > MAX_MALLOC_SIZE) {
+            len = MAX_MALLOC_SIZE;
+        }
         buf = malloc(len);
         if (buf == NULL) {
             JNU_ThrowOutOfMemoryError(env, NULL);
@@ -147,6 +157,9 @@ writeBytes(JNIEnv *env, jobject this, jbyteArray bytes,
            jint off, jint len, jboolean append, jfieldID fid)
 {
     jint n;
+    jint pos;
+    jint chunk;
+    jint bufSize;
     char stackBuf[BUF_SIZE];
     char *buf = NULL;
     FD fd;
@@ -164,37 +177,47 @@ writeBytes(JNIEnv *env, jobject this, jbyteArray bytes,
     if (len == 0) {
         return;
     } else if (len > BUF_SIZE) {
-        buf = malloc(len);
+        bufSize = len < MAX_MALLOC_SIZE ? len : MAX_MALLOC_SIZE;
+        buf = malloc(bufSize);
         if (buf == NULL) {
             JNU_ThrowOutOfMemoryError(env, NULL);
             return;
         }
     } else {
+        bufSize = BUF_SIZE;
         buf = stackBuf;
     }
 
-    (*env)->GetByteArrayRegion(env, bytes, off, len, (jbyte *)buf);
-
-    if (!(*env)->ExceptionOccurred(env)) {
-        off = 0;
-        while (len > 0) {
+    /* Copy and write the array slice a buffer-full at a time */
+    while (len > 0) {
+        chunk = len < bufSize ? len : bufSize;
+        (*env)->GetByteArrayRegion(env, bytes, off, chunk, (jbyte *)buf);
+        if ((*env)->ExceptionOccurred(env)) {
+            break;
+        }
+        pos = 0;
+        while (pos < chunk) {
             fd = getFD(env, this, fid);
             if (fd == -1) {
                 JNU_ThrowIOException(env, "Stream Closed");
                 break;
             }
             if (append == JNI_TRUE) {
-                n = IO_Append(fd, buf+off, len);
+                n = IO_Append(fd, buf+pos, chunk-pos);
             } else {
-                n = IO_Write(fd, buf+off, len);
+                n = IO_Write(fd, buf+pos, chunk-pos);
             }
             if (n == -1) {
                 JNU_ThrowIOExceptionWithLastError(env, "Write error");
                 break;
             }
-            off += n;
-            len -= n;
+            pos += n;
+        }
+        if (pos < chunk) {
+            break;
         }
+        off += chunk;
+        len -= chunk;
     }
     if (buf != stackBuf) {
         free(buf);
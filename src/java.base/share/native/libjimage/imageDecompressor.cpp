@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2022, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2024, Oracle and/or its affiliates. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -157,8 +157,13 @@ void ImageDecompressor::decompress_resource(u1* compressed, u1* uncompressed,
         compressed_resource += 1;
         has_header = _header._magic == ResourceHeader::resource_header_magic;
         if (has_header) {
+            // The last decompressor of the stack produces the actual resource,
+            // decompress it in place rather than through a temporary buffer.
+            bool in_place = _header._is_terminal == 1 &&
+                            _header._uncompressed_size == uncompressed_size;
             // decompressed_resource array contains the result of decompression
-            decompressed_resource = new u1[(size_t) _header._uncompressed_size];
+            decompressed_resource = in_place ? uncompressed :
+                                    new u1[(size_t) _header._uncompressed_size];
             // Retrieve the decompressor name
             const char* decompressor_name = strings->get(_header._decompressor_name_offset);
             assert(decompressor_name && "image decompressor not found");
@@ -171,6 +176,9 @@ void ImageDecompressor::decompress_resource(u1* compressed, u1* uncompressed,
             if (compressed_resource_base != compressed) {
                 delete[] compressed_resource_base;
             }
+            if (in_place) {
+                return;
+            }
             compressed_resource = decompressed_resource;
         }
     } while (has_header);
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2024, Oracle and/or its affiliates. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -161,23 +161,19 @@ ImageModuleData::~ImageModuleData() {
 
 // Return the module in which a package resides.    Returns NULL if not found.
 const char* ImageModuleData::package_to_module(const char* package_name) {
-    // replace all '/' by '.'
-    char* replaced = new char[(int) strlen(package_name) + 1];
-    assert(replaced != NULL && "allocation failed");
+    // build path /packages/<package_name>, replacing all '/' by '.'
+    const char* radical = "/packages/";
+    int radical_length = (int) strlen(radical);
+    char* path = new char[radical_length + (int) strlen(package_name) + 1];
+    assert(path != NULL && "allocation failed");
+    strcpy(path, radical);
+    char* replaced = path + radical_length;
     int i;
     for (i = 0; package_name[i] != '\0'; i++) {
       replaced[i] = package_name[i] == '/' ? '.' : package_name[i];
     }
     replaced[i] = '\0';
 
-    // build path /packages/<package_name>
-    const char* radical = "/packages/";
-    char* path = new char[(int) strlen(radical) + (int) strlen(package_name) + 1];
-    assert(path != NULL && "allocation failed");
-    strcpy(path, radical);
-    strcat(path, replaced);
-    delete[] replaced;
-
     // retrieve package location
     ImageLocation location;
     bool found = _image_file->find_location(path, location);
@@ -186,24 +182,34 @@ const char* ImageModuleData::package_to_module(const char* package_name) {
         return NULL;
     }
 
-    // retrieve offsets to module name
+    // retrieve offsets to module name, directly from the mapped image if possible
     int size = (int)location.get_attribute(ImageLocation::ATTRIBUTE_UNCOMPRESSED);
-    u1* content = new u1[size];
-    assert(content != NULL && "allocation failed");
-    _image_file->get_resource(location, content);
+    u1* content = _image_file->get_mapped_resource(location);
+    bool is_copy = content == NULL;
+    if (is_copy) {
+        content = new u1[size];
+        assert(content != NULL && "allocation failed");
+        _image_file->get_resource(location, content);
+    }
     u1* ptr = content;
     // sequence of sizeof(8) isEmpty|offset. Use the first module that is not empty.
+    // The mapped resource is not necessarily aligned, so copy the values out.
     u4 offset = 0;
     for (i = 0; i < size; i+=8) {
-        u4 isEmpty = _endian->get(*((u4*)ptr));
+        u4 isEmpty;
+        memcpy(&isEmpty, ptr, sizeof(u4));
+        isEmpty = _endian->get(isEmpty);
         ptr += 4;
         if (!isEmpty) {
-            offset = _endian->get(*((u4*)ptr));
+            memcpy(&offset, ptr, sizeof(u4));
+            offset = _endian->get(offset);
             break;
         }
         ptr += 4;
     }
-    delete[] content;
+    if (is_copy) {
+        delete[] content;
+    }
     return _image_file->get_strings().get(offset);
 }
 
@@ -532,6 +538,16 @@ void ImageFileReader::get_resource(u4 offset, u1* uncompressed_data) const {
         get_resource(location, uncompressed_data);
 }
 
+// Return the address of the resource for the supplied location in the mapped
+// image, or NULL if the image is not fully mapped or the resource is compressed.
+u1* ImageFileReader::get_mapped_resource(ImageLocation& location) const {
+    if (!memory_map_image ||
+        location.get_attribute(ImageLocation::ATTRIBUTE_COMPRESSED) != 0) {
+        return NULL;
+    }
+    return get_data_address() + location.get_attribute(ImageLocation::ATTRIBUTE_OFFSET);
+}
+
 // Return the resource for the supplied location.
 void ImageFileReader::get_resource(ImageLocation& location, u1* uncompressed_data) const {
     // Retrieve the byte offset and size of the resource.
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2015, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2015, 2024, Oracle and/or its affiliates. All rights reserved.
  *
  * Redistribution and use in source and binary forms, with or without
  * modification, are permitted provided that the following conditions
@@ -578,6 +578,10 @@ public:
     // Return the resource for the supplied path.
     void get_resource(ImageLocation& location, u1* uncompressed_data) const;
 
+    // Return the address of the resource for the supplied location in the
+    // mapped image, or NULL if the resource has to be read with get_resource.
+    u1* get_mapped_resource(ImageLocation& location) const;
+
     // Return the ImageModuleData for this image
     ImageModuleData * get_image_module_data();
 
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2013, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2013, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -31,6 +31,9 @@
 #include <string.h>
 #include <unistd.h>
 #include <limits.h>
+#if defined(__linux__)
+#include <sys/syscall.h>
+#endif
 
 #include "childproc.h"
 
@@ -77,6 +80,15 @@ closeDescriptors(void)
     struct dirent *dirp;
     int from_fd = FAIL_FILENO + 1;
 
+#if defined(__linux__) && defined(SYS_close_range)
+    /* Close all file descriptors with a single system call if the kernel
+     * supports close_range (Linux 5.9+), otherwise fall back to walking
+     * the open file descriptors. */
+    if (syscall(SYS_close_range, from_fd, ~0U, 0) == 0) {
+        return 1;
+    }
+#endif
+
     /* We're trying to close all file descriptors, but opendir() might
      * itself be implemented using a file descriptor, and we certainly
      * don't want to close that while it's in use.  We assume that if
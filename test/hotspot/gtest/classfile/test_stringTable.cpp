@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+
+#include "precompiled.hpp"
+#include "classfile/javaClasses.inline.hpp"
+#include "classfile/stringTable.hpp"
+#include "memory/resourceArea.hpp"
+#include "oops/oop.inline.hpp"
+#include "runtime/handles.inline.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "unittest.hpp"
+
+// Intern a set of strings, some of them with their String.hashCode() already
+// computed as it is for strings used from Java, and check that lookups and
+// repeated interning find the same strings.
+TEST_VM(StringTable, intern_and_lookup) {
+  JavaThread* THREAD = JavaThread::current();
+  ThreadInVMfromNative invm(THREAD);
+  ResourceMark rm(THREAD);
+  HandleMark hm(THREAD);
+
+  const int num_strings = 10000;
+  GrowableArray<Handle> interned(num_strings);
+  char buf[64];
+  for (int i = 0; i < num_strings; i++) {
+    os::snprintf_checked(buf, sizeof(buf), "test_stringTable_%d", i);
+    oop s = StringTable::intern(buf, THREAD);
+    ASSERT_FALSE(HAS_PENDING_EXCEPTION);
+    if (i % 2 == 0) {
+      java_lang_String::hash_code(s);
+    }
+    interned.append(Handle(THREAD, s));
+  }
+
+  for (int i = 0; i < num_strings; i++) {
+    os::snprintf_checked(buf, sizeof(buf), "test_stringTable_%d", i);
+    oop s = StringTable::intern(buf, THREAD);
+    ASSERT_FALSE(HAS_PENDING_EXCEPTION);
+    ASSERT_EQ(s, interned.at(i)()) << "interned twice: " << buf;
+
+    int len;
+    jchar* chars = java_lang_String::as_unicode_string(s, len, THREAD);
+    ASSERT_EQ(StringTable::lookup(chars, len), interned.at(i)()) << "lookup failed: " << buf;
+  }
+
+  os::snprintf_checked(buf, sizeof(buf), "test_stringTable_%d", num_strings);
+  int len = (int)strlen(buf);
+  jchar* missing = NEW_RESOURCE_ARRAY(jchar, len);
+  for (int i = 0; i < len; i++) {
+    missing[i] = buf[i];
+  }
+  ASSERT_TRUE(StringTable::lookup(missing, len) == nullptr);
+}
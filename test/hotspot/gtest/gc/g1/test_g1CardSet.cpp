@@ -27,10 +27,12 @@
 #include "gc/g1/g1CardSetMemory.hpp"
 #include "gc/g1/g1MonotonicArenaFreePool.hpp"
 #include "gc/g1/heapRegionRemSet.hpp"
+#include "gc/shared/gc_globals.hpp"
 #include "gc/shared/gcTraceTime.inline.hpp"
 #include "gc/shared/workerThread.hpp"
 #include "logging/log.hpp"
 #include "memory/allocation.hpp"
+#include "runtime/flags/flagSetting.hpp"
 #include "unittest.hpp"
 #include "utilities/powerOfTwo.hpp"
 
@@ -78,6 +80,7 @@ public:
 
   static void cardset_basic_test();
   static void cardset_mt_test();
+  static void cardset_howl_runs_test();
 
   static void add_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards, G1AddCardResult* results);
   static void contains_cards(G1CardSet* card_set, uint cards_per_region, uint* cards, uint num_cards);
@@ -479,6 +482,61 @@ void G1CardSetTest::cardset_mt_test() {
   ASSERT_TRUE(count_cards._num_cards <= cl.added());
 }
 
+void G1CardSetTest::cardset_howl_runs_test() {
+  FlagSetting fs(G1RemSetUseHowlRuns, true);
+
+  const uint CardsPerRegion = 16384;
+  const double FullCardSetThreshold = 0.8;
+  const double BitmapCoarsenThreshold = 0.9;
+
+  G1CardSetConfiguration config(16,
+                                BitmapCoarsenThreshold,
+                                8,
+                                FullCardSetThreshold,
+                                CardsPerRegion,
+                                0);
+  ASSERT_GT(config.max_runs_in_howl_runs(), 4u);
+
+  G1CardSetFreePool free_pool(config.num_mem_object_types());
+  G1CardSetMemoryManager mm(&config, &free_pool);
+
+  G1CardSet card_set(&config, &mm);
+
+  // A few runs of cards within the first Howl bucket; the runs of cards container
+  // replaces the array of cards.
+  const uint NumRuns = 4;
+  const uint CardsPerRun = 20;
+  uint cards1[NumRuns * CardsPerRun];
+  const uint NumCards1 = ARRAY_SIZE(cards1);
+  for (uint i = 0; i < NumCards1; i++) {
+    cards1[i] = (i / CardsPerRun) * 100 + (i % CardsPerRun);
+  }
+  translate_cards(CardsPerRegion, 7, cards1, ARRAY_SIZE(cards1));
+  add_cards(&card_set, CardsPerRegion, cards1, ARRAY_SIZE(cards1), NULL);
+  contains_cards(&card_set, CardsPerRegion, cards1, ARRAY_SIZE(cards1));
+  ASSERT_EQ(card_set.occupied(), ARRAY_SIZE(cards1));
+  check_iteration(&card_set, card_set.occupied());
+
+  // Scattered cards in the same bucket make the runs of cards container overflow
+  // into a bitmap.
+  uint cards2[2 * (NumRuns + 16)];
+  for (uint i = 0; i < ARRAY_SIZE(cards2); i++) {
+    cards2[i] = 1000 + 2 * i;
+  }
+  translate_cards(CardsPerRegion, 7, cards2, ARRAY_SIZE(cards2));
+  add_cards(&card_set, CardsPerRegion, cards2, ARRAY_SIZE(cards2), NULL);
+  contains_cards(&card_set, CardsPerRegion, cards2, ARRAY_SIZE(cards2));
+  // contains_cards() overwrote the entries of cards1, so check them directly.
+  for (uint i = 0; i < NumRuns * CardsPerRun; i++) {
+    ASSERT_TRUE(card_set.contains_card(7, (i / CardsPerRun) * 100 + (i % CardsPerRun)));
+  }
+  ASSERT_EQ(card_set.occupied(), NumCards1 + ARRAY_SIZE(cards2));
+  check_iteration(&card_set, card_set.occupied());
+
+  card_set.clear();
+  ASSERT_TRUE(card_set.occupied() == 0);
+}
+
 TEST_VM(G1CardSetTest, basic_cardset_test) {
   G1CardSetTest::cardset_basic_test();
 }
@@ -486,3 +544,7 @@ TEST_VM(G1CardSetTest, basic_cardset_test) {
 TEST_VM(G1CardSetTest, mt_cardset_test) {
   G1CardSetTest::cardset_mt_test();
 }
+
+TEST_VM(G1CardSetTest, howl_runs_cardset_test) {
+  G1CardSetTest::cardset_howl_runs_test();
+}
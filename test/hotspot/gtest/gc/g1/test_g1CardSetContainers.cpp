@@ -42,6 +42,7 @@ public:
   static void cardset_inlineptr_test(uint bits_per_card);
   static void cardset_array_test(uint cards_per_array);
   static void cardset_bitmap_test(uint threshold, uint size_in_bits);
+  static void cardset_runs_test(uint runs_per_container, uint cards_per_run);
 };
 
 class G1FindCardsInRange : public StackObj {
@@ -235,6 +236,90 @@ void G1CardSetContainersTest::cardset_bitmap_test(uint threshold, uint size_in_b
   FREE_C_HEAP_ARRAY(mtGC, cardset_data);
 }
 
+void G1CardSetContainersTest::cardset_runs_test(uint runs_per_container, uint cards_per_run) {
+  uint8_t* cardset_data = NEW_C_HEAP_ARRAY(uint8_t, G1CardSetRuns::size_in_bytes(runs_per_container), mtGC);
+  G1CardSetRuns* cards = new (cardset_data) G1CardSetRuns(1, runs_per_container);
+
+  ASSERT_TRUE(cards->contains(1)); // Added during initialization
+  ASSERT_TRUE(cards->num_entries() == 1); // Check it's the only one.
+
+  // Runs are separated by a single card not in the set; run i starts at card
+  // i * stride + 1.
+  uint const stride = cards_per_run + 1;
+
+  G1AddCardResult res;
+
+  // Extend the first run at its end, all others at their start.
+  for (uint i = 2; i <= cards_per_run; i++) {
+    res = cards->add(i);
+    ASSERT_TRUE(res == Added);
+  }
+  for (uint run = 1; run < runs_per_container; run++) {
+    for (uint i = cards_per_run; i > 0; i--) {
+      res = cards->add(run * stride + i);
+      ASSERT_TRUE(res == Added);
+    }
+  }
+  ASSERT_TRUE(cards->num_entries() == runs_per_container);
+
+  // Check they are in the container, but not the separating cards.
+  for (uint run = 0; run < runs_per_container; run++) {
+    ASSERT_TRUE(!cards->contains(run * stride));
+    for (uint i = 1; i <= cards_per_run; i++) {
+      ASSERT_TRUE(cards->contains(run * stride + i));
+    }
+  }
+
+  // Try to add again, should all return that the card had been added.
+  for (uint run = 0; run < runs_per_container; run++) {
+    for (uint i = 1; i <= cards_per_run; i++) {
+      res = cards->add(run * stride + i);
+      ASSERT_TRUE(res == Found);
+    }
+  }
+
+  // Should be no more space for a new run.
+  {
+    res = cards->add(runs_per_container * stride + 1);
+    ASSERT_TRUE(res == Overflow);
+  }
+
+  // But runs can still be extended.
+  {
+    res = cards->add(runs_per_container * stride);
+    ASSERT_TRUE(res == Added);
+    ASSERT_TRUE(cards->num_entries() == runs_per_container);
+  }
+  uint const num_cards = runs_per_container * cards_per_run + 1;
+
+  // Verify iteration finds all cards too.
+  {
+    uint num_found = 0;
+    auto check_card = [&] (uint card_idx) {
+      ASSERT_TRUE(cards->contains(card_idx));
+      num_found++;
+    };
+    cards->iterate_cards(check_card);
+    ASSERT_EQ(num_found, num_cards);
+  }
+
+  {
+    uint num_runs = 0;
+    uint num_found = 0;
+    auto check_run = [&] (uint card_idx, uint length) {
+      ASSERT_TRUE(cards->contains(card_idx));
+      ASSERT_TRUE(cards->contains(card_idx + length - 1));
+      num_runs++;
+      num_found += length;
+    };
+    cards->iterate_runs(check_run);
+    ASSERT_EQ(num_runs, runs_per_container);
+    ASSERT_EQ(num_found, num_cards);
+  }
+
+  FREE_C_HEAP_ARRAY(mtGC, cardset_data);
+}
+
 TEST_VM_F(G1CardSetContainersTest, basic_cardset_inptr_test) {
   uint const min = (uint)log2i(HeapRegionBounds::min_size());
   uint const max = (uint)log2i(HeapRegionBounds::max_size());
@@ -261,3 +346,14 @@ TEST_VM_F(G1CardSetContainersTest, basic_cardset_bitmap_test) {
     G1CardSetContainersTest::cardset_bitmap_test(threshold_sizes[i], bit_sizes[i]);
   }
 }
+
+TEST_VM_F(G1CardSetContainersTest, basic_cardset_runs_test) {
+  uint run_counts[] = { 1, 4, 16 };
+  uint run_lengths[] = { 1, 3, 100 };
+
+  for (uint i = 0; i < ARRAY_SIZE(run_counts); i++) {
+    for (uint j = 0; j < ARRAY_SIZE(run_lengths); j++) {
+      G1CardSetContainersTest::cardset_runs_test(run_counts[i], run_lengths[j]);
+    }
+  }
+}
@@ -0,0 +1,164 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1CardTable.hpp"
+#include "gc/g1/g1CardTableChunkScanner.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/os.hpp"
+#include "utilities/align.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "unittest.hpp"
+
+using CardValue = G1CardTable::CardValue;
+
+class G1CardTableChunkScannerTest : public ::testing::Test {
+protected:
+  static CardValue* allocate_cards(size_t num_cards) {
+    // C heap allocations are at least word aligned.
+    CardValue* cards = NEW_C_HEAP_ARRAY(CardValue, num_cards, mtGC);
+    assert(is_aligned(cards, sizeof(size_t)), "must be");
+    return cards;
+  }
+
+  // Fill cards with dirty cards with the given probability in percent. Non-dirty
+  // cards are either clean or already scanned.
+  static void fill_cards(CardValue* cards, size_t num_cards, uint dirty_percent, unsigned int seed) {
+    for (size_t i = 0; i < num_cards; i++) {
+      seed = os::next_random(seed);
+      if ((seed % 100) < dirty_percent) {
+        cards[i] = G1CardTable::dirty_card_val();
+      } else if ((seed & 0x100) != 0) {
+        cards[i] = G1CardTable::clean_card_val();
+      } else {
+        cards[i] = G1CardTable::g1_scanned_card_val();
+      }
+    }
+  }
+
+  static bool is_dirty(const CardValue* card) {
+    return (*card & G1CardTable::g1_card_already_scanned) == 0;
+  }
+
+  // Verify that the scanner reports exactly the runs of dirty cards in the chunk.
+  static void verify_chunk(CardValue* start, CardValue* end) {
+    CardValue* expected = start;
+    G1CardTableChunkScanner scanner(start, end);
+    scanner.on_dirty_cards([&] (CardValue* dirty_l, CardValue* dirty_r) {
+      while (expected < dirty_l) {
+        ASSERT_FALSE(is_dirty(expected)) << "missed dirty card " << (expected - start);
+        expected++;
+      }
+      ASSERT_LT(dirty_l, dirty_r);
+      while (expected < dirty_r) {
+        ASSERT_TRUE(is_dirty(expected)) << "non-dirty card " << (expected - start) << " in run";
+        expected++;
+      }
+      ASSERT_TRUE(dirty_r == end || !is_dirty(dirty_r)) << "run ends early at " << (dirty_r - start);
+    });
+    while (expected < end) {
+      ASSERT_FALSE(is_dirty(expected)) << "missed dirty card " << (expected - start);
+      expected++;
+    }
+  }
+};
+
+TEST_VM_F(G1CardTableChunkScannerTest, patterns) {
+  const size_t num_cards = 4096;
+  CardValue* cards = allocate_cards(num_cards);
+
+  const uint percentages[] = { 0, 1, 10, 50, 90, 99, 100 };
+  for (uint percent : percentages) {
+    for (unsigned int seed = 1; seed <= 10; seed++) {
+      fill_cards(cards, num_cards, percent, seed);
+      // Use chunks of different (word aligned) sizes and offsets to cover the
+      // block and word wise paths and their transitions.
+      for (size_t chunk_size = sizeof(size_t); chunk_size <= 512; chunk_size *= 2) {
+        for (size_t start = 0; start + chunk_size <= num_cards; start += chunk_size) {
+          verify_chunk(cards + start, cards + start + chunk_size);
+        }
+      }
+    }
+  }
+
+  FREE_C_HEAP_ARRAY(CardValue, cards);
+}
+
+// Count the dirty cards and runs of dirty cards of a large card table chunk by
+// chunk, and compare against a card by card count. Runs are split at chunk
+// boundaries.
+TEST_VM_F(G1CardTableChunkScannerTest, totals) {
+  const size_t num_cards = 1 * M;
+  const size_t chunk_size = 512;
+  CardValue* cards = allocate_cards(num_cards);
+
+  const uint percentages[] = { 0, 1, 10, 50, 100 };
+  for (uint percent : percentages) {
+    fill_cards(cards, num_cards, percent, 42);
+
+    size_t expected_runs = 0;
+    size_t expected_dirty = 0;
+    for (size_t i = 0; i < num_cards; i++) {
+      if (is_dirty(&cards[i])) {
+        expected_dirty++;
+        if (i % chunk_size == 0 || !is_dirty(&cards[i - 1])) {
+          expected_runs++;
+        }
+      }
+    }
+
+    size_t num_runs = 0;
+    size_t num_dirty = 0;
+    for (size_t start = 0; start < num_cards; start += chunk_size) {
+      G1CardTableChunkScanner scanner(cards + start, cards + start + chunk_size);
+      scanner.on_dirty_cards([&] (CardValue* dirty_l, CardValue* dirty_r) {
+        num_runs++;
+        num_dirty += pointer_delta(dirty_r, dirty_l, sizeof(CardValue));
+      });
+    }
+    ASSERT_EQ(expected_dirty, num_dirty) << "dirty " << percent << "%";
+    ASSERT_EQ(expected_runs, num_runs) << "dirty " << percent << "%";
+  }
+
+  FREE_C_HEAP_ARRAY(CardValue, cards);
+}
+
+// Single dirty cards and short runs at every position of a chunk, including
+// its first and last card.
+TEST_VM_F(G1CardTableChunkScannerTest, positions) {
+  const size_t num_cards = 64;
+  CardValue* cards = allocate_cards(num_cards);
+
+  for (size_t run_length = 1; run_length <= 9; run_length++) {
+    for (size_t pos = 0; pos + run_length <= num_cards; pos++) {
+      for (size_t i = 0; i < num_cards; i++) {
+        cards[i] = (pos <= i && i < pos + run_length) ? G1CardTable::dirty_card_val()
+                                                     : G1CardTable::clean_card_val();
+      }
+      verify_chunk(cards, cards + num_cards);
+    }
+  }
+
+  FREE_C_HEAP_ARRAY(CardValue, cards);
+}
@@ -0,0 +1,105 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/g1/g1LinearRegressionSeq.hpp"
+#include "gc/g1/g1Predictions.hpp"
+#include "unittest.hpp"
+
+static const double epsilon = 1e-6;
+
+TEST_VM(G1LinearRegressionSeq, not_enough_samples) {
+  G1LinearRegressionSeq seq(10);
+  ASSERT_FALSE(seq.has_model());
+
+  for (uint i = 1; i < G1LinearRegressionSeq::MinSamples; i++) {
+    seq.add(i * 100.0, 1.0 + i);
+    ASSERT_FALSE(seq.has_model()) << "must not have a model with " << i << " samples";
+  }
+  seq.add(1000.0, 11.0);
+  ASSERT_TRUE(seq.has_model());
+}
+
+TEST_VM(G1LinearRegressionSeq, no_spread) {
+  G1LinearRegressionSeq seq(10);
+  for (uint i = 0; i < 10; i++) {
+    seq.add(1000.0, 1.0 + i * 0.1);
+  }
+  ASSERT_FALSE(seq.has_model()) << "must not fit a slope to samples with the same x";
+}
+
+TEST_VM(G1LinearRegressionSeq, negative_slope) {
+  G1LinearRegressionSeq seq(10);
+  for (uint i = 0; i < 10; i++) {
+    seq.add(100.0 * (i + 1), 10.0 - i);
+  }
+  ASSERT_FALSE(seq.has_model()) << "must not use a model where cost decreases with work";
+}
+
+TEST_VM(G1LinearRegressionSeq, exact_fit) {
+  G1Predictions predictor(0.5);
+  G1LinearRegressionSeq seq(10);
+  for (uint i = 0; i < 10; i++) {
+    double x = 1000.0 * (i + 1);
+    seq.add(x, 2.0 + 0.001 * x);
+  }
+  ASSERT_TRUE(seq.has_model());
+  // No scatter around the fit, so the confidence bound does not add anything.
+  ASSERT_NEAR(seq.predict_slope(&predictor), 0.001, epsilon);
+  ASSERT_NEAR(seq.predict_intercept(), 2.0, epsilon);
+}
+
+TEST_VM(G1LinearRegressionSeq, confidence_bound) {
+  G1Predictions no_confidence(0.0);
+  G1Predictions confidence(1.0);
+  G1LinearRegressionSeq seq(10);
+  for (uint i = 0; i < 10; i++) {
+    double x = 1000.0 * (i + 1);
+    double noise = (i % 2 == 0) ? 0.5 : -0.5;
+    seq.add(x, 2.0 + 0.001 * x + noise);
+  }
+  ASSERT_TRUE(seq.has_model());
+  ASSERT_GT(seq.predict_slope(&confidence), seq.predict_slope(&no_confidence));
+}
+
+TEST_VM(G1LinearRegressionSeq, old_samples_drop_out) {
+  G1Predictions predictor(0.5);
+  const uint length = 5;
+  G1LinearRegressionSeq seq(length);
+  for (uint i = 0; i < length; i++) {
+    double x = 1000.0 * (i + 1);
+    seq.add(x, 0.01 * x);
+  }
+  ASSERT_NEAR(seq.predict_slope(&predictor), 0.01, epsilon);
+  ASSERT_NEAR(seq.predict_intercept(), 0.0, epsilon);
+
+  // Overwrite all samples with a different relation.
+  for (uint i = 0; i < length; i++) {
+    double x = 1000.0 * (i + 1);
+    seq.add(x, 5.0 + 0.002 * x);
+  }
+  ASSERT_EQ(seq.num(), length);
+  ASSERT_NEAR(seq.predict_slope(&predictor), 0.002, epsilon);
+  ASSERT_NEAR(seq.predict_intercept(), 5.0, epsilon);
+}
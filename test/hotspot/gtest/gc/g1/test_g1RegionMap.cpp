@@ -36,6 +36,13 @@ public:
     verify_inactive_count(0, TestRegions, num_inactive());
   }
 
+  void verify_uncommitted_range(const HeapRegionRange& range) {
+    for (uint i = range.start(); i < range.end(); i++) {
+      ASSERT_FALSE(active(i)) << "region " << i << " is active";
+      ASSERT_FALSE(inactive(i)) << "region " << i << " is inactive";
+    }
+  }
+
 protected:
   void guarantee_mt_safety_active() const { }
   void guarantee_mt_safety_inactive() const { }
@@ -127,4 +134,33 @@ TEST(G1CommittedRegionMapTest, serial) {
     serial_map.verify_counts();
     ASSERT_EQ(serial_map.num_inactive(), 0u);
   }
-}
\ No newline at end of file
+}
+
+static void random_commit_inactive(G1CommittedRegionMapSerial* map) {
+  uint current_offset = 0;
+  do {
+    HeapRegionRange current = map->next_uncommitted_range(current_offset);
+    map->verify_uncommitted_range(current);
+    if (current.length() > 0 && mutate()) {
+      // Commit the first half, rounded up.
+      map->commit_inactive(current.start(), current.end() - (current.length() / 2));
+    }
+
+    current_offset = current.end();
+  } while (current_offset != G1CommittedRegionMapSerial::TestRegions);
+}
+
+TEST(G1CommittedRegionMapTest, commit_inactive) {
+  G1CommittedRegionMapSerial serial_map;
+  serial_map.initialize(G1CommittedRegionMapSerial::TestRegions);
+
+  generate_random_map(&serial_map);
+
+  for (int i = 0; i < 500; i++) {
+    random_deactivate(&serial_map);
+    random_commit_inactive(&serial_map);
+    serial_map.verify_counts();
+    random_uncommit_or_reactive(&serial_map);
+    serial_map.verify_counts();
+  }
+}
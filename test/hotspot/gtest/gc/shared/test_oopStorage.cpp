@@ -23,6 +23,7 @@
 
 #include "precompiled.hpp"
 #include "gc/shared/oopStorage.inline.hpp"
+#include "gc/shared/oopStorageAllocationCache.hpp"
 #include "gc/shared/oopStorageParState.inline.hpp"
 #include "gc/shared/workerThread.hpp"
 #include "memory/allocation.inline.hpp"
@@ -518,6 +519,36 @@ TEST_VM_F(OopStorageTest, bulk_allocation) {
   }
 }
 
+TEST_VM_F(OopStorageTest, allocation_cache) {
+  static const size_t max_entries = 100;
+  oop* entries[max_entries] = {};
+  OopStorageAllocationCache cache;
+
+  for (size_t i = 0; i < max_entries; ++i) {
+    entries[i] = cache.allocate(&storage());
+    ASSERT_TRUE(entries[i] != nullptr);
+    EXPECT_EQ(OopStorage::ALLOCATED_ENTRY, storage().allocation_status(entries[i]));
+    EXPECT_TRUE(*entries[i] == nullptr);
+  }
+  // Cached entries count as allocated.
+  EXPECT_LE(max_entries, storage().allocation_count());
+
+  for (size_t i = 0; i < max_entries; ++i) {
+    cache.release(&storage(), entries[i]);
+  }
+  // Released entries are reused before anything else.
+  oop* reused = cache.allocate(&storage());
+  EXPECT_EQ(entries[max_entries - 1], reused);
+  cache.release(&storage(), reused);
+
+  cache.flush(&storage());
+  EXPECT_EQ(0u, storage().allocation_count());
+  for (size_t i = 0; i < max_entries; ++i) {
+    EXPECT_EQ(OopStorage::UNALLOCATED_ENTRY, storage().allocation_status(entries[i]));
+  }
+  EXPECT_LT(0u, storage().allocation_lock_count());
+}
+
 #ifndef DISABLE_GARBAGE_ALLOCATION_STATUS_TESTS
 TEST_VM_F(OopStorageTest, invalid_pointer) {
   {
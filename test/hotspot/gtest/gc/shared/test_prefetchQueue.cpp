@@ -0,0 +1,239 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "gc/shared/prefetchQueue.inline.hpp"
+#include "memory/allocation.inline.hpp"
+#include "runtime/os.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "unittest.hpp"
+
+template <uint Capacity>
+static void test_capacity() {
+  PrefetchQueue<uintptr_t, Capacity> queue;
+  uintptr_t dummy = 0;
+  uintptr_t evicted = 0;
+
+  // Elements are only evicted once Capacity elements are queued.
+  for (uintptr_t i = 0; i < Capacity; i++) {
+    ASSERT_FALSE(queue.push(i, &dummy, evicted)) << "capacity " << Capacity;
+    ASSERT_FALSE(queue.is_empty());
+  }
+  ASSERT_TRUE(queue.push(Capacity, &dummy, evicted)) << "capacity " << Capacity;
+  ASSERT_EQ(0u, evicted);
+
+  // Popping makes room again.
+  uintptr_t elem = 0;
+  ASSERT_TRUE(queue.pop(elem));
+  ASSERT_EQ(1u, elem);
+  ASSERT_FALSE(queue.push(Capacity + 1, &dummy, evicted)) << "capacity " << Capacity;
+}
+
+TEST(PrefetchQueueTest, capacity) {
+  test_capacity<1>();
+  test_capacity<2>();
+  test_capacity<8>();
+}
+
+TEST(PrefetchQueueTest, wrap_around) {
+  // Interleave pushes and pops so that head wraps around the buffer several
+  // times, and check the queue against a simple model of its contents.
+  const uint Capacity = 4;
+  PrefetchQueue<uintptr_t, Capacity> queue;
+  uintptr_t dummy = 0;
+  uintptr_t next_push = 0;
+  uintptr_t next_pop = 0;
+
+  for (int round = 0; round < 16; round++) {
+    uint num_push = 1 + round % 6;
+    for (uint i = 0; i < num_push; i++) {
+      uintptr_t evicted = 0;
+      bool has_evicted = queue.push(next_push, &dummy, evicted);
+      ASSERT_EQ(next_push - next_pop == Capacity, has_evicted) << "round " << round;
+      if (has_evicted) {
+        ASSERT_EQ(next_pop, evicted) << "round " << round;
+        next_pop++;
+      }
+      next_push++;
+    }
+    uint num_pop = round % 3;
+    for (uint i = 0; i < num_pop && next_pop < next_push; i++) {
+      uintptr_t elem = 0;
+      ASSERT_TRUE(queue.pop(elem));
+      ASSERT_EQ(next_pop, elem) << "round " << round;
+      next_pop++;
+    }
+  }
+
+  // Draining returns the remaining elements in order.
+  uintptr_t elem = 0;
+  while (queue.pop(elem)) {
+    ASSERT_EQ(next_pop, elem);
+    next_pop++;
+  }
+  ASSERT_EQ(next_push, next_pop);
+  ASSERT_TRUE(queue.is_empty());
+}
+
+TEST(PrefetchQueueTest, fifo) {
+  PrefetchQueue<uintptr_t, 4> queue;
+  uintptr_t dummy = 0;
+  uintptr_t evicted = 0;
+
+  ASSERT_TRUE(queue.is_empty());
+  for (uintptr_t i = 0; i < 4; i++) {
+    ASSERT_FALSE(queue.push(i, &dummy, evicted));
+  }
+  for (uintptr_t i = 4; i < 10; i++) {
+    ASSERT_TRUE(queue.push(i, &dummy, evicted));
+    ASSERT_EQ(i - 4, evicted);
+  }
+  for (uintptr_t i = 6; i < 10; i++) {
+    uintptr_t elem = 0;
+    ASSERT_TRUE(queue.pop(elem));
+    ASSERT_EQ(i, elem);
+  }
+  ASSERT_TRUE(queue.is_empty());
+  ASSERT_FALSE(queue.pop(evicted));
+}
+
+// Marks a synthetic object graph the way MarkSweep does: a node is marked when
+// it is found, and then pushed on a stack to have its children examined. The
+// nodes are scattered across a large array so that most of them miss in the
+// cache.
+class PrefetchQueueMarkTest : public ::testing::Test {
+protected:
+  struct Node {
+    bool _marked;
+    Node* _children[3];
+    char _payload[32];
+  };
+
+  static const size_t NumNodes = 512 * K;
+
+  Node* _nodes;
+  Node** _stack;
+  size_t _stack_top;
+
+  void SetUp() {
+    _nodes = NEW_C_HEAP_ARRAY(Node, NumNodes, mtGC);
+    _stack = NEW_C_HEAP_ARRAY(Node*, NumNodes, mtGC);
+    unsigned int seed = 42;
+    for (size_t i = 0; i < NumNodes; i++) {
+      _nodes[i]._marked = false;
+      for (Node*& child : _nodes[i]._children) {
+        seed = os::next_random(seed);
+        child = (seed % 8 == 0) ? nullptr : &_nodes[seed % NumNodes];
+      }
+    }
+    _stack_top = 0;
+  }
+
+  void TearDown() {
+    FREE_C_HEAP_ARRAY(Node*, _stack);
+    FREE_C_HEAP_ARRAY(Node, _nodes);
+  }
+
+  void clear_marks() {
+    for (size_t i = 0; i < NumNodes; i++) {
+      _nodes[i]._marked = false;
+    }
+  }
+
+  void mark_and_push(Node* node) {
+    if (!node->_marked) {
+      node->_marked = true;
+      _stack[_stack_top++] = node;
+    }
+  }
+
+  size_t mark_plain(Node* root) {
+    size_t marked = 0;
+    mark_and_push(root);
+    while (_stack_top > 0) {
+      Node* node = _stack[--_stack_top];
+      marked++;
+      for (Node* child : node->_children) {
+        if (child != nullptr) {
+          mark_and_push(child);
+        }
+      }
+    }
+    return marked;
+  }
+
+  size_t mark_prefetch(Node* root) {
+    PrefetchQueue<Node*, 8> queue;
+    size_t marked = 0;
+    mark_and_push(root);
+    do {
+      while (_stack_top > 0) {
+        Node* node = _stack[--_stack_top];
+        marked++;
+        for (Node* child : node->_children) {
+          Node* evicted;
+          if (child != nullptr && queue.push(child, child, evicted)) {
+            mark_and_push(evicted);
+          }
+        }
+      }
+      Node* node;
+      while (_stack_top == 0 && queue.pop(node)) {
+        mark_and_push(node);
+      }
+    } while (_stack_top > 0);
+    return marked;
+  }
+};
+
+TEST_VM_F(PrefetchQueueMarkTest, same_result) {
+  size_t plain = mark_plain(&_nodes[0]);
+  bool* expected = NEW_C_HEAP_ARRAY(bool, NumNodes, mtGC);
+  for (size_t i = 0; i < NumNodes; i++) {
+    expected[i] = _nodes[i]._marked;
+  }
+
+  clear_marks();
+  size_t prefetch = mark_prefetch(&_nodes[0]);
+  ASSERT_EQ(plain, prefetch);
+  for (size_t i = 0; i < NumNodes; i++) {
+    ASSERT_EQ(expected[i], _nodes[i]._marked) << "node " << i;
+  }
+
+  FREE_C_HEAP_ARRAY(bool, expected);
+}
+
+TEST_VM_F(PrefetchQueueMarkTest, queue_drained) {
+  // Every node handed to the queue comes back out, so the queue is empty and
+  // each reachable node was processed exactly once.
+  size_t marked = mark_prefetch(&_nodes[0]);
+  size_t num_marked = 0;
+  for (size_t i = 0; i < NumNodes; i++) {
+    if (_nodes[i]._marked) {
+      num_marked++;
+    }
+  }
+  ASSERT_EQ(num_marked, marked);
+  ASSERT_EQ(0u, _stack_top);
+}
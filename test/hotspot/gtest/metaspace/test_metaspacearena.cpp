@@ -209,9 +209,9 @@ public:
     size_t used2 = 0, committed2 = 0, capacity2 = 0;
     usage_numbers_with_test(&used2, &committed2, &capacity2);
 
-    // Nothing should have changed. Deallocated blocks are added to the free block list
-    // which still counts as used.
-    ASSERT_EQ(used2, used);
+    // Deallocated blocks are added to the free block list which still counts as used,
+    // unless they are given back to the top of the current chunk.
+    ASSERT_LE(used2, used);
     ASSERT_EQ(committed2, committed);
     ASSERT_EQ(capacity2, capacity);
   }
@@ -426,6 +426,11 @@ TEST_VM(metaspace, MetaspaceArena_deallocate) {
     helper.usage_numbers_with_test(&used1, NULL, &capacity1);
     ASSERT_EQ(used1, s);
 
+    // Allocate another block on top, so that the first block is not returned
+    // to the chunk but to the free block list.
+    helper.allocate_from_arena_with_tests(0x10);
+    helper.usage_numbers_with_test(&used1, NULL, &capacity1);
+
     helper.deallocate_with_tests(p1, s);
 
     size_t used2 = 0, capacity2 = 0;
@@ -446,6 +451,36 @@ TEST_VM(metaspace, MetaspaceArena_deallocate) {
   }
 }
 
+// Deallocating the most recent allocation gives the space back to the current chunk,
+// where it can be reused by an allocation of a different size.
+TEST_VM(metaspace, MetaspaceArena_deallocate_top) {
+  if (Settings::use_allocation_guard()) {
+    return;
+  }
+  MetaspaceGtestContext context;
+  MetaspaceArenaTestHelper helper(context, Metaspace::StandardMetaspaceType, false);
+
+  MetaWord* p1 = NULL;
+  helper.allocate_from_arena_with_tests_expect_success(&p1, 0x20);
+
+  size_t used1 = 0, committed1 = 0;
+  helper.usage_numbers_with_test(&used1, &committed1, NULL);
+
+  MetaWord* p2 = NULL;
+  helper.allocate_from_arena_with_tests_expect_success(&p2, 0x100);
+  ASSERT_EQ(p2, p1 + 0x20);
+  helper.deallocate_with_tests(p2, 0x100);
+
+  size_t used2 = 0, committed2 = 0;
+  helper.usage_numbers_with_test(&used2, &committed2, NULL);
+  ASSERT_EQ(used2, used1);
+  ASSERT_EQ(committed2, committed1);
+
+  MetaWord* p3 = NULL;
+  helper.allocate_from_arena_with_tests_expect_success(&p3, 0x40);
+  ASSERT_EQ(p3, p2);
+}
+
 static void test_recover_from_commit_limit_hit() {
 
   // Test:
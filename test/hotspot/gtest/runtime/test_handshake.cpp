@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "runtime/handshake.hpp"
+#include "runtime/interfaceSupport.inline.hpp"
+#include "runtime/javaThread.hpp"
+#include "runtime/threadSMR.hpp"
+#include "unittest.hpp"
+
+class TestAsyncBatchClosure : public AsyncBatchHandshakeClosure {
+  JavaThread* const _target;
+  int* const _executed;
+  int* const _completed;
+
+ public:
+  TestAsyncBatchClosure(JavaThread* target, int* executed, int* completed) :
+    AsyncBatchHandshakeClosure("TestAsyncBatch"),
+    _target(target), _executed(executed), _completed(completed) {}
+
+  virtual void do_thread(Thread* thread) {
+    EXPECT_EQ(_target, thread);
+    EXPECT_EQ(0, *_completed) << "Completion must be last";
+    (*_executed)++;
+  }
+
+  virtual void do_completion() {
+    (*_completed)++;
+  }
+};
+
+TEST_VM(Handshake, async_batch_to_self) {
+  JavaThread* current = JavaThread::current();
+  int executed = 0;
+  int completed = 0;
+  {
+    ThreadInVMfromNative invm(current);
+    ThreadsListHandle tlh;
+    JavaThread* targets[] = { current, current, current };
+    Handshake::execute(new TestAsyncBatchClosure(current, &executed, &completed), targets, 3);
+  }
+  {
+    // The target executes its asynchronous handshakes itself, here when
+    // transitioning from native.
+    ThreadInVMfromNative invm(current);
+  }
+  EXPECT_EQ(3, executed);
+  EXPECT_EQ(1, completed);
+}
+
+TEST_VM(Handshake, async_batch_no_targets) {
+  JavaThread* current = JavaThread::current();
+  int executed = 0;
+  int completed = 0;
+  {
+    ThreadInVMfromNative invm(current);
+    Handshake::execute(new TestAsyncBatchClosure(current, &executed, &completed), nullptr, 0);
+  }
+  // Completes as soon as submitting is done.
+  EXPECT_EQ(0, executed);
+  EXPECT_EQ(1, completed);
+}
@@ -1,5 +1,5 @@
 /*
- * Copyright (c) 2018, 2023, Oracle and/or its affiliates. All rights reserved.
+ * Copyright (c) 2018, 2024, Oracle and/or its affiliates. All rights reserved.
  * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
  *
  * This code is free software; you can redistribute it and/or modify it
@@ -25,6 +25,7 @@
 
 #ifdef LINUX
 
+#include "hugepages.hpp"
 #include "os_linux.hpp"
 #include "prims/jniCheck.hpp"
 #include "runtime/globals.hpp"
@@ -141,6 +142,40 @@ TEST_VM(os_linux, reserve_memory_special_huge_tlbfs_size_not_aligned_without_add
   }
 }
 
+TEST_VM(os_linux, reserve_memory_special_huge_tlbfs_size_mixed_page_sizes) {
+  if (!UseHugeTLBFS) {
+    return;
+  }
+  size_t lp = os::large_page_size();
+  size_t smaller_lp = os::page_sizes().next_smaller(lp);
+  if (smaller_lp <= os::vm_page_size()) {
+    // Needs at least two large page sizes
+    return;
+  }
+  size_t ag = os::vm_allocation_granularity();
+
+  // Remainders that can use the smaller large page size, with and
+  // without an additional small page tail.
+  const size_t sizes[] = {
+    lp + smaller_lp, lp + smaller_lp + ag, lp * 2 + smaller_lp * 3 + ag
+  };
+  const int num_sizes = sizeof(sizes) / sizeof(size_t);
+  if (HugePages::available_static_hugepages(lp) < 2) {
+    // Needs at least two available pages of the large page size
+    return;
+  }
+  // Without a pool for the smaller size the remainder must fall back to
+  // small pages, so the reservation is expected to succeed either way.
+  for (int i = 0; i < num_sizes; i++) {
+    const size_t size = sizes[i];
+    char* p = HugeTlbfsMemory::reserve_memory_special_huge_tlbfs(size, lp, lp, NULL, false);
+    ASSERT_TRUE(p != NULL) << " size = " << size;
+    HugeTlbfsMemory mr(p, size);
+    EXPECT_PRED2(is_ptr_aligned, p, lp) << " size = " << size;
+    small_page_write(p, size);
+  }
+}
+
 TEST_VM(os_linux, reserve_memory_special_huge_tlbfs_size_not_aligned_with_good_req_addr) {
   if (!UseHugeTLBFS) {
     return;
@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ *
+ */
+
+#include "precompiled.hpp"
+#include "utilities/byteswap.hpp"
+#include "utilities/copy.hpp"
+#include "utilities/globalDefinitions.hpp"
+#include "unittest.hpp"
+
+#include <string.h>
+
+static const size_t BufferSize = 256;
+
+// Reference implementation: copy the elements, then swap them in place.
+template <typename T>
+static void reference_copy_swap(const uint8_t* src, uint8_t* dst, size_t byte_count) {
+  memmove(dst, src, byte_count);
+  for (size_t i = 0; i < byte_count; i += sizeof(T)) {
+    T tmp;
+    memcpy(&tmp, dst + i, sizeof(T));
+    tmp = byteswap(tmp);
+    memcpy(dst + i, &tmp, sizeof(T));
+  }
+}
+
+static void fill(uint8_t* buf) {
+  for (size_t i = 0; i < BufferSize; i++) {
+    buf[i] = (uint8_t)(i * 7 + 1);
+  }
+}
+
+// Copy-swap within one buffer, covering disjoint and overlapping ranges in
+// both directions, with aligned and unaligned addresses and lengths that do
+// and do not fill whole words.
+template <typename T>
+static void test_conjoint_swap() {
+  uint8_t expected[BufferSize];
+  uint8_t actual[BufferSize];
+  for (size_t src_offset = 0; src_offset < 2 * sizeof(uint64_t); src_offset++) {
+    for (size_t dst_offset = 0; dst_offset < BufferSize / 2; dst_offset += 3) {
+      for (size_t count = 0; count <= BufferSize / 2 - 2 * sizeof(uint64_t); count += sizeof(T)) {
+        fill(expected);
+        fill(actual);
+        reference_copy_swap<T>(expected + src_offset, expected + dst_offset, count);
+        Copy::conjoint_swap(actual + src_offset, actual + dst_offset, count, sizeof(T));
+        ASSERT_EQ(0, memcmp(expected, actual, BufferSize))
+          << "elem_size " << sizeof(T) << " src " << src_offset << " dst " << dst_offset << " count " << count;
+      }
+    }
+  }
+}
+
+TEST(Copy, conjoint_swap_2) {
+  test_conjoint_swap<uint16_t>();
+}
+
+TEST(Copy, conjoint_swap_4) {
+  test_conjoint_swap<uint32_t>();
+}
+
+TEST(Copy, conjoint_swap_8) {
+  test_conjoint_swap<uint64_t>();
+}
@@ -0,0 +1,194 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test id=default
+ * @summary Test primitive array copies around ArrayCopyNonTemporalThreshold,
+ *          with unaligned source and destination and various tail lengths.
+ * @requires os.arch == "amd64" | os.arch == "x86_64"
+ * @requires vm.compiler2.enabled | vm.compiler1.enabled
+ * @library /test/lib
+ * @run main/othervm -Xbatch -XX:+UnlockDiagnosticVMOptions -XX:ArrayCopyNonTemporalThreshold=4096
+ *                   compiler.arraycopy.TestArrayCopyNonTemporal 4096
+ * @run main/othervm -Xbatch -XX:+UnlockDiagnosticVMOptions -XX:ArrayCopyNonTemporalThreshold=4096
+ *                   -XX:AVX3Threshold=0 compiler.arraycopy.TestArrayCopyNonTemporal 4096
+ * @run main/othervm -Xbatch -XX:+UnlockDiagnosticVMOptions -XX:ArrayCopyNonTemporalThreshold=256
+ *                   -XX:AVX3Threshold=0 compiler.arraycopy.TestArrayCopyNonTemporal 256
+ */
+
+/*
+ * @test id=no-avx512
+ * @summary Test that ArrayCopyNonTemporalThreshold has no effect on the
+ *          correctness of array copies on CPUs without AVX-512.
+ * @requires os.arch == "amd64" | os.arch == "x86_64"
+ * @requires vm.compiler2.enabled | vm.compiler1.enabled
+ * @requires vm.cpu.features ~= ".*avx2.*"
+ * @library /test/lib
+ * @run main/othervm -Xbatch -XX:+UnlockDiagnosticVMOptions -XX:ArrayCopyNonTemporalThreshold=4096
+ *                   -XX:UseAVX=2 compiler.arraycopy.TestArrayCopyNonTemporal 4096
+ * @run main/othervm -Xbatch -XX:+UnlockDiagnosticVMOptions -XX:ArrayCopyNonTemporalThreshold=4096
+ *                   -XX:UseAVX=0 compiler.arraycopy.TestArrayCopyNonTemporal 4096
+ */
+
+package compiler.arraycopy;
+
+import jdk.test.lib.Asserts;
+
+public class TestArrayCopyNonTemporal {
+    private static final int WARMUP = 20_000;
+
+    // Offsets in elements, to make source and destination unaligned
+    // relative to each other and to the 64 byte vector size.
+    private static final int[] SRC_OFFSETS = { 0, 1, 3, 7 };
+    private static final int[] DST_OFFSETS = { 0, 1, 5 };
+
+    // Copy sizes in bytes relative to the threshold. The main loops copy
+    // 192 bytes per iteration, so these cover all kinds of tails.
+    private static int[] byteLengths(int threshold) {
+        return new int[] {
+            threshold - 193, threshold - 192, threshold - 65, threshold - 1,
+            threshold, threshold + 1, threshold + 63, threshold + 64,
+            threshold + 191, threshold + 192, threshold + 193,
+            4 * threshold + 7, 64 * threshold + 129
+        };
+    }
+
+    static void copyBytes(byte[] src, int srcPos, byte[] dst, int dstPos, int len) {
+        System.arraycopy(src, srcPos, dst, dstPos, len);
+    }
+
+    static void copyShorts(short[] src, int srcPos, short[] dst, int dstPos, int len) {
+        System.arraycopy(src, srcPos, dst, dstPos, len);
+    }
+
+    static void copyInts(int[] src, int srcPos, int[] dst, int dstPos, int len) {
+        System.arraycopy(src, srcPos, dst, dstPos, len);
+    }
+
+    static void copyLongs(long[] src, int srcPos, long[] dst, int dstPos, int len) {
+        System.arraycopy(src, srcPos, dst, dstPos, len);
+    }
+
+    static void warmup() {
+        byte[] b = new byte[64];
+        short[] s = new short[64];
+        int[] i = new int[64];
+        long[] l = new long[64];
+        for (int n = 0; n < WARMUP; n++) {
+            int len = n % 32;
+            copyBytes(b, 1, b, 32, len);
+            copyShorts(s, 1, s, 32, len);
+            copyInts(i, 1, i, 32, len);
+            copyLongs(l, 1, l, 32, len);
+        }
+    }
+
+    static void testBytes(int len) {
+        int size = len + 16;
+        byte[] src = new byte[size];
+        byte[] dst = new byte[size];
+        for (int srcOff : SRC_OFFSETS) {
+            for (int dstOff : DST_OFFSETS) {
+                for (int i = 0; i < size; i++) {
+                    src[i] = (byte)(i * 31 + 7);
+                    dst[i] = (byte)-1;
+                }
+                copyBytes(src, srcOff, dst, dstOff, len);
+                for (int i = 0; i < size; i++) {
+                    byte expected = (i >= dstOff && i < dstOff + len) ? src[i - dstOff + srcOff] : (byte)-1;
+                    Asserts.assertEquals(expected, dst[i], "byte len " + len + " src " + srcOff + " dst " + dstOff + " at " + i);
+                }
+            }
+        }
+    }
+
+    static void testShorts(int len) {
+        int size = len + 16;
+        short[] src = new short[size];
+        short[] dst = new short[size];
+        for (int srcOff : SRC_OFFSETS) {
+            for (int dstOff : DST_OFFSETS) {
+                for (int i = 0; i < size; i++) {
+                    src[i] = (short)(i * 31 + 7);
+                    dst[i] = (short)-1;
+                }
+                copyShorts(src, srcOff, dst, dstOff, len);
+                for (int i = 0; i < size; i++) {
+                    short expected = (i >= dstOff && i < dstOff + len) ? src[i - dstOff + srcOff] : (short)-1;
+                    Asserts.assertEquals(expected, dst[i], "short len " + len + " src " + srcOff + " dst " + dstOff + " at " + i);
+                }
+            }
+        }
+    }
+
+    static void testInts(int len) {
+        int size = len + 16;
+        int[] src = new int[size];
+        int[] dst = new int[size];
+        for (int srcOff : SRC_OFFSETS) {
+            for (int dstOff : DST_OFFSETS) {
+                for (int i = 0; i < size; i++) {
+                    src[i] = i * 31 + 7;
+                    dst[i] = -1;
+                }
+                copyInts(src, srcOff, dst, dstOff, len);
+                for (int i = 0; i < size; i++) {
+                    int expected = (i >= dstOff && i < dstOff + len) ? src[i - dstOff + srcOff] : -1;
+                    Asserts.assertEquals(expected, dst[i], "int len " + len + " src " + srcOff + " dst " + dstOff + " at " + i);
+                }
+            }
+        }
+    }
+
+    static void testLongs(int len) {
+        int size = len + 16;
+        long[] src = new long[size];
+        long[] dst = new long[size];
+        for (int srcOff : SRC_OFFSETS) {
+            for (int dstOff : DST_OFFSETS) {
+                for (int i = 0; i < size; i++) {
+                    src[i] = i * 0x9E3779B97F4A7C15L;
+                    dst[i] = -1L;
+                }
+                copyLongs(src, srcOff, dst, dstOff, len);
+                for (int i = 0; i < size; i++) {
+                    long expected = (i >= dstOff && i < dstOff + len) ? src[i - dstOff + srcOff] : -1L;
+                    Asserts.assertEquals(expected, dst[i], "long len " + len + " src " + srcOff + " dst " + dstOff + " at " + i);
+                }
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        int threshold = Integer.parseInt(args[0]);
+        // Get the copy methods compiled, so that the copies below use the
+        // arraycopy stubs.
+        warmup();
+        for (int bytes : byteLengths(threshold)) {
+            testBytes(bytes);
+            testShorts(bytes / 2);
+            testInts(bytes / 4);
+            testLongs(bytes / 8);
+        }
+    }
+}
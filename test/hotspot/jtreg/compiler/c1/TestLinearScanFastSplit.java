@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that splitting intervals as late as possible in LinearScan,
+ *          as done for huge methods, produces correct code.
+ * @requires vm.compiler1.enabled
+ * @run main/othervm -Xbatch -XX:TieredStopAtLevel=1
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:LinearScanFastSplitLIRSize=1
+ *                   compiler.c1.TestLinearScanFastSplit
+ * @run main/othervm -Xcomp -XX:TieredStopAtLevel=1
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:LinearScanFastSplitLIRSize=1
+ *                   -XX:CompileCommand=compileonly,java.util.HashMap::*
+ *                   -XX:CompileCommand=compileonly,compiler.c1.TestLinearScanFastSplit::*
+ *                   compiler.c1.TestLinearScanFastSplit
+ */
+
+package compiler.c1;
+
+import java.util.HashMap;
+
+public class TestLinearScanFastSplit {
+
+    static long sink;
+
+    static void call(long x) {
+        sink += x;
+    }
+
+    // Many values that are live across calls and loops, so that intervals
+    // are split and spilled.
+    static long test(int n, long a, long b, double c, double d) {
+        long v0 = a, v1 = b, v2 = a ^ b, v3 = a + 1, v4 = b - 1, v5 = a * 3, v6 = b * 5, v7 = a - b;
+        double f0 = c, f1 = d, f2 = c * d, f3 = c + d;
+        for (int i = 0; i < n; i++) {
+            v0 += i; v1 ^= v0; v2 += v1; v3 -= v2;
+            call(v3);
+            v4 += v3; v5 ^= v4; v6 += v5; v7 -= v6;
+            f0 += v0; f1 *= 1.0001; f2 -= f1; f3 += f0;
+            if ((i & 3) == 0) {
+                call(v7);
+                for (int j = 0; j < 3; j++) {
+                    v0 += v7 + j;
+                    f3 -= j;
+                }
+            }
+        }
+        return v0 + v1 + v2 + v3 + v4 + v5 + v6 + v7 + (long)(f0 + f1 + f2 + f3);
+    }
+
+    public static void main(String[] args) {
+        long expected = 0;
+        for (int iter = 0; iter < 10_000; iter++) {
+            sink = 0;
+            long result = test(100, iter, 3 * iter, 0.5, 1.5) + sink;
+            if (iter == 0) {
+                expected = result;
+            } else if (iter % 1000 == 0) {
+                // Recompute the first result with compiled code.
+                sink = 0;
+                long again = test(100, 0, 0, 0.5, 1.5) + sink;
+                if (again != expected) {
+                    throw new RuntimeException("wrong result " + again + ", expected " + expected);
+                }
+            }
+        }
+        HashMap<Integer, Integer> map = new HashMap<>();
+        for (int i = 0; i < 100_000; i++) {
+            map.merge(i % 1000, i, Integer::sum);
+        }
+        if (map.size() != 1000) {
+            throw new RuntimeException("wrong size " + map.size());
+        }
+    }
+}
@@ -0,0 +1,104 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that C1 inlines calls with a monomorphic receiver type profile
+ *          behind a receiver type check that invalidates the code when it fails.
+ * @requires vm.compiler1.enabled & vm.compiler2.enabled & vm.flagless
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+C1InlineProfiledReceiver
+ *                   -XX:TieredStopAtLevel=3 -XX:ProfileMaturityPercentage=0 -Xbatch
+ *                   -XX:CompileCommand=dontinline,compiler.c1.TestProfiledReceiverInlining::test
+ *                   compiler.c1.TestProfiledReceiverInlining
+ */
+
+package compiler.c1;
+
+import java.lang.reflect.Method;
+
+import jdk.test.lib.Asserts;
+import jdk.test.whitebox.WhiteBox;
+
+public class TestProfiledReceiverInlining {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+    private static final int TIER3 = 3;
+
+    static abstract class Shape {
+        abstract int sides();
+    }
+
+    static class Triangle extends Shape {
+        int sides() { return 3; }
+    }
+
+    static class Square extends Shape {
+        int sides() { return 4; }
+    }
+
+    static int test(Shape s) {
+        return s.sides() + 1;
+    }
+
+    static void compile(Method m) {
+        WB.deoptimizeMethod(m);
+        Asserts.assertTrue(WB.enqueueMethodForCompilation(m, TIER3), "failed to enqueue " + m);
+        Asserts.assertTrue(WB.isMethodCompiled(m), m + " should be compiled");
+    }
+
+    public static void main(String[] args) throws Exception {
+        Method m = TestProfiledReceiverInlining.class.getDeclaredMethod("test", Shape.class);
+        Shape triangle = new Triangle();
+        // Load the second subclass so that CHA doesn't find a unique target.
+        Shape square = new Square();
+
+        // Collect a profile that only has Triangle receivers.
+        compile(m);
+        for (int i = 0; i < 10_000; i++) {
+            Asserts.assertEquals(test(triangle), 4);
+        }
+
+        // Recompile with the mature profile, the call is now bound to Triangle.
+        compile(m);
+        for (int i = 0; i < 10_000; i++) {
+            Asserts.assertEquals(test(triangle), 4);
+        }
+        Asserts.assertTrue(WB.isMethodCompiled(m), m + " should still be compiled");
+
+        // A different receiver fails the check and invalidates the code.
+        Asserts.assertEquals(test(square), 5);
+        Asserts.assertFalse(WB.isMethodCompiled(m), m + " should have been invalidated");
+
+        // The failed check is recorded, so the call isn't bound to the profiled
+        // receiver type again.
+        compile(m);
+        for (int i = 0; i < 10_000; i++) {
+            Asserts.assertEquals(test(triangle), 4);
+            Asserts.assertEquals(test(square), 5);
+        }
+        Asserts.assertTrue(WB.isMethodCompiled(m), m + " should still be compiled");
+    }
+}
@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that moving uncommon blocks to the end of the method code
+ *          preserves the semantics of rarely taken paths.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+BlockLayoutSplitCold
+ *                   -XX:CompileCommand=exclude,compiler.c2.TestBlockLayoutSplitCold::expected
+ *                   compiler.c2.TestBlockLayoutSplitCold
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+BlockLayoutSplitCold
+ *                   -XX:CompileCommand=exclude,compiler.c2.TestBlockLayoutSplitCold::expected
+ *                   -XX:-BlockLayoutRotateLoops
+ *                   compiler.c2.TestBlockLayoutSplitCold
+ */
+
+package compiler.c2;
+
+public class TestBlockLayoutSplitCold {
+
+    static int rare(int[] a, int i) {
+        int sum = 0;
+        for (int j = 0; j < a.length; j++) {
+            int v = a[j];
+            if (v == i) {
+                // Rarely taken, but profiled.
+                sum -= v * 3;
+                if (v % 7 == 0) {
+                    sum ^= j;
+                }
+            } else {
+                sum += v;
+            }
+        }
+        return sum;
+    }
+
+    static int expected(int[] a, int i) {
+        int sum = 0;
+        for (int j = 0; j < a.length; j++) {
+            int v = a[j];
+            if (v == i) {
+                sum -= v * 3;
+                if (v % 7 == 0) {
+                    sum ^= j;
+                }
+            } else {
+                sum += v;
+            }
+        }
+        return sum;
+    }
+
+    public static void main(String[] args) {
+        int[] a = new int[1000];
+        for (int j = 0; j < a.length; j++) {
+            a[j] = j;
+        }
+        for (int i = 0; i < 20_000; i++) {
+            int key = (i % 100 == 0) ? (i % a.length) : -1;
+            int result = rare(a, key);
+            int exp = expected(a, key);
+            if (result != exp) {
+                throw new RuntimeException("wrong result " + result + " for " + key + ", expected " + exp);
+            }
+        }
+    }
+}
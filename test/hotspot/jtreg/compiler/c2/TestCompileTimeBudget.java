@@ -0,0 +1,84 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that compilations that exceed C2CompileTimeBudget skip the
+ *          remaining optimization rounds and still produce correct code.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:+CITime
+ *                   -XX:+UnlockExperimentalVMOptions -XX:C2CompileTimeBudget=1
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestCompileTimeBudget::test
+ *                   compiler.c2.TestCompileTimeBudget
+ */
+
+package compiler.c2;
+
+public class TestCompileTimeBudget {
+
+    static int test(int[] a, int n) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            for (int j = 0; j < n; j++) {
+                if ((a[i] & 1) == 0) {
+                    sum += a[i] * j;
+                } else {
+                    sum -= a[i] + j;
+                }
+            }
+            a[i] = sum;
+        }
+        return sum;
+    }
+
+    static int reference(int[] a, int n) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            for (int j = 0; j < n; j++) {
+                if ((a[i] & 1) == 0) {
+                    sum += a[i] * j;
+                } else {
+                    sum -= a[i] + j;
+                }
+            }
+            a[i] = sum;
+        }
+        return sum;
+    }
+
+    public static void main(String[] args) {
+        for (int iter = 0; iter < 20_000; iter++) {
+            int[] a = new int[100];
+            int[] b = new int[100];
+            for (int i = 0; i < a.length; i++) {
+                a[i] = i * iter;
+                b[i] = i * iter;
+            }
+            int result = test(a, iter % 17);
+            int expected = reference(b, iter % 17);
+            if (result != expected) {
+                throw new RuntimeException("wrong result " + result + ", expected " + expected);
+            }
+        }
+    }
+}
@@ -0,0 +1,96 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that the hashCode intrinsics return the identity hash of
+ *          objects with an inflated monitor, before and after deflation.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run main/othervm -Xbootclasspath/a:. -XX:+UnlockDiagnosticVMOptions -XX:+WhiteBoxAPI
+ *                   -Xbatch -XX:-TieredCompilation -XX:LockingMode=2
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestHashCodeInflatedMonitor::hash*
+ *                   compiler.c2.TestHashCodeInflatedMonitor
+ */
+
+package compiler.c2;
+
+import jdk.test.whitebox.WhiteBox;
+
+public class TestHashCodeInflatedMonitor {
+    private static final WhiteBox WB = WhiteBox.getWhiteBox();
+    private static final int NumObjects = 100;
+
+    static int hashIdentity(Object o) {
+        return System.identityHashCode(o);
+    }
+
+    static int hashVirtual(Object o) {
+        return o.hashCode();
+    }
+
+    static void inflate(Object o) throws InterruptedException {
+        synchronized (o) {
+            o.wait(1);
+        }
+        if (!WB.isMonitorInflated(o)) {
+            throw new RuntimeException("monitor should be inflated");
+        }
+    }
+
+    static void check(Object[] objects, int[] expected) {
+        for (int i = 0; i < 20_000; i++) {
+            int j = i % objects.length;
+            int h1 = hashIdentity(objects[j]);
+            int h2 = hashVirtual(objects[j]);
+            if (h1 != expected[j] || h2 != expected[j]) {
+                throw new RuntimeException("wrong hash " + h1 + "/" + h2 + " for object " + j +
+                                           ", expected " + expected[j]);
+            }
+        }
+    }
+
+    public static void main(String[] args) throws Exception {
+        Object[] objects = new Object[NumObjects];
+        int[] expected = new int[NumObjects];
+        for (int i = 0; i < NumObjects; i++) {
+            objects[i] = new Object();
+            if (i % 2 == 0) {
+                // Hash assigned before inflation, moved into the monitor.
+                expected[i] = System.identityHashCode(objects[i]);
+                inflate(objects[i]);
+            } else {
+                // Hash assigned while inflated, stored in the monitor.
+                inflate(objects[i]);
+                expected[i] = System.identityHashCode(objects[i]);
+            }
+        }
+        check(objects, expected);
+
+        // Deflation restores the hash into the object header.
+        WB.deflateIdleMonitors();
+        check(objects, expected);
+    }
+}
@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test id=product
+ * @summary Test that incrementally inlining the most frequent call sites first
+ *          works with a small live node budget.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+IncrementalInlineByFrequency
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+PrintInlining
+ *                   -XX:LiveNodeCountInliningCutoff=200
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestIncrementalInlineByFrequency::*
+ *                   compiler.c2.TestIncrementalInlineByFrequency
+ */
+
+/*
+ * @test id=debug
+ * @summary Test that delaying inlining beyond the node count cutoff and
+ *          incrementally inlining the most frequent call sites first works.
+ * @requires vm.compiler2.enabled & vm.debug
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+IncrementalInlineByFrequency
+ *                   -XX:NodeCountInliningCutoff=200 -XX:LiveNodeCountInliningCutoff=2000
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestIncrementalInlineByFrequency::*
+ *                   compiler.c2.TestIncrementalInlineByFrequency
+ */
+
+package compiler.c2;
+
+public class TestIncrementalInlineByFrequency {
+
+    static int level3(int x) {
+        int r = x;
+        for (int i = 0; i < 4; i++) {
+            r = r * 31 + i;
+        }
+        return r;
+    }
+
+    static int level2(int x) {
+        return level3(x) + level3(x + 1);
+    }
+
+    static int level1(int x) {
+        return level2(x) ^ level2(x - 1);
+    }
+
+    static int cold(int x) {
+        return level1(x) - level1(x * 2);
+    }
+
+    static int test(int x) {
+        int r = level1(x) + level1(x >> 1) + level1(x >> 2);
+        if ((x & 0xfff) == 0) {
+            r += cold(x);
+        }
+        return r;
+    }
+
+    static int reference(int x) {
+        int r = 0;
+        for (int k = 0; k < 3; k++) {
+            int y = x >> k;
+            int a = 0;
+            for (int d = 0; d < 2; d++) {
+                int z = y - d;
+                int b = 0;
+                for (int e = 0; e < 2; e++) {
+                    int v = z + e;
+                    for (int i = 0; i < 4; i++) {
+                        v = v * 31 + i;
+                    }
+                    b += v;
+                }
+                a = (d == 0) ? b : (a ^ b);
+            }
+            r += a;
+        }
+        if ((x & 0xfff) == 0) {
+            r += cold(x);
+        }
+        return r;
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < 50_000; i++) {
+            int result = test(i);
+            int expected = reference(i);
+            if (result != expected) {
+                throw new RuntimeException("wrong result " + result + " for " + i + ", expected " + expected);
+            }
+        }
+    }
+}
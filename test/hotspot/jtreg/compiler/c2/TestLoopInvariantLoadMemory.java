@@ -0,0 +1,160 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that loads bypass the memory Phi of a loop only if no store
+ *          in the loop may write the loaded location.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestLoopInvariantLoadMemory::test*
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestLoopInvariantLoadMemory::store
+ *                   -XX:CompileCommand=dontinline,compiler.c2.TestLoopInvariantLoadMemory::store
+ *                   compiler.c2.TestLoopInvariantLoadMemory
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+OptimizeLoopInvariantLoads
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestLoopInvariantLoadMemory::test*
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestLoopInvariantLoadMemory::store
+ *                   -XX:CompileCommand=dontinline,compiler.c2.TestLoopInvariantLoadMemory::store
+ *                   compiler.c2.TestLoopInvariantLoadMemory
+ */
+
+package compiler.c2;
+
+public class TestLoopInvariantLoadMemory {
+
+    static class Node {
+        int value;
+        int count;
+        Node next;
+    }
+
+    static class VolatileNode {
+        volatile int value;
+    }
+
+    // The store to a[1] cannot write b[0], whatever a and b are.
+    static int testOtherOffset(int[] a, int[] b, int n) {
+        int sum = 0;
+        for (int i = 0; i < n; i++) {
+            a[1] = i;
+            sum += b[0];
+        }
+        return sum;
+    }
+
+    // The store to a[0] writes b[0] if a == b.
+    static int testSameOffset(int[] a, int[] b, int n) {
+        int sum = 0;
+        for (int i = 0; i < n; i++) {
+            a[0] = i;
+            sum += b[0];
+        }
+        return sum;
+    }
+
+    // The store to p.count doesn't write q.value, the store to p.value may.
+    static int testFields(Node p, Node q, int n) {
+        int sum = 0;
+        for (int i = 0; i < n; i++) {
+            p.count = i;
+            sum += q.value;
+            if ((i & 7) == 0) {
+                p.value = i;
+            }
+        }
+        return sum;
+    }
+
+    static void store(int[] a, int v) {
+        a[0] = v;
+    }
+
+    // The call may write b[0].
+    static int testCall(int[] a, int[] b, int n) {
+        int sum = 0;
+        for (int i = 0; i < n; i++) {
+            store(a, i);
+            sum += b[0];
+        }
+        return sum;
+    }
+
+    // The volatile store, with its memory barriers, writes q.value if p == q.
+    static int testVolatile(VolatileNode p, VolatileNode q, int n) {
+        int sum = 0;
+        for (int i = 0; i < n; i++) {
+            p.value = i;
+            sum += q.value;
+        }
+        return sum;
+    }
+
+    static void check(int result, int expected, String what) {
+        if (result != expected) {
+            throw new RuntimeException(what + ": " + result + " != " + expected);
+        }
+    }
+
+    public static void main(String[] args) {
+        int n = 100;
+        for (int iter = 0; iter < 20_000; iter++) {
+            int[] a = new int[2];
+            int[] b = new int[2];
+            b[0] = 3;
+            check(testOtherOffset(a, b, n), 3 * n, "other offset");
+            check(testOtherOffset(a, a, n), 0, "other offset, same array");
+
+            b[0] = 3;
+            check(testSameOffset(a, b, n), 3 * n, "same offset");
+            // sum of 0..n-1 as a[0] is written before each load
+            a[0] = 0;
+            check(testSameOffset(a, a, n), n * (n - 1) / 2, "same offset, same array");
+
+            b[0] = 3;
+            check(testCall(a, b, n), 3 * n, "call");
+            check(testCall(a, a, n), n * (n - 1) / 2, "call, same array");
+
+            VolatileNode vp = new VolatileNode();
+            VolatileNode vq = new VolatileNode();
+            vq.value = 7;
+            check(testVolatile(vp, vq, n), 7 * n, "volatile");
+            check(testVolatile(vp, vp, n), n * (n - 1) / 2, "volatile, same object");
+
+            Node p = new Node();
+            Node q = new Node();
+            q.value = 5;
+            check(testFields(p, q, n), 5 * n, "fields");
+            int expected = 0;
+            int v = 0;
+            for (int i = 0; i < n; i++) {
+                expected += v;
+                if ((i & 7) == 0) {
+                    v = i;
+                }
+            }
+            p.value = 0;
+            check(testFields(p, p, n), expected, "fields, same object");
+        }
+    }
+}
@@ -0,0 +1,87 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that call sites with more than two profiled receiver types
+ *          dispatch correctly when inlined through a chain of type checks,
+ *          also after an unexpected receiver type shows up.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UsePolymorphicInlining
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:+PrintInlining
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestPolymorphicInlining::*
+ *                   compiler.c2.TestPolymorphicInlining
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:TypeProfileWidth=8
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UsePolymorphicInlining
+ *                   -XX:CompileCommand=compileonly,compiler.c2.TestPolymorphicInlining::*
+ *                   compiler.c2.TestPolymorphicInlining
+ */
+
+package compiler.c2;
+
+public class TestPolymorphicInlining {
+
+    interface Shape {
+        int value(int x);
+    }
+
+    static class A implements Shape { public int value(int x) { return x + 1; } }
+    static class B implements Shape { public int value(int x) { return x * 2; } }
+    static class C implements Shape { public int value(int x) { return x - 3; } }
+    static class D implements Shape { public int value(int x) { return x ^ 4; } }
+    static class E implements Shape { public int value(int x) { return -x;    } }
+
+    static int test(Shape s, int x) {
+        return s.value(x);
+    }
+
+    static int reference(Shape s, int x) {
+        if (s instanceof A) return x + 1;
+        if (s instanceof B) return x * 2;
+        if (s instanceof C) return x - 3;
+        if (s instanceof D) return x ^ 4;
+        return -x;
+    }
+
+    static void run(Shape[] shapes, int iterations) {
+        for (int i = 0; i < iterations; i++) {
+            Shape s = shapes[i % shapes.length];
+            int result = test(s, i);
+            int expected = reference(s, i);
+            if (result != expected) {
+                throw new RuntimeException("wrong result " + result + " for " + s.getClass().getName() +
+                                           " and " + i + ", expected " + expected);
+            }
+        }
+    }
+
+    public static void main(String[] args) {
+        // Skewed distribution of four receiver types.
+        Shape[] shapes = { new A(), new A(), new A(), new A(), new B(), new B(), new C(), new D() };
+        run(shapes, 50_000);
+        // A fifth receiver type fails all the type checks.
+        Shape[] more = { new A(), new B(), new C(), new D(), new E() };
+        run(more, 50_000);
+    }
+}
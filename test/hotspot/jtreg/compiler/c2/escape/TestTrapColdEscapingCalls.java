@@ -0,0 +1,80 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that replacing cold calls that let a freshly allocated
+ *          object escape by uncommon traps materializes the object correctly
+ *          when the cold path is taken.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+TrapColdEscapingCalls
+ *                   -XX:CompileCommand=dontinline,compiler.c2.escape.TestTrapColdEscapingCalls::report
+ *                   compiler.c2.escape.TestTrapColdEscapingCalls
+ */
+
+package compiler.c2.escape;
+
+public class TestTrapColdEscapingCalls {
+
+    static class Point {
+        int x;
+        int y;
+
+        Point(int x, int y) {
+            this.x = x;
+            this.y = y;
+        }
+    }
+
+    static Point reported;
+
+    static void report(Point p) {
+        reported = p;
+    }
+
+    static int test(int x, int y) {
+        Point p = new Point(x, y);
+        if (p.x == Integer.MIN_VALUE) {
+            // Cold path: p escapes only here.
+            report(p);
+            return -1;
+        }
+        return p.x + p.y;
+    }
+
+    public static void main(String[] args) {
+        for (int i = 0; i < 100_000; i++) {
+            int result = test(i, 2 * i);
+            if (result != 3 * i) {
+                throw new RuntimeException("wrong result " + result + " for " + i);
+            }
+        }
+        // Take the cold path in compiled code.
+        int result = test(Integer.MIN_VALUE, 42);
+        if (result != -1 || reported == null ||
+            reported.x != Integer.MIN_VALUE || reported.y != 42) {
+            throw new RuntimeException("object not materialized correctly");
+        }
+    }
+}
@@ -0,0 +1,119 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that strip mined loops with small and large bodies compute
+ *          the right results when their strip length is scaled by the body
+ *          size, while other threads request safepoints.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:+UseCountedLoopSafepoints
+ *                   -XX:LoopStripMiningIter=1000
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseAdaptiveLoopStripMining
+ *                   -XX:CompileCommand=exclude,compiler.c2.loopopts.TestAdaptiveLoopStripMining::largeReference
+ *                   compiler.c2.loopopts.TestAdaptiveLoopStripMining
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:+UseCountedLoopSafepoints
+ *                   -XX:LoopStripMiningIter=10 -XX:LoopStripMiningIterShortLoop=0
+ *                   -XX:+UnlockExperimentalVMOptions -XX:+UseAdaptiveLoopStripMining
+ *                   -XX:CompileCommand=exclude,compiler.c2.loopopts.TestAdaptiveLoopStripMining::largeReference
+ *                   compiler.c2.loopopts.TestAdaptiveLoopStripMining
+ */
+
+package compiler.c2.loopopts;
+
+public class TestAdaptiveLoopStripMining {
+
+    static volatile boolean done;
+
+    static long small(int[] a) {
+        long sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            sum += a[i];
+        }
+        return sum;
+    }
+
+    static long large(int[] a, int[] b) {
+        long sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            int x = a[i];
+            int y = b[i];
+            b[i] = x * 31 + (y >>> 3);
+            sum += (x ^ y) + (long)x * y - (x | (y << 2)) + (x & 7) * (y % 13);
+        }
+        return sum;
+    }
+
+    static long largeReference(int[] a, int[] b) {
+        long sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            int x = a[i];
+            int y = b[i];
+            b[i] = x * 31 + (y >>> 3);
+            sum += (x ^ y) + (long)x * y - (x | (y << 2)) + (x & 7) * (y % 13);
+        }
+        return sum;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Request safepoints while the loops run.
+        Thread gcThread = new Thread(() -> {
+            while (!done) {
+                System.gc();
+                try {
+                    Thread.sleep(1);
+                } catch (InterruptedException e) {
+                }
+            }
+        });
+        gcThread.start();
+
+        int n = 100_000;
+        int[] a = new int[n];
+        int[] b1 = new int[n];
+        int[] b2 = new int[n];
+        long expectedSmall = 0;
+        for (int i = 0; i < n; i++) {
+            a[i] = i * 7 - 100;
+            b1[i] = b2[i] = i ^ 0x5555;
+            expectedSmall += a[i];
+        }
+
+        try {
+            for (int iter = 0; iter < 200; iter++) {
+                long s = small(a);
+                if (s != expectedSmall) {
+                    throw new RuntimeException("small: expected " + expectedSmall + " but got " + s);
+                }
+                long l = large(a, b1);
+                long r = largeReference(a, b2);
+                if (l != r) {
+                    throw new RuntimeException("large: expected " + r + " but got " + l);
+                }
+            }
+        } finally {
+            done = true;
+            gcThread.join();
+        }
+    }
+}
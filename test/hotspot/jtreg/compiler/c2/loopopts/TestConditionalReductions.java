@@ -0,0 +1,144 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that conditionally updated reductions are computed correctly
+ *          when C2 turns them into unconditional reductions.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   compiler.c2.loopopts.TestConditionalReductions
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:+UseVectorCmov
+ *                   compiler.c2.loopopts.TestConditionalReductions
+ */
+
+package compiler.c2.loopopts;
+
+import java.util.Random;
+
+public class TestConditionalReductions {
+
+    static int sumIfGreater(int[] a, int t) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            if (a[i] > t) {
+                sum += a[i];
+            }
+        }
+        return sum;
+    }
+
+    static long sumIfNotGreater(long[] a, long t) {
+        long sum = 7;
+        for (int i = 0; i < a.length; i++) {
+            if (a[i] > t) {
+                // nothing
+            } else {
+                sum += a[i];
+            }
+        }
+        return sum;
+    }
+
+    // The compared values are wider than the reduction.
+    static int sumIfLongGreater(int[] a, long[] b, long t) {
+        int sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            if (b[i] > t) {
+                sum += a[i];
+            }
+        }
+        return sum;
+    }
+
+    // The compared values are narrower than the reduction.
+    static long sumIfIntGreater(long[] a, int[] b, int t) {
+        long sum = 0;
+        for (int i = 0; i < a.length; i++) {
+            if (b[i] > t) {
+                sum += a[i];
+            }
+        }
+        return sum;
+    }
+
+    static int max(int[] a) {
+        int max = Integer.MIN_VALUE;
+        for (int i = 0; i < a.length; i++) {
+            if (a[i] > max) {
+                max = a[i];
+            }
+        }
+        return max;
+    }
+
+    static int min(int[] a) {
+        int min = Integer.MAX_VALUE;
+        for (int i = 0; i < a.length; i++) {
+            if (min > a[i]) {
+                min = a[i];
+            }
+        }
+        return min;
+    }
+
+    public static void main(String[] args) {
+        Random r = new Random(17);
+        int[] ints = new int[1000];
+        long[] longs = new long[1000];
+        for (int i = 0; i < ints.length; i++) {
+            ints[i] = r.nextInt();
+            longs[i] = r.nextLong();
+        }
+
+        int expectedSum = 0;
+        long expectedLongSum = 7;
+        int expectedIntSumIfLong = 0;
+        long expectedLongSumIfInt = 0;
+        int expectedMax = Integer.MIN_VALUE;
+        int expectedMin = Integer.MAX_VALUE;
+        for (int i = 0; i < ints.length; i++) {
+            expectedSum += (ints[i] > 100) ? ints[i] : 0;
+            expectedLongSum += (longs[i] > -100) ? 0 : longs[i];
+            expectedIntSumIfLong += (longs[i] > 100) ? ints[i] : 0;
+            expectedLongSumIfInt += (ints[i] > 100) ? longs[i] : 0;
+            expectedMax = Math.max(expectedMax, ints[i]);
+            expectedMin = Math.min(expectedMin, ints[i]);
+        }
+
+        for (int n = 0; n < 20_000; n++) {
+            check("sumIfGreater", sumIfGreater(ints, 100), expectedSum);
+            check("sumIfNotGreater", sumIfNotGreater(longs, -100), expectedLongSum);
+            check("sumIfLongGreater", sumIfLongGreater(ints, longs, 100), expectedIntSumIfLong);
+            check("sumIfIntGreater", sumIfIntGreater(longs, ints, 100), expectedLongSumIfInt);
+            check("max", max(ints), expectedMax);
+            check("min", min(ints), expectedMin);
+        }
+    }
+
+    static void check(String name, long actual, long expected) {
+        if (actual != expected) {
+            throw new RuntimeException(name + ": expected " + expected + " but got " + actual);
+        }
+    }
+}
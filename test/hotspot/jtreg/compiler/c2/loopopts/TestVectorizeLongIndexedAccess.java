@@ -0,0 +1,92 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that long indexed accesses in the int inner loop of a long
+ *          counted loop nest are vectorized correctly.
+ * @requires vm.compiler2.enabled
+ * @modules java.base/jdk.internal.misc
+ * @run main/othervm -Xbatch -XX:-TieredCompilation
+ *                   -XX:CompileCommand=compileonly,compiler.c2.loopopts.TestVectorizeLongIndexedAccess::test*
+ *                   compiler.c2.loopopts.TestVectorizeLongIndexedAccess
+ * @run main/othervm -Xbatch -XX:-TieredCompilation -XX:+UnlockExperimentalVMOptions
+ *                   -XX:+UnlockDiagnosticVMOptions -XX:LoopStripMiningIter=1000 -XX:+AlignVector
+ *                   -XX:CompileCommand=compileonly,compiler.c2.loopopts.TestVectorizeLongIndexedAccess::test*
+ *                   compiler.c2.loopopts.TestVectorizeLongIndexedAccess
+ */
+
+package compiler.c2.loopopts;
+
+import jdk.internal.misc.Unsafe;
+
+public class TestVectorizeLongIndexedAccess {
+    private static final Unsafe UNSAFE = Unsafe.getUnsafe();
+    private static final long INT_BASE = UNSAFE.arrayBaseOffset(int[].class);
+    private static final long BYTE_BASE = UNSAFE.arrayBaseOffset(byte[].class);
+    private static final int SIZE = 1031;
+
+    static void testAddInts(int[] dst, int[] a, int[] b, long from, long to) {
+        for (long i = from; i < to; i++) {
+            long offset = INT_BASE + i * 4;
+            UNSAFE.putInt(dst, offset, UNSAFE.getInt(a, offset) + UNSAFE.getInt(b, offset));
+        }
+    }
+
+    static void testCopyBytes(byte[] dst, byte[] src, long from, long to) {
+        for (long i = from; i < to; i++) {
+            UNSAFE.putByte(dst, BYTE_BASE + i + 1, (byte)(UNSAFE.getByte(src, BYTE_BASE + i) + 1));
+        }
+    }
+
+    public static void main(String[] args) {
+        int[] a = new int[SIZE];
+        int[] b = new int[SIZE];
+        int[] dst = new int[SIZE];
+        byte[] src = new byte[SIZE];
+        byte[] bdst = new byte[SIZE];
+        for (int i = 0; i < SIZE; i++) {
+            a[i] = i;
+            b[i] = 3 * i;
+            src[i] = (byte)i;
+        }
+        for (int iter = 0; iter < 20_000; iter++) {
+            long from = iter % 5;
+            long to = SIZE - (iter % 3);
+            java.util.Arrays.fill(dst, -1);
+            java.util.Arrays.fill(bdst, (byte)-1);
+            testAddInts(dst, a, b, from, to);
+            testCopyBytes(bdst, src, from, to - 1);
+            for (int i = 0; i < SIZE; i++) {
+                int expected = (i >= from && i < to) ? 4 * i : -1;
+                if (dst[i] != expected) {
+                    throw new RuntimeException("dst[" + i + "] = " + dst[i] + ", expected " + expected);
+                }
+                byte bexpected = (i > from && i < to) ? (byte)(i - 1 + 1) : (byte)-1;
+                if (bdst[i] != bexpected) {
+                    throw new RuntimeException("bdst[" + i + "] = " + bdst[i] + ", expected " + bexpected);
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,99 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test post loop vectorization with vector masks of loops that
+ *          mix element sizes, e.g. widening bytes and chars to ints.
+ * @requires vm.compiler2.enabled
+ * @run main/othervm -XX:+UnlockExperimentalVMOptions -XX:+PostLoopMultiversioning
+ *                   -Xbatch -XX:-TieredCompilation
+ *                   compiler.c2.loopopts.TestVectorizedMixedSizePostLoop
+ */
+
+package compiler.c2.loopopts;
+
+public class TestVectorizedMixedSizePostLoop {
+
+    private static final int Iterations = 20_000;
+
+    static void byteToInt(byte[] src, int[] dst, int len) {
+        for (int i = 0; i < len; i++) {
+            dst[i] = src[i] + 1;
+        }
+    }
+
+    static void charToInt(char[] src, int[] dst, int len) {
+        for (int i = 0; i < len; i++) {
+            dst[i] = src[i] * 3;
+        }
+    }
+
+    static void intToByte(int[] src, byte[] dst, int len) {
+        for (int i = 0; i < len; i++) {
+            dst[i] = (byte)(src[i] >> 2);
+        }
+    }
+
+    public static void main(String[] args) {
+        byte[] bytes = new byte[257];
+        char[] chars = new char[257];
+        int[] ints = new int[257];
+        for (int i = 0; i < bytes.length; i++) {
+            bytes[i] = (byte)(i * 7);
+            chars[i] = (char)(i * 13 + 0x100);
+        }
+
+        for (int n = 0; n < Iterations; n++) {
+            // Vary the length to exercise all possible post loop trip counts.
+            int len = 20 + (n % 180);
+
+            byteToInt(bytes, ints, len);
+            verify("byteToInt", ints, len, i -> bytes[i] + 1);
+
+            charToInt(chars, ints, len);
+            verify("charToInt", ints, len, i -> chars[i] * 3);
+
+            byte[] out = new byte[bytes.length];
+            intToByte(ints, out, len);
+            for (int i = 0; i < out.length; i++) {
+                byte expected = (i < len) ? (byte)(ints[i] >> 2) : 0;
+                if (out[i] != expected) {
+                    throw new RuntimeException("intToByte: wrong value at " + i + " for length " + len);
+                }
+            }
+        }
+    }
+
+    interface Expected {
+        int at(int i);
+    }
+
+    static void verify(String name, int[] values, int len, Expected expected) {
+        for (int i = 0; i < len; i++) {
+            if (values[i] != expected.at(i)) {
+                throw new RuntimeException(name + ": wrong value at " + i + " for length " + len);
+            }
+        }
+    }
+}
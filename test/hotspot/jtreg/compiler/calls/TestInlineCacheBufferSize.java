@@ -0,0 +1,58 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that the inline cache buffer is sized for the number of
+ *          processors unless InlineCacheBufferSize is set explicitly.
+ * @library /test/lib
+ * @run driver compiler.calls.TestInlineCacheBufferSize
+ */
+
+package compiler.calls;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestInlineCacheBufferSize {
+
+    public static void main(String[] args) throws Exception {
+        // Many processors scale the default size.
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:ActiveProcessorCount=32",
+            "-Xlog:codecache=debug",
+            "-version");
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("InlineCacheBuffer size: ([2-9][0-9]|[1-9][0-9][0-9]+)K");
+
+        // An explicit size is kept.
+        output = ProcessTools.executeLimitedTestJava(
+            "-XX:ActiveProcessorCount=32",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:InlineCacheBufferSize=12K",
+            "-Xlog:codecache=debug",
+            "-version");
+        output.shouldHaveExitValue(0);
+        output.shouldContain("InlineCacheBuffer size: 12K");
+    }
+}
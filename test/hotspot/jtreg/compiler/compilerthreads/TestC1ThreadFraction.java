@@ -0,0 +1,60 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that CIC1ThreadFraction splits the compiler threads between
+ *          C1 and C2 and keeps at least one thread for each compiler.
+ * @requires vm.flagless & vm.compiler1.enabled & vm.compiler2.enabled
+ * @library /test/lib
+ * @run driver compiler.compilerthreads.TestC1ThreadFraction
+ */
+
+package compiler.compilerthreads;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestC1ThreadFraction {
+
+    public static void main(String[] args) throws Exception {
+        check("0.5", 3, 3);
+        check("0.0", 1, 5);
+        check("1.0", 5, 1);
+    }
+
+    private static void check(String fraction, int c1Threads, int c2Threads) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeTestJava(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:CICompilerCount=6",
+            "-XX:CIC1ThreadFraction=" + fraction,
+            "-XX:-UseDynamicNumberOfCompilerThreads",
+            "-Xlog:jit+thread=debug",
+            "-version");
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Added initial compiler thread C1 CompilerThread" + (c1Threads - 1));
+        output.shouldNotContain("Added initial compiler thread C1 CompilerThread" + c1Threads);
+        output.shouldContain("Added initial compiler thread C2 CompilerThread" + (c2Threads - 1));
+        output.shouldNotContain("Added initial compiler thread C2 CompilerThread" + c2Threads);
+    }
+}
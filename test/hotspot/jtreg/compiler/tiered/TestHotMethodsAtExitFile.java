@@ -0,0 +1,83 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that HotMethodsAtExitFile writes compile commands for the
+ *          methods compiled at the highest tier that a later run can use.
+ * @requires vm.flagless & vm.compiler2.enabled
+ * @library /test/lib
+ * @run driver compiler.tiered.TestHotMethodsAtExitFile
+ */
+
+package compiler.tiered;
+
+import java.nio.file.Files;
+import java.nio.file.Path;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestHotMethodsAtExitFile {
+
+    public static void main(String[] args) throws Exception {
+        Path file = Path.of("hot_methods.txt");
+
+        OutputAnalyzer output = ProcessTools.executeTestJava(
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:HotMethodsAtExitFile=" + file,
+            "-XX:HotMethodsThresholdScaling=0.05",
+            "-Xlog:jit+compilation=info",
+            Workload.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("Wrote [0-9]+ hot methods to ");
+
+        List<String> lines = Files.readAllLines(file);
+        String expected = "CompileThresholdScaling," + Workload.class.getName().replace('.', '/') + ".hot(I)I,0.050000";
+        if (!lines.contains(expected)) {
+            throw new RuntimeException("Missing '" + expected + "' in " + lines);
+        }
+
+        // The file can be used as compile command file.
+        output = ProcessTools.executeTestJava(
+            "-XX:CompileCommandFile=" + file,
+            Workload.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldNotContain("CompileCommand: An error occurred during parsing");
+    }
+
+    public static class Workload {
+        static int hot(int x) {
+            return x * 31 + (x >>> 3);
+        }
+
+        public static void main(String[] args) {
+            int sum = 0;
+            for (int i = 0; i < 1_000_000; i++) {
+                sum += hot(i);
+            }
+            System.out.println(sum);
+        }
+    }
+}
@@ -0,0 +1,101 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that the interpreter starts profiling methods that are queued
+ *          for a C1 compilation unless Tier0ProfileQueuedMethods is off.
+ * @requires vm.flagless & vm.compiler1.enabled & vm.compiler2.enabled
+ * @library /test/lib
+ * @run driver compiler.tiered.TestTier0ProfileQueuedMethods
+ */
+
+package compiler.tiered;
+
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestTier0ProfileQueuedMethods {
+
+    private static final String HOT = Workload.class.getName() + ".hot(I)I";
+
+    private static List<String> run(boolean profileQueued) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeTestJava(
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:" + (profileQueued ? "+" : "-") + "Tier0ProfileQueuedMethods",
+            // Only compile hot(), so that the C1 queue stays short and
+            // nothing else delays profiling in the interpreter.
+            "-XX:CompileCommand=quiet",
+            "-XX:CompileCommand=compileonly," + Workload.class.getName() + "::hot",
+            "-XX:+PrintTieredEvents",
+            Workload.class.getName());
+        output.shouldHaveExitValue(0);
+        return output.asLines();
+    }
+
+    // Returns whether an MDO was created for hot() in the interpreter after
+    // it was queued for a tier 3 compilation. Until the tier 3 code is
+    // installed, the method runs in the interpreter.
+    private static boolean profiledWhileQueued(List<String> lines) {
+        boolean queued = false;
+        for (String line : lines) {
+            if (line.contains("[compile level=3 [" + HOT + "]")) {
+                queued = true;
+            } else if (line.contains("[create-mdo level=0 [" + HOT + "]")) {
+                if (queued) {
+                    return true;
+                }
+                throw new RuntimeException("Profiling started before compilation: " + line);
+            }
+        }
+        if (!queued) {
+            throw new RuntimeException("hot() was not compiled at tier 3");
+        }
+        return false;
+    }
+
+    public static void main(String[] args) throws Exception {
+        if (!profiledWhileQueued(run(true))) {
+            throw new RuntimeException("hot() was not profiled in the interpreter while queued");
+        }
+        if (profiledWhileQueued(run(false))) {
+            throw new RuntimeException("hot() was profiled in the interpreter while queued");
+        }
+    }
+
+    public static class Workload {
+        static int hot(int x) {
+            return x * 31 + (x >>> 3);
+        }
+
+        public static void main(String[] args) {
+            int sum = 0;
+            for (int i = 0; i < 1_000_000; i++) {
+                sum += hot(i);
+            }
+            System.out.println(sum);
+        }
+    }
+}
@@ -0,0 +1,109 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc;
+
+/*
+ * @test id=G1
+ * @summary Smoke test GC task stealing with GCStealBatchLimit and
+ *          GCStealPreferLocalNode, and check the range of GCStealBatchLimit.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @run driver gc.TestGCStealOptions -XX:+UseG1GC
+ */
+
+/*
+ * @test id=Parallel
+ * @requires vm.gc.Parallel
+ * @library /test/lib
+ * @run driver gc.TestGCStealOptions -XX:+UseParallelGC
+ */
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.List;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestGCStealOptions {
+
+    private static OutputAnalyzer run(String gc, String... flags) throws Exception {
+        List<String> args = new ArrayList<>();
+        Collections.addAll(args, gc, "-XX:+UnlockExperimentalVMOptions", "-XX:ParallelGCThreads=4", "-Xmx128m");
+        Collections.addAll(args, flags);
+        args.add(Workload.class.getName());
+        return ProcessTools.executeLimitedTestJava(args);
+    }
+
+    public static void main(String[] args) throws Exception {
+        String gc = args[0];
+
+        String[][] valid = {
+            { "-XX:GCStealBatchLimit=1" },
+            { "-XX:GCStealBatchLimit=64" },
+            { "-XX:GCStealBatchLimit=" + 0xffffffffL },
+            { "-XX:+UseNUMA", "-XX:+GCStealPreferLocalNode" },
+            { "-XX:+UseNUMA", "-XX:+GCStealPreferLocalNode", "-XX:GCStealBatchLimit=16" },
+        };
+        for (String[] flags : valid) {
+            OutputAnalyzer output = run(gc, flags);
+            output.shouldHaveExitValue(0);
+        }
+
+        String[] invalid = { "-1", "" + (0xffffffffL + 1) };
+        for (String value : invalid) {
+            OutputAnalyzer output = run(gc, "-XX:GCStealBatchLimit=" + value);
+            output.shouldNotHaveExitValue(0);
+            output.shouldContain("Improperly specified VM option 'GCStealBatchLimit=" + value + "'");
+        }
+    }
+
+    public static class Workload {
+        static class Node {
+            Node left;
+            Node right;
+        }
+
+        // A wide tree, so that the marking and copying work is spread over
+        // the task queues of all workers and stolen.
+        static Node build(int depth) {
+            Node n = new Node();
+            if (depth > 0) {
+                n.left = build(depth - 1);
+                n.right = build(depth - 1);
+            }
+            return n;
+        }
+
+        public static void main(String[] args) {
+            Node root = build(18);
+            for (int i = 0; i < 5; i++) {
+                System.gc();
+            }
+            if (root.left == null || root.right == null) {
+                throw new RuntimeException("Tree was not kept alive");
+            }
+        }
+    }
+}
@@ -0,0 +1,156 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc;
+
+/*
+ * @test id=Serial
+ * @summary Test that references are enqueued and cleared correctly when
+ *          PhantomReferences are processed together with other references.
+ * @requires vm.gc.Serial
+ * @library /test/lib
+ * @run main/othervm -XX:+UseSerialGC -XX:+UnlockExperimentalVMOptions
+ *                   -XX:+RefProcMergePhantomPhase gc.TestRefProcMergePhantomPhase
+ */
+
+/*
+ * @test id=Parallel
+ * @requires vm.gc.Parallel
+ * @library /test/lib
+ * @run main/othervm -XX:+UseParallelGC -XX:+UnlockExperimentalVMOptions
+ *                   -XX:+RefProcMergePhantomPhase gc.TestRefProcMergePhantomPhase
+ */
+
+/*
+ * @test id=G1
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @run main/othervm -XX:+UseG1GC -XX:+UnlockExperimentalVMOptions
+ *                   -XX:+RefProcMergePhantomPhase gc.TestRefProcMergePhantomPhase
+ */
+
+/*
+ * @test id=G1Concurrent
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @run main/othervm -XX:+UseG1GC -XX:+ExplicitGCInvokesConcurrent
+ *                   -XX:+UnlockExperimentalVMOptions
+ *                   -XX:+RefProcMergePhantomPhase gc.TestRefProcMergePhantomPhase
+ */
+
+import java.lang.ref.PhantomReference;
+import java.lang.ref.Reference;
+import java.lang.ref.ReferenceQueue;
+import java.lang.ref.WeakReference;
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.IdentityHashMap;
+import java.util.List;
+import java.util.Set;
+
+import jdk.test.lib.Asserts;
+
+public class TestRefProcMergePhantomPhase {
+
+    private static final int COUNT = 1000;
+    private static final int MAX_GCS = 100;
+
+    // Payloads of Finalizable objects, made strongly reachable again by their finalizers.
+    private static final List<Object> resurrected = Collections.synchronizedList(new ArrayList<>());
+
+    private static class Finalizable {
+        private final Object payload;
+
+        Finalizable(Object payload) {
+            this.payload = payload;
+        }
+
+        @SuppressWarnings("removal")
+        @Override
+        protected void finalize() {
+            resurrected.add(payload);
+        }
+    }
+
+    // Runs GCs until all references have been enqueued on the queue.
+    private static void awaitEnqueued(ReferenceQueue<Object> queue, List<? extends Reference<Object>> refs) throws InterruptedException {
+        Set<Reference<?>> enqueued = Collections.newSetFromMap(new IdentityHashMap<>());
+        for (int i = 0; i < MAX_GCS && enqueued.size() < refs.size(); i++) {
+            System.gc();
+            Reference<?> ref;
+            while ((ref = queue.remove(100)) != null) {
+                enqueued.add(ref);
+            }
+        }
+        Asserts.assertEquals(refs.size(), enqueued.size(), "Not all references were enqueued");
+        for (Reference<Object> ref : refs) {
+            Asserts.assertTrue(enqueued.contains(ref), "Reference not enqueued");
+            Asserts.assertTrue(ref.refersTo(null), "Enqueued reference not cleared");
+        }
+    }
+
+    private static void testPhantomOnly() throws InterruptedException {
+        ReferenceQueue<Object> queue = new ReferenceQueue<>();
+        List<PhantomReference<Object>> phantoms = new ArrayList<>();
+        for (int i = 0; i < COUNT; i++) {
+            phantoms.add(new PhantomReference<>(new Object(), queue));
+        }
+        awaitEnqueued(queue, phantoms);
+    }
+
+    private static void testMixed() throws InterruptedException {
+        ReferenceQueue<Object> queue = new ReferenceQueue<>();
+        ReferenceQueue<Object> payloadQueue = new ReferenceQueue<>();
+        List<Reference<Object>> refs = new ArrayList<>();
+        List<PhantomReference<Object>> payloadPhantoms = new ArrayList<>();
+        for (int i = 0; i < COUNT; i++) {
+            refs.add(new WeakReference<>(new Object(), queue));
+            refs.add(new PhantomReference<>(new Object(), queue));
+            Object payload = new Object();
+            payloadPhantoms.add(new PhantomReference<>(payload, payloadQueue));
+            new Finalizable(payload);
+        }
+        awaitEnqueued(queue, refs);
+
+        // The payloads are kept alive for their finalizers, so their
+        // PhantomReferences must not have been enqueued.
+        for (int i = 0; i < MAX_GCS && resurrected.size() < COUNT; i++) {
+            System.gc();
+            System.runFinalization();
+        }
+        Asserts.assertEquals(COUNT, resurrected.size(), "Not all finalizers ran");
+        System.gc();
+        Asserts.assertNull(payloadQueue.poll(), "PhantomReference to a resurrected object enqueued");
+        for (PhantomReference<Object> ref : payloadPhantoms) {
+            Asserts.assertFalse(ref.refersTo(null), "PhantomReference to a resurrected object cleared");
+        }
+
+        resurrected.clear();
+        awaitEnqueued(payloadQueue, payloadPhantoms);
+    }
+
+    public static void main(String[] args) throws Exception {
+        testPhantomOnly();
+        testMixed();
+    }
+}
@@ -0,0 +1,120 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc;
+
+/*
+ * @test
+ * @summary Check that TLABSizeFromSlowAllocations grows the desired TLAB
+ *          size of a thread that keeps allocating outside of its TLAB.
+ * @requires vm.gc.Serial
+ * @library /test/lib
+ * @run driver gc.TestTLABSizeFromSlowAllocations
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestTLABSizeFromSlowAllocations {
+
+    private static final int REFILL_WASTE_FRACTION = 64;
+
+    private static final Pattern NEW_SIZE =
+        Pattern.compile("TLAB new size: .* slow: (\\d+) desired_size: (\\d+) -> (\\d+)");
+
+    private static OutputAnalyzer run(boolean enabled) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:+UseSerialGC",
+            "-Xmx256m",
+            "-Xmn64m",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:" + (enabled ? "+" : "-") + "TLABSizeFromSlowAllocations",
+            "-XX:+ResizeTLAB",
+            // A small initial tlab whose refill waste limit (TLABSize / 64)
+            // is well below the size of the allocations in the workload, so
+            // that they go outside of the tlab.
+            "-XX:TLABSize=256k",
+            "-XX:TLABRefillWasteFraction=" + REFILL_WASTE_FRACTION,
+            "-Xlog:gc+tlab=trace",
+            Workload.class.getName());
+        output.shouldHaveExitValue(0);
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        // With the flag on, the resize of the allocating thread's tlab takes
+        // its slow allocations into account, and the new desired size is big
+        // enough that the refill waste limit covers them.
+        Matcher m = NEW_SIZE.matcher(run(true).getStdout());
+        boolean found = false;
+        while (m.find()) {
+            long slow = Long.parseLong(m.group(1));
+            long newSize = Long.parseLong(m.group(3));
+            if (slow == 0) {
+                continue;
+            }
+            found = true;
+            if (newSize < slow * REFILL_WASTE_FRACTION) {
+                throw new RuntimeException("Desired size " + newSize + " does not cover slow allocations of " +
+                                           slow + " words: " + m.group());
+            }
+        }
+        if (!found) {
+            throw new RuntimeException("No tlab resize accounted for slow allocations");
+        }
+
+        // With the flag off, slow allocations are not sampled.
+        m = NEW_SIZE.matcher(run(false).getStdout());
+        found = false;
+        while (m.find()) {
+            found = true;
+            if (Long.parseLong(m.group(1)) != 0) {
+                throw new RuntimeException("Slow allocations sampled with the flag off: " + m.group());
+            }
+        }
+        if (!found) {
+            throw new RuntimeException("No tlab resize logged");
+        }
+    }
+
+    public static class Workload {
+        static Object sink;
+
+        public static void main(String[] args) {
+            Object[] keep = new Object[64];
+            for (int gc = 0; gc < 5; gc++) {
+                // 32k arrays, more than the eight samples the resize asks
+                // for before it trusts the histogram.
+                for (int i = 0; i < 1024; i++) {
+                    byte[] b = new byte[32 * 1024];
+                    keep[i % keep.length] = b;
+                    sink = b;
+                }
+                System.gc();
+            }
+        }
+    }
+}
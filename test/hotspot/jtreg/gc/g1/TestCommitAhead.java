@@ -0,0 +1,82 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestCommitAhead
+ * @summary Test that committing regions ahead of heap expansion on the service
+ *          thread works together with expansion, shrinking and uncommit.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @run driver gc.g1.TestCommitAhead
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestCommitAhead {
+
+    public static void main(String[] args) throws Exception {
+        runTest("-XX:-AlwaysPreTouch");
+        runTest("-XX:+AlwaysPreTouch");
+    }
+
+    private static void runTest(String preTouchFlag) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:+UseG1GC",
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+G1CommitAhead",
+            preTouchFlag,
+            // Make heap expansion after young collections likely.
+            "-XX:GCTimeRatio=99",
+            "-XX:+VerifyAfterGC",
+            "-Xms8M",
+            "-Xmx128M",
+            "-XX:G1HeapRegionSize=1M",
+            "-Xlog:gc+heap=debug",
+            GCTest.class.getName());
+
+        output.shouldHaveExitValue(0);
+        System.out.println(output.getStdout());
+    }
+
+    public static class GCTest {
+        private static final int NumArrays = 2000;
+        private static Object[] sink = new Object[NumArrays];
+
+        public static void main(String args[]) throws Exception {
+            long deadline = System.currentTimeMillis() + 2000;
+            int i = 0;
+            while (System.currentTimeMillis() < deadline) {
+                sink[i++ % NumArrays] = new byte[16 * 1024];
+                if (i % 100000 == 0) {
+                    // Shrink the heap and return committed ahead regions.
+                    System.gc();
+                }
+            }
+            System.out.println(sink.length);
+        }
+    }
+}
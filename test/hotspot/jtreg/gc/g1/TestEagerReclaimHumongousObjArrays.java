@@ -0,0 +1,112 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestEagerReclaimHumongousObjArrays
+ * @summary Test that humongous object arrays containing references into other
+ *          regions are eagerly reclaimed once they become unreachable, and that
+ *          the remembered set entries they leave behind do not cause problems.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run driver gc.g1.TestEagerReclaimHumongousObjArrays
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.Asserts;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+
+public class TestEagerReclaimHumongousObjArrays {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-Xbootclasspath/a:.",
+            "-XX:+UseG1GC",
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:+WhiteBoxAPI",
+            "-XX:+VerifyAfterGC",
+            "-Xms128M",
+            "-Xmx128M",
+            "-XX:G1HeapRegionSize=1M",
+            "-Xlog:gc+humongous=debug",
+            GCTest.class.getName());
+
+        output.shouldHaveExitValue(0);
+
+        Pattern p = Pattern.compile("Reclaimed humongous region [0-9]+ \\(object size ([0-9]+) @");
+        Matcher m = p.matcher(output.getStdout());
+        int found = 0;
+        while (m.find()) {
+            if (Long.parseLong(m.group(1)) >= GCTest.MinArrayBytes) {
+                found++;
+            }
+        }
+        System.out.println("Eagerly reclaimed " + found + " humongous object arrays");
+        Asserts.assertGTE(found, GCTest.NumIterations / 2, "Too few humongous object arrays were eagerly reclaimed");
+    }
+
+    public static class GCTest {
+        public static final int NumIterations = 10;
+        private static final int NumElements = 1024 * 1024;
+        // The size of the object arrays in bytes is at least this, independent of
+        // compressed oops.
+        public static final long MinArrayBytes = NumElements * 4L;
+
+        // Old objects the humongous object arrays refer to, resulting in remembered
+        // set entries for the old regions containing them.
+        static Object[] oldObjects = new Object[1024];
+
+        // Keep the most recent humongous object array reachable from an old object
+        // until the next iteration, so that it has remembered set entries itself.
+        static Object[] holder = new Object[1];
+
+        public static void main(String[] args) {
+            WhiteBox wb = WhiteBox.getWhiteBox();
+
+            for (int i = 0; i < oldObjects.length; i++) {
+                oldObjects[i] = new int[16];
+            }
+            wb.fullGC();
+
+            for (int i = 0; i < NumIterations; i++) {
+                Object[] large = new Object[NumElements];
+                for (int j = 0; j < large.length; j += 512) {
+                    large[j] = oldObjects[j % oldObjects.length];
+                    large[j + 1] = new int[16];
+                }
+                holder[0] = large;
+                wb.youngGC();
+                holder[0] = null;
+                wb.youngGC();
+            }
+            System.out.println(oldObjects.length);
+        }
+    }
+}
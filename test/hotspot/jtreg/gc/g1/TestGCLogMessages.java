@@ -125,6 +125,7 @@ public class TestGCLogMessages {
         new LogMessageWithLevel("Merged Howl Inline", Level.DEBUG),
         new LogMessageWithLevel("Merged Howl ArrayOfCards", Level.DEBUG),
         new LogMessageWithLevel("Merged Howl BitMap", Level.DEBUG),
+        new LogMessageWithLevel("Merged Howl Runs", Level.DEBUG),
         new LogMessageWithLevel("Merged Howl Full", Level.DEBUG),
         new LogMessageWithLevel("Log Buffers", Level.DEBUG),
         new LogMessageWithLevel("Dirty Cards", Level.DEBUG),
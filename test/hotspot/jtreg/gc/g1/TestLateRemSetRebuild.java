@@ -0,0 +1,115 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestLateRemSetRebuild
+ * @summary Test that the late remembered set rebuild during the mixed phase
+ *          results in complete remembered sets.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run driver gc.g1.TestLateRemSetRebuild
+ */
+
+import java.util.ArrayList;
+import java.util.Collections;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+
+public class TestLateRemSetRebuild {
+
+    public static void main(String[] args) throws Exception {
+        ArrayList<String> opts = new ArrayList<>();
+        Collections.addAll(opts, new String[] {
+                                 "-Xbootclasspath/a:.",
+                                 "-XX:+UseG1GC",
+                                 "-XX:+UnlockDiagnosticVMOptions",
+                                 "-XX:+UnlockExperimentalVMOptions",
+                                 "-XX:+WhiteBoxAPI",
+                                 "-XX:+G1UseLateRemSetRebuild",
+                                 "-XX:G1LateRemSetRebuildLiveThresholdPercent=100",
+                                 "-XX:G1HeapWastePercent=0",
+                                 "-XX:+VerifyAfterGC",
+                                 "-XX:VerifyGCType=young-normal",
+                                 "-XX:VerifyGCType=mixed",
+                                 "-XX:ParallelGCThreads=1",
+                                 "-Xlog:gc+remset+tracking=debug",
+                                 "-Xms32M",
+                                 "-Xmx32M",
+                                 "-XX:G1HeapRegionSize=1M",
+                                 GCTest.class.getName()});
+
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(opts);
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("Late Rebuild: (Selected [0-9]+ of [0-9]+ eligible regions|No regions selected)");
+    }
+
+    public static class GCTest {
+        private static final int NumObjects = 20000;
+        private static final int ObjectSize = 256;
+
+        public static void main(String args[]) throws Exception {
+            WhiteBox wb = WhiteBox.getWhiteBox();
+
+            // Regions that will be mostly live after marking, and not selected for
+            // remembered set rebuild at Remark but eligible for the late rebuild.
+            Object[] mostlyLive = new Object[NumObjects];
+            // Regions that will be collection set candidates after marking.
+            Object[] mostlyDead = new Object[NumObjects];
+            for (int i = 0; i < NumObjects; i++) {
+                mostlyLive[i] = new byte[ObjectSize];
+            }
+            for (int i = 0; i < NumObjects; i++) {
+                mostlyDead[i] = new byte[ObjectSize];
+            }
+            // Compact everything into old regions.
+            wb.fullGC();
+
+            for (int i = 0; i < NumObjects; i++) {
+                if (i % 10 == 0) {
+                    mostlyLive[i] = null;
+                }
+                if (i % 2 == 0) {
+                    mostlyDead[i] = null;
+                }
+            }
+            // Add references from the candidates into the mostly live regions.
+            for (int i = 1; i < NumObjects; i += 2) {
+                mostlyDead[i] = new Object[] { mostlyLive[NumObjects - i] };
+            }
+
+            wb.g1RunConcurrentGC();
+            // Young gc preparing the mixed phase, then mixed gcs.
+            for (int i = 0; i < 10; i++) {
+                wb.youngGC();
+                Thread.sleep(20);
+            }
+            System.out.println(mostlyLive.length + mostlyDead.length);
+        }
+    }
+}
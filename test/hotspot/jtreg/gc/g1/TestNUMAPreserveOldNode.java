@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test
+ * @summary Test that copying objects to old regions on the node of their source
+ *          region works, with and without NUMA being available.
+ * @requires vm.gc.G1
+ * @run main/othervm -XX:+UseG1GC -XX:+UseNUMA -XX:+UnlockExperimentalVMOptions -XX:+G1NUMAPreserveOldNode
+ *                   -XX:MaxTenuringThreshold=1 -Xms32m -Xmx32m -XX:G1HeapRegionSize=1M
+ *                   -Xlog:gc+heap+numa=info gc.g1.TestNUMAPreserveOldNode
+ */
+
+import java.util.ArrayList;
+
+public class TestNUMAPreserveOldNode {
+    public static void main(String[] args) throws Exception {
+        ArrayList<Object> live = new ArrayList<>();
+        // Keep some objects alive for long enough to be promoted, and let the
+        // young gcs copy them into old regions.
+        for (int i = 0; i < 200_000; i++) {
+            live.add(new byte[64]);
+            if (live.size() > 50_000) {
+                live.subList(0, 25_000).clear();
+            }
+        }
+        System.out.println(live.size());
+    }
+}
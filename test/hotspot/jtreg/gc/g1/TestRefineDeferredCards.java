@@ -0,0 +1,116 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestRefineDeferredCards
+ * @summary Test that deferring refinement of cards in regions that are likely
+ *          to be evacuated by the next mixed gc keeps remembered sets complete.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @build jdk.test.whitebox.WhiteBox
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller jdk.test.whitebox.WhiteBox
+ * @run driver gc.g1.TestRefineDeferredCards
+ */
+
+import java.util.ArrayList;
+import java.util.Collections;
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.whitebox.WhiteBox;
+
+public class TestRefineDeferredCards {
+
+    public static void main(String[] args) throws Exception {
+        ArrayList<String> opts = new ArrayList<>();
+        Collections.addAll(opts, new String[] {
+                                 "-Xbootclasspath/a:.",
+                                 "-XX:+UseG1GC",
+                                 "-XX:+UnlockDiagnosticVMOptions",
+                                 "-XX:+UnlockExperimentalVMOptions",
+                                 "-XX:+WhiteBoxAPI",
+                                 "-XX:G1RefineDeferredCardsPerRegion=64",
+                                 // Refine all pending cards concurrently.
+                                 "-XX:G1RSetUpdatingPauseTimePercent=0",
+                                 "-XX:G1HeapWastePercent=0",
+                                 "-XX:G1MixedGCLiveThresholdPercent=100",
+                                 "-XX:+VerifyAfterGC",
+                                 "-XX:VerifyGCType=mixed",
+                                 "-Xlog:gc+refine+stats=debug",
+                                 "-Xms32M",
+                                 "-Xmx32M",
+                                 "-XX:G1HeapRegionSize=1M",
+                                 GCTest.class.getName()});
+
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(opts);
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("Total refinement: .*, deferred: [0-9]+");
+
+        // Some cards in the candidate regions must have actually been deferred.
+        Matcher m = Pattern.compile("Total refinement: .*, deferred: ([0-9]+)").matcher(output.getStdout());
+        long maxDeferred = 0;
+        while (m.find()) {
+            maxDeferred = Math.max(maxDeferred, Long.parseLong(m.group(1)));
+        }
+        if (maxDeferred == 0) {
+            throw new RuntimeException("No cards have been deferred");
+        }
+    }
+
+    public static class GCTest {
+        private static final int NumObjects = 20000;
+        private static final int ObjectSize = 256;
+
+        public static void main(String args[]) throws Exception {
+            WhiteBox wb = WhiteBox.getWhiteBox();
+
+            Object[][] holders = new Object[NumObjects][];
+            for (int i = 0; i < NumObjects; i++) {
+                holders[i] = new Object[ObjectSize / 8];
+            }
+            // Compact everything into old regions.
+            wb.fullGC();
+
+            // Make the old regions collection set candidates after marking.
+            for (int i = 0; i < NumObjects; i += 2) {
+                holders[i] = null;
+            }
+
+            wb.g1RunConcurrentGC();
+            // Young gc preparing the mixed phase, then mixed gcs. Dirty cards in the
+            // old regions in between, with some time for concurrent refinement.
+            for (int i = 0; i < 10; i++) {
+                wb.youngGC();
+                for (int j = 1; j < NumObjects; j += 2) {
+                    holders[j][0] = new byte[16];
+                }
+                Thread.sleep(100);
+            }
+            System.out.println(holders.length);
+        }
+    }
+}
@@ -0,0 +1,69 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestRegionSizeWorkingSet
+ * @summary Test that the ergonomic region size selection uses
+ *          G1ExpectedMaxWorkingSetSize if set.
+ * @requires vm.gc.G1 & vm.bits == 64
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver gc.g1.TestRegionSizeWorkingSet
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestRegionSizeWorkingSet {
+
+    private static void checkRegionSize(long expectedRegionSize, String... flags) throws Exception {
+        String[] baseArgs = new String[] { "-XX:+UseG1GC",
+                                           "-XX:+UnlockExperimentalVMOptions",
+                                           "-Xmx8g",
+                                           "-Xlog:gc+ergo+heap=debug",
+                                           "-XX:+PrintFlagsFinal",
+                                           "-version" };
+        String[] args = new String[flags.length + baseArgs.length];
+        System.arraycopy(flags, 0, args, 0, flags.length);
+        System.arraycopy(baseArgs, 0, args, flags.length, baseArgs.length);
+
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(args);
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("size_t G1HeapRegionSize\\s+= " + expectedRegionSize + " ");
+        output.shouldContain("Projected remembered set container sizes");
+    }
+
+    public static void main(String[] args) throws Exception {
+        final long M = 1024 * 1024;
+        // 8g / 2048 regions.
+        checkRegionSize(4 * M);
+        checkRegionSize(1 * M, "-XX:G1ExpectedMaxWorkingSetSize=512m");
+        checkRegionSize(2 * M, "-XX:G1ExpectedMaxWorkingSetSize=4g");
+        // Capped by the maximum heap size.
+        checkRegionSize(4 * M, "-XX:G1ExpectedMaxWorkingSetSize=64g");
+        // An explicit region size takes precedence.
+        checkRegionSize(8 * M, "-XX:G1ExpectedMaxWorkingSetSize=512m", "-XX:G1HeapRegionSize=8m");
+    }
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.g1;
+
+/*
+ * @test TestSoftMaxHeapSize
+ * @summary Test that G1 shrinks the heap towards SoftMaxHeapSize when it is
+ *          lowered at run time.
+ * @requires vm.gc.G1
+ * @library /test/lib
+ * @modules java.management jdk.management
+ * @run main/othervm -XX:+UseG1GC -Xmx256m -XX:InitialHeapSize=128m -XX:MinHeapSize=8m
+ *                   -XX:MaxHeapFreeRatio=100 -XX:G1HeapRegionSize=1m
+ *                   -Xlog:gc+ergo+heap=debug gc.g1.TestSoftMaxHeapSize
+ */
+
+import java.lang.management.ManagementFactory;
+
+import com.sun.management.HotSpotDiagnosticMXBean;
+
+public class TestSoftMaxHeapSize {
+
+    private static final long M = 1024 * 1024;
+    private static final long SoftMaxHeapSize = 32 * M;
+
+    public static void main(String[] args) throws Exception {
+        Runtime rt = Runtime.getRuntime();
+        long before = rt.totalMemory();
+        if (before <= SoftMaxHeapSize) {
+            throw new RuntimeException("Initial heap " + before + " is already below the soft maximum");
+        }
+
+        // MaxHeapFreeRatio=100 disables regular shrinking, so only the
+        // soft maximum makes the heap shrink.
+        HotSpotDiagnosticMXBean diagnostic = ManagementFactory.getPlatformMXBean(HotSpotDiagnosticMXBean.class);
+        diagnostic.setVMOption("SoftMaxHeapSize", Long.toString(SoftMaxHeapSize));
+        System.gc();
+
+        long after = rt.totalMemory();
+        System.out.println("Heap capacity before: " + before + " after: " + after);
+        if (after > SoftMaxHeapSize) {
+            throw new RuntimeException("Heap capacity " + after + " above SoftMaxHeapSize " + SoftMaxHeapSize);
+        }
+    }
+}
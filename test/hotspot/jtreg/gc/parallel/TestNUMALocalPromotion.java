@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package gc.parallel;
+
+/*
+ * @test
+ * @summary Test that PSNUMALocalPromotion binds promotion LABs to the local NUMA node.
+ * @requires vm.gc.Parallel
+ * @requires os.family == "linux"
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ * @run driver gc.parallel.TestNUMALocalPromotion
+ */
+
+import java.util.ArrayList;
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+import jtreg.SkippedException;
+
+public class TestNUMALocalPromotion {
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava("-XX:+UseParallelGC",
+                                                                    "-XX:+UseNUMA",
+                                                                    "-XX:+UnlockExperimentalVMOptions",
+                                                                    "-XX:+PSNUMALocalPromotion",
+                                                                    "-XX:-UseLargePages",
+                                                                    "-XX:MaxTenuringThreshold=1",
+                                                                    "-Xms64m", "-Xmx64m", "-Xmn16m",
+                                                                    "-XX:+PrintFlagsFinal",
+                                                                    "-Xlog:gc+numa=trace",
+                                                                    Promoter.class.getName());
+        output.shouldHaveExitValue(0);
+
+        String useNUMA = output.firstMatch("bool UseNUMA\\s+=\\s+(\\w+)", 1);
+        if (!"true".equals(useNUMA)) {
+            // UseNUMA is turned off on single node systems.
+            throw new SkippedException("NUMA is not available");
+        }
+        output.shouldMatch("Bound old gen range \\[0x[0-9a-f]+, 0x[0-9a-f]+\\) to node \\d+");
+    }
+
+    static class Promoter {
+        public static void main(String[] args) {
+            ArrayList<Object> live = new ArrayList<>();
+            // Keep objects alive across young collections so that they get
+            // promoted into newly allocated old generation LABs.
+            for (int i = 0; i < 400_000; i++) {
+                live.add(new byte[64]);
+                if (live.size() > 100_000) {
+                    live.subList(0, 50_000).clear();
+                }
+            }
+            System.out.println(live.size());
+        }
+    }
+}
@@ -0,0 +1,66 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that fields listed in ContendedFields are laid out as if they
+ *          were annotated with @Contended.
+ * @modules java.base/jdk.internal.misc
+ * @run main/othervm TestContendedFields false
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:ContendedFields=TestContendedFields$Holder.b
+ *                   TestContendedFields true
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:ContendedFields=Unrelated.a,TestContendedFields$Holder.b
+ *                   TestContendedFields true
+ * @run main/othervm -XX:+UnlockDiagnosticVMOptions
+ *                   -XX:ContendedFields=TestContendedFields$Holder.b
+ *                   -XX:-EnableContended
+ *                   TestContendedFields false
+ */
+
+import jdk.internal.misc.Unsafe;
+
+public class TestContendedFields {
+    private static final Unsafe U = Unsafe.getUnsafe();
+
+    static class Holder {
+        long a;
+        long b;
+    }
+
+    public static void main(String[] args) throws Exception {
+        boolean expectPadded = Boolean.parseBoolean(args[0]);
+        long a = U.objectFieldOffset(Holder.class.getDeclaredField("a"));
+        long b = U.objectFieldOffset(Holder.class.getDeclaredField("b"));
+        long distance = Math.abs(b - a);
+        System.out.println("Offsets: a = " + a + ", b = " + b);
+        // The default ContendedPaddingWidth is 128 bytes.
+        if (expectPadded && distance < 128) {
+            throw new RuntimeException("Field b is not padded: distance " + distance);
+        }
+        if (!expectPadded && distance != 8) {
+            throw new RuntimeException("Fields a and b are not adjacent: distance " + distance);
+        }
+    }
+}
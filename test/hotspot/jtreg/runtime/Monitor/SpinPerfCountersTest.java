@@ -0,0 +1,98 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test id=default
+ * @summary Test the PerfData counters for monitor spinning
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run main/othervm -XX:+UsePerfData SpinPerfCountersTest
+ */
+
+/*
+ * @test id=limited
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run main/othervm -XX:+UsePerfData -XX:+UnlockDiagnosticVMOptions -XX:MonitorMaxSpinners=1
+ *                   SpinPerfCountersTest
+ */
+
+import java.util.regex.Matcher;
+import java.util.regex.Pattern;
+
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+public class SpinPerfCountersTest {
+
+    private static final int THREADS = 4;
+    private static final long DURATION_MS = 1000;
+
+    private static final Object lock = new Object();
+    private static long counter;
+
+    private static long readCounter(OutputAnalyzer output, String name) {
+        Matcher m = Pattern.compile("sun\\.rt\\._sync_" + name + "=([0-9]+)").matcher(output.getStdout());
+        if (!m.find()) {
+            throw new RuntimeException("Counter " + name + " not found");
+        }
+        return Long.parseLong(m.group(1));
+    }
+
+    public static void main(String[] args) throws Exception {
+        // Contend on one monitor with short critical sections, which is
+        // where spinning is expected to pay off.
+        Thread[] threads = new Thread[THREADS];
+        long end = System.currentTimeMillis() + DURATION_MS;
+        for (int i = 0; i < THREADS; i++) {
+            threads[i] = new Thread(() -> {
+                while (System.currentTimeMillis() < end) {
+                    synchronized (lock) {
+                        for (int j = 0; j < 100; j++) {
+                            counter++;
+                        }
+                    }
+                }
+            });
+            threads[i].start();
+        }
+        for (Thread t : threads) {
+            t.join();
+        }
+
+        OutputAnalyzer output = new PidJcmdExecutor().execute("PerfCounter.print");
+        long successes = readCounter(output, "SpinSuccesses");
+        long failures = readCounter(output, "SpinFailures");
+        long skipped = readCounter(output, "SpinsSkipped");
+        System.out.println("Spin successes: " + successes + ", failures: " + failures + ", skipped: " + skipped);
+
+        // Spinning is disabled with a single processor.
+        if (Runtime.getRuntime().availableProcessors() > 1 && successes + failures + skipped == 0) {
+            throw new RuntimeException("No spin outcomes were counted");
+        }
+    }
+}
@@ -0,0 +1,86 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that concurrent thread dumps and deadlock detection, which
+ *          can be batched into the safepoints of other VM operations,
+ *          all complete with correct results.
+ * @run main/othervm -Xlog:vmthread=debug:file=vmthread.log TestBatchedVMOperations
+ */
+
+import java.lang.management.ManagementFactory;
+import java.lang.management.ThreadInfo;
+import java.lang.management.ThreadMXBean;
+import java.util.ArrayList;
+import java.util.List;
+import java.util.concurrent.atomic.AtomicReference;
+
+public class TestBatchedVMOperations {
+
+    public static void main(String[] args) throws Exception {
+        ThreadMXBean bean = ManagementFactory.getThreadMXBean();
+        AtomicReference<Throwable> failure = new AtomicReference<>();
+        long deadline = System.currentTimeMillis() + 3000;
+        long mainId = Thread.currentThread().threadId();
+
+        List<Thread> threads = new ArrayList<>();
+        for (int i = 0; i < 8; i++) {
+            final boolean dump = (i % 2 == 0);
+            Thread t = new Thread(() -> {
+                try {
+                    while (System.currentTimeMillis() < deadline) {
+                        if (dump) {
+                            ThreadInfo[] infos = bean.dumpAllThreads(true, true);
+                            boolean foundMain = false;
+                            for (ThreadInfo info : infos) {
+                                foundMain |= (info.getThreadId() == mainId);
+                            }
+                            if (!foundMain) {
+                                throw new RuntimeException("main thread missing from thread dump");
+                            }
+                        } else if (bean.findDeadlockedThreads() != null) {
+                            throw new RuntimeException("unexpected deadlock");
+                        }
+                    }
+                } catch (Throwable e) {
+                    failure.compareAndSet(null, e);
+                }
+            });
+            threads.add(t);
+            t.start();
+        }
+
+        // Safepoint operations the above can be batched with.
+        while (System.currentTimeMillis() < deadline) {
+            System.gc();
+        }
+
+        for (Thread t : threads) {
+            t.join();
+        }
+        if (failure.get() != null) {
+            throw new RuntimeException(failure.get());
+        }
+    }
+}
@@ -0,0 +1,79 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that threads late for a safepoint are sampled and reported.
+ * @requires vm.compiler2.enabled
+ * @library /test/lib
+ * @run driver TestSafepointStragglers
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestSafepointStragglers {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:SafepointStragglerSampleDelay=1",
+            // Compiled counted loops without safepoint polls delay safepoints.
+            "-XX:-UseCountedLoopSafepoints",
+            "-Xlog:safepoint+stragglers=info",
+            Spinner.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("still running after [0-9]+ ms");
+    }
+
+    public static class Spinner {
+        static volatile boolean done;
+        static volatile long sink;
+
+        static long spin(int n) {
+            long sum = 0;
+            for (int i = 0; i < n; i++) {
+                sum += (i ^ (sum >>> 3)) * 31;
+            }
+            return sum;
+        }
+
+        public static void main(String[] args) throws Exception {
+            for (int i = 0; i < 20_000; i++) {
+                sink = spin(1000);
+            }
+            Thread spinner = new Thread(() -> {
+                while (!done) {
+                    sink = spin(Integer.MAX_VALUE);
+                }
+            });
+            spinner.setDaemon(true);
+            spinner.start();
+            for (int i = 0; i < 10; i++) {
+                Thread.sleep(50);
+                System.gc();
+            }
+            done = true;
+        }
+    }
+}
@@ -0,0 +1,78 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Test that a CDS archive that needs relocation can be read into
+ *          its reserved space instead of being mapped.
+ * @requires vm.cds
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.management
+ * @run driver ReadArchiveForRelocation
+ */
+
+import jdk.test.lib.Platform;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class ReadArchiveForRelocation {
+    private static final String ARCHIVE_FILE = "./ReadArchiveForRelocation.jsa";
+
+    private static OutputAnalyzer run(String readOption) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:+UnlockDiagnosticVMOptions",
+            "-XX:SharedArchiveFile=" + ARCHIVE_FILE,
+            "-Xshare:on",
+            readOption,
+            // Always map at an address other than the one the archive was created for.
+            "-XX:ArchiveRelocationMode=1",
+            "-XX:+VerifySharedSpaces",
+            "-Xlog:cds",
+            "-Xlog:cds+reloc=debug",
+            "-version");
+        output.shouldHaveExitValue(0);
+        output.shouldContain("sharing");
+        output.shouldContain("runtime archive relocation done");
+        return output;
+    }
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:SharedArchiveFile=" + ARCHIVE_FILE,
+            "-Xshare:dump",
+            "-Xlog:cds");
+        output.shouldHaveExitValue(0);
+
+        // The core regions are read into committed memory.
+        output = run("-XX:+ReadArchiveForRelocation");
+        output.shouldMatch("Commit static +region #[0-9]+ .*\\(rw\\)");
+        output.shouldMatch("Commit static +region #[0-9]+ .*\\(ro\\)");
+
+        // The core regions are mapped, except on Windows, where they are always read.
+        output = run("-XX:-ReadArchiveForRelocation");
+        if (!Platform.isWindows()) {
+            output.shouldNotContain("Commit static");
+        }
+    }
+}
@@ -0,0 +1,95 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/**
+ * @test
+ * @summary Test that constant pool entries naming array classes are
+ *          archived resolved when their bottom class can be.
+ * @requires vm.cds
+ * @library /test/lib
+ * @build ResolvedArrayClassEntries
+ * @run driver jdk.test.lib.helpers.ClassFileInstaller -jar app.jar ArrayClassApp
+ * @run driver ResolvedArrayClassEntries
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class ResolvedArrayClassEntries {
+    private static final String BASE_ARCHIVE = "./ResolvedArrayClassEntries-base.jsa";
+    private static final String TOP_ARCHIVE = "./ResolvedArrayClassEntries-top.jsa";
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:SharedArchiveFile=" + BASE_ARCHIVE,
+            "-Xshare:dump",
+            "-Xlog:cds");
+        output.shouldHaveExitValue(0);
+
+        // The app runs before the dynamic archive is dumped, so all the array
+        // classes it names have been created by then.
+        output = ProcessTools.executeLimitedTestJava(
+            "-XX:SharedArchiveFile=" + BASE_ARCHIVE,
+            "-XX:ArchiveClassesAtExit=" + TOP_ARCHIVE,
+            "-Xlog:cds+resolve=debug",
+            "-cp", "app.jar",
+            "ArrayClassApp");
+        output.shouldHaveExitValue(0);
+        // Primitive arrays
+        output.shouldContain("ArrayClassApp => [I");
+        output.shouldContain("ArrayClassApp => [[I");
+        // Arrays of the class itself
+        output.shouldContain("ArrayClassApp => [LArrayClassApp;");
+        output.shouldContain("ArrayClassApp => [[LArrayClassApp;");
+        // The boot loader class String is not archived resolved in an app
+        // class, and neither are arrays of it.
+        output.shouldNotContain("ArrayClassApp => [Ljava.lang.String;");
+
+        // The archived entries are usable at runtime.
+        output = ProcessTools.executeLimitedTestJava(
+            "-XX:SharedArchiveFile=" + BASE_ARCHIVE + java.io.File.pathSeparator + TOP_ARCHIVE,
+            "-Xlog:class+load",
+            "-cp", "app.jar",
+            "ArrayClassApp");
+        output.shouldHaveExitValue(0);
+        output.shouldMatch("ArrayClassApp source: shared objects file");
+    }
+}
+
+class ArrayClassApp {
+    public static void main(String[] args) {
+        Object o = new int[1];
+        int[] ints = (int[]) o;
+        o = new int[1][1];
+        int[][] intss = (int[][]) o;
+        o = new ArrayClassApp[1];
+        ArrayClassApp[] apps = (ArrayClassApp[]) o;
+        o = new ArrayClassApp[1][];
+        ArrayClassApp[][] appss = (ArrayClassApp[][]) o;
+        o = new String[1];
+        String[] strings = (String[]) o;
+        if (ints.length + intss.length + apps.length + appss.length + strings.length != 5) {
+            throw new RuntimeException("Wrong array lengths");
+        }
+    }
+}
@@ -0,0 +1,61 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/* @test
+ * @summary Verify that -Xcheck:jni detects a JNI global handle deleted twice
+ *          when JNI global handles are cached per thread
+ * @requires vm.flagless
+ * @library /test/lib
+ * @run main/native TestCheckedDeleteGlobalRefCache launch
+ */
+
+import jdk.test.lib.process.ProcessTools;
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.Utils;
+
+public class TestCheckedDeleteGlobalRefCache {
+
+    static {
+        System.loadLibrary("TestCheckedDeleteGlobalRefCache");
+    }
+
+    public static void main(String[] args) throws Throwable {
+        if (args == null || args.length == 0) {
+            deleteTwice(new Object());
+        } else {
+            ProcessBuilder pb =
+                ProcessTools.createLimitedTestJavaProcessBuilder("-Xcheck:jni",
+                                                                 "-XX:+UnlockExperimentalVMOptions",
+                                                                 "-XX:+UseJNIGlobalHandleCache",
+                                                                 "-XX:-CreateCoredumpOnCrash",
+                                                                 "-Djava.library.path=" + Utils.TEST_NATIVE_PATH,
+                                                                 "TestCheckedDeleteGlobalRefCache");
+            OutputAnalyzer output = ProcessTools.executeProcess(pb);
+            output.shouldNotHaveExitValue(0);
+            output.shouldContain("FATAL ERROR in native method: Invalid global JNI handle passed to DeleteGlobalRef");
+        }
+    }
+
+    // Creates a global reference to obj and deletes it twice.
+    static native void deleteTwice(Object obj);
+}
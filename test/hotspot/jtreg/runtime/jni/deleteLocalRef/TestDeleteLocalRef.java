@@ -0,0 +1,56 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that local references stay valid when other local references
+ *          are deleted in and out of creation order, including across GCs.
+ * @run main/othervm/native TestDeleteLocalRef
+ */
+
+public class TestDeleteLocalRef {
+
+    static {
+        System.loadLibrary("TestDeleteLocalRef");
+    }
+
+    // Creates and deletes local references to the elements of objs in various
+    // orders, calling back to gc() in between. Returns the number of local
+    // references that did not refer to the expected element.
+    private static native int check(Object[] objs);
+
+    static void gc() {
+        System.gc();
+    }
+
+    public static void main(String[] args) {
+        Object[] objs = new Object[200];
+        for (int i = 0; i < objs.length; i++) {
+            objs[i] = new String("object " + i);
+        }
+        int failures = check(objs);
+        if (failures != 0) {
+            throw new RuntimeException(failures + " local references are stale");
+        }
+    }
+}
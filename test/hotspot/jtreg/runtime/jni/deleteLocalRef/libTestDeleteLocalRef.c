@@ -0,0 +1,103 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+#include "jni.h"
+
+#define MAX_REFS 200
+
+static jobject refs[MAX_REFS];
+static jint expected[MAX_REFS];
+
+static int verify(JNIEnv* env, jobjectArray objs, int count) {
+  int failures = 0;
+  for (int i = 0; i < count; i++) {
+    if (refs[i] == NULL) {
+      continue;
+    }
+    jobject obj = (*env)->GetObjectArrayElement(env, objs, expected[i]);
+    if (!(*env)->IsSameObject(env, refs[i], obj)) {
+      failures++;
+    }
+    (*env)->DeleteLocalRef(env, obj);
+  }
+  return failures;
+}
+
+JNIEXPORT jint JNICALL
+Java_TestDeleteLocalRef_check(JNIEnv* env, jclass clazz, jobjectArray objs) {
+  jmethodID gc = (*env)->GetStaticMethodID(env, clazz, "gc", "()V");
+  int len = (*env)->GetArrayLength(env, objs);
+  int count = len < MAX_REFS ? len : MAX_REFS;
+  int failures = 0;
+
+  if ((*env)->EnsureLocalCapacity(env, count + 16) != JNI_OK) {
+    return -1;
+  }
+
+  for (int i = 0; i < count; i++) {
+    refs[i] = (*env)->GetObjectArrayElement(env, objs, i);
+    expected[i] = i;
+    // Delete every third reference right away, in creation order.
+    if (i % 3 == 0) {
+      (*env)->DeleteLocalRef(env, refs[i]);
+      refs[i] = NULL;
+    }
+  }
+  (*env)->CallStaticVoidMethod(env, clazz, gc);
+  failures += verify(env, objs, count);
+
+  // Delete the most recently created references in reverse order, and
+  // reuse their slots for references to other elements.
+  for (int i = count - 1; i >= count / 2; i--) {
+    if (refs[i] != NULL) {
+      (*env)->DeleteLocalRef(env, refs[i]);
+    }
+    refs[i] = NULL;
+  }
+  for (int i = count / 2; i < count; i++) {
+    expected[i] = count - 1 - i;
+    refs[i] = (*env)->GetObjectArrayElement(env, objs, expected[i]);
+  }
+  (*env)->CallStaticVoidMethod(env, clazz, gc);
+  failures += verify(env, objs, count);
+
+  // Interleave creating and deleting references inside a local frame.
+  if ((*env)->PushLocalFrame(env, 16) == JNI_OK) {
+    for (int i = 0; i < count; i++) {
+      jobject a = (*env)->GetObjectArrayElement(env, objs, i);
+      jobject b = (*env)->GetObjectArrayElement(env, objs, count - 1 - i);
+      (*env)->DeleteLocalRef(env, a);
+      jobject c = (*env)->GetObjectArrayElement(env, objs, count - 1 - i);
+      if (!(*env)->IsSameObject(env, b, c)) {
+        failures++;
+      }
+      (*env)->DeleteLocalRef(env, c);
+      (*env)->DeleteLocalRef(env, b);
+    }
+    (*env)->PopLocalFrame(env, NULL);
+  }
+  (*env)->CallStaticVoidMethod(env, clazz, gc);
+  failures += verify(env, objs, count);
+
+  return failures;
+}
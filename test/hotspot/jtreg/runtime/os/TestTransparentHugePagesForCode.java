@@ -0,0 +1,51 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that the code cache and the JVM text can be advised to use
+ *          transparent huge pages independently of the large page flags.
+ * @requires os.family == "linux"
+ * @library /test/lib
+ * @run driver TestTransparentHugePagesForCode
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestTransparentHugePagesForCode {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:+UnlockExperimentalVMOptions",
+            "-XX:+UseTransparentHugePagesForCode",
+            "-XX:-UseLargePages",
+            "-Xlog:pagesize=info",
+            "-version");
+        output.shouldHaveExitValue(0);
+        // Either the JVM text was advised, or the system does not support
+        // transparent huge pages and the flag was switched off.
+        output.shouldMatch("(Advised huge pages for JVM text|JVM text is too small for huge pages|" +
+                           "UseTransparentHugePagesForCode disabled)");
+    }
+}
@@ -0,0 +1,64 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Test that interning many strings grows the StringTable
+ *          concurrently without waiting for a GC to trigger it.
+ * @library /test/lib
+ * @run driver TestStringTableGrowOnIntern
+ */
+
+import jdk.test.lib.process.OutputAnalyzer;
+import jdk.test.lib.process.ProcessTools;
+
+public class TestStringTableGrowOnIntern {
+
+    public static void main(String[] args) throws Exception {
+        OutputAnalyzer output = ProcessTools.executeLimitedTestJava(
+            "-XX:StringTableSize=128",
+            // Make sure no GC happens while interning.
+            "-Xms256m", "-Xmx256m", "-Xmn200m",
+            "-Xlog:stringtable=debug",
+            Intern.class.getName());
+        output.shouldHaveExitValue(0);
+        output.shouldContain("Concurrent grow triggered");
+        output.shouldMatch("Grown to size:[0-9]+");
+    }
+
+    public static class Intern {
+        public static void main(String[] args) throws Exception {
+            String[] strings = new String[100_000];
+            for (int i = 0; i < strings.length; i++) {
+                strings[i] = ("intern" + i).intern();
+            }
+            // Give the service thread some time to grow the table.
+            Thread.sleep(1000);
+            for (int i = 0; i < strings.length; i++) {
+                if (strings[i] != ("intern" + i).intern()) {
+                    throw new RuntimeException("interned twice: " + strings[i]);
+                }
+            }
+        }
+    }
+}
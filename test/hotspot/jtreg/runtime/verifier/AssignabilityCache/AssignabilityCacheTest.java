@@ -0,0 +1,67 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+/*
+ * @test
+ * @summary Check that the verifier gives the same answers to repeated
+ *          assignability checks that need to resolve classes, whether they
+ *          are cached or not.
+ * @compile AssignabilityChecks.jasm
+ * @run main/othervm AssignabilityCacheTest
+ * @run main/othervm -Xlog:class+resolve=debug AssignabilityCacheTest
+ */
+
+class AssignBase {}
+
+class AssignSub extends AssignBase {}
+
+class AssignOther {}
+
+public class AssignabilityCacheTest {
+
+    public static void main(String[] args) throws Exception {
+        // Repeated passing checks.
+        Class<?> c = Class.forName("AssignabilityRepeated");
+        AssignSub sub = new AssignSub();
+        if (c.getMethod("up1", AssignSub.class).invoke(null, sub) != sub ||
+            c.getMethod("up2", AssignSub.class).invoke(null, sub) != sub) {
+            throw new RuntimeException("Wrong result");
+        }
+        c.getMethod("pass", AssignSub.class).invoke(null, sub);
+
+        // The reverse of a passing check is not answered from the cache.
+        shouldFailVerification("AssignabilityReversed");
+
+        // Neither is a check with another source type.
+        shouldFailVerification("AssignabilityUnrelated");
+    }
+
+    private static void shouldFailVerification(String name) throws Exception {
+        try {
+            Class.forName(name);
+            throw new RuntimeException(name + " should not pass verification");
+        } catch (VerifyError e) {
+            System.out.println("Expected: " + e);
+        }
+    }
+}
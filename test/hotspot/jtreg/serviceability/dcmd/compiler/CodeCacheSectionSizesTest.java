@@ -0,0 +1,71 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+import jdk.test.lib.dcmd.CommandExecutor;
+import jdk.test.lib.dcmd.JMXExecutor;
+import jdk.test.lib.dcmd.PidJcmdExecutor;
+import jdk.test.lib.process.OutputAnalyzer;
+
+import org.testng.annotations.Test;
+
+/*
+ * @test
+ * @summary Test the nmethod section sizes printed by Compiler.codecache
+ * @library /test/lib
+ * @modules java.base/jdk.internal.misc
+ *          java.compiler
+ *          java.management
+ *          jdk.internal.jvmstat/sun.jvmstat.monitor
+ * @run testng/othervm -XX:-BackgroundCompilation -XX:CompileThreshold=100 CodeCacheSectionSizesTest
+ */
+public class CodeCacheSectionSizesTest {
+
+    static int sink;
+
+    static int work(int i) {
+        return i * 31 + (i >>> 3);
+    }
+
+    public void run(CommandExecutor executor) {
+        // Make sure there is at least one compiled method.
+        for (int i = 0; i < 100_000; i++) {
+            sink += work(i);
+        }
+
+        OutputAnalyzer output = executor.execute("Compiler.codecache");
+        output.shouldMatch("(?m)^ nmethods=[1-9]\\d* total=\\d+Kb code=\\d+Kb \\(\\d+%\\)$");
+        output.shouldMatch("(?m)^  code: insts=\\d+Kb stubs=\\d+Kb consts=\\d+Kb$");
+        output.shouldMatch("(?m)^  metadata: header=\\d+Kb relocation=\\d+Kb oops=\\d+Kb" +
+                           " metadata=\\d+Kb scopes_pcs=\\d+Kb scopes_data=\\d+Kb$");
+        output.shouldMatch("(?m)^ +dependencies=\\d+Kb handler_table=\\d+Kb nul_chk_table=\\d+Kb$");
+    }
+
+    @Test
+    public void jmx() {
+        run(new JMXExecutor());
+    }
+
+    @Test
+    public void cli() {
+        run(new PidJcmdExecutor());
+    }
+}
@@ -0,0 +1,74 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package jdk.jfr.event.compiler;
+
+import java.time.Duration;
+import java.util.List;
+
+import jdk.jfr.Recording;
+import jdk.jfr.consumer.RecordedEvent;
+import jdk.test.lib.jfr.EventNames;
+import jdk.test.lib.jfr.Events;
+
+/**
+ * @test
+ * @summary Test that the Compilation event reports the peak arena memory of
+ *          the compilation.
+ * @key jfr
+ * @requires vm.hasJFR
+ * @requires vm.compMode != "Xint"
+ * @library /test/lib
+ * @run main/othervm -Xbatch jdk.jfr.event.compiler.TestCompilationArenaBytes
+ */
+public class TestCompilationArenaBytes {
+
+    private static int sink;
+
+    private static int work(int n) {
+        int sum = 0;
+        for (int i = 0; i < n; i++) {
+            sum += i * (i ^ n);
+        }
+        return sum;
+    }
+
+    public static void main(String[] args) throws Exception {
+        try (Recording recording = new Recording()) {
+            recording.enable(EventNames.Compilation).withThreshold(Duration.ofMillis(0));
+            recording.start();
+            for (int i = 0; i < 20_000; i++) {
+                sink += work(i & 0xff);
+            }
+            recording.stop();
+
+            List<RecordedEvent> events = Events.fromRecording(recording);
+            Events.hasEvents(events);
+            for (RecordedEvent event : events) {
+                System.out.println(event);
+                // Every compilation allocates at least the arena of its ciEnv.
+                Events.assertField(event, "arenaBytes").above(0L);
+            }
+        }
+    }
+}
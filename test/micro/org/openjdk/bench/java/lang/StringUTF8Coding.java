@@ -0,0 +1,91 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.java.lang;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.nio.charset.StandardCharsets;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * UTF-8 encoding and decoding of text with different shares of non-ASCII
+ * characters. Only the ASCII parts are handled by intrinsics
+ * (StringCoding.countPositives); the rest is decoded and encoded by the
+ * scalar Java code in String.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3)
+public class StringUTF8Coding {
+    @Param({"1024"})
+    public int size;
+
+    // Percentage of non-ASCII characters
+    @Param({"0", "10", "100"})
+    public int nonAscii;
+
+    // Use characters outside of Latin-1, so that the strings are UTF-16
+    @Param({"false", "true"})
+    public boolean utf16;
+
+    private String string;
+    private byte[] bytes;
+
+    @Setup
+    public void setup() {
+        StringBuilder sb = new StringBuilder(size);
+        for (int i = 0; i < size; i++) {
+            if (i % 100 < nonAscii) {
+                sb.append(utf16 ? (char)(0x0400 + i % 256) : (char)(0xC0 + i % 64));
+            } else {
+                sb.append((char)('a' + i % 26));
+            }
+        }
+        string = sb.toString();
+        bytes = string.getBytes(StandardCharsets.UTF_8);
+    }
+
+    @Benchmark
+    public byte[] encode() {
+        return string.getBytes(StandardCharsets.UTF_8);
+    }
+
+    @Benchmark
+    public String decode() {
+        return new String(bytes, StandardCharsets.UTF_8);
+    }
+}
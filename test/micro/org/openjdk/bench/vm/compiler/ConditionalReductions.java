@@ -0,0 +1,118 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+
+package org.openjdk.bench.vm.compiler;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+
+import java.util.Random;
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Reductions in loops whose update is guarded by a condition. With
+ * -XX:+UseVectorCmov, C2 turns these into unconditional reductions that
+ * SuperWord can vectorize.
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+@Fork(value = 3)
+public class ConditionalReductions {
+    @Param({"1024"})
+    public int size;
+
+    private int[] ints;
+    private long[] longs;
+    private int threshold;
+
+    @Setup
+    public void setup() {
+        Random r = new Random(42);
+        ints = new int[size];
+        longs = new long[size];
+        for (int i = 0; i < size; i++) {
+            ints[i] = r.nextInt();
+            longs[i] = r.nextLong();
+        }
+        threshold = 0;
+    }
+
+    @Benchmark
+    public int sumIfGreaterInt() {
+        int sum = 0;
+        for (int i = 0; i < ints.length; i++) {
+            if (ints[i] > threshold) {
+                sum += ints[i];
+            }
+        }
+        return sum;
+    }
+
+    @Benchmark
+    public long sumIfGreaterLong() {
+        long sum = 0;
+        for (int i = 0; i < longs.length; i++) {
+            if (longs[i] > threshold) {
+                sum += longs[i];
+            }
+        }
+        return sum;
+    }
+
+    @Benchmark
+    public int maxInt() {
+        int max = Integer.MIN_VALUE;
+        for (int i = 0; i < ints.length; i++) {
+            if (ints[i] > max) {
+                max = ints[i];
+            }
+        }
+        return max;
+    }
+
+    @Benchmark
+    public int minInt() {
+        int min = Integer.MAX_VALUE;
+        for (int i = 0; i < ints.length; i++) {
+            if (ints[i] < min) {
+                min = ints[i];
+            }
+        }
+        return min;
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseVectorCmov"})
+    public static class WithVectorCmov extends ConditionalReductions {}
+}
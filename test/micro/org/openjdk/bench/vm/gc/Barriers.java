@@ -0,0 +1,158 @@
+/*
+ * Copyright (c) 2024, Oracle and/or its affiliates. All rights reserved.
+ * DO NOT ALTER OR REMOVE COPYRIGHT NOTICES OR THIS FILE HEADER.
+ *
+ * This code is free software; you can redistribute it and/or modify it
+ * under the terms of the GNU General Public License version 2 only, as
+ * published by the Free Software Foundation.
+ *
+ * This code is distributed in the hope that it will be useful, but WITHOUT
+ * ANY WARRANTY; without even the implied warranty of MERCHANTABILITY or
+ * FITNESS FOR A PARTICULAR PURPOSE.  See the GNU General Public License
+ * version 2 for more details (a copy is included in the LICENSE file that
+ * accompanied this code).
+ *
+ * You should have received a copy of the GNU General Public License version
+ * 2 along with this work; if not, write to the Free Software Foundation,
+ * Inc., 51 Franklin St, Fifth Floor, Boston, MA 02110-1301 USA.
+ *
+ * Please contact Oracle, 500 Oracle Parkway, Redwood Shores, CA 94065 USA
+ * or visit www.oracle.com if you need additional information or have any
+ * questions.
+ */
+package org.openjdk.bench.vm.gc;
+
+import org.openjdk.jmh.annotations.Benchmark;
+import org.openjdk.jmh.annotations.BenchmarkMode;
+import org.openjdk.jmh.annotations.Fork;
+import org.openjdk.jmh.annotations.Measurement;
+import org.openjdk.jmh.annotations.Mode;
+import org.openjdk.jmh.annotations.OutputTimeUnit;
+import org.openjdk.jmh.annotations.Param;
+import org.openjdk.jmh.annotations.Scope;
+import org.openjdk.jmh.annotations.Setup;
+import org.openjdk.jmh.annotations.State;
+import org.openjdk.jmh.annotations.Warmup;
+import org.openjdk.jmh.infra.Blackhole;
+
+import java.util.concurrent.TimeUnit;
+
+/**
+ * Isolates the cost of GC barriers and allocation paths. Each nested class
+ * runs the same benchmarks with a different collector, so the results can
+ * be compared side by side:
+ * <ul>
+ * <li>reference loads and stores exercise the load barriers (ZGC, and the
+ *     Shenandoah load reference barrier) and the pre/post write barriers
+ *     (G1, Shenandoah SATB, the card mark of Parallel);</li>
+ * <li>storing old-to-young references into a long lived array exercises the
+ *     G1 post-write barrier slow path and card marking;</li>
+ * <li>arraycopy of references exercises the arraycopy barriers;</li>
+ * <li>small and large allocations exercise the TLAB fast path and the
+ *     outside-TLAB slow path.</li>
+ * </ul>
+ */
+@BenchmarkMode(Mode.AverageTime)
+@OutputTimeUnit(TimeUnit.NANOSECONDS)
+@State(Scope.Thread)
+@Warmup(iterations = 5, time = 1)
+@Measurement(iterations = 5, time = 1)
+public abstract class Barriers {
+
+    @Param({"1024"})
+    private int size;
+
+    // Allocated in setup, so it is promoted to the old generation early on.
+    private Object[] oldArray;
+    private Object[] srcArray;
+    private Object[] dstArray;
+    private Object nullValue;
+
+    @Setup
+    public void setup() {
+        oldArray = new Object[size];
+        srcArray = new Object[size];
+        dstArray = new Object[size];
+        for (int i = 0; i < size; i++) {
+            srcArray[i] = new Object();
+            oldArray[i] = srcArray[i];
+        }
+        // Encourage the arrays to be promoted before measurement starts.
+        System.gc();
+    }
+
+    @Benchmark
+    public void loadReferences(Blackhole bh) {
+        Object[] a = oldArray;
+        for (int i = 0; i < a.length; i++) {
+            bh.consume(a[i]);
+        }
+    }
+
+    @Benchmark
+    public void storeNull() {
+        Object[] a = oldArray;
+        Object v = nullValue;
+        for (int i = 0; i < a.length; i++) {
+            a[i] = v;
+        }
+    }
+
+    @Benchmark
+    public void storeOldToOld() {
+        Object[] a = oldArray;
+        Object[] src = srcArray;
+        for (int i = 0; i < a.length; i++) {
+            a[i] = src[i];
+        }
+    }
+
+    @Benchmark
+    public void storeOldToYoung() {
+        Object[] a = oldArray;
+        for (int i = 0; i < a.length; i++) {
+            a[i] = new Object();
+        }
+    }
+
+    @Benchmark
+    public void storeYoungToYoung(Blackhole bh) {
+        Object[] a = new Object[size];
+        Object v = new Object();
+        for (int i = 0; i < a.length; i++) {
+            a[i] = v;
+        }
+        bh.consume(a);
+    }
+
+    @Benchmark
+    public void arraycopyReferences() {
+        System.arraycopy(srcArray, 0, dstArray, 0, srcArray.length);
+    }
+
+    @Benchmark
+    public Object allocateInTLAB() {
+        return new Object[8];
+    }
+
+    // Large enough to be allocated outside of the TLAB by all collectors.
+    @Benchmark
+    public Object allocateOutsideTLAB() {
+        return new byte[4 * 1024 * 1024];
+    }
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseG1GC"})
+    public static class G1 extends Barriers {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseParallelGC"})
+    public static class Parallel extends Barriers {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseZGC", "-XX:+ZGenerational"})
+    public static class ZGC extends Barriers {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseShenandoahGC"})
+    public static class Shenandoah extends Barriers {}
+
+    @Fork(value = 3, jvmArgsAppend = {"-XX:+UseSerialGC"})
+    public static class Serial extends Barriers {}
+}